@@ -0,0 +1,3958 @@
+/*
+ * A programmer's apology and warning
+ *
+ * Sorry (tm Canada :-)) for the appalling condition of the code below.
+ *
+ * The people who worked on this repo did NOT write this code. Well, OK, we DID
+ * write this comment. We refer to code beyond this comment. The code below was
+ * generated by the bison or flex code generators.
+ *
+ * WARNING: We do NOT recommend that you modify the generated code even though
+ * it is digitally odoriferous and has a gleety appearance. Beautification of
+ * this code, no matter how disagreeable it may seem, is unwise as such
+ * modifications tend to be practically impossible to maintain. Even if this
+ * Flying Spaghetti Monster style code tempts you to tweak it, doing so might
+ * produce visions and nightmares of Cthulhu-like tentacles grabbing at the very
+ * logic of your mind, pulling it down into a hideous maelstrom of code
+ * maintenance cacophony.
+ *
+ * OK, it might not give you nightmares but why take the risk? The point is
+ * don't work on this file! Instead work on the bison and flex related source
+ * files. See the Makefile for details on how this file was generated. See also
+ * run_bison.sh and run_flex.sh.
+ *
+ * Now some might be tempted to point out this code was originally in support of
+ * the International Obfuscated C Code Contest (IOCCC) and that objecting to the
+ * output of Bison and Flex borders on programming sanctimoniousness. At first
+ * glance, this incongruence is unsustainable. In response we opine that one of
+ * the fundamental undertones of the IOCCC is the promotion of good programming
+ * through irony by awarding highly obfuscated C code. So, if it helps, we
+ * suggest you view this apology in a satirical light, even if you are humour
+ * impaired. Nevertheless, we still recommend you to eschew modifying the code
+ * below.
+ *
+ * Thanks in advance for your understanding, and sorry (tm Canada :-)).
+ *
+ * Of course, on the other hand, the fact the scanner and parser are for JSON
+ * might suggest that we shouldn't have to apologise because the JSON spec is
+ * objectionable and so are the generated scanner and parser so this apology
+ * might very well be superfluous. If one were to then ignore the fact that
+ * bison and flex do not care what they are parsing this same person could
+ * argue, obviously by some perverted logical fallacies, that bison and flex did
+ * their job well. Well, OK they probably DID do their job well but in an
+ * objectionable way. :-)
+ *
+ * P.S. In 2022 April 04, when this comment was initially formed, none of the
+ *	people working on this parser/scanner were Canadian. But some of them
+ *	have several good friends who live in, or are from Canada. Those
+ *	friends say sorry in a fun and friendly way, so we honour those friends
+ *	accordingly.
+ */
+#line 1 "./jparse.c"
+#line 1 "jparse.c"
+
+#line 3 "jparse.c"
+
+#define  YY_INT_ALIGNED short int
+
+/* A lexical scanner generated by flex */
+
+#define FLEX_SCANNER
+#define YY_FLEX_MAJOR_VERSION 2
+#define YY_FLEX_MINOR_VERSION 6
+#define YY_FLEX_SUBMINOR_VERSION 4
+#if YY_FLEX_SUBMINOR_VERSION > 0
+#define FLEX_BETA
+#endif
+
+#ifdef yy_create_buffer
+#define jparse__create_buffer_ALREADY_DEFINED
+#else
+#define yy_create_buffer jparse__create_buffer
+#endif
+
+#ifdef yy_delete_buffer
+#define jparse__delete_buffer_ALREADY_DEFINED
+#else
+#define yy_delete_buffer jparse__delete_buffer
+#endif
+
+#ifdef yy_scan_buffer
+#define jparse__scan_buffer_ALREADY_DEFINED
+#else
+#define yy_scan_buffer jparse__scan_buffer
+#endif
+
+#ifdef yy_scan_string
+#define jparse__scan_string_ALREADY_DEFINED
+#else
+#define yy_scan_string jparse__scan_string
+#endif
+
+#ifdef yy_scan_bytes
+#define jparse__scan_bytes_ALREADY_DEFINED
+#else
+#define yy_scan_bytes jparse__scan_bytes
+#endif
+
+#ifdef yy_init_buffer
+#define jparse__init_buffer_ALREADY_DEFINED
+#else
+#define yy_init_buffer jparse__init_buffer
+#endif
+
+#ifdef yy_flush_buffer
+#define jparse__flush_buffer_ALREADY_DEFINED
+#else
+#define yy_flush_buffer jparse__flush_buffer
+#endif
+
+#ifdef yy_load_buffer_state
+#define jparse__load_buffer_state_ALREADY_DEFINED
+#else
+#define yy_load_buffer_state jparse__load_buffer_state
+#endif
+
+#ifdef yy_switch_to_buffer
+#define jparse__switch_to_buffer_ALREADY_DEFINED
+#else
+#define yy_switch_to_buffer jparse__switch_to_buffer
+#endif
+
+#ifdef yypush_buffer_state
+#define jparse_push_buffer_state_ALREADY_DEFINED
+#else
+#define yypush_buffer_state jparse_push_buffer_state
+#endif
+
+#ifdef yypop_buffer_state
+#define jparse_pop_buffer_state_ALREADY_DEFINED
+#else
+#define yypop_buffer_state jparse_pop_buffer_state
+#endif
+
+#ifdef yyensure_buffer_stack
+#define jparse_ensure_buffer_stack_ALREADY_DEFINED
+#else
+#define yyensure_buffer_stack jparse_ensure_buffer_stack
+#endif
+
+#ifdef yylex
+#define jparse_lex_ALREADY_DEFINED
+#else
+#define yylex jparse_lex
+#endif
+
+#ifdef yyrestart
+#define jparse_restart_ALREADY_DEFINED
+#else
+#define yyrestart jparse_restart
+#endif
+
+#ifdef yylex_init
+#define jparse_lex_init_ALREADY_DEFINED
+#else
+#define yylex_init jparse_lex_init
+#endif
+
+#ifdef yylex_init_extra
+#define jparse_lex_init_extra_ALREADY_DEFINED
+#else
+#define yylex_init_extra jparse_lex_init_extra
+#endif
+
+#ifdef yylex_destroy
+#define jparse_lex_destroy_ALREADY_DEFINED
+#else
+#define yylex_destroy jparse_lex_destroy
+#endif
+
+#ifdef yyget_debug
+#define jparse_get_debug_ALREADY_DEFINED
+#else
+#define yyget_debug jparse_get_debug
+#endif
+
+#ifdef yyset_debug
+#define jparse_set_debug_ALREADY_DEFINED
+#else
+#define yyset_debug jparse_set_debug
+#endif
+
+#ifdef yyget_extra
+#define jparse_get_extra_ALREADY_DEFINED
+#else
+#define yyget_extra jparse_get_extra
+#endif
+
+#ifdef yyset_extra
+#define jparse_set_extra_ALREADY_DEFINED
+#else
+#define yyset_extra jparse_set_extra
+#endif
+
+#ifdef yyget_in
+#define jparse_get_in_ALREADY_DEFINED
+#else
+#define yyget_in jparse_get_in
+#endif
+
+#ifdef yyset_in
+#define jparse_set_in_ALREADY_DEFINED
+#else
+#define yyset_in jparse_set_in
+#endif
+
+#ifdef yyget_out
+#define jparse_get_out_ALREADY_DEFINED
+#else
+#define yyget_out jparse_get_out
+#endif
+
+#ifdef yyset_out
+#define jparse_set_out_ALREADY_DEFINED
+#else
+#define yyset_out jparse_set_out
+#endif
+
+#ifdef yyget_leng
+#define jparse_get_leng_ALREADY_DEFINED
+#else
+#define yyget_leng jparse_get_leng
+#endif
+
+#ifdef yyget_text
+#define jparse_get_text_ALREADY_DEFINED
+#else
+#define yyget_text jparse_get_text
+#endif
+
+#ifdef yyget_lineno
+#define jparse_get_lineno_ALREADY_DEFINED
+#else
+#define yyget_lineno jparse_get_lineno
+#endif
+
+#ifdef yyset_lineno
+#define jparse_set_lineno_ALREADY_DEFINED
+#else
+#define yyset_lineno jparse_set_lineno
+#endif
+
+#ifdef yyget_column
+#define jparse_get_column_ALREADY_DEFINED
+#else
+#define yyget_column jparse_get_column
+#endif
+
+#ifdef yyset_column
+#define jparse_set_column_ALREADY_DEFINED
+#else
+#define yyset_column jparse_set_column
+#endif
+
+#ifdef yywrap
+#define jparse_wrap_ALREADY_DEFINED
+#else
+#define yywrap jparse_wrap
+#endif
+
+#ifdef yyget_lval
+#define jparse_get_lval_ALREADY_DEFINED
+#else
+#define yyget_lval jparse_get_lval
+#endif
+
+#ifdef yyset_lval
+#define jparse_set_lval_ALREADY_DEFINED
+#else
+#define yyset_lval jparse_set_lval
+#endif
+
+#ifdef yyget_lloc
+#define jparse_get_lloc_ALREADY_DEFINED
+#else
+#define yyget_lloc jparse_get_lloc
+#endif
+
+#ifdef yyset_lloc
+#define jparse_set_lloc_ALREADY_DEFINED
+#else
+#define yyset_lloc jparse_set_lloc
+#endif
+
+#ifdef yyalloc
+#define jparse_alloc_ALREADY_DEFINED
+#else
+#define yyalloc jparse_alloc
+#endif
+
+#ifdef yyrealloc
+#define jparse_realloc_ALREADY_DEFINED
+#else
+#define yyrealloc jparse_realloc
+#endif
+
+#ifdef yyfree
+#define jparse_free_ALREADY_DEFINED
+#else
+#define yyfree jparse_free
+#endif
+
+/* First, we deal with  platform-specific or compiler-specific issues. */
+
+/* begin standard C headers. */
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+/* end standard C headers. */
+
+/* flex integer type definitions */
+
+#ifndef FLEXINT_H
+#define FLEXINT_H
+
+/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
+
+#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+
+/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
+ * if you want the limit (max/min) macros for int types. 
+ */
+#ifndef __STDC_LIMIT_MACROS
+#define __STDC_LIMIT_MACROS 1
+#endif
+
+#include <inttypes.h>
+typedef int8_t flex_int8_t;
+typedef uint8_t flex_uint8_t;
+typedef int16_t flex_int16_t;
+typedef uint16_t flex_uint16_t;
+typedef int32_t flex_int32_t;
+typedef uint32_t flex_uint32_t;
+#else
+typedef signed char flex_int8_t;
+typedef short int flex_int16_t;
+typedef int flex_int32_t;
+typedef unsigned char flex_uint8_t; 
+typedef unsigned short int flex_uint16_t;
+typedef unsigned int flex_uint32_t;
+
+/* Limits of integral types. */
+#ifndef INT8_MIN
+#define INT8_MIN               (-128)
+#endif
+#ifndef INT16_MIN
+#define INT16_MIN              (-32767-1)
+#endif
+#ifndef INT32_MIN
+#define INT32_MIN              (-2147483647-1)
+#endif
+#ifndef INT8_MAX
+#define INT8_MAX               (127)
+#endif
+#ifndef INT16_MAX
+#define INT16_MAX              (32767)
+#endif
+#ifndef INT32_MAX
+#define INT32_MAX              (2147483647)
+#endif
+#ifndef UINT8_MAX
+#define UINT8_MAX              (255U)
+#endif
+#ifndef UINT16_MAX
+#define UINT16_MAX             (65535U)
+#endif
+#ifndef UINT32_MAX
+#define UINT32_MAX             (4294967295U)
+#endif
+
+#ifndef SIZE_MAX
+#define SIZE_MAX               (~(size_t)0)
+#endif
+
+#endif /* ! C99 */
+
+#endif /* ! FLEXINT_H */
+
+/* begin standard C++ headers. */
+
+/* TODO: this is always defined, so inline it */
+#define yyconst const
+
+#if defined(__GNUC__) && __GNUC__ >= 3
+#define yynoreturn __attribute__((__noreturn__))
+#else
+#define yynoreturn
+#endif
+
+/* Returned upon end-of-file. */
+#define YY_NULL 0
+
+/* Promotes a possibly negative, possibly signed char to an
+ *   integer in range [0..255] for use as an array index.
+ */
+#define YY_SC_TO_UI(c) ((YY_CHAR) (c))
+
+/* An opaque pointer. */
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void* yyscan_t;
+#endif
+
+/* For convenience, these vars (plus the bison vars far below)
+   are macros in the reentrant scanner. */
+#define yyin yyg->yyin_r
+#define yyout yyg->yyout_r
+#define yyextra yyg->yyextra_r
+#define yyleng yyg->yyleng_r
+#define yytext yyg->yytext_r
+#define yylineno (YY_CURRENT_BUFFER_LVALUE->yy_bs_lineno)
+#define yycolumn (YY_CURRENT_BUFFER_LVALUE->yy_bs_column)
+#define yy_flex_debug yyg->yy_flex_debug_r
+
+/* Enter a start condition.  This macro really ought to take a parameter,
+ * but we do it the disgusting crufty way forced on us by the ()-less
+ * definition of BEGIN.
+ */
+#define BEGIN yyg->yy_start = 1 + 2 *
+/* Translate the current start state into a value that can be later handed
+ * to BEGIN to return to the state.  The YYSTATE alias is for lex
+ * compatibility.
+ */
+#define YY_START ((yyg->yy_start - 1) / 2)
+#define YYSTATE YY_START
+/* Action number for EOF rule of a given start state. */
+#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
+/* Special action meaning "start processing a new file". */
+#define YY_NEW_FILE yyrestart( yyin , yyscanner )
+#define YY_END_OF_BUFFER_CHAR 0
+
+/* Size of default input buffer. */
+#ifndef YY_BUF_SIZE
+#ifdef __ia64__
+/* On IA-64, the buffer size is 16k, not 8k.
+ * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
+ * Ditto for the __ia64__ case accordingly.
+ */
+#define YY_BUF_SIZE 32768
+#else
+#define YY_BUF_SIZE 16384
+#endif /* __ia64__ */
+#endif
+
+/* The state buf must be large enough to hold one state per character in the main buffer.
+ */
+#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
+
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state *YY_BUFFER_STATE;
+#endif
+
+#ifndef YY_TYPEDEF_YY_SIZE_T
+#define YY_TYPEDEF_YY_SIZE_T
+typedef size_t yy_size_t;
+#endif
+
+#define EOB_ACT_CONTINUE_SCAN 0
+#define EOB_ACT_END_OF_FILE 1
+#define EOB_ACT_LAST_MATCH 2
+    
+    /* Note: We specifically omit the test for yy_rule_can_match_eol because it requires
+     *       access to the local variable yy_act. Since yyless() is a macro, it would break
+     *       existing scanners that call yyless() from OUTSIDE yylex.
+     *       One obvious solution it to make yy_act a global. I tried that, and saw
+     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
+     *       normally declared as a register variable-- so it is not worth it.
+     */
+    #define  YY_LESS_LINENO(n) \
+            do { \
+                int yyl;\
+                for ( yyl = n; yyl < yyleng; ++yyl )\
+                    if ( yytext[yyl] == '\n' )\
+                        --yylineno;\
+            }while(0)
+    #define YY_LINENO_REWIND_TO(dst) \
+            do {\
+                const char *p;\
+                for ( p = yy_cp-1; p >= (dst); --p)\
+                    if ( *p == '\n' )\
+                        --yylineno;\
+            }while(0)
+    
+/* Return all but the first "n" matched characters back to the input stream. */
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		*yy_cp = yyg->yy_hold_char; \
+		YY_RESTORE_YY_MORE_OFFSET \
+		yyg->yy_c_buf_p = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
+		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
+		} \
+	while ( 0 )
+#define unput(c) yyunput( c, yyg->yytext_ptr , yyscanner )
+
+#ifndef YY_STRUCT_YY_BUFFER_STATE
+#define YY_STRUCT_YY_BUFFER_STATE
+struct yy_buffer_state
+	{
+	FILE *yy_input_file;
+
+	char *yy_ch_buf;		/* input buffer */
+	char *yy_buf_pos;		/* current position in input buffer */
+
+	/* Size of input buffer in bytes, not including room for EOB
+	 * characters.
+	 */
+	int yy_buf_size;
+
+	/* Number of characters read into yy_ch_buf, not including EOB
+	 * characters.
+	 */
+	int yy_n_chars;
+
+	/* Whether we "own" the buffer - i.e., we know we created it,
+	 * and can realloc() it to grow it, and should free() it to
+	 * delete it.
+	 */
+	int yy_is_our_buffer;
+
+	/* Whether this is an "interactive" input source; if so, and
+	 * if we're using stdio for input, then we want to use getc()
+	 * instead of fread(), to make sure we stop fetching input after
+	 * each newline.
+	 */
+	int yy_is_interactive;
+
+	/* Whether we're considered to be at the beginning of a line.
+	 * If so, '^' rules will be active on the next match, otherwise
+	 * not.
+	 */
+	int yy_at_bol;
+
+    int yy_bs_lineno; /**< The line count. */
+    int yy_bs_column; /**< The column count. */
+
+	/* Whether to try to fill the input buffer when we reach the
+	 * end of it.
+	 */
+	int yy_fill_buffer;
+
+	int yy_buffer_status;
+
+#define YY_BUFFER_NEW 0
+#define YY_BUFFER_NORMAL 1
+	/* When an EOF's been seen but there's still some text to process
+	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
+	 * shouldn't try reading from the input source any more.  We might
+	 * still have a bunch of tokens to match, though, because of
+	 * possible backing-up.
+	 *
+	 * When we actually see the EOF, we change the status to "new"
+	 * (via yyrestart()), so that the user can continue scanning by
+	 * just pointing yyin at a new input file.
+	 */
+#define YY_BUFFER_EOF_PENDING 2
+
+	};
+#endif /* !YY_STRUCT_YY_BUFFER_STATE */
+
+/* We provide macros for accessing buffer states in case in the
+ * future we want to put the buffer states in a more general
+ * "scanner state".
+ *
+ * Returns the top of the stack, or NULL.
+ */
+#define YY_CURRENT_BUFFER ( yyg->yy_buffer_stack \
+                          ? yyg->yy_buffer_stack[yyg->yy_buffer_stack_top] \
+                          : NULL)
+/* Same as previous macro, but useful when we know that the buffer stack is not
+ * NULL or when we need an lvalue. For internal use only.
+ */
+#define YY_CURRENT_BUFFER_LVALUE yyg->yy_buffer_stack[yyg->yy_buffer_stack_top]
+
+void yyrestart ( FILE *input_file , yyscan_t yyscanner );
+void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size , yyscan_t yyscanner );
+void yy_delete_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yy_flush_buffer ( YY_BUFFER_STATE b , yyscan_t yyscanner );
+void yypush_buffer_state ( YY_BUFFER_STATE new_buffer , yyscan_t yyscanner );
+void yypop_buffer_state ( yyscan_t yyscanner );
+
+static void yyensure_buffer_stack ( yyscan_t yyscanner );
+static void yy_load_buffer_state ( yyscan_t yyscanner );
+static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file , yyscan_t yyscanner );
+#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER , yyscanner)
+
+YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_string ( const char *yy_str , yyscan_t yyscanner );
+YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len , yyscan_t yyscanner );
+
+void *yyalloc ( yy_size_t , yyscan_t yyscanner );
+void *yyrealloc ( void *, yy_size_t , yyscan_t yyscanner );
+void yyfree ( void * , yyscan_t yyscanner );
+
+#define yy_new_buffer yy_create_buffer
+#define yy_set_interactive(is_interactive) \
+	{ \
+	if ( ! YY_CURRENT_BUFFER ){ \
+        yyensure_buffer_stack (yyscanner); \
+		YY_CURRENT_BUFFER_LVALUE =    \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
+	} \
+	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
+	}
+#define yy_set_bol(at_bol) \
+	{ \
+	if ( ! YY_CURRENT_BUFFER ){\
+        yyensure_buffer_stack (yyscanner); \
+		YY_CURRENT_BUFFER_LVALUE =    \
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner); \
+	} \
+	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
+	}
+#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
+
+/* Begin user sect3 */
+
+#define jparse_wrap(yyscanner) (/*CONSTCOND*/1)
+#define YY_SKIP_YYWRAP
+typedef flex_uint8_t YY_CHAR;
+
+typedef int yy_state_type;
+
+#define yytext_ptr yytext_r
+
+static yy_state_type yy_get_previous_state ( yyscan_t yyscanner );
+static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  , yyscan_t yyscanner);
+static int yy_get_next_buffer ( yyscan_t yyscanner );
+static void yynoreturn yy_fatal_error ( const char* msg , yyscan_t yyscanner );
+
+/* Done after the current pattern has been matched and before the
+ * corresponding action - sets up yytext.
+ */
+#define YY_DO_BEFORE_ACTION \
+	yyg->yytext_ptr = yy_bp; \
+	yyleng = (int) (yy_cp - yy_bp); \
+	yyg->yy_hold_char = *yy_cp; \
+	*yy_cp = '\0'; \
+	yyg->yy_c_buf_p = yy_cp;
+#define YY_NUM_RULES 15
+#define YY_END_OF_BUFFER 16
+/* This struct is not used in this scanner,
+   but its presence is necessary. */
+struct yy_trans_info
+	{
+	flex_int32_t yy_verify;
+	flex_int32_t yy_nxt;
+	};
+static const flex_int16_t yy_accept[48] =
+    {   0,
+        0,    0,   16,   14,    1,    2,   14,   13,   14,    4,
+        4,   12,   10,   11,   14,   14,   14,    8,    9,    1,
+        2,    0,    3,    0,    4,    4,    0,    0,    4,    0,
+        0,    0,    3,    4,    0,    4,    0,    0,    0,    0,
+        0,    5,    6,    0,    4,    7,    0
+    } ;
+
+static const YY_CHAR yy_ec[256] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    4,    5,    6,    5,    5,    5,    5,    5,    5,
+        5,    5,    7,    8,    9,   10,    5,   11,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   13,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,   14,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       15,   16,   17,    5,    5,    5,   18,    5,    5,    5,
+
+       19,   20,    5,    5,    5,    5,    5,   21,    5,   22,
+        5,    5,    5,   23,   24,   25,   26,    5,    5,    5,
+        5,    5,   27,    5,   28,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5
+    } ;
+
+static const YY_CHAR yy_meta[29] =
+    {   0,
+        1,    1,    1,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+        2,    2,    2,    2,    2,    2,    2,    2
+    } ;
+
+static const flex_int16_t yy_base[49] =
+    {   0,
+        0,    0,   89,   90,   27,   85,   24,   90,   21,   24,
+       34,   90,   90,   90,   69,   60,   62,   90,   90,   33,
+       81,   33,   90,   35,   40,    0,   44,   51,    0,   62,
+       55,   48,   36,   53,   57,   59,   42,   40,   38,   66,
+       28,   90,   90,   68,   70,   90,   90,   34
+    } ;
+
+static const flex_int16_t yy_def[49] =
+    {   0,
+       47,    1,   47,   47,   47,   47,   48,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   48,   47,   48,   47,   11,   47,   47,   11,   47,
+       47,   47,   48,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,    0,   47
+    } ;
+
+static const flex_int16_t yy_nxt[119] =
+    {   0,
+        4,    5,    6,    5,    4,    7,    4,    8,    9,    4,
+       10,   11,   12,    4,   13,    4,   14,    4,    4,   15,
+        4,   16,    4,    4,   17,    4,   18,   19,   20,   23,
+       20,   25,   26,   27,   20,   22,   20,   28,   23,   24,
+       33,   23,   28,   27,   29,   29,   46,   28,   24,   27,
+       24,   24,   28,   28,   34,   34,   43,   35,   28,   35,
+       42,   36,   36,   34,   34,   41,   40,   36,   36,   36,
+       36,   40,   44,   39,   44,   38,   45,   45,   45,   45,
+       45,   45,   37,   21,   32,   31,   30,   21,   47,    3,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47
+    } ;
+
+static const flex_int16_t yy_chk[119] =
+    {   0,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    5,    7,
+        5,    9,    9,   10,   20,   48,   20,   10,   22,    7,
+       24,   33,   10,   11,   11,   11,   41,   11,   22,   25,
+       24,   33,   11,   25,   27,   27,   39,   28,   25,   28,
+       38,   28,   28,   34,   34,   37,   34,   35,   35,   36,
+       36,   34,   40,   32,   40,   31,   40,   40,   44,   44,
+       45,   45,   30,   21,   17,   16,   15,    6,    3,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47
+    } ;
+
+/* Table of booleans, true if rule could match eol. */
+static const flex_int32_t yy_rule_can_match_eol[16] =
+    {   0,
+0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,     };
+
+/* The intent behind this definition is that it'll catch
+ * any uses of REJECT which flex missed.
+ */
+#define REJECT reject_used_but_not_detected
+#define yymore() yymore_used_but_not_detected
+#define YY_MORE_ADJ 0
+#define YY_RESTORE_YY_MORE_OFFSET
+#line 1 "./jparse.l"
+/*
+ * JSON scanner - JSON scanner in flex grammar form
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON scanner was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+/* Section 0: Declarations and option settings */
+/*
+ * The
+ *
+ *      %option noyywrap
+ *
+ * prevents needing to link in the flex(1) library (flex(3))
+ * which means those without flex can compile the code. Even if everyone had
+ * flex(1), though, under macOS you have to pass -ll to the compiler to link in
+ * the flex library whereas in other systems you have to use -lfl which would
+ * cause a lot of problems. Another way is to provide 'int yywrap() { return 1;
+ * }' but this is unnecessary.
+ */
+/*
+ * We also need these options set:
+ *
+ *      %option nodefault
+ *      %option nounput
+ *      %option noinput
+ *      %option yylineno
+ *      %option 8bit
+ *      %option bison-bridge
+ *      %option bison-locations
+ *      %option reentrant
+ *      %option prefix="jparse_"
+ *      %option header-file="jparse.lex.h"
+ *      %option extra-type="struct json_extra *"
+ */
+#define YY_NO_INPUT 1
+#line 63 "./jparse.l"
+/* Declarations etc. go here.
+ *
+ * Code is copied verbatim near the top of the generated code.
+ */
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+extern int jparse_lex(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
+
+/*
+ * locations in the file / json block
+ *
+ * Why is it that columns start out at 0 and the line starts out at 1? This is
+ * because of the way the scanning works. Whenever a token is matched this macro
+ * is run. Each time a token is matched if the column is 0 we have to make sure
+ * it is 1 and otherwise we have to increase it: unless it's a tab or a newline.
+ * If it's a newline we set the column back to 0 and increase the line. If
+ * however it's a tab we increase the column count by 8 as that is the default
+ * value for '\t'.
+ *
+ * Now as far as the final 'else' in the for loop it seems more complicated than
+ * it might need to be. This was done during the fixing of error location
+ * reporting, specifically with the first column being reported as column 0 and
+ * then column 2, but the extra defence in the way it is done does not hurt
+ * anything so we have left it as is. Thus if the token is not a newline and not
+ * a tab we check if first_column is 0 or if last_column is 0 and if either one
+ * is 0, we explicitly set the respective variable to 1. Otherwise we increment
+ * the first_column and last_column.
+ */
+#define YY_USER_ACTION \
+			yylloc->filename = yyextra != NULL ? yyextra->filename:""; \
+			yylloc->first_line = yylloc->last_line + 1; \
+			yylloc->first_column = yylloc->last_column; \
+			for (char *p = yytext; *p; ++p) { \
+			    if (*p == '\n') { \
+				yylloc->last_line++; \
+				yylloc->last_column = 0; \
+			    } \
+			    else if (*p == '\t') { \
+				yylloc->last_column += 8; \
+			    } \
+			    else { \
+				if (yylloc->first_column == 0 || yylloc->last_column == 0) { \
+				    if (yylloc->first_column == 0) { \
+					yylloc->first_column = 1; \
+				    } \
+				    if (yylloc->last_column == 0) { \
+					yylloc->last_column = 1; \
+				    } \
+				} else { \
+				    yylloc->last_column++; \
+				    yylloc->first_column++; \
+				} \
+			    } \
+			}
+#line 823 "jparse.c"
+/*
+ * Section 1: Patterns (regular expressions) and actions.
+ */
+/*
+ * JSON_WS              [ \t\r]+
+ */
+/*
+ * JSON_NL              \n+
+ */
+/*
+ * NOTE: on the subject of JSON_STRING one might ask the question about the
+ * tighter restrictions on JSON strings and why we don't even consider them.
+ * This is a good question but the answer is simple: the JSON string conversion
+ * routines actually do these checks. This simplifies the lexer regex and so we
+ * don't have to worry about complicating the lexer or parser unnecessarily.
+ *
+ * We do exclude specific lower bytes but we also pre-scan for these same bytes
+ * and if they're there and unescaped we warn about it. The reason to still
+ * exclude them is because this way they are not passed to the parser. This
+ * might not be necessary because if we find invalid bytes it is an error and
+ * the parser will never find them but this is more defensive. For the
+ * interested, the old regexp was:
+ *
+ *	    \"([^\n"]|\\\")*\"
+ *
+ * ...and this is the current one:
+ *
+ * JSON_STRING	        \"([^"\x01-\x1f]|\\\")*\"
+ */
+/*
+ * JSON_INTEGER         -?([1-9][0-9]*|0)
+ */
+/*
+ * JSON_FRACTION        "."[0-9]+
+ */
+/*
+ * JSON_EXPONENT	[Ee][-+]?[0-9]+
+ */
+/*
+ * JSON_NUMBER		({JSON_INTEGER}|{JSON_INTEGER}{JSON_FRACTION}|{JSON_INTEGER}{JSON_FRACTION}{JSON_EXPONENT}|{JSON_INTEGER}{JSON_EXPONENT})
+ */
+/*
+ * JSON_TRUE		"true"
+ */
+/*
+ * JSON_FALSE		"false"
+ */
+/*
+ * JSON_NULL		"null"
+ */
+/*
+ * JSON_OPEN_BRACE	"{"
+ */
+/*
+ * JSON_CLOSE_BRACE	"}"
+ */
+/*
+ * JSON_OPEN_BRACKET	"["
+ */
+/*
+ * JSON_CLOSE_BRACKET	"]"
+ */
+/*
+ * JSON_COLON		":"
+ */
+/*
+ * JSON_COMMA		","
+ */
+/* Actions. */
+#line 893 "jparse.c"
+
+#define INITIAL 0
+
+#ifndef YY_NO_UNISTD_H
+/* Special case for "unistd.h", since it is non-ANSI. We include it way
+ * down here because we want the user's section 1 to have been scanned first.
+ * The user has a chance to override it with an option.
+ */
+#include <unistd.h>
+#endif
+
+#define YY_EXTRA_TYPE struct json_extra *
+
+/* Holds the entire state of the reentrant scanner. */
+struct yyguts_t
+    {
+
+    /* User-defined. Not touched by flex. */
+    YY_EXTRA_TYPE yyextra_r;
+
+    /* The rest are the same as the globals declared in the non-reentrant scanner. */
+    FILE *yyin_r, *yyout_r;
+    size_t yy_buffer_stack_top; /**< index of top of stack. */
+    size_t yy_buffer_stack_max; /**< capacity of stack. */
+    YY_BUFFER_STATE * yy_buffer_stack; /**< Stack as an array. */
+    char yy_hold_char;
+    int yy_n_chars;
+    int yyleng_r;
+    char *yy_c_buf_p;
+    int yy_init;
+    int yy_start;
+    int yy_did_buffer_switch_on_eof;
+    int yy_start_stack_ptr;
+    int yy_start_stack_depth;
+    int *yy_start_stack;
+    yy_state_type yy_last_accepting_state;
+    char* yy_last_accepting_cpos;
+
+    int yylineno_r;
+    int yy_flex_debug_r;
+
+    char *yytext_r;
+    int yy_more_flag;
+    int yy_more_len;
+
+    YYSTYPE * yylval_r;
+
+    YYLTYPE * yylloc_r;
+
+    }; /* end struct yyguts_t */
+
+static int yy_init_globals ( yyscan_t yyscanner );
+
+    /* This must go here because YYSTYPE and YYLTYPE are included
+     * from bison output in section 1.*/
+    #    define yylval yyg->yylval_r
+    
+    #    define yylloc yyg->yylloc_r
+    
+int yylex_init (yyscan_t* scanner);
+
+int yylex_init_extra ( YY_EXTRA_TYPE user_defined, yyscan_t* scanner);
+
+/* Accessor methods to globals.
+   These are made visible to non-reentrant scanners for convenience. */
+
+int yylex_destroy ( yyscan_t yyscanner );
+
+int yyget_debug ( yyscan_t yyscanner );
+
+void yyset_debug ( int debug_flag , yyscan_t yyscanner );
+
+YY_EXTRA_TYPE yyget_extra ( yyscan_t yyscanner );
+
+void yyset_extra ( YY_EXTRA_TYPE user_defined , yyscan_t yyscanner );
+
+FILE *yyget_in ( yyscan_t yyscanner );
+
+void yyset_in  ( FILE * _in_str , yyscan_t yyscanner );
+
+FILE *yyget_out ( yyscan_t yyscanner );
+
+void yyset_out  ( FILE * _out_str , yyscan_t yyscanner );
+
+			int yyget_leng ( yyscan_t yyscanner );
+
+char *yyget_text ( yyscan_t yyscanner );
+
+int yyget_lineno ( yyscan_t yyscanner );
+
+void yyset_lineno ( int _line_number , yyscan_t yyscanner );
+
+int yyget_column  ( yyscan_t yyscanner );
+
+void yyset_column ( int _column_no , yyscan_t yyscanner );
+
+YYSTYPE * yyget_lval ( yyscan_t yyscanner );
+
+void yyset_lval ( YYSTYPE * yylval_param , yyscan_t yyscanner );
+
+       YYLTYPE *yyget_lloc ( yyscan_t yyscanner );
+    
+        void yyset_lloc ( YYLTYPE * yylloc_param , yyscan_t yyscanner );
+    
+/* Macros after this point can all be overridden by user definitions in
+ * section 1.
+ */
+
+#ifndef YY_SKIP_YYWRAP
+#ifdef __cplusplus
+extern "C" int yywrap ( yyscan_t yyscanner );
+#else
+extern int yywrap ( yyscan_t yyscanner );
+#endif
+#endif
+
+#ifndef YY_NO_UNPUT
+    
+#endif
+
+#ifndef yytext_ptr
+static void yy_flex_strncpy ( char *, const char *, int , yyscan_t yyscanner);
+#endif
+
+#ifdef YY_NEED_STRLEN
+static int yy_flex_strlen ( const char * , yyscan_t yyscanner);
+#endif
+
+#ifndef YY_NO_INPUT
+#ifdef __cplusplus
+static int yyinput ( yyscan_t yyscanner );
+#else
+static int input ( yyscan_t yyscanner );
+#endif
+
+#endif
+
+/* Amount of stuff to slurp up with each read. */
+#ifndef YY_READ_BUF_SIZE
+#ifdef __ia64__
+/* On IA-64, the buffer size is 16k, not 8k */
+#define YY_READ_BUF_SIZE 16384
+#else
+#define YY_READ_BUF_SIZE 8192
+#endif /* __ia64__ */
+#endif
+
+/* Copy whatever the last rule matched to the standard output. */
+#ifndef ECHO
+/* This used to be an fputs(), but since the string might contain NUL's,
+ * we now use fwrite().
+ */
+#define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
+#endif
+
+/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
+ * is returned in "result".
+ */
+#ifndef YY_INPUT
+#define YY_INPUT(buf,result,max_size) \
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
+		{ \
+		int c = '*'; \
+		int n; \
+		for ( n = 0; n < max_size && \
+			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
+			buf[n] = (char) c; \
+		if ( c == '\n' ) \
+			buf[n++] = (char) c; \
+		if ( c == EOF && ferror( yyin ) ) \
+			YY_FATAL_ERROR( "input in flex scanner failed" ); \
+		result = n; \
+		} \
+	else \
+		{ \
+		errno=0; \
+		while ( (result = (int) fread(buf, 1, (yy_size_t) max_size, yyin)) == 0 && ferror(yyin)) \
+			{ \
+			if( errno != EINTR) \
+				{ \
+				YY_FATAL_ERROR( "input in flex scanner failed" ); \
+				break; \
+				} \
+			errno=0; \
+			clearerr(yyin); \
+			} \
+		}\
+\
+
+#endif
+
+/* No semi-colon after return; correct usage is to write "yyterminate();" -
+ * we don't want an extra ';' after the "return" because that will cause
+ * some compilers to complain about unreachable statements.
+ */
+#ifndef yyterminate
+#define yyterminate() return YY_NULL
+#endif
+
+/* Number of entries by which start-condition stack grows. */
+#ifndef YY_START_STACK_INCR
+#define YY_START_STACK_INCR 25
+#endif
+
+/* Report a fatal error. */
+#ifndef YY_FATAL_ERROR
+#define YY_FATAL_ERROR(msg) yy_fatal_error( msg , yyscanner)
+#endif
+
+/* end tables serialization structures and prototypes */
+
+/* Default declaration of generated scanner - a define so the user can
+ * easily add parameters.
+ */
+#ifndef YY_DECL
+#define YY_DECL_IS_OURS 1
+
+extern int yylex \
+               (YYSTYPE * yylval_param, YYLTYPE * yylloc_param , yyscan_t yyscanner);
+
+#define YY_DECL int yylex \
+               (YYSTYPE * yylval_param, YYLTYPE * yylloc_param , yyscan_t yyscanner)
+#endif /* !YY_DECL */
+
+/* Code executed at the beginning of each rule, after yytext and yyleng
+ * have been set up.
+ */
+#ifndef YY_USER_ACTION
+#define YY_USER_ACTION
+#endif
+
+/* Code executed at the end of each rule. */
+#ifndef YY_BREAK
+#define YY_BREAK /*LINTED*/break;
+#endif
+
+#define YY_RULE_SETUP \
+	YY_USER_ACTION
+
+/** The main scanner function which does all the work.
+ */
+YY_DECL
+{
+	yy_state_type yy_current_state;
+	char *yy_cp, *yy_bp;
+	int yy_act;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+    yylval = yylval_param;
+
+    yylloc = yylloc_param;
+
+	if ( !yyg->yy_init )
+		{
+		yyg->yy_init = 1;
+
+#ifdef YY_USER_INIT
+		YY_USER_INIT;
+#endif
+
+		if ( ! yyg->yy_start )
+			yyg->yy_start = 1;	/* first start state */
+
+		if ( ! yyin )
+			yyin = stdin;
+
+		if ( ! yyout )
+			yyout = stdout;
+
+		if ( ! YY_CURRENT_BUFFER ) {
+			yyensure_buffer_stack (yyscanner);
+			YY_CURRENT_BUFFER_LVALUE =
+				yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
+		}
+
+		yy_load_buffer_state( yyscanner );
+		}
+
+	{
+#line 210 "./jparse.l"
+
+#line 1175 "jparse.c"
+
+	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
+		{
+		yy_cp = yyg->yy_c_buf_p;
+
+		/* Support of yytext. */
+		*yy_cp = yyg->yy_hold_char;
+
+		/* yy_bp points to the position in yy_ch_buf of the start of
+		 * the current run.
+		 */
+		yy_bp = yy_cp;
+
+		yy_current_state = yyg->yy_start;
+yy_match:
+		do
+			{
+			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
+			if ( yy_accept[yy_current_state] )
+				{
+				yyg->yy_last_accepting_state = yy_current_state;
+				yyg->yy_last_accepting_cpos = yy_cp;
+				}
+			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+				{
+				yy_current_state = (int) yy_def[yy_current_state];
+				if ( yy_current_state >= 48 )
+					yy_c = yy_meta[yy_c];
+				}
+			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+			++yy_cp;
+			}
+		while ( yy_base[yy_current_state] != 90 );
+
+yy_find_action:
+		yy_act = yy_accept[yy_current_state];
+		if ( yy_act == 0 )
+			{ /* have to back up */
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
+			yy_act = yy_accept[yy_current_state];
+			}
+
+		YY_DO_BEFORE_ACTION;
+
+		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
+			{
+			int yyl;
+			for ( yyl = 0; yyl < yyleng; ++yyl )
+				if ( yytext[yyl] == '\n' )
+					
+    do{ yylineno++;
+        yycolumn=0;
+    }while(0)
+;
+			}
+
+do_action:	/* This label is used only to access EOF actions. */
+
+		switch ( yy_act )
+	{ /* beginning of action switch */
+			case 0: /* must back up */
+			/* undo the effects of YY_DO_BEFORE_ACTION */
+			*yy_cp = yyg->yy_hold_char;
+			yy_cp = yyg->yy_last_accepting_cpos;
+			yy_current_state = yyg->yy_last_accepting_state;
+			goto yy_find_action;
+
+case 1:
+YY_RULE_SETUP
+#line 211 "./jparse.l"
+{
+			    /*
+			     * Whitespace excluding newlines
+			     *
+			     * NOTE: we MUST include this action (JSON_WS) as
+			     * otherwise the action '.' will return an invalid
+			     * token to the parser!
+			     *
+			     * We don't really need the below debug message but
+                             * when we were developing the scanner/parser we
+                             * used it to see how many whitespaces were ignored
+                             * (depending on if the JSON debug level was high
+                             * enough).
+			     */
+			    (void) json_dbg(JSON_DBG_VVHIGH, __func__, "\nignoring %ju whitespace%s\n",
+							     (uintmax_t)yyleng, yyleng==1?"":"s");
+			}
+	YY_BREAK
+case 2:
+/* rule 2 can match eol */
+YY_RULE_SETUP
+#line 229 "./jparse.l"
+{
+                            /*
+                             * on newline (JSON_NL) we need to reset the column
+                             * for error location tracking.
+                             */
+			    yycolumn = 1;
+			}
+	YY_BREAK
+case 3:
+YY_RULE_SETUP
+#line 237 "./jparse.l"
+{
+			    /*
+                             * string (JSON_STRING)
+                             */
+			    return JSON_STRING;
+			}
+	YY_BREAK
+case 4:
+YY_RULE_SETUP
+#line 244 "./jparse.l"
+{
+			    /*
+                             * number (JSON_NUMBER)
+                             */
+			    return JSON_NUMBER;
+			}
+	YY_BREAK
+case 5:
+YY_RULE_SETUP
+#line 251 "./jparse.l"
+{
+			    /*
+                             * null object (JSON_NULL)
+                             */
+			    return JSON_NULL;
+			}
+	YY_BREAK
+case 6:
+YY_RULE_SETUP
+#line 258 "./jparse.l"
+{
+			    /*
+                             * true (JSON_TRUE)
+                             */
+			    return JSON_TRUE;
+			}
+	YY_BREAK
+case 7:
+YY_RULE_SETUP
+#line 264 "./jparse.l"
+{
+			    /*
+                             * false (JSON_FALSE)
+                             *
+                             * NOTE: the fact this is false does not make it
+                             * really false, as we do need false! :-)
+                             */
+			    return JSON_FALSE;
+			}
+	YY_BREAK
+case 8:
+YY_RULE_SETUP
+#line 274 "./jparse.l"
+{
+			    /*
+                             * start of object - open brace i.e. "{" (JSON_OPEN_BRACE)
+                             */
+			    return JSON_OPEN_BRACE;
+			}
+	YY_BREAK
+case 9:
+YY_RULE_SETUP
+#line 280 "./jparse.l"
+{
+			    /*
+                             * end of object - close brace i.e. "}" (JSON_CLOSE_BRACE)
+                             */
+			    return JSON_CLOSE_BRACE;
+			}
+	YY_BREAK
+case 10:
+YY_RULE_SETUP
+#line 287 "./jparse.l"
+{
+			    /*
+                             * start of array - open bracket i.e. "[" (JSON_OPEN_BRACKET)
+                             */
+			    return JSON_OPEN_BRACKET;
+			}
+	YY_BREAK
+case 11:
+YY_RULE_SETUP
+#line 293 "./jparse.l"
+{
+			    /*
+                             * end of array - close bracket i.e. "]" (JSON_CLOSE_BRACKET)
+                             */
+			    return JSON_CLOSE_BRACKET;
+			}
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+#line 300 "./jparse.l"
+{
+			    /*
+                             * colon or 'equals' (JSON_COLON)
+                             */
+			    return JSON_COLON;
+			}
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+#line 307 "./jparse.l"
+{
+			    /*
+                             * comma: name/value pair separator (JSON_COMMA)
+                             */
+			    return JSON_COMMA;
+			}
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+#line 314 "./jparse.l"
+{
+			    /*
+                             * invalid token: any other character (regexp ".")
+                             */
+			    dbg(DBG_LOW, "at line %d column %d: invalid token: 0x%02x = <%c>", yylloc->first_line,
+                                    yylloc->first_column, *yytext, *yytext);
+
+			    /*
+			     * Returning 'token' (return token;) is a hack for
+                             * better error messages with invalid tokens. Bison
+                             * syntax error messages are in the form of:
+			     *
+			     *	    syntax error, unexpected <token name>
+			     *	    syntax error, unexpected <token name>, expecting } or JSON_STRING
+			     *
+			     * etc. where <token name> is whatever we return
+                             * here in the lexer actions (e.g.  JSON_STRING or
+                             * in this case literally token) to the parser. But
+                             * the problem is what do we call an invalid token
+                             * without knowing what what the token actually is?
+                             * Thus we call it token so that it will read
+                             * literally as 'unexpected token' which removes any
+                             * ambiguity (it could otherwise be read as 'it's
+                             * unexpected in this place but it is valid in other
+                             * contexts' but it's never actually valid: it's a
+                             * catch all for anything that's not valid).
+			     *
+			     * We also make use of yytext in yyerror() which
+                             * makes for a somewhat reasonable error message
+                             * even when yyerror() is called from memory
+                             * exhaustion. See that function and the comments
+                             * for '%token token' in jparse.y.
+			     */
+			    return token;
+			}
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+#line 350 "./jparse.l"
+YY_FATAL_ERROR( "flex scanner jammed" );
+	YY_BREAK
+#line 1434 "jparse.c"
+case YY_STATE_EOF(INITIAL):
+	yyterminate();
+
+	case YY_END_OF_BUFFER:
+		{
+		/* Amount of text matched not including the EOB char. */
+		int yy_amount_of_matched_text = (int) (yy_cp - yyg->yytext_ptr) - 1;
+
+		/* Undo the effects of YY_DO_BEFORE_ACTION. */
+		*yy_cp = yyg->yy_hold_char;
+		YY_RESTORE_YY_MORE_OFFSET
+
+		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
+			{
+			/* We're scanning a new file or input source.  It's
+			 * possible that this happened because the user
+			 * just pointed yyin at a new source and called
+			 * yylex().  If so, then we have to assure
+			 * consistency between YY_CURRENT_BUFFER and our
+			 * globals.  Here is the right place to do so, because
+			 * this is the first action (other than possibly a
+			 * back-up) that will match for the new input source.
+			 */
+			yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
+			}
+
+		/* Note that here we test for yy_c_buf_p "<=" to the position
+		 * of the first EOB in the buffer, since yy_c_buf_p will
+		 * already have been incremented past the NUL character
+		 * (since all states make transitions on EOB to the
+		 * end-of-buffer state).  Contrast this with the test
+		 * in input().
+		 */
+		if ( yyg->yy_c_buf_p <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
+			{ /* This was really a NUL. */
+			yy_state_type yy_next_state;
+
+			yyg->yy_c_buf_p = yyg->yytext_ptr + yy_amount_of_matched_text;
+
+			yy_current_state = yy_get_previous_state( yyscanner );
+
+			/* Okay, we're now positioned to make the NUL
+			 * transition.  We couldn't have
+			 * yy_get_previous_state() go ahead and do it
+			 * for us because it doesn't know how to deal
+			 * with the possibility of jamming (and we don't
+			 * want to build jamming into it because then it
+			 * will run more slowly).
+			 */
+
+			yy_next_state = yy_try_NUL_trans( yy_current_state , yyscanner);
+
+			yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+
+			if ( yy_next_state )
+				{
+				/* Consume the NUL. */
+				yy_cp = ++yyg->yy_c_buf_p;
+				yy_current_state = yy_next_state;
+				goto yy_match;
+				}
+
+			else
+				{
+				yy_cp = yyg->yy_c_buf_p;
+				goto yy_find_action;
+				}
+			}
+
+		else switch ( yy_get_next_buffer( yyscanner ) )
+			{
+			case EOB_ACT_END_OF_FILE:
+				{
+				yyg->yy_did_buffer_switch_on_eof = 0;
+
+				if ( yywrap( yyscanner ) )
+					{
+					/* Note: because we've taken care in
+					 * yy_get_next_buffer() to have set up
+					 * yytext, we can now set up
+					 * yy_c_buf_p so that if some total
+					 * hoser (like flex itself) wants to
+					 * call the scanner after we return the
+					 * YY_NULL, it'll still work - another
+					 * YY_NULL will get returned.
+					 */
+					yyg->yy_c_buf_p = yyg->yytext_ptr + YY_MORE_ADJ;
+
+					yy_act = YY_STATE_EOF(YY_START);
+					goto do_action;
+					}
+
+				else
+					{
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
+						YY_NEW_FILE;
+					}
+				break;
+				}
+
+			case EOB_ACT_CONTINUE_SCAN:
+				yyg->yy_c_buf_p =
+					yyg->yytext_ptr + yy_amount_of_matched_text;
+
+				yy_current_state = yy_get_previous_state( yyscanner );
+
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+				goto yy_match;
+
+			case EOB_ACT_LAST_MATCH:
+				yyg->yy_c_buf_p =
+				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars];
+
+				yy_current_state = yy_get_previous_state( yyscanner );
+
+				yy_cp = yyg->yy_c_buf_p;
+				yy_bp = yyg->yytext_ptr + YY_MORE_ADJ;
+				goto yy_find_action;
+			}
+		break;
+		}
+
+	default:
+		YY_FATAL_ERROR(
+			"fatal flex scanner internal error--no action found" );
+	} /* end of action switch */
+		} /* end of scanning one token */
+	} /* end of user's declarations */
+} /* end of yylex */
+
+/* yy_get_next_buffer - try to read in a new buffer
+ *
+ * Returns a code representing an action:
+ *	EOB_ACT_LAST_MATCH -
+ *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
+ *	EOB_ACT_END_OF_FILE - end of file
+ */
+static int yy_get_next_buffer (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
+	char *source = yyg->yytext_ptr;
+	int number_to_move, i;
+	int ret_val;
+
+	if ( yyg->yy_c_buf_p > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] )
+		YY_FATAL_ERROR(
+		"fatal flex scanner internal error--end of buffer missed" );
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
+		{ /* Don't try to fill the buffer, so this is an EOF. */
+		if ( yyg->yy_c_buf_p - yyg->yytext_ptr - YY_MORE_ADJ == 1 )
+			{
+			/* We matched a single character, the EOB, so
+			 * treat this as a final EOF.
+			 */
+			return EOB_ACT_END_OF_FILE;
+			}
+
+		else
+			{
+			/* We matched some text prior to the EOB, first
+			 * process it.
+			 */
+			return EOB_ACT_LAST_MATCH;
+			}
+		}
+
+	/* Try to read more data. */
+
+	/* First move last chars to start of buffer. */
+	number_to_move = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr - 1);
+
+	for ( i = 0; i < number_to_move; ++i )
+		*(dest++) = *(source++);
+
+	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
+		/* don't do the read, it's not guaranteed to return an EOF,
+		 * just force an EOF
+		 */
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars = 0;
+
+	else
+		{
+			int num_to_read =
+			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
+
+		while ( num_to_read <= 0 )
+			{ /* Not enough room in the buffer - grow it. */
+
+			/* just a shorter name for the current buffer */
+			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
+
+			int yy_c_buf_p_offset =
+				(int) (yyg->yy_c_buf_p - b->yy_ch_buf);
+
+			if ( b->yy_is_our_buffer )
+				{
+				int new_size = b->yy_buf_size * 2;
+
+				if ( new_size <= 0 )
+					b->yy_buf_size += b->yy_buf_size / 8;
+				else
+					b->yy_buf_size *= 2;
+
+				b->yy_ch_buf = (char *)
+					/* Include room in for 2 EOB chars. */
+					yyrealloc( (void *) b->yy_ch_buf,
+							 (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
+				}
+			else
+				/* Can't grow it, we don't own it. */
+				b->yy_ch_buf = NULL;
+
+			if ( ! b->yy_ch_buf )
+				YY_FATAL_ERROR(
+				"fatal error - scanner input buffer overflow" );
+
+			yyg->yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
+
+			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
+						number_to_move - 1;
+
+			}
+
+		if ( num_to_read > YY_READ_BUF_SIZE )
+			num_to_read = YY_READ_BUF_SIZE;
+
+		/* Read in more data. */
+		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
+			yyg->yy_n_chars, num_to_read );
+
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	if ( yyg->yy_n_chars == 0 )
+		{
+		if ( number_to_move == YY_MORE_ADJ )
+			{
+			ret_val = EOB_ACT_END_OF_FILE;
+			yyrestart( yyin  , yyscanner);
+			}
+
+		else
+			{
+			ret_val = EOB_ACT_LAST_MATCH;
+			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
+				YY_BUFFER_EOF_PENDING;
+			}
+		}
+
+	else
+		ret_val = EOB_ACT_CONTINUE_SCAN;
+
+	if ((yyg->yy_n_chars + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
+		/* Extend the array by 50%, plus the number we really need. */
+		int new_size = yyg->yy_n_chars + number_to_move + (yyg->yy_n_chars >> 1);
+		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
+			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size , yyscanner );
+		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
+			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
+		/* "- 2" to take care of EOB's */
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
+	}
+
+	yyg->yy_n_chars += number_to_move;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] = YY_END_OF_BUFFER_CHAR;
+	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
+
+	yyg->yytext_ptr = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
+
+	return ret_val;
+}
+
+/* yy_get_previous_state - get the state just before the EOB char was reached */
+
+    static yy_state_type yy_get_previous_state (yyscan_t yyscanner)
+{
+	yy_state_type yy_current_state;
+	char *yy_cp;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yy_current_state = yyg->yy_start;
+
+	for ( yy_cp = yyg->yytext_ptr + YY_MORE_ADJ; yy_cp < yyg->yy_c_buf_p; ++yy_cp )
+		{
+		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 5);
+		if ( yy_accept[yy_current_state] )
+			{
+			yyg->yy_last_accepting_state = yy_current_state;
+			yyg->yy_last_accepting_cpos = yy_cp;
+			}
+		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+			{
+			yy_current_state = (int) yy_def[yy_current_state];
+			if ( yy_current_state >= 48 )
+				yy_c = yy_meta[yy_c];
+			}
+		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+		}
+
+	return yy_current_state;
+}
+
+/* yy_try_NUL_trans - try to make a transition on the NUL character
+ *
+ * synopsis
+ *	next_state = yy_try_NUL_trans( current_state );
+ */
+    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state , yyscan_t yyscanner)
+{
+	int yy_is_jam;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner; /* This var may be unused depending upon options. */
+	char *yy_cp = yyg->yy_c_buf_p;
+
+	YY_CHAR yy_c = 5;
+	if ( yy_accept[yy_current_state] )
+		{
+		yyg->yy_last_accepting_state = yy_current_state;
+		yyg->yy_last_accepting_cpos = yy_cp;
+		}
+	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
+		{
+		yy_current_state = (int) yy_def[yy_current_state];
+		if ( yy_current_state >= 48 )
+			yy_c = yy_meta[yy_c];
+		}
+	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
+	yy_is_jam = (yy_current_state == 47);
+
+	(void)yyg;
+	return yy_is_jam ? 0 : yy_current_state;
+}
+
+#ifndef YY_NO_UNPUT
+
+#endif
+
+#ifndef YY_NO_INPUT
+#ifdef __cplusplus
+    static int yyinput (yyscan_t yyscanner)
+#else
+    static int input  (yyscan_t yyscanner)
+#endif
+
+{
+	int c;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	*yyg->yy_c_buf_p = yyg->yy_hold_char;
+
+	if ( *yyg->yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
+		{
+		/* yy_c_buf_p now points to the character we want to return.
+		 * If this occurs *before* the EOB characters, then it's a
+		 * valid NUL; if not, then we've hit the end of the buffer.
+		 */
+		if ( yyg->yy_c_buf_p < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[yyg->yy_n_chars] )
+			/* This was really a NUL. */
+			*yyg->yy_c_buf_p = '\0';
+
+		else
+			{ /* need more input */
+			int offset = (int) (yyg->yy_c_buf_p - yyg->yytext_ptr);
+			++yyg->yy_c_buf_p;
+
+			switch ( yy_get_next_buffer( yyscanner ) )
+				{
+				case EOB_ACT_LAST_MATCH:
+					/* This happens because yy_g_n_b()
+					 * sees that we've accumulated a
+					 * token and flags that we need to
+					 * try matching the token before
+					 * proceeding.  But for input(),
+					 * there's no matching to consider.
+					 * So convert the EOB_ACT_LAST_MATCH
+					 * to EOB_ACT_END_OF_FILE.
+					 */
+
+					/* Reset buffer status. */
+					yyrestart( yyin , yyscanner);
+
+					/*FALLTHROUGH*/
+
+				case EOB_ACT_END_OF_FILE:
+					{
+					if ( yywrap( yyscanner ) )
+						return 0;
+
+					if ( ! yyg->yy_did_buffer_switch_on_eof )
+						YY_NEW_FILE;
+#ifdef __cplusplus
+					return yyinput(yyscanner);
+#else
+					return input(yyscanner);
+#endif
+					}
+
+				case EOB_ACT_CONTINUE_SCAN:
+					yyg->yy_c_buf_p = yyg->yytext_ptr + offset;
+					break;
+				}
+			}
+		}
+
+	c = *(unsigned char *) yyg->yy_c_buf_p;	/* cast for 8-bit char's */
+	*yyg->yy_c_buf_p = '\0';	/* preserve yytext */
+	yyg->yy_hold_char = *++yyg->yy_c_buf_p;
+
+	if ( c == '\n' )
+		
+    do{ yylineno++;
+        yycolumn=0;
+    }while(0)
+;
+
+	return c;
+}
+#endif	/* ifndef YY_NO_INPUT */
+
+/** Immediately switch to a different input stream.
+ * @param input_file A readable stream.
+ * @param yyscanner The scanner object.
+ * @note This function does not reset the start condition to @c INITIAL .
+ */
+    void yyrestart  (FILE * input_file , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( ! YY_CURRENT_BUFFER ){
+        yyensure_buffer_stack (yyscanner);
+		YY_CURRENT_BUFFER_LVALUE =
+            yy_create_buffer( yyin, YY_BUF_SIZE , yyscanner);
+	}
+
+	yy_init_buffer( YY_CURRENT_BUFFER, input_file , yyscanner);
+	yy_load_buffer_state( yyscanner );
+}
+
+/** Switch to a different input buffer.
+ * @param new_buffer The new input buffer.
+ * @param yyscanner The scanner object.
+ */
+    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	/* TODO. We should be able to replace this entire function body
+	 * with
+	 *		yypop_buffer_state();
+	 *		yypush_buffer_state(new_buffer);
+     */
+	yyensure_buffer_stack (yyscanner);
+	if ( YY_CURRENT_BUFFER == new_buffer )
+		return;
+
+	if ( YY_CURRENT_BUFFER )
+		{
+		/* Flush out information for old buffer. */
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+	yy_load_buffer_state( yyscanner );
+
+	/* We don't actually know whether we did this switch during
+	 * EOF (yywrap()) processing, but the only time this flag
+	 * is looked at is after yywrap() is called, so it's safe
+	 * to go ahead and always set it.
+	 */
+	yyg->yy_did_buffer_switch_on_eof = 1;
+}
+
+static void yy_load_buffer_state  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	yyg->yy_n_chars = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
+	yyg->yytext_ptr = yyg->yy_c_buf_p = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
+	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
+	yyg->yy_hold_char = *yyg->yy_c_buf_p;
+}
+
+/** Allocate and initialize an input buffer state.
+ * @param file A readable stream.
+ * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
+ * @param yyscanner The scanner object.
+ * @return the allocated buffer state.
+ */
+    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+    
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_buf_size = size;
+
+	/* yy_ch_buf has to be 2 characters longer than the size given because
+	 * we need to put in 2 end-of-buffer characters.
+	 */
+	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2) , yyscanner );
+	if ( ! b->yy_ch_buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
+
+	b->yy_is_our_buffer = 1;
+
+	yy_init_buffer( b, file , yyscanner);
+
+	return b;
+}
+
+/** Destroy the buffer.
+ * @param b a buffer created with yy_create_buffer()
+ * @param yyscanner The scanner object.
+ */
+    void yy_delete_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if ( ! b )
+		return;
+
+	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
+		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
+
+	if ( b->yy_is_our_buffer )
+		yyfree( (void *) b->yy_ch_buf , yyscanner );
+
+	yyfree( (void *) b , yyscanner );
+}
+
+/* Initializes or reinitializes a buffer.
+ * This function is sometimes called more than once on the same buffer,
+ * such as during a yyrestart() or at EOF.
+ */
+    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file , yyscan_t yyscanner)
+
+{
+	int oerrno = errno;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	yy_flush_buffer( b , yyscanner);
+
+	b->yy_input_file = file;
+	b->yy_fill_buffer = 1;
+
+    /* If b is the current buffer, then yy_init_buffer was _probably_
+     * called from yyrestart() or through yy_get_next_buffer.
+     * In that case, we don't want to reset the lineno or column.
+     */
+    if (b != YY_CURRENT_BUFFER){
+        b->yy_bs_lineno = 1;
+        b->yy_bs_column = 0;
+    }
+
+        b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
+    
+	errno = oerrno;
+}
+
+/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
+ * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
+ * @param yyscanner The scanner object.
+ */
+    void yy_flush_buffer (YY_BUFFER_STATE  b , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if ( ! b )
+		return;
+
+	b->yy_n_chars = 0;
+
+	/* We always need two end-of-buffer characters.  The first causes
+	 * a transition to the end-of-buffer state.  The second causes
+	 * a jam in that state.
+	 */
+	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
+	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
+
+	b->yy_buf_pos = &b->yy_ch_buf[0];
+
+	b->yy_at_bol = 1;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	if ( b == YY_CURRENT_BUFFER )
+		yy_load_buffer_state( yyscanner );
+}
+
+/** Pushes the new state onto the stack. The new state becomes
+ *  the current state. This function will allocate the stack
+ *  if necessary.
+ *  @param new_buffer The new state.
+ *  @param yyscanner The scanner object.
+ */
+void yypush_buffer_state (YY_BUFFER_STATE new_buffer , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (new_buffer == NULL)
+		return;
+
+	yyensure_buffer_stack(yyscanner);
+
+	/* This block is copied from yy_switch_to_buffer. */
+	if ( YY_CURRENT_BUFFER )
+		{
+		/* Flush out information for old buffer. */
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = yyg->yy_c_buf_p;
+		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = yyg->yy_n_chars;
+		}
+
+	/* Only push if top exists. Otherwise, replace top. */
+	if (YY_CURRENT_BUFFER)
+		yyg->yy_buffer_stack_top++;
+	YY_CURRENT_BUFFER_LVALUE = new_buffer;
+
+	/* copied from yy_switch_to_buffer. */
+	yy_load_buffer_state( yyscanner );
+	yyg->yy_did_buffer_switch_on_eof = 1;
+}
+
+/** Removes and deletes the top of the stack, if present.
+ *  The next element becomes the new top.
+ *  @param yyscanner The scanner object.
+ */
+void yypop_buffer_state (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	if (!YY_CURRENT_BUFFER)
+		return;
+
+	yy_delete_buffer(YY_CURRENT_BUFFER , yyscanner);
+	YY_CURRENT_BUFFER_LVALUE = NULL;
+	if (yyg->yy_buffer_stack_top > 0)
+		--yyg->yy_buffer_stack_top;
+
+	if (YY_CURRENT_BUFFER) {
+		yy_load_buffer_state( yyscanner );
+		yyg->yy_did_buffer_switch_on_eof = 1;
+	}
+}
+
+/* Allocates the stack if it does not exist.
+ *  Guarantees space for at least one push.
+ */
+static void yyensure_buffer_stack (yyscan_t yyscanner)
+{
+	yy_size_t num_to_alloc;
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+	if (!yyg->yy_buffer_stack) {
+
+		/* First allocation is just for 2 elements, since we don't know if this
+		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
+		 * immediate realloc on the next call.
+         */
+      num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyalloc
+								(num_to_alloc * sizeof(struct yy_buffer_state*)
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		memset(yyg->yy_buffer_stack, 0, num_to_alloc * sizeof(struct yy_buffer_state*));
+
+		yyg->yy_buffer_stack_max = num_to_alloc;
+		yyg->yy_buffer_stack_top = 0;
+		return;
+	}
+
+	if (yyg->yy_buffer_stack_top >= (yyg->yy_buffer_stack_max) - 1){
+
+		/* Increase the buffer to prepare for a possible push. */
+		yy_size_t grow_size = 8 /* arbitrary grow size */;
+
+		num_to_alloc = yyg->yy_buffer_stack_max + grow_size;
+		yyg->yy_buffer_stack = (struct yy_buffer_state**)yyrealloc
+								(yyg->yy_buffer_stack,
+								num_to_alloc * sizeof(struct yy_buffer_state*)
+								, yyscanner);
+		if ( ! yyg->yy_buffer_stack )
+			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
+
+		/* zero only the new slots.*/
+		memset(yyg->yy_buffer_stack + yyg->yy_buffer_stack_max, 0, grow_size * sizeof(struct yy_buffer_state*));
+		yyg->yy_buffer_stack_max = num_to_alloc;
+	}
+}
+
+/** Setup the input buffer state to scan directly from a user-specified character buffer.
+ * @param base the character buffer
+ * @param size the size in bytes of the character buffer
+ * @param yyscanner The scanner object.
+ * @return the newly allocated buffer state object.
+ */
+YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+    
+	if ( size < 2 ||
+	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
+	     base[size-1] != YY_END_OF_BUFFER_CHAR )
+		/* They forgot to leave room for the EOB's. */
+		return NULL;
+
+	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state ) , yyscanner );
+	if ( ! b )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
+
+	b->yy_buf_size = (int) (size - 2);	/* "- 2" to take care of EOB's */
+	b->yy_buf_pos = b->yy_ch_buf = base;
+	b->yy_is_our_buffer = 0;
+	b->yy_input_file = NULL;
+	b->yy_n_chars = b->yy_buf_size;
+	b->yy_is_interactive = 0;
+	b->yy_at_bol = 1;
+	b->yy_fill_buffer = 0;
+	b->yy_buffer_status = YY_BUFFER_NEW;
+
+	yy_switch_to_buffer( b , yyscanner );
+
+	return b;
+}
+
+/** Setup the input buffer state to scan a string. The next call to yylex() will
+ * scan from a @e copy of @a str.
+ * @param yystr a NUL-terminated string to scan
+ * @param yyscanner The scanner object.
+ * @return the newly allocated buffer state object.
+ * @note If you want to scan bytes that may contain NUL values, then use
+ *       yy_scan_bytes() instead.
+ */
+YY_BUFFER_STATE yy_scan_string (const char * yystr , yyscan_t yyscanner)
+{
+    
+	return yy_scan_bytes( yystr, (int) strlen(yystr) , yyscanner);
+}
+
+/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
+ * scan from a @e copy of @a bytes.
+ * @param yybytes the byte buffer to scan
+ * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
+ * @param yyscanner The scanner object.
+ * @return the newly allocated buffer state object.
+ */
+YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len , yyscan_t yyscanner)
+{
+	YY_BUFFER_STATE b;
+	char *buf;
+	yy_size_t n;
+	int i;
+    
+	/* Get memory for full buffer, including space for trailing EOB's. */
+	n = (yy_size_t) (_yybytes_len + 2);
+	buf = (char *) yyalloc( n , yyscanner );
+	if ( ! buf )
+		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
+
+	for ( i = 0; i < _yybytes_len; ++i )
+		buf[i] = yybytes[i];
+
+	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
+
+	b = yy_scan_buffer( buf, n , yyscanner);
+	if ( ! b )
+		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
+
+	/* It's okay to grow etc. this buffer, and we should throw it
+	 * away when we're done.
+	 */
+	b->yy_is_our_buffer = 1;
+
+	return b;
+}
+
+#ifndef YY_EXIT_FAILURE
+#define YY_EXIT_FAILURE 2
+#endif
+
+static void yynoreturn yy_fatal_error (const char* msg , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	fprintf( stderr, "%s\n", msg );
+	exit( YY_EXIT_FAILURE );
+}
+
+/* Redefine yyless() so it works in section 3 code. */
+
+#undef yyless
+#define yyless(n) \
+	do \
+		{ \
+		/* Undo effects of setting up yytext. */ \
+        int yyless_macro_arg = (n); \
+        YY_LESS_LINENO(yyless_macro_arg);\
+		yytext[yyleng] = yyg->yy_hold_char; \
+		yyg->yy_c_buf_p = yytext + yyless_macro_arg; \
+		yyg->yy_hold_char = *yyg->yy_c_buf_p; \
+		*yyg->yy_c_buf_p = '\0'; \
+		yyleng = yyless_macro_arg; \
+		} \
+	while ( 0 )
+
+/* Accessor  methods (get/set functions) to struct members. */
+
+/** Get the user-defined data for this scanner.
+ * @param yyscanner The scanner object.
+ */
+YY_EXTRA_TYPE yyget_extra  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyextra;
+}
+
+/** Get the current line number.
+ * @param yyscanner The scanner object.
+ */
+int yyget_lineno  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
+    return yylineno;
+}
+
+/** Get the current column number.
+ * @param yyscanner The scanner object.
+ */
+int yyget_column  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        if (! YY_CURRENT_BUFFER)
+            return 0;
+    
+    return yycolumn;
+}
+
+/** Get the input stream.
+ * @param yyscanner The scanner object.
+ */
+FILE *yyget_in  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyin;
+}
+
+/** Get the output stream.
+ * @param yyscanner The scanner object.
+ */
+FILE *yyget_out  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyout;
+}
+
+/** Get the length of the current token.
+ * @param yyscanner The scanner object.
+ */
+int yyget_leng  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yyleng;
+}
+
+/** Get the current token.
+ * @param yyscanner The scanner object.
+ */
+
+char *yyget_text  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yytext;
+}
+
+/** Set the user-defined data. This data is never touched by the scanner.
+ * @param user_defined The data to be associated with this scanner.
+ * @param yyscanner The scanner object.
+ */
+void yyset_extra (YY_EXTRA_TYPE  user_defined , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyextra = user_defined ;
+}
+
+/** Set the current line number.
+ * @param _line_number line number
+ * @param yyscanner The scanner object.
+ */
+void yyset_lineno (int  _line_number , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* lineno is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_lineno called with no buffer" );
+    
+    yylineno = _line_number;
+}
+
+/** Set the current column.
+ * @param _column_no column number
+ * @param yyscanner The scanner object.
+ */
+void yyset_column (int  _column_no , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+        /* column is only valid if an input buffer exists. */
+        if (! YY_CURRENT_BUFFER )
+           YY_FATAL_ERROR( "yyset_column called with no buffer" );
+    
+    yycolumn = _column_no;
+}
+
+/** Set the input stream. This does not discard the current
+ * input buffer.
+ * @param _in_str A readable stream.
+ * @param yyscanner The scanner object.
+ * @see yy_switch_to_buffer
+ */
+void yyset_in (FILE *  _in_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyin = _in_str ;
+}
+
+void yyset_out (FILE *  _out_str , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yyout = _out_str ;
+}
+
+int yyget_debug  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yy_flex_debug;
+}
+
+void yyset_debug (int  _bdebug , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yy_flex_debug = _bdebug ;
+}
+
+/* Accessor methods for yylval and yylloc */
+
+YYSTYPE * yyget_lval  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylval;
+}
+
+void yyset_lval (YYSTYPE *  yylval_param , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylval = yylval_param;
+}
+
+YYLTYPE *yyget_lloc  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    return yylloc;
+}
+    
+void yyset_lloc (YYLTYPE *  yylloc_param , yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    yylloc = yylloc_param;
+}
+    
+/* User-visible API */
+
+/* yylex_init is special because it creates the scanner itself, so it is
+ * the ONLY reentrant function that doesn't take the scanner as the last argument.
+ * That's why we explicitly handle the declaration, instead of using our macros.
+ */
+int yylex_init(yyscan_t* ptr_yy_globals)
+{
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), NULL );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+/* yylex_init_extra has the same functionality as yylex_init, but follows the
+ * convention of taking the scanner as the last argument. Note however, that
+ * this is a *pointer* to a scanner, as it will be allocated by this call (and
+ * is the reason, too, why this function also must handle its own declaration).
+ * The user defined value in the first argument will be available to yyalloc in
+ * the yyextra field.
+ */
+int yylex_init_extra( YY_EXTRA_TYPE yy_user_defined, yyscan_t* ptr_yy_globals )
+{
+    struct yyguts_t dummy_yyguts;
+
+    yyset_extra (yy_user_defined, &dummy_yyguts);
+
+    if (ptr_yy_globals == NULL){
+        errno = EINVAL;
+        return 1;
+    }
+
+    *ptr_yy_globals = (yyscan_t) yyalloc ( sizeof( struct yyguts_t ), &dummy_yyguts );
+
+    if (*ptr_yy_globals == NULL){
+        errno = ENOMEM;
+        return 1;
+    }
+
+    /* By setting to 0xAA, we expose bugs in
+    yy_init_globals. Leave at 0x00 for releases. */
+    memset(*ptr_yy_globals,0x00,sizeof(struct yyguts_t));
+
+    yyset_extra (yy_user_defined, *ptr_yy_globals);
+
+    return yy_init_globals ( *ptr_yy_globals );
+}
+
+static int yy_init_globals (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+    /* Initialization is the same as for the non-reentrant scanner.
+     * This function is called from yylex_destroy(), so don't allocate here.
+     */
+
+    yyg->yy_buffer_stack = NULL;
+    yyg->yy_buffer_stack_top = 0;
+    yyg->yy_buffer_stack_max = 0;
+    yyg->yy_c_buf_p = NULL;
+    yyg->yy_init = 0;
+    yyg->yy_start = 0;
+
+    yyg->yy_start_stack_ptr = 0;
+    yyg->yy_start_stack_depth = 0;
+    yyg->yy_start_stack =  NULL;
+
+/* Defined in main.c */
+#ifdef YY_STDINIT
+    yyin = stdin;
+    yyout = stdout;
+#else
+    yyin = NULL;
+    yyout = NULL;
+#endif
+
+    /* For future reference: Set errno on error, since we are called by
+     * yylex_init()
+     */
+    return 0;
+}
+
+/* yylex_destroy is for both reentrant and non-reentrant scanners. */
+int yylex_destroy  (yyscan_t yyscanner)
+{
+    struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+
+    /* Pop the buffer stack, destroying each element. */
+	while(YY_CURRENT_BUFFER){
+		yy_delete_buffer( YY_CURRENT_BUFFER , yyscanner );
+		YY_CURRENT_BUFFER_LVALUE = NULL;
+		yypop_buffer_state(yyscanner);
+	}
+
+	/* Destroy the stack itself. */
+	yyfree(yyg->yy_buffer_stack , yyscanner);
+	yyg->yy_buffer_stack = NULL;
+
+    /* Destroy the start condition stack. */
+        yyfree( yyg->yy_start_stack , yyscanner );
+        yyg->yy_start_stack = NULL;
+
+    /* Reset the globals. This is important in a non-reentrant scanner so the next time
+     * yylex() is called, initialization will occur. */
+    yy_init_globals( yyscanner);
+
+    /* Destroy the main struct (reentrant only). */
+    yyfree ( yyscanner , yyscanner );
+    yyscanner = NULL;
+    return 0;
+}
+
+/*
+ * Internal utility routines.
+ */
+
+#ifndef yytext_ptr
+static void yy_flex_strncpy (char* s1, const char * s2, int n , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+
+	int i;
+	for ( i = 0; i < n; ++i )
+		s1[i] = s2[i];
+}
+#endif
+
+#ifdef YY_NEED_STRLEN
+static int yy_flex_strlen (const char * s , yyscan_t yyscanner)
+{
+	int n;
+	for ( n = 0; s[n]; ++n )
+		;
+
+	return n;
+}
+#endif
+
+void *yyalloc (yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	return malloc(size);
+}
+
+void *yyrealloc  (void * ptr, yy_size_t  size , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+
+	/* The cast to (char *) in the following accommodates both
+	 * implementations that use char* generic pointers, and those
+	 * that use void* generic pointers.  It works with the latter
+	 * because both ANSI C and C++ allow castless assignment from
+	 * any pointer type to void*, and deal with argument conversions
+	 * as though doing an assignment.
+	 */
+	return realloc(ptr, size);
+}
+
+void yyfree (void * ptr , yyscan_t yyscanner)
+{
+	struct yyguts_t * yyg = (struct yyguts_t*)yyscanner;
+	(void)yyg;
+	free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
+}
+
+#define YYTABLES_NAME "yytables"
+
+#line 350 "./jparse.l"
+
+
+/* Section 2: Code that's copied to the generated scanner */
+
+/*
+ * low_byte_scan - detect certain low byte values
+ *
+ * Scan data for bytes in the class: [\x00-\x08\x0e-\x1f]
+ *
+ * A flex programmer's apology:
+ *
+ * Whenever a scanner matches a token, the text of the token is stored in
+ * the NUL byte terminated string yytext.  The length in yyleng is the same
+ * as the value that would be returned by the strlen(3) function.
+ * Even though regular expressions can detect the presence of a NUL (\x00) bytes
+ * in a block of data, error reporting and internal pointer advancement
+ * appears to assume NUL (\x00) terminated strings AND thus the state machine
+ * can become "confused" when scanning a block of data with NUL bytes inside
+ * instead of just terminating it.
+ *
+ * To avoid such problems, we pre-scan the block of data for NUL (\x00) bytes
+ * and report their presence if we find any NUL (\x00) bytes in data.
+ *
+ * The so-called JSON spec does not allow byte values [\x00-\x1f] within
+ * JSON strings.  Attempts to modify JSON_STRING to exclude such byte values
+ * within a JSON string has not worked well, especially when it comes to
+ * printing error messages with strings that contain such bytes.
+ *
+ * To make it easier for the scanner and error messages, we pre-scan data
+ * for bytes in the class: [\x00-\x08\x0e-\x1f].  Compared to [\x00-\x1f],
+ * this class allows the following subset of whitespace characters:
+ *
+ *	\x09	Horizontal Tab (\t)
+ *	\x0a	Line Feed (\n)
+ *	\x0b	Vertical Tab (\v)
+ *	\x0c	Form Feed (\f)
+ *	\x0d	Carriage Return (\r)
+ *
+ *	NOTE: Along with \x20 (space) this represents the ASCII whitespace set.
+ *	      We avoid scanning for \x20 (space) by limiting our upper exclusion
+ *	      range to \x1f.
+ *
+ * While this subset of whitespace characters are strictly not allowed in
+ * JSON strings, we won't scan for them because it might be reasonable for
+ * those characters to used outside elements of JSON syntax:
+ *
+ * We scan data for bytes in the class: [\x00-\x08\x0e-\x1f].  When such
+ * bytes are detected, we increment the external variable and we will indicate to
+ * the caller that the JSON is invalid by returning true.
+ *
+ * We also keep track of newlines.  Not to exclude them, but to make it easy
+ * for this routine to reference line number and byte position in the line.
+ *
+ * When a byte in the class: [\x00-\x08\x0e-\x1f] is detected we consider
+ * issuing a warning message that indicates the line number, byte position in
+ * the line, and byte value.  To avoid printing a huge flood of warning messages
+ * (say should a large block of NUL (\x00) and SOM (\x01) bytes are
+ * encountered), we limit the number of NUL (\x00) byte warnings to the first
+ * MAX_NUL_BYTES_REPORTED, and limit the number of low ([\x01-\x08\x0e-\x1f]) byte
+ * warnings to the first MAX_LOW_BYTES_REPORTED.  Should we find more warnings that
+ * the limit, a one time "too many" warning is issues.
+ *
+ * given:
+ *
+ *	data	    - pointer to block of data to scan for NUL bytes
+ *	len	    - length of data in bytes
+ *	low_bytes   - pointer to set the number of low bytes found (that aren't NUL) in
+ *	nul_bytes   - pointer to set the number of NUL bytes found in
+ *
+ * return:
+ *	true ==> data == NULL OR len <= 0 OR one or more [\x00-\x08\x0e-\x1f]
+ *		 bytes are found OR low_bytes == NULL OR nul_bytes == NULL
+ *	false ==> data != NULL AND len > 0 AND no NUL [\x00-\x08\x0e-\x1f] bytes were found
+ */
+static bool
+low_byte_scan(char const *data, size_t len, size_t *low_bytes, size_t *nul_bytes)
+{
+    size_t linenum = 0;	    /* number of newline terminated lines we have processed */
+    size_t byte_pos = 0;    /* byte position within the current line number */
+    bool nul_limit = false;	/* true ==> found too many NUL (\x00) bytes to report all */
+    bool low_limit = false;	/* true ==> found too many low ([\x01-\x08\x0e-\x1f]) bytes to report all */
+    size_t i = 0;
+
+    /*
+     * firewall
+     */
+    if (data == NULL) {
+	werr(30, __func__, "data is NULL");
+	return true;
+    }
+    if (len <= 0) {
+	werr(31, __func__, "len: %zu <= 0 ", len);
+	return true;
+    }
+    if (low_bytes == NULL) {
+	werr(32, __func__, "low_bytes is NULL");
+	return true;
+    } else {
+	/* set *low_bytes to 0 */
+	*low_bytes = 0;
+    }
+    if (nul_bytes == NULL) {
+	werr(33, __func__, "nul_bytes is NULL"); /* nul_bytes is ironically NULL! :-) */
+	return true;
+    } else {
+	*nul_bytes = 0;
+    }
+
+    /*
+     * start with the first line number
+     */
+    ++linenum;
+
+    /*
+     * scan the data
+     */
+    for (i=0; i < len; ++i) {
+
+	/* count this byte within the line */
+	++byte_pos;
+
+	/*
+	 * process the current data byte
+	 */
+        switch (data[i]) {
+	case '\0':	/* NUL byte */
+
+	    /* count NUL byte */
+	    ++(*nul_bytes);
+
+	    /*
+	     * case below the report limit
+	     */
+	    if (*nul_bytes <= MAX_NUL_BYTES_REPORTED) {
+		werr(34, __func__, "invalid NUL (0) byte detected in line: %zu byte position: %zu",
+			 linenum, byte_pos);
+
+	    /*
+	     * case at or above the report limit
+	     */
+	    } else if (nul_limit == false) {
+		werr(35, __func__, "too many NUL ('\\0') bytes detected: "
+			 "additional NUL byte reports disabled");
+		nul_limit = true;	/* report reaching report limit only once */
+	    }
+	    break;
+
+	/*
+	 * For grins, we document some of the historical byte meanings :-)
+	 */
+	case '\x01':	/* SOH - Start of Heading */
+	case '\x02':	/* EOA - Start of Text */
+	case '\x03':	/* EOM - End of Text */
+	case '\x04':	/* EOT - End of Transmission */
+	case '\x05':	/* ENQ - Enquiry */
+	case '\x06':	/* ACK - Acknowledgement */
+	case '\x07':	/* BEL - Bell */
+	case '\x08':	/* BS - Backspace */
+	case '\x0e':	/* SO - Shift Out */
+	case '\x0f':	/* SI - Shift In */
+	case '\x10':	/* DCO / DLE - Data Link Escape */
+	case '\x11':	/* DC1 / XON - Device Control 1 */
+	case '\x12':	/* DC2 - Device Control 2 */
+	case '\x13':	/* DC3 / XOFF - Device Control 3 */
+	case '\x14':	/* DC4 - Device Control 4 */
+	case '\x15':	/* ERR / NAK - Negative Acknowledgement */
+	case '\x16':	/* SYNC / SYN - Synchronous Idle */
+	case '\x17':	/* LEM / ETB - End of Transmission Block */
+	case '\x18':	/* S0 / CAN - Cancel */
+	case '\x19':	/* S1 / EM - End of Medium */
+	case '\x1a':	/* S2 / SS / SUB - Substitute */
+	case '\x1b':	/* S3 / ESC - Escape */
+	case '\x1c':	/* S4 / FS - File Separator */
+	case '\x1d':	/* S5 / GS - Group Separator */
+	case '\x1e':	/* S6 / RS - Record Separator */
+	case '\x1f':	/* S7 / US - Unit Separator */
+
+	    /* count low ([\x01-\x08\x0e-\x1f]) byte */
+	    ++(*low_bytes);
+
+	    /*
+	     * case: below the report limit
+	     */
+	    if (*low_bytes <= MAX_LOW_BYTES_REPORTED) {
+		werr(36, __func__, "invalid LOW byte 0x%02x detected in line: %zu byte position: %zu",
+			 data[i], linenum, byte_pos);
+
+	    /*
+	     * case: at or above the report limit
+	     */
+	    } else if (low_limit == false) {
+		werr(37, __func__, "too many LOW bytes ([\\x01-\\x08\\x0e-\\x1f] detected: "
+		         "additional low byte reports disabled");
+		low_limit = true;	/* report reaching report limit only once */
+	    }
+	    break;
+
+	case '\n':	/* \x0a - LF - Line Feed / Newline */
+
+	    /* count newline */
+	    ++linenum;
+	    byte_pos = 0;	/* reset byte position */
+	    break;
+
+	default:	/* normal data byte */
+	    break;
+	}
+    }
+
+    /*
+     * return the NUL detection status
+     */
+    if (*nul_bytes > 0 || *low_bytes > 0) {
+	return true;
+    }
+    return false;
+}
+
+
+/*
+ * jparse_ctx_init - initialise a parser context
+ *
+ * given:
+ *
+ *	ctx	    - parser context to initialise
+ *
+ * The options are set to their defaults: the scanner and parser selected by
+ * json_scanner_backend and json_parser_backend, no nesting limit, and syntax
+ * errors written to stderr.  The flex scanner is not created until a parse
+ * needs it.
+ *
+ * NOTE: this function does not return on NULL ctx.
+ */
+void
+jparse_ctx_init(struct jparse_ctx *ctx)
+{
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(68, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->scanner_backend = json_scanner_backend;
+    ctx->parser_backend = json_parser_backend;
+    ctx->max_depth = JSON_INFINITE_DEPTH;
+    ctx->errs = NULL;
+    ctx->max_bytes = 0;
+    ctx->max_nodes = 0;
+    ctx->max_string = 0;
+    ctx->max_number = 0;
+    ctx->scanner = NULL;
+    ctx->bs = NULL;
+    ctx->stack = NULL;
+    ctx->stack_size = 0;
+}
+
+
+/*
+ * jparse_ctx_fini - free what a parser context holds
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_init()
+ *
+ * NOTE: the struct jparse_ctx itself is not freed.
+ */
+void
+jparse_ctx_fini(struct jparse_ctx *ctx)
+{
+    if (ctx == NULL) {
+	return;
+    }
+    if (ctx->scanner != NULL) {
+	if (ctx->bs != NULL) {
+	    yy_delete_buffer(ctx->bs, ctx->scanner);
+	    ctx->bs = NULL;
+	}
+	jparse_lex_destroy(ctx->scanner);
+	ctx->scanner = NULL;
+    }
+    json_scan_fini(&ctx->scan);
+    jparse_push_abort(ctx);
+    if (ctx->push.carry != NULL) {
+	free(ctx->push.carry);
+	ctx->push.carry = NULL;
+    }
+    ctx->push.carry_size = 0;
+    if (ctx->stack != NULL) {
+	free(ctx->stack);
+	ctx->stack = NULL;
+    }
+    ctx->stack_size = 0;
+}
+
+
+/*
+ * jparse_ctx_create - allocate and initialise a parser context
+ *
+ * returns:
+ *	pointer to a parser context to pass to parse_json_ctx() and later to
+ *	jparse_ctx_free()
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+struct jparse_ctx *
+jparse_ctx_create(void)
+{
+    struct jparse_ctx *ctx = NULL;
+
+    errno = 0;	/* pre-clear errno for errp() */
+    ctx = malloc(sizeof(*ctx));
+    if (ctx == NULL) {
+	errp(69, __func__, "malloc of struct jparse_ctx failed");
+	not_reached();
+    }
+    jparse_ctx_init(ctx);
+    return ctx;
+}
+
+
+/*
+ * jparse_ctx_free - free a parser context from jparse_ctx_create()
+ *
+ * given:
+ *
+ *	ctx	    - parser context to free, may be NULL
+ */
+void
+jparse_ctx_free(struct jparse_ctx *ctx)
+{
+    if (ctx == NULL) {
+	return;
+    }
+    jparse_ctx_fini(ctx);
+    free(ctx);
+}
+
+
+/*
+ * parse_json_buffer - parse a JSON document of a given length with a parser context
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	padded	    - true ==> ptr is writable and followed by JPARSE_PADDING NUL bytes
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * The structural index scanner always scans ptr in place.  The flex scanner
+ * does too if ptr is padded: yy_scan_buffer() needs two NUL bytes after the
+ * data and writes into the buffer as it goes, putting back what it changed
+ * before this function returns.  Otherwise yy_scan_bytes() scans a copy.
+ *
+ * The limits of the context (max_bytes, max_nodes, max_string, max_number and
+ * max_depth) are checked as the tokens are taken, so the parse stops before
+ * anything more is allocated for JSON that is too big: ctx->limit then says
+ * which limit was exceeded.
+ *
+ * NOTE: the reason this is in the scanner and not the parser is because
+ * YY_BUFFER_STATE is part of the scanner and not the parser.
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error; warning on errors is so that an entire
+ *       report of all the problems can be given at the end if the verbosity
+ *       level is high enough (or otherwise if this information is requested).
+ */
+static struct json *
+parse_json_buffer(struct jparse_ctx *ctx, char const *ptr, size_t len, bool padded, char const *filename,
+		  bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    int ret = 0;			/* jparse_parse() return value */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(70, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(38, __func__, "is_valid == NULL");
+	not_reached();
+    } else {
+	/*
+	 * assume the JSON block is is valid; set *is_valid to true so that the
+         * caller does not need to worry about it (well they should in case this
+         * is removed but we do it explicitly for them anyway).
+	 */
+	*is_valid = true;
+    }
+    ctx->nul_seen = false;
+    ctx->nodes = 0;
+    ctx->limit = JPARSE_LIMIT_NONE;
+
+    /*
+     * firewall
+     */
+    if (ptr == NULL) {
+	werr(39, __func__, "ptr is NULL");
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/*
+         * return a blank JSON tree
+         */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    if (filename == NULL) {
+        if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "filename is NULL, forcing it to be \"-\" for stdin");
+        }
+	filename = "-";	/* assume stdin */
+    }
+
+    /*
+     * refuse JSON longer than the context allows before scanning any of it
+     */
+    if (ctx->max_bytes != 0 && len > ctx->max_bytes) {
+	ctx->limit = JPARSE_LIMIT_BYTES;
+	jparse_limit_error(ctx, filename, NULL);
+	*is_valid = false;
+
+	/*
+	 * return a blank JSON tree
+	 */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * the hand-written parser needs neither the flex scanner nor bison
+     */
+    if (ctx->parser_backend == JSON_PARSER_FAST) {
+	return parse_json_fast_ctx(ctx, ptr, len, filename, is_valid);
+    }
+
+    /*
+     * initialise the scanner the first time this context needs it
+     */
+    if (ctx->scanner == NULL) {
+	errno = 0;
+	ret = jparse_lex_init_extra(&ctx->extra, &ctx->scanner);
+	if (ret != 0) {
+	    werrp(40, __func__, "jparse_lex_init_extra failed");
+	    ctx->scanner = NULL;
+
+	    /*
+	     * if jparse_lex_init_extra() reports an error (!= 0) then *is_valid
+	     * must be set to false and we must return NULL
+	     */
+	    *is_valid = false;
+	    return NULL;
+	}
+    }
+    ctx->extra.filename = filename;
+    ctx->extra.scan = NULL;
+    ctx->extra.ctx = ctx;
+    ctx->depth = 0;
+
+    /*
+     * the structural index scanner scans the blob in place: jparse_parse()
+     * will take its tokens from it instead of from jparse_lex()
+     */
+    if (ctx->scanner_backend == JSON_SCANNER_INDEX) {
+	json_scan_init(&ctx->scan, ptr, len);
+	ctx->extra.scan = &ctx->scan;
+    }
+
+    /*
+     * scan the blob: in place if it is followed by the padding flex needs,
+     * otherwise from a copy made by yy_scan_bytes()
+     */
+    if (ctx->extra.scan == NULL) {
+	if (padded) {
+	    ctx->bs = yy_scan_buffer((char *)ptr, len + JPARSE_PADDING, ctx->scanner);
+	} else {
+	    ctx->bs = yy_scan_bytes(ptr, (int)len, ctx->scanner);
+	}
+	if (ctx->bs == NULL) {
+	    /*
+	     * if unable to scan the bytes it indicates an internal error and
+	     * perhaps it should call err() instead but for now we make it a
+	     * non-fatal error as well.
+	     */
+	    werr(41, __func__, "unable to scan string");
+
+	    /*
+	     * since we cannot scan the bytes, we set *is_valid to false, even
+	     * though it could very well be valid if it could be scanned.
+	     */
+	    *is_valid = false;
+
+	    /*
+	     * return a blank JSON tree
+	     */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+	}
+
+	/*
+	 * we cannot set the column (and probably line number) without first
+	 * having a buffer which is why the yy_scan_buffer() or yy_scan_bytes() is called first
+	 * (see above).
+	 *
+	 * For why we set the column to 0 but the line to 1 see the comments
+	 * with the YY_USER_ACTION macro.
+	 */
+	jparse_set_column(0, ctx->scanner);
+	jparse_set_lineno(1, ctx->scanner);
+    }
+
+    /*
+     * announce beginning of parse, if JSON debug level is high enough
+     */
+    if (json_dbg_allowed(JSON_DBG_VVHIGH)) {
+	fprstr(stderr, "*** BEGIN PARSE\n");
+	fprstr(stderr, "<\n");
+	(void) fprint_line_buf(stderr, ptr, len, 0, 0);
+	fprstr(stderr, "\n>\n");
+    }
+
+    /*
+     * parse the blob, passing into the parser the node and scanner
+     */
+    ret = jparse_parse(&tree, ctx->scanner);
+
+    /*
+     * free memory associated with bytes scanned by yy_scan_bytes() or with
+     * the structural index scanner
+     */
+    if (ctx->extra.scan != NULL) {
+	ctx->nul_seen = ctx->scan.nul;
+	json_scan_free(&ctx->scan);
+	ctx->extra.scan = NULL;
+    } else {
+	/*
+	 * flex puts a NUL after the current token and keeps the byte it
+	 * replaced in yy_hold_char: when scanning in place put that byte back
+	 */
+	if (padded) {
+	    struct yyguts_t *yyg = (struct yyguts_t *)ctx->scanner;
+
+	    if (yyg->yy_c_buf_p != NULL) {
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+	    }
+	}
+	yy_delete_buffer(ctx->bs, ctx->scanner);
+	ctx->bs = NULL;
+    }
+
+    /*
+     * announce end of parse, if JSON debug level is high enough
+     */
+    if (json_dbg_allowed(JSON_DBG_VVHIGH)) {
+	fprstr(stderr, "*** END PARSE\n");
+    }
+
+    /*
+     * report scanner / parser success or failure, if JSON debug level is high
+     * enough
+     */
+    if (json_dbg_allowed(JSON_DBG_VVHIGH)) {
+	json_dbg(JSON_DBG_VVHIGH, __func__, "jparse_parse() returned: %d", ret);
+    }
+
+    if (ret == 0) {
+        /*
+         * we will only report valid JSON (whatever that means :-) ) in debug
+         * message if JSON debug level is high enough (where high is low :-)
+         */
+        if (json_dbg_allowed(JSON_DBG_LOW)) {
+	    json_dbg(JSON_DBG_LOW, __func__, "valid JSON");
+        }
+        /*
+         * flag that we have valid JSON, even though we assumed it will be
+         */
+	*is_valid = true;
+    } else {
+        /*
+         * we will only report invalid JSON in debug message if JSON debug level
+         * is high enough (where high is low :-)
+         */
+        if (json_dbg_allowed(JSON_DBG_LOW)) {
+	    json_dbg(JSON_DBG_LOW, __func__, "invalid JSON");
+        }
+
+        /*
+         * whereas if it's valid JSON it is redundant to set *is_valid, here we
+         * must set *is_valid to false as we always assume at first that it will
+         * be valid JSON (whatever that means :-) )
+         */
+	*is_valid = false;
+    }
+
+    /*
+     * return parse tree
+     */
+    return tree;
+}
+
+/*
+ * parse_json_ctx - parse a JSON document of a given length with a parser context
+ *
+ * Given a pointer to char and a length, use the parser to determine if the JSON
+ * is valid or not.
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * The context keeps the flex scanner from one call to the next so that
+ * parsing many documents does not set it up and tear it down each time.  A
+ * context must not be used by more than one thread at a time.
+ *
+ * The data is not modified.  The flex scanner backend scans a copy of it: to
+ * avoid the copy use parse_json_inplace_ctx().
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error; warning on errors is so that an entire
+ *       report of all the problems can be given at the end if the verbosity
+ *       level is high enough (or otherwise if this information is requested).
+ */
+struct json *
+parse_json_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    return parse_json_buffer(ctx, ptr, len, false, filename, is_valid);
+}
+
+
+/*
+ * parse_json_inplace_ctx - parse a padded JSON document in place with a parser context
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob followed by JPARSE_PADDING NUL bytes
+ *	len	    - length of the JSON blob, not counting the padding
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_ctx() without the copy the flex scanner backend would
+ * otherwise make: ptr[len] through ptr[len+JPARSE_PADDING-1] must be NUL and the
+ * data must be writable.  The scanner changes bytes of the data while parsing
+ * and puts them back before returning.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error.
+ */
+struct json *
+parse_json_inplace_ctx(struct jparse_ctx *ctx, char *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(74, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(75, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    if (ptr != NULL) {
+	for (i = 0; i < JPARSE_PADDING; ++i) {
+	    if (ptr[len + i] != '\0') {
+		werr(76, __func__, "ptr[len+%zu] is not NUL: data is not padded", i);
+
+		/*
+		 * flag that we have invalid JSON
+		 */
+		*is_valid = false;
+
+		/*
+		 * return a blank JSON tree
+		 */
+		tree = json_alloc(JTYPE_UNSET);
+		return tree;
+	    }
+	}
+    }
+
+    return parse_json_buffer(ctx, ptr, len, true, filename, is_valid);
+}
+
+
+/*
+ * parse_json - parse a JSON document of a given length
+ *
+ * Given a pointer to char and a length, use the parser to determine if the JSON
+ * is valid or not.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_ctx() with a context that lasts for just this call.  To
+ * parse many documents, or to set options, use a context of your own.
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: this function only warns on error, except for NULL is_valid, in which
+ *       case it is an error; warning on errors is so that an entire report of
+ *       all the problems can be given at the end if the verbosity level is high
+ *       enough (or otherwise if this information is requested).
+ */
+struct json *
+parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_inplace - parse a padded JSON document in place
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob followed by JPARSE_PADDING NUL bytes
+ *	len	    - length of the JSON blob, not counting the padding
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_inplace_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_inplace(char *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_inplace_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * read_limited - read a stream, but no more than one byte past a limit
+ *
+ * given:
+ *	stream	    open stream to read
+ *	max_bytes   the most bytes the caller wants
+ *	psize	    where to store the number of bytes read
+ *
+ * returns:
+ *	allocated data, NUL terminated, or NULL on a read error
+ *
+ * When the stream holds more than max_bytes, max_bytes + 1 bytes are
+ * returned so that the caller can tell without the rest being read.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static char *
+read_limited(FILE *stream, size_t max_bytes, size_t *psize)
+{
+    char *data = NULL;		/* data read */
+    size_t size = 0;		/* allocated size of data */
+    size_t len = 0;		/* bytes read so far */
+    size_t want = 0;		/* bytes to read next */
+    size_t got = 0;		/* bytes fread() read */
+
+    *psize = 0;
+    do {
+	if (len + 1 >= size) {
+	    size = (size > 0) ? size * 2 : BUFSIZ;
+	    if (max_bytes < SIZE_MAX - 2 && size > max_bytes + 2) {
+		size = max_bytes + 2;
+	    }
+	    errno = 0;	/* pre-clear errno for errp() */
+	    data = realloc(data, size);
+	    if (data == NULL) {
+		errp(77, __func__, "realloc of %ju bytes failed", (uintmax_t)size);
+		not_reached();
+	    }
+	}
+	want = size - 1 - len;
+	got = fread(data + len, 1, want, stream);
+	len += got;
+    } while (got == want && len <= max_bytes);
+    if (ferror(stream)) {
+	free(data);
+	return NULL;
+    }
+    data[len] = '\0';
+    *psize = len;
+    return data;
+}
+
+
+/*
+ * parse_json_stream_ctx - parse an open file stream for JSON data with a parser context
+ *
+ * Given an open file stream, we will read in all data (until EOF) and
+ * then parse that data as if it were JSON.
+ *
+ * A regular file is mapped with map_all() rather than read, and the mapping is
+ * parsed in place, so the data is neither copied into a read buffer nor, when
+ * the file leaves room for JPARSE_PADDING bytes in its last page, copied again
+ * for the flex scanner.  Anything else (a pipe, a terminal, ...) is read with
+ * read_all() and then parsed.
+ *
+ * The data must not have bytes in the range [\x00-\x08\x0e-\x1f].  Both
+ * scanners reject all of them except for a NUL in a string, which they
+ * note in the context, so low_byte_scan() only needs to look at the data
+ * (and report what it finds) if the parse failed or found a NUL byte.
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	stream      - open file stream containing JSON data
+ *	filename    - name of file or NULL for stdin
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * If stream is NULL or stream is not open, or if read_all() fails, or if the
+ * data has low bytes, then this function warns and sets *is_valid to false.
+ *
+ * NOTE: the reason this is in the scanner and not the parser is because
+ *	 YY_BUFFER_STATE is part of the scanner and not the parser and that's required
+ *	 for the parse_json_block() function.
+ *
+ * NOTE: if filename is "-" and stream is NULL, then the stream is set to stdin,
+ * as if the filename was NULL.
+ *
+ * NOTE: this function only warns on error, except for NULL is_valid, in which
+ *       case it is an error; warning on errors is so that an entire report of
+ *       all the problems can be given at the end if the verbosity level is high
+ *       enough (or otherwise if this information is requested).
+ */
+struct json *
+parse_json_stream_ctx(struct jparse_ctx *ctx, FILE *stream, char const *filename, bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    char *data = NULL;			/* data mapped or read from the stream */
+    size_t len = 0;			/* length of data read */
+    size_t pad = 0;			/* NUL bytes after mapped data */
+    bool mapped = false;		/* true ==> data is from map_all(), false ==> from read_all() */
+    bool low_byte_detected = false;	/* true ==> byte values [\x00-\x08\x0e-\x1f] detected in data */
+    size_t nul_bytes = 0;		/* number of NUL bytes found */
+    size_t low_bytes = 0;		/* number of low bytes that are not NUL found */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(72, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(42, __func__, "is_valid == NULL");
+	not_reached();
+    } else {
+	/*
+	 * assume the JSON stream is is valid JSON; set *is_valid to true so
+         * that the caller does not need to worry about it (well they should in
+         * case this is removed but we do it explicitly for them anyway).
+	 */
+	*is_valid = true;
+    }
+
+    if (filename == NULL) {
+	json_dbg(JSON_DBG_HIGH, __func__, "filename is NULL, forcing it to be \"-\" for stdin");
+	filename = "-";
+	stream = stdin;
+    } else if (!strcmp(filename, "-") && stream == NULL) {
+	stream = stdin;
+    }
+
+    if (stream == NULL) {
+
+	/*
+         * report NULL stream
+         */
+	werr(43, __func__, "stream is NULL");
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/*
+         * return a blank JSON tree
+         */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * if stream is not stdin check if the stream is open
+     */
+    if (stream != stdin && fd_is_ready(__func__, false, fileno(stream)) == false) {
+
+	/*
+         * report closed stream
+         */
+	werr(44, __func__, "stream is not open");
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/*
+         * return a blank JSON tree
+         */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * map the entire file into memory if we can, else read it
+     */
+    data = map_all(stream, &len, &pad);
+    if (data != NULL) {
+	mapped = true;
+    } else if (ctx->max_bytes != 0) {
+	data = read_limited(stream, ctx->max_bytes, &len);
+    } else {
+	data = read_all(stream, &len);
+    }
+    if (data == NULL) {
+
+	/*
+         * warn about read error
+         */
+	werr(45, __func__, "could not read read stream");
+        /*
+         * we need to clearerr() or fclose(), depending on the stream.
+         */
+	clearerr_or_fclose(stream);
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/* return a blank JSON tree */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * if JSON debug level is high enough we will log the call with the length
+     */
+    if (json_dbg_allowed(JSON_DBG_HIGH)) {
+        json_dbg(JSON_DBG_HIGH, __func__, "calling parse_json_buffer on %s data block with length %ju:",
+				       mapped ? "mapped" : "read", (uintmax_t)len);
+    }
+
+    /*
+     * JSON parse the data from the file
+     */
+    tree = parse_json_buffer(ctx, data, len, mapped && pad >= JPARSE_PADDING, filename, is_valid);
+
+    /*
+     * scan data for byte values in range of [\x00-\x08\x0e-\x1f] if the
+     * scanners could not rule them out
+     */
+    if (!*is_valid || ctx->nul_seen) {
+	low_byte_detected = low_byte_scan(data, len, &low_bytes, &nul_bytes);
+	if (low_byte_detected || low_bytes > 0 || nul_bytes > 0) {
+
+	    /*
+	     * report invalid bytes
+	     */
+	    if (low_bytes > 0 && nul_bytes > 0) {
+		werr(46, __func__, "%ju low byte%s and %ju NUL byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)low_bytes, low_bytes > 1 ? "s":"",
+			(uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
+	    } else if (low_bytes > 0) {
+		werr(47, __func__, "%ju low byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)low_bytes, low_bytes > 1 ? "s":"");
+	    } else if (nul_bytes > 0) {
+		werr(48, __func__, "%ju NUL byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
+	    }
+
+	    /*
+	     * flag that we have invalid JSON
+	     */
+	    *is_valid = false;
+
+	    /*
+	     * replace any parse tree with a blank JSON tree
+	     */
+	    if (tree != NULL) {
+		json_tree_release(tree);
+	    }
+	    tree = json_alloc(JTYPE_UNSET);
+	}
+    }
+
+    /* unmap or free data */
+    if (mapped) {
+	unmap_all(data, len);
+	data = NULL;
+    } else if (data != NULL) {
+	free(data);
+	data = NULL;
+    }
+
+    /*
+     * clear error or close stream, depending on stream
+     */
+    clearerr_or_fclose(stream);
+    stream = NULL;
+
+    /*
+     * return the JSON parse tree tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_stream - parse an open file stream for JSON data
+ *
+ * given:
+ *	stream      - open file stream containing JSON data
+ *	filename    - name of file or NULL for stdin
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_stream_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_stream_ctx(&ctx, stream, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return the JSON parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_file_ctx - parses file file with a parser context
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	name	    - filename of file to parse
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * If name is NULL or the name is not a readable file (or is empty) or if
+ * read_all() fails, then this function warns and sets *is_valid to false.
+ *
+ * NOTE: The reason this is in the scanner and not the parser is because
+ *	 YY_BUFFER_STATE is part of the scanner and not the parser and that's required
+ *	 for the parse_json_block() function.
+ *
+ * NOTE: This function only warns on error. It does this via the called function
+ *	 parse_json(). This is done so that an entire report of all the problems can
+ *	 be given at the end if the verbosity level is high enough (or otherwise if
+ *	 this information is requested).
+ */
+struct json *
+parse_json_file_ctx(struct jparse_ctx *ctx, char const *name, bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    FILE *stream = NULL;		/* file stream to read from */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(73, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(49, __func__, "is_valid == NULL");
+	not_reached();
+    } else {
+	/*
+	 * assume the JSON file is is valid JSON; set *is_valid to true so
+         * that the caller does not need to worry about it (well they should in
+         * case this is removed but we do it explicitly for them anyway).
+	 */
+	*is_valid = true;
+    }
+    if (name == NULL) {
+	werr(50, __func__, "passed NULL name");
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/*
+         * return a blank JSON tree
+         */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+    if (*name == '\0') { /* strlen(name) == 0 */
+
+	/*
+         * warn about bogus name
+         */
+	werr(51, __func__, "passed empty filename");
+
+	/*
+         * flag that we have invalid JSON
+         */
+	*is_valid = false;
+
+	/*
+         * return a blank JSON tree
+         */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
+    }
+
+    /*
+     * if file is "-", then we will parse stdin
+     */
+    if (strcmp(name, "-") == 0) {
+	stream = stdin;
+
+    /*
+     * case: will read from a file
+     */
+    } else {
+
+	/*
+	 * validate filename
+	 */
+	if (!exists(name)) {
+	    /*
+             * report missing file
+             */
+	    werr(52, __func__, "passed filename that's not actually a file: %s", name);
+
+	    /*
+             * flag that we have invalid JSON
+             */
+	    *is_valid = false;
+
+	    /*
+             * return a blank JSON tree
+             */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+
+	}
+	if (!is_file(name)) {
+	    /*
+             * report that file is not a normal file
+             */
+	    werr(53, __func__, "passed filename not a normal file: %s", name);
+
+	    /*
+             * report invalid JSON
+             */
+	    *is_valid = false;
+
+	    /*
+             * return a blank JSON tree
+             */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+	}
+	if (!is_read(name)) {
+	    /*
+             * report unreadable file
+             */
+	    werr(54, __func__, "passed filename not a readable file: %s", name);
+
+	    /*
+             * flag that we have invalid JSON
+             */
+	    *is_valid = false;
+
+	    /*
+             * return a blank JSON tree
+             */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+	}
+
+	/*
+	 * open file for scanner to use
+	 */
+	errno = 0;
+	stream = fopen(name, "r");
+	if (stream == NULL) {
+
+	    /*
+             * warn about file open error
+             */
+	    werrp(55, __func__, "couldn't open file %s, ignoring", name);
+
+	    /*
+             * flag that we have invalid JSON
+             */
+	    *is_valid = false;
+
+	    /*
+             * return a blank JSON tree
+             */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+	}
+    }
+
+    /*
+     * JSON parse the open stream
+     */
+    tree = parse_json_stream_ctx(ctx, stream, name, is_valid);
+
+    /*
+     * return the JSON parse tree tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_file	    - parses file file
+ *
+ * given:
+ *	name	    - filename of file to parse
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_file_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_file(char const *name, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_file_ctx(&ctx, name, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return the JSON parse tree
+     */
+    return tree;
+}
@@ -63,6 +63,7 @@
 #if !defined(MAX_LOW_BYTES_REPORTED)
 #define MAX_LOW_BYTES_REPORTED (5)	/* do not report more than the first MAX_LOW_BYTES_REPORTED bytes [\x01-\x08\x0e-\x1f] */
 #endif
+#define JPARSE_PADDING (2)		/* NUL bytes that must follow the data given to parse_json_inplace() */
 
 /*
  * jparse.tab.h - generated by bison
@@ -74,6 +75,36 @@
 #include "jparse.tab.h"
 #endif
 
+/*
+ * json_scan - JSON structural index scanner
+ */
+#include "json_scan.h"
+
+/*
+ * json_fast - JSON parser without the bison tables
+ */
+#include "json_fast.h"
+
+/*
+ * json_seq - parse a stream of JSON texts one record at a time
+ */
+#include "json_seq.h"
+
+/*
+ * json_validate - check JSON without building a parse tree
+ */
+#include "json_validate.h"
+
+/*
+ * json_doc - JSON document read on demand from a flat tape
+ */
+#include "json_doc.h"
+
+/*
+ * json_write - write JSON parse trees as JSON text
+ */
+#include "json_write.h"
+
 
 /*
  * globals
@@ -87,6 +118,59 @@ extern int jparse_debug;
 struct json_extra
 {
     char const *filename;	/* filename being parsed ("-" means stdin) */
+    struct json_scan *scan;	/* != NULL ==> tokens come from the structural index, not jparse_lex() */
+    struct jparse_ctx *ctx;	/* parser context that owns the scanner */
+};
+
+/*
+ * which limit of a struct jparse_ctx stopped a parse
+ */
+enum jparse_limit
+{
+    JPARSE_LIMIT_NONE = 0,	/* no limit was exceeded (must be 0) */
+    JPARSE_LIMIT_BYTES,		/* the JSON is longer than max_bytes */
+    JPARSE_LIMIT_NODES,		/* the JSON has more than max_nodes values */
+    JPARSE_LIMIT_DEPTH,		/* objects and arrays nest deeper than max_depth */
+    JPARSE_LIMIT_STRING,	/* a string or member name is longer than max_string */
+    JPARSE_LIMIT_NUMBER,	/* a number is longer than max_number */
+};
+
+/*
+ * struct jparse_ctx - reusable parser context
+ *
+ * A context holds the options of a parse and everything that the scanner and
+ * parser keep between tokens: the flex scanner (created on first use and then
+ * kept), its buffer, the structural index scanner and the parse_json_fast()
+ * stack.  Nothing is shared between contexts, so threads may parse at the same
+ * time as long as each one uses its own context.
+ *
+ * Use jparse_ctx_create() / jparse_ctx_free() for a context on the heap or
+ * jparse_ctx_init() / jparse_ctx_fini() for one embedded in something else.
+ */
+struct jparse_ctx
+{
+    /* options: jparse_ctx_init() sets the defaults */
+    enum json_scanner scanner_backend;	/* scanner for the bison parser (def: json_scanner_backend) */
+    enum json_parser parser_backend;	/* parser to use (def: json_parser_backend) */
+    unsigned int max_depth;		/* most nested objects and arrays, JSON_INFINITE_DEPTH ==> no limit */
+    FILE *errs;				/* stream for syntax error messages, NULL ==> stderr */
+    size_t max_bytes;			/* longest JSON to parse in bytes, 0 ==> no limit */
+    uintmax_t max_nodes;		/* most values (objects, arrays, names, strings, ...), 0 ==> no limit */
+    size_t max_string;			/* longest string or member name in bytes, 0 ==> no limit */
+    size_t max_number;			/* longest number in bytes, 0 ==> no limit */
+
+    /* state kept between parses */
+    yyscan_t scanner;			/* flex scanner or NULL if not yet needed */
+    struct yy_buffer_state *bs;		/* flex buffer of the parse in progress or NULL */
+    struct json_extra extra;		/* flex scanner extra data */
+    struct json_scan scan;		/* structural index scanner */
+    struct json_fast_frame *stack;	/* parse_json_fast() stack of open objects and arrays */
+    size_t stack_size;			/* number of frames allocated in stack */
+    struct json_push push;		/* jparse_push_feed() state */
+    unsigned int depth;			/* current nesting depth seen by the bison parser */
+    bool nul_seen;			/* true ==> the last parse found a NUL byte in a string */
+    uintmax_t nodes;			/* values counted so far against max_nodes */
+    enum jparse_limit limit;		/* limit that stopped the last parse or JPARSE_LIMIT_NONE */
 };
 
 /*
@@ -98,12 +182,26 @@ extern int jparse_lex(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yy
  * function prototypes for jparse.y
  */
 extern void jparse_error(JPARSE_LTYPE *yyltype, struct json **tree, yyscan_t scanner, char const *format, ...);
+extern void jparse_depth_error(FILE *errs, unsigned int max_depth, JPARSE_LTYPE const *loc, char const *text);
+extern bool jparse_limit_token(struct jparse_ctx *ctx, int tok, size_t leng);
+extern void jparse_limit_error(struct jparse_ctx const *ctx, char const *filename, JPARSE_LTYPE const *loc);
 
 /*
  * function prototypes for jparse.l
  */
+extern void jparse_ctx_init(struct jparse_ctx *ctx);
+extern void jparse_ctx_fini(struct jparse_ctx *ctx);
+extern struct jparse_ctx *jparse_ctx_create(void);
+extern void jparse_ctx_free(struct jparse_ctx *ctx);
+extern struct json *parse_json_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename,
+				   bool *is_valid);
 extern struct json *parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid);
+extern struct json *parse_json_inplace_ctx(struct jparse_ctx *ctx, char *ptr, size_t len, char const *filename,
+					   bool *is_valid);
+extern struct json *parse_json_inplace(char *ptr, size_t len, char const *filename, bool *is_valid);
+extern struct json *parse_json_stream_ctx(struct jparse_ctx *ctx, FILE *stream, char const *filename, bool *is_valid);
 extern struct json *parse_json_stream(FILE *stream, char const *filename, bool *is_valid);
+extern struct json *parse_json_file_ctx(struct jparse_ctx *ctx, char const *name, bool *is_valid);
 extern struct json *parse_json_file(char const *name, bool *is_valid);
 
 
@@ -824,7 +824,6 @@ static const flex_int32_t yy_rule_can_match_eol[16] =
 #include "jparse.h"
 
 extern int jparse_lex(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
-static YY_BUFFER_STATE bs;
 
 /*
  * locations in the file / json block
@@ -872,7 +871,7 @@ static YY_BUFFER_STATE bs;
 				} \
 			    } \
 			}
-#line 824 "jparse.c"
+#line 823 "jparse.c"
 /*
  * Section 1: Patterns (regular expressions) and actions.
  */
@@ -942,7 +941,7 @@ static YY_BUFFER_STATE bs;
  * JSON_COMMA		","
  */
 /* Actions. */
-#line 894 "jparse.c"
+#line 893 "jparse.c"
 
 #define INITIAL 0
 
@@ -1222,9 +1221,9 @@ YY_DECL
 		}
 
 	{
-#line 211 "./jparse.l"
+#line 210 "./jparse.l"
 
-#line 1176 "jparse.c"
+#line 1175 "jparse.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1295,7 +1294,7 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 212 "./jparse.l"
+#line 211 "./jparse.l"
 {
 			    /*
 			     * Whitespace excluding newlines
@@ -1317,7 +1316,7 @@ YY_RULE_SETUP
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 230 "./jparse.l"
+#line 229 "./jparse.l"
 {
                             /*
                              * on newline (JSON_NL) we need to reset the column
@@ -1328,7 +1327,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 238 "./jparse.l"
+#line 237 "./jparse.l"
 {
 			    /*
                              * string (JSON_STRING)
@@ -1338,7 +1337,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 245 "./jparse.l"
+#line 244 "./jparse.l"
 {
 			    /*
                              * number (JSON_NUMBER)
@@ -1348,7 +1347,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 252 "./jparse.l"
+#line 251 "./jparse.l"
 {
 			    /*
                              * null object (JSON_NULL)
@@ -1358,7 +1357,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 259 "./jparse.l"
+#line 258 "./jparse.l"
 {
 			    /*
                              * true (JSON_TRUE)
@@ -1368,7 +1367,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 265 "./jparse.l"
+#line 264 "./jparse.l"
 {
 			    /*
                              * false (JSON_FALSE)
@@ -1381,7 +1380,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 275 "./jparse.l"
+#line 274 "./jparse.l"
 {
 			    /*
                              * start of object - open brace i.e. "{" (JSON_OPEN_BRACE)
@@ -1391,7 +1390,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 281 "./jparse.l"
+#line 280 "./jparse.l"
 {
 			    /*
                              * end of object - close brace i.e. "}" (JSON_CLOSE_BRACE)
@@ -1401,7 +1400,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 288 "./jparse.l"
+#line 287 "./jparse.l"
 {
 			    /*
                              * start of array - open bracket i.e. "[" (JSON_OPEN_BRACKET)
@@ -1411,7 +1410,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 294 "./jparse.l"
+#line 293 "./jparse.l"
 {
 			    /*
                              * end of array - close bracket i.e. "]" (JSON_CLOSE_BRACKET)
@@ -1421,7 +1420,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 301 "./jparse.l"
+#line 300 "./jparse.l"
 {
 			    /*
                              * colon or 'equals' (JSON_COLON)
@@ -1431,7 +1430,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 308 "./jparse.l"
+#line 307 "./jparse.l"
 {
 			    /*
                              * comma: name/value pair separator (JSON_COMMA)
@@ -1441,7 +1440,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 315 "./jparse.l"
+#line 314 "./jparse.l"
 {
 			    /*
                              * invalid token: any other character (regexp ".")
@@ -1480,10 +1479,10 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 351 "./jparse.l"
+#line 350 "./jparse.l"
 YY_FATAL_ERROR( "flex scanner jammed" );
 	YY_BREAK
-#line 1435 "jparse.c"
+#line 1434 "jparse.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2645,7 +2644,7 @@ void yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 351 "./jparse.l"
+#line 350 "./jparse.l"
 
 
 /* Section 2: Code that's copied to the generated scanner */
@@ -2866,42 +2865,176 @@ low_byte_scan(char const *data, size_t len, size_t *low_bytes, size_t *nul_bytes
 
 
 /*
- * parse_json - parse a JSON document of a given length
+ * jparse_ctx_init - initialise a parser context
  *
- * Given a pointer to char and a length, use the parser to determine if the JSON
- * is valid or not.
+ * given:
+ *
+ *	ctx	    - parser context to initialise
+ *
+ * The options are set to their defaults: the scanner and parser selected by
+ * json_scanner_backend and json_parser_backend, no nesting limit, and syntax
+ * errors written to stderr.  The flex scanner is not created until a parse
+ * needs it.
+ *
+ * NOTE: this function does not return on NULL ctx.
+ */
+void
+jparse_ctx_init(struct jparse_ctx *ctx)
+{
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(68, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->scanner_backend = json_scanner_backend;
+    ctx->parser_backend = json_parser_backend;
+    ctx->max_depth = JSON_INFINITE_DEPTH;
+    ctx->errs = NULL;
+    ctx->max_bytes = 0;
+    ctx->max_nodes = 0;
+    ctx->max_string = 0;
+    ctx->max_number = 0;
+    ctx->scanner = NULL;
+    ctx->bs = NULL;
+    ctx->stack = NULL;
+    ctx->stack_size = 0;
+}
+
+
+/*
+ * jparse_ctx_fini - free what a parser context holds
  *
  * given:
  *
+ *	ctx	    - parser context from jparse_ctx_init()
+ *
+ * NOTE: the struct jparse_ctx itself is not freed.
+ */
+void
+jparse_ctx_fini(struct jparse_ctx *ctx)
+{
+    if (ctx == NULL) {
+	return;
+    }
+    if (ctx->scanner != NULL) {
+	if (ctx->bs != NULL) {
+	    yy_delete_buffer(ctx->bs, ctx->scanner);
+	    ctx->bs = NULL;
+	}
+	jparse_lex_destroy(ctx->scanner);
+	ctx->scanner = NULL;
+    }
+    json_scan_fini(&ctx->scan);
+    jparse_push_abort(ctx);
+    if (ctx->push.carry != NULL) {
+	free(ctx->push.carry);
+	ctx->push.carry = NULL;
+    }
+    ctx->push.carry_size = 0;
+    if (ctx->stack != NULL) {
+	free(ctx->stack);
+	ctx->stack = NULL;
+    }
+    ctx->stack_size = 0;
+}
+
+
+/*
+ * jparse_ctx_create - allocate and initialise a parser context
+ *
+ * returns:
+ *	pointer to a parser context to pass to parse_json_ctx() and later to
+ *	jparse_ctx_free()
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+struct jparse_ctx *
+jparse_ctx_create(void)
+{
+    struct jparse_ctx *ctx = NULL;
+
+    errno = 0;	/* pre-clear errno for errp() */
+    ctx = malloc(sizeof(*ctx));
+    if (ctx == NULL) {
+	errp(69, __func__, "malloc of struct jparse_ctx failed");
+	not_reached();
+    }
+    jparse_ctx_init(ctx);
+    return ctx;
+}
+
+
+/*
+ * jparse_ctx_free - free a parser context from jparse_ctx_create()
+ *
+ * given:
+ *
+ *	ctx	    - parser context to free, may be NULL
+ */
+void
+jparse_ctx_free(struct jparse_ctx *ctx)
+{
+    if (ctx == NULL) {
+	return;
+    }
+    jparse_ctx_fini(ctx);
+    free(ctx);
+}
+
+
+/*
+ * parse_json_buffer - parse a JSON document of a given length with a parser context
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
  *	ptr	    - pointer to start of JSON blob
  *	len	    - length of the JSON blob
+ *	padded	    - true ==> ptr is writable and followed by JPARSE_PADDING NUL bytes
  *	filename    - filename or NULL for stdin
  *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
  *
  * return:
  *	pointer to a JSON parse tree
  *
+ * The structural index scanner always scans ptr in place.  The flex scanner
+ * does too if ptr is padded: yy_scan_buffer() needs two NUL bytes after the
+ * data and writes into the buffer as it goes, putting back what it changed
+ * before this function returns.  Otherwise yy_scan_bytes() scans a copy.
+ *
+ * The limits of the context (max_bytes, max_nodes, max_string, max_number and
+ * max_depth) are checked as the tokens are taken, so the parse stops before
+ * anything more is allocated for JSON that is too big: ctx->limit then says
+ * which limit was exceeded.
+ *
  * NOTE: the reason this is in the scanner and not the parser is because
  * YY_BUFFER_STATE is part of the scanner and not the parser.
  *
  * NOTE: if filename is NULL we set it to "-" for stdin.
  *
- * NOTE: this function only warns on error, except for NULL is_valid, in which
- *       case it is an error; warning on errors is so that an entire report of
- *       all the problems can be given at the end if the verbosity level is high
- *       enough (or otherwise if this information is requested).
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error; warning on errors is so that an entire
+ *       report of all the problems can be given at the end if the verbosity
+ *       level is high enough (or otherwise if this information is requested).
  */
-struct json *
-parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
+static struct json *
+parse_json_buffer(struct jparse_ctx *ctx, char const *ptr, size_t len, bool padded, char const *filename,
+		  bool *is_valid)
 {
     struct json *tree = NULL;		/* the JSON parse tree */
     int ret = 0;			/* jparse_parse() return value */
-    yyscan_t scanner;			/* scanner instance: is a void * */
-    struct json_extra extra;
 
     /*
      * firewall
      */
+    if (ctx == NULL) {
+	err(70, __func__, "ctx is NULL");
+	not_reached();
+    }
     if (is_valid == NULL) {
 	err(38, __func__, "is_valid == NULL");
 	not_reached();
@@ -2913,6 +3046,9 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
 	 */
 	*is_valid = true;
     }
+    ctx->nul_seen = false;
+    ctx->nodes = 0;
+    ctx->limit = JPARSE_LIMIT_NONE;
 
     /*
      * firewall
@@ -2940,57 +3076,101 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
     }
 
     /*
-     * initialise scanner
+     * refuse JSON longer than the context allows before scanning any of it
      */
-    errno = 0;
-    ret = jparse_lex_init_extra(&extra, &scanner);
-    if (ret != 0) {
-	werrp(40, __func__, "jparse_lex_init_extra failed");
+    if (ctx->max_bytes != 0 && len > ctx->max_bytes) {
+	ctx->limit = JPARSE_LIMIT_BYTES;
+	jparse_limit_error(ctx, filename, NULL);
+	*is_valid = false;
 
-        /*
-         * if jparse_lex_init_extra() reports an error (!= 0) then *is_valid
-         * must be set to false and we must return NULL
-         */
-        *is_valid = false;
-	return NULL;
+	/*
+	 * return a blank JSON tree
+	 */
+	tree = json_alloc(JTYPE_UNSET);
+	return tree;
     }
-    extra.filename = filename;
 
     /*
-     * scan the blob
+     * the hand-written parser needs neither the flex scanner nor bison
      */
-    bs = yy_scan_bytes(ptr, (int)len, scanner);
-    if (bs == NULL) {
-	/*
-	 * if unable to scan the bytes it indicates an internal error and
-	 * perhaps it should call err() instead but for now we make it a
-	 * non-fatal error as well.
-	 */
-	werr(41, __func__, "unable to scan string");
+    if (ctx->parser_backend == JSON_PARSER_FAST) {
+	return parse_json_fast_ctx(ctx, ptr, len, filename, is_valid);
+    }
 
-	/*
-         * since we cannot scan the bytes, we set *is_valid to false, even
-         * though it could very well be valid if it could be scanned.
-         */
-	*is_valid = false;
+    /*
+     * initialise the scanner the first time this context needs it
+     */
+    if (ctx->scanner == NULL) {
+	errno = 0;
+	ret = jparse_lex_init_extra(&ctx->extra, &ctx->scanner);
+	if (ret != 0) {
+	    werrp(40, __func__, "jparse_lex_init_extra failed");
+	    ctx->scanner = NULL;
 
-	/*
-         * return a blank JSON tree
-         */
-	tree = json_alloc(JTYPE_UNSET);
-	jparse_lex_destroy(scanner);
-	return tree;
+	    /*
+	     * if jparse_lex_init_extra() reports an error (!= 0) then *is_valid
+	     * must be set to false and we must return NULL
+	     */
+	    *is_valid = false;
+	    return NULL;
+	}
     }
+    ctx->extra.filename = filename;
+    ctx->extra.scan = NULL;
+    ctx->extra.ctx = ctx;
+    ctx->depth = 0;
 
     /*
-     * we cannot set the column (and probably line number) without first having
-     * a buffer which is why the yy_scan_bytes() is called first (see above).
-     *
-     * For why we set the column to 0 but the line to 1 see the comments with
-     * the YY_USER_ACTION macro.
+     * the structural index scanner scans the blob in place: jparse_parse()
+     * will take its tokens from it instead of from jparse_lex()
      */
-    jparse_set_column(0, scanner);
-    jparse_set_lineno(1, scanner);
+    if (ctx->scanner_backend == JSON_SCANNER_INDEX) {
+	json_scan_init(&ctx->scan, ptr, len);
+	ctx->extra.scan = &ctx->scan;
+    }
+
+    /*
+     * scan the blob: in place if it is followed by the padding flex needs,
+     * otherwise from a copy made by yy_scan_bytes()
+     */
+    if (ctx->extra.scan == NULL) {
+	if (padded) {
+	    ctx->bs = yy_scan_buffer((char *)ptr, len + JPARSE_PADDING, ctx->scanner);
+	} else {
+	    ctx->bs = yy_scan_bytes(ptr, (int)len, ctx->scanner);
+	}
+	if (ctx->bs == NULL) {
+	    /*
+	     * if unable to scan the bytes it indicates an internal error and
+	     * perhaps it should call err() instead but for now we make it a
+	     * non-fatal error as well.
+	     */
+	    werr(41, __func__, "unable to scan string");
+
+	    /*
+	     * since we cannot scan the bytes, we set *is_valid to false, even
+	     * though it could very well be valid if it could be scanned.
+	     */
+	    *is_valid = false;
+
+	    /*
+	     * return a blank JSON tree
+	     */
+	    tree = json_alloc(JTYPE_UNSET);
+	    return tree;
+	}
+
+	/*
+	 * we cannot set the column (and probably line number) without first
+	 * having a buffer which is why the yy_scan_buffer() or yy_scan_bytes() is called first
+	 * (see above).
+	 *
+	 * For why we set the column to 0 but the line to 1 see the comments
+	 * with the YY_USER_ACTION macro.
+	 */
+	jparse_set_column(0, ctx->scanner);
+	jparse_set_lineno(1, ctx->scanner);
+    }
 
     /*
      * announce beginning of parse, if JSON debug level is high enough
@@ -3005,13 +3185,31 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
     /*
      * parse the blob, passing into the parser the node and scanner
      */
-    ret = jparse_parse(&tree, scanner);
+    ret = jparse_parse(&tree, ctx->scanner);
 
     /*
-     * free memory associated with bytes scanned by yy_scan_bytes()
+     * free memory associated with bytes scanned by yy_scan_bytes() or with
+     * the structural index scanner
      */
-    yy_delete_buffer(bs, scanner);
-    bs = NULL;
+    if (ctx->extra.scan != NULL) {
+	ctx->nul_seen = ctx->scan.nul;
+	json_scan_free(&ctx->scan);
+	ctx->extra.scan = NULL;
+    } else {
+	/*
+	 * flex puts a NUL after the current token and keeps the byte it
+	 * replaced in yy_hold_char: when scanning in place put that byte back
+	 */
+	if (padded) {
+	    struct yyguts_t *yyg = (struct yyguts_t *)ctx->scanner;
+
+	    if (yyg->yy_c_buf_p != NULL) {
+		*yyg->yy_c_buf_p = yyg->yy_hold_char;
+	    }
+	}
+	yy_delete_buffer(ctx->bs, ctx->scanner);
+	ctx->bs = NULL;
+    }
 
     /*
      * announce end of parse, if JSON debug level is high enough
@@ -3058,9 +3256,178 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
     }
 
     /*
-     * free the scanner of the so-called JSON <del>spec</del> nightmare
+     * return parse tree
+     */
+    return tree;
+}
+
+/*
+ * parse_json_ctx - parse a JSON document of a given length with a parser context
+ *
+ * Given a pointer to char and a length, use the parser to determine if the JSON
+ * is valid or not.
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * The context keeps the flex scanner from one call to the next so that
+ * parsing many documents does not set it up and tear it down each time.  A
+ * context must not be used by more than one thread at a time.
+ *
+ * The data is not modified.  The flex scanner backend scans a copy of it: to
+ * avoid the copy use parse_json_inplace_ctx().
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error; warning on errors is so that an entire
+ *       report of all the problems can be given at the end if the verbosity
+ *       level is high enough (or otherwise if this information is requested).
+ */
+struct json *
+parse_json_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    return parse_json_buffer(ctx, ptr, len, false, filename, is_valid);
+}
+
+
+/*
+ * parse_json_inplace_ctx - parse a padded JSON document in place with a parser context
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob followed by JPARSE_PADDING NUL bytes
+ *	len	    - length of the JSON blob, not counting the padding
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_ctx() without the copy the flex scanner backend would
+ * otherwise make: ptr[len] through ptr[len+JPARSE_PADDING-1] must be NUL and the
+ * data must be writable.  The scanner changes bytes of the data while parsing
+ * and puts them back before returning.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error.
+ */
+struct json *
+parse_json_inplace_ctx(struct jparse_ctx *ctx, char *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct json *tree = NULL;		/* the JSON parse tree */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(74, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(75, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    if (ptr != NULL) {
+	for (i = 0; i < JPARSE_PADDING; ++i) {
+	    if (ptr[len + i] != '\0') {
+		werr(76, __func__, "ptr[len+%zu] is not NUL: data is not padded", i);
+
+		/*
+		 * flag that we have invalid JSON
+		 */
+		*is_valid = false;
+
+		/*
+		 * return a blank JSON tree
+		 */
+		tree = json_alloc(JTYPE_UNSET);
+		return tree;
+	    }
+	}
+    }
+
+    return parse_json_buffer(ctx, ptr, len, true, filename, is_valid);
+}
+
+
+/*
+ * parse_json - parse a JSON document of a given length
+ *
+ * Given a pointer to char and a length, use the parser to determine if the JSON
+ * is valid or not.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_ctx() with a context that lasts for just this call.  To
+ * parse many documents, or to set options, use a context of your own.
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: this function only warns on error, except for NULL is_valid, in which
+ *       case it is an error; warning on errors is so that an entire report of
+ *       all the problems can be given at the end if the verbosity level is high
+ *       enough (or otherwise if this information is requested).
+ */
+struct json *
+parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return parse tree
      */
-    jparse_lex_destroy(scanner);
+    return tree;
+}
+
+
+/*
+ * parse_json_inplace - parse a padded JSON document in place
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob followed by JPARSE_PADDING NUL bytes
+ *	len	    - length of the JSON blob, not counting the padding
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_inplace_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_inplace(char *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_inplace_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
 
     /*
      * return parse tree
@@ -3070,12 +3437,77 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
 
 
 /*
- * parse_json_stream - parse an open file stream for JSON data
+ * read_limited - read a stream, but no more than one byte past a limit
+ *
+ * given:
+ *	stream	    open stream to read
+ *	max_bytes   the most bytes the caller wants
+ *	psize	    where to store the number of bytes read
+ *
+ * returns:
+ *	allocated data, NUL terminated, or NULL on a read error
+ *
+ * When the stream holds more than max_bytes, max_bytes + 1 bytes are
+ * returned so that the caller can tell without the rest being read.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static char *
+read_limited(FILE *stream, size_t max_bytes, size_t *psize)
+{
+    char *data = NULL;		/* data read */
+    size_t size = 0;		/* allocated size of data */
+    size_t len = 0;		/* bytes read so far */
+    size_t want = 0;		/* bytes to read next */
+    size_t got = 0;		/* bytes fread() read */
+
+    *psize = 0;
+    do {
+	if (len + 1 >= size) {
+	    size = (size > 0) ? size * 2 : BUFSIZ;
+	    if (max_bytes < SIZE_MAX - 2 && size > max_bytes + 2) {
+		size = max_bytes + 2;
+	    }
+	    errno = 0;	/* pre-clear errno for errp() */
+	    data = realloc(data, size);
+	    if (data == NULL) {
+		errp(77, __func__, "realloc of %ju bytes failed", (uintmax_t)size);
+		not_reached();
+	    }
+	}
+	want = size - 1 - len;
+	got = fread(data + len, 1, want, stream);
+	len += got;
+    } while (got == want && len <= max_bytes);
+    if (ferror(stream)) {
+	free(data);
+	return NULL;
+    }
+    data[len] = '\0';
+    *psize = len;
+    return data;
+}
+
+
+/*
+ * parse_json_stream_ctx - parse an open file stream for JSON data with a parser context
  *
  * Given an open file stream, we will read in all data (until EOF) and
  * then parse that data as if it were JSON.
  *
+ * A regular file is mapped with map_all() rather than read, and the mapping is
+ * parsed in place, so the data is neither copied into a read buffer nor, when
+ * the file leaves room for JPARSE_PADDING bytes in its last page, copied again
+ * for the flex scanner.  Anything else (a pipe, a terminal, ...) is read with
+ * read_all() and then parsed.
+ *
+ * The data must not have bytes in the range [\x00-\x08\x0e-\x1f].  Both
+ * scanners reject all of them except for a NUL in a string, which they
+ * note in the context, so low_byte_scan() only needs to look at the data
+ * (and report what it finds) if the parse failed or found a NUL byte.
+ *
  * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
  *	stream      - open file stream containing JSON data
  *	filename    - name of file or NULL for stdin
  *	is_valid    - non-NULL printer to boolean to set depending on json validity
@@ -3083,8 +3515,8 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
  * return:
  *	pointer to a JSON parse tree
  *
- * If stream is NULL or stream is not open, or if read_all() fails,
- * then this function warns and sets *is_valid to false.
+ * If stream is NULL or stream is not open, or if read_all() fails, or if the
+ * data has low bytes, then this function warns and sets *is_valid to false.
  *
  * NOTE: the reason this is in the scanner and not the parser is because
  *	 YY_BUFFER_STATE is part of the scanner and not the parser and that's required
@@ -3099,11 +3531,13 @@ parse_json(char const *ptr, size_t len, char const *filename, bool *is_valid)
  *       enough (or otherwise if this information is requested).
  */
 struct json *
-parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
+parse_json_stream_ctx(struct jparse_ctx *ctx, FILE *stream, char const *filename, bool *is_valid)
 {
     struct json *tree = NULL;		/* the JSON parse tree */
-    char *data = NULL;			/* used to determine if there are NUL bytes in the file */
+    char *data = NULL;			/* data mapped or read from the stream */
     size_t len = 0;			/* length of data read */
+    size_t pad = 0;			/* NUL bytes after mapped data */
+    bool mapped = false;		/* true ==> data is from map_all(), false ==> from read_all() */
     bool low_byte_detected = false;	/* true ==> byte values [\x00-\x08\x0e-\x1f] detected in data */
     size_t nul_bytes = 0;		/* number of NUL bytes found */
     size_t low_bytes = 0;		/* number of low bytes that are not NUL found */
@@ -3111,6 +3545,10 @@ parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
     /*
      * firewall
      */
+    if (ctx == NULL) {
+	err(72, __func__, "ctx is NULL");
+	not_reached();
+    }
     if (is_valid == NULL) {
 	err(42, __func__, "is_valid == NULL");
 	not_reached();
@@ -3173,9 +3611,16 @@ parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
     }
 
     /*
-     * read the entire file into memory
+     * map the entire file into memory if we can, else read it
      */
-    data = read_all(stream, &len);
+    data = map_all(stream, &len, &pad);
+    if (data != NULL) {
+	mapped = true;
+    } else if (ctx->max_bytes != 0) {
+	data = read_limited(stream, ctx->max_bytes, &len);
+    } else {
+	data = read_all(stream, &len);
+    }
     if (data == NULL) {
 
 	/*
@@ -3197,62 +3642,62 @@ parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
 	return tree;
     }
 
-    /*
-     * pre-scan data for byte values in range of [\x00-\x08\x0e-\x1f]
-     */
-    low_byte_detected = low_byte_scan(data, len, &low_bytes, &nul_bytes);
-    if (low_byte_detected || low_bytes > 0 || nul_bytes > 0) {
-
-	/*
-         * report invalid bytes
-         */
-	if (low_bytes > 0 && nul_bytes > 0) {
-	    werr(46, __func__, "%ju low byte%s and %ju NUL byte%s detected: data block is NOT valid JSON",
-		    (uintmax_t)low_bytes, low_bytes > 1 ? "s":"",
-		    (uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
-	} else if (low_bytes > 0) {
-	    werr(47, __func__, "%ju low byte%s detected: data block is NOT valid JSON",
-		    (uintmax_t)low_bytes, low_bytes > 1 ? "s":"");
-	} else if (nul_bytes > 0) {
-	    werr(48, __func__, "%ju NUL byte%s detected: data block is NOT valid JSON",
-		    (uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
-	}
-
-	/*
-         * clearerr() or fclose() depending on stream
-         */
-	clearerr_or_fclose(stream);
-
-	/*
-         * flag that we have invalid JSON
-         */
-	*is_valid = false;
-
-	/* free data */
-	if (data != NULL) {
-	    free(data);
-	    data = NULL;
-	}
-
-	/* return a blank JSON tree */
-	tree = json_alloc(JTYPE_UNSET);
-	return tree;
-    }
-
     /*
      * if JSON debug level is high enough we will log the call with the length
      */
     if (json_dbg_allowed(JSON_DBG_HIGH)) {
-        json_dbg(JSON_DBG_HIGH, __func__, "calling parse_json on data block with length %ju:", (uintmax_t)len);
+        json_dbg(JSON_DBG_HIGH, __func__, "calling parse_json_buffer on %s data block with length %ju:",
+				       mapped ? "mapped" : "read", (uintmax_t)len);
     }
 
     /*
      * JSON parse the data from the file
      */
-    tree = parse_json(data, len, filename, is_valid);
+    tree = parse_json_buffer(ctx, data, len, mapped && pad >= JPARSE_PADDING, filename, is_valid);
 
-    /* free data */
-    if (data != NULL) {
+    /*
+     * scan data for byte values in range of [\x00-\x08\x0e-\x1f] if the
+     * scanners could not rule them out
+     */
+    if (!*is_valid || ctx->nul_seen) {
+	low_byte_detected = low_byte_scan(data, len, &low_bytes, &nul_bytes);
+	if (low_byte_detected || low_bytes > 0 || nul_bytes > 0) {
+
+	    /*
+	     * report invalid bytes
+	     */
+	    if (low_bytes > 0 && nul_bytes > 0) {
+		werr(46, __func__, "%ju low byte%s and %ju NUL byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)low_bytes, low_bytes > 1 ? "s":"",
+			(uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
+	    } else if (low_bytes > 0) {
+		werr(47, __func__, "%ju low byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)low_bytes, low_bytes > 1 ? "s":"");
+	    } else if (nul_bytes > 0) {
+		werr(48, __func__, "%ju NUL byte%s detected: data block is NOT valid JSON",
+			(uintmax_t)nul_bytes, nul_bytes > 1 ? "s":"");
+	    }
+
+	    /*
+	     * flag that we have invalid JSON
+	     */
+	    *is_valid = false;
+
+	    /*
+	     * replace any parse tree with a blank JSON tree
+	     */
+	    if (tree != NULL) {
+		json_tree_release(tree);
+	    }
+	    tree = json_alloc(JTYPE_UNSET);
+	}
+    }
+
+    /* unmap or free data */
+    if (mapped) {
+	unmap_all(data, len);
+	data = NULL;
+    } else if (data != NULL) {
 	free(data);
 	data = NULL;
     }
@@ -3271,9 +3716,40 @@ parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
 
 
 /*
- * parse_json_file	    - parses file file
+ * parse_json_stream - parse an open file stream for JSON data
  *
  * given:
+ *	stream      - open file stream containing JSON data
+ *	filename    - name of file or NULL for stdin
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_stream_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_stream_ctx(&ctx, stream, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return the JSON parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * parse_json_file_ctx - parses file file with a parser context
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
  *	name	    - filename of file to parse
  *	is_valid    - non-NULL printer to boolean to set depending on json validity
  *
@@ -3293,7 +3769,7 @@ parse_json_stream(FILE *stream, char const *filename, bool *is_valid)
  *	 this information is requested).
  */
 struct json *
-parse_json_file(char const *name, bool *is_valid)
+parse_json_file_ctx(struct jparse_ctx *ctx, char const *name, bool *is_valid)
 {
     struct json *tree = NULL;		/* the JSON parse tree */
     FILE *stream = NULL;		/* file stream to read from */
@@ -3301,6 +3777,10 @@ parse_json_file(char const *name, bool *is_valid)
     /*
      * firewall
      */
+    if (ctx == NULL) {
+	err(73, __func__, "ctx is NULL");
+	not_reached();
+    }
     if (is_valid == NULL) {
 	err(49, __func__, "is_valid == NULL");
 	not_reached();
@@ -3440,7 +3920,7 @@ parse_json_file(char const *name, bool *is_valid)
     /*
      * JSON parse the open stream
      */
-    tree = parse_json_stream(stream, name, is_valid);
+    tree = parse_json_stream_ctx(ctx, stream, name, is_valid);
 
     /*
      * return the JSON parse tree tree
@@ -3448,3 +3928,31 @@ parse_json_file(char const *name, bool *is_valid)
     return tree;
 }
 
+
+/*
+ * parse_json_file	    - parses file file
+ *
+ * given:
+ *	name	    - filename of file to parse
+ *	is_valid    - non-NULL printer to boolean to set depending on json validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * This is parse_json_file_ctx() with a context that lasts for just this call.
+ */
+struct json *
+parse_json_file(char const *name, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_file_ctx(&ctx, name, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return the JSON parse tree
+     */
+    return tree;
+}
@@ -0,0 +1,2867 @@
+/*
+ * A programmer's apology and warning
+ *
+ * Sorry (tm Canada :-)) for the appalling condition of the code below.
+ *
+ * The people who worked on this repo did NOT write this code. Well, OK, we DID
+ * write this comment. We refer to code beyond this comment. The code below was
+ * generated by the bison or flex code generators.
+ *
+ * WARNING: We do NOT recommend that you modify the generated code even though
+ * it is digitally odoriferous and has a gleety appearance. Beautification of
+ * this code, no matter how disagreeable it may seem, is unwise as such
+ * modifications tend to be practically impossible to maintain. Even if this
+ * Flying Spaghetti Monster style code tempts you to tweak it, doing so might
+ * produce visions and nightmares of Cthulhu-like tentacles grabbing at the very
+ * logic of your mind, pulling it down into a hideous maelstrom of code
+ * maintenance cacophony.
+ *
+ * OK, it might not give you nightmares but why take the risk? The point is
+ * don't work on this file! Instead work on the bison and flex related source
+ * files. See the Makefile for details on how this file was generated. See also
+ * run_bison.sh and run_flex.sh.
+ *
+ * Now some might be tempted to point out this code was originally in support of
+ * the International Obfuscated C Code Contest (IOCCC) and that objecting to the
+ * output of Bison and Flex borders on programming sanctimoniousness. At first
+ * glance, this incongruence is unsustainable. In response we opine that one of
+ * the fundamental undertones of the IOCCC is the promotion of good programming
+ * through irony by awarding highly obfuscated C code. So, if it helps, we
+ * suggest you view this apology in a satirical light, even if you are humour
+ * impaired. Nevertheless, we still recommend you to eschew modifying the code
+ * below.
+ *
+ * Thanks in advance for your understanding, and sorry (tm Canada :-)).
+ *
+ * Of course, on the other hand, the fact the scanner and parser are for JSON
+ * might suggest that we shouldn't have to apologise because the JSON spec is
+ * objectionable and so are the generated scanner and parser so this apology
+ * might very well be superfluous. If one were to then ignore the fact that
+ * bison and flex do not care what they are parsing this same person could
+ * argue, obviously by some perverted logical fallacies, that bison and flex did
+ * their job well. Well, OK they probably DID do their job well but in an
+ * objectionable way. :-)
+ *
+ * P.S. In 2022 April 04, when this comment was initially formed, none of the
+ *	people working on this parser/scanner were Canadian. But some of them
+ *	have several good friends who live in, or are from Canada. Those
+ *	friends say sorry in a fun and friendly way, so we honour those friends
+ *	accordingly.
+ */
+#line 1 "./jparse.tab.c"
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         JPARSE_STYPE
+#define YYLTYPE         JPARSE_LTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         jparse_parse
+#define yylex           jparse_lex
+#define yyerror         jparse_error
+#define yydebug         jparse_debug
+#define yynerrs         jparse_nerrs
+
+/* First part of user prologue.  */
+#line 76 "./jparse.y"
+
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * version - JSON parser API and tool version
+ */
+#include "version.h"
+
+
+/*
+ * for the re-entrant scanner.
+ *
+ * NOTE that we cannot #include "jparse.lex.h" in jparse.h so we do it here
+ * instead.
+ */
+#include "jparse.lex.h"
+
+/*
+ * bison debug information for development
+ */
+int jparse_debug = 0;	/* 0 ==> verbose bison debug off, 1 ==> verbose bison debug on */
+
+/*
+ * JSON parser version strings (format: major.minor YYYY-MM-DD)
+ */
+const char *const jparse_library_version = JPARSE_LIBRARY_VERSION;  /* jparse library version */
+const char *const jparse_version = JPARSE_VERSION;		    /* jparse tool version */
+const char *const jparse_utf8_version = JPARSE_UTF8_VERSION;	    /* jparse utf8 version */
+
+/*
+ * token source
+ *
+ * The parser obtains tokens through jparse_token() rather than directly from
+ * jparse_lex() so that they may come from the structural index scanner in
+ * json_scan.c instead: see the scan member of struct json_extra. For the same
+ * reason the actions use jparse_text() and jparse_leng() and not
+ * jparse_get_text() and jparse_get_leng().
+ */
+static int jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
+static char const *jparse_text(yyscan_t scanner);
+static size_t jparse_leng(yyscan_t scanner);
+#undef yylex
+#define yylex jparse_token
+
+
+#line 128 "jparse.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "jparse.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_JSON_OPEN_BRACE = 3,            /* "{"  */
+  YYSYMBOL_JSON_CLOSE_BRACE = 4,           /* "}"  */
+  YYSYMBOL_JSON_OPEN_BRACKET = 5,          /* "["  */
+  YYSYMBOL_JSON_CLOSE_BRACKET = 6,         /* "]"  */
+  YYSYMBOL_JSON_COMMA = 7,                 /* ","  */
+  YYSYMBOL_JSON_COLON = 8,                 /* ":"  */
+  YYSYMBOL_JSON_NULL = 9,                  /* "null"  */
+  YYSYMBOL_JSON_TRUE = 10,                 /* "true"  */
+  YYSYMBOL_JSON_FALSE = 11,                /* "false"  */
+  YYSYMBOL_JSON_STRING = 12,               /* JSON_STRING  */
+  YYSYMBOL_JSON_NUMBER = 13,               /* JSON_NUMBER  */
+  YYSYMBOL_token = 14,                     /* token  */
+  YYSYMBOL_YYACCEPT = 15,                  /* $accept  */
+  YYSYMBOL_json = 16,                      /* json  */
+  YYSYMBOL_json_value = 17,                /* json_value  */
+  YYSYMBOL_json_object = 18,               /* json_object  */
+  YYSYMBOL_json_members = 19,              /* json_members  */
+  YYSYMBOL_json_member = 20,               /* json_member  */
+  YYSYMBOL_json_array = 21,                /* json_array  */
+  YYSYMBOL_json_elements = 22,             /* json_elements  */
+  YYSYMBOL_json_element = 23,              /* json_element  */
+  YYSYMBOL_json_string = 24,               /* json_string  */
+  YYSYMBOL_json_number = 25                /* json_number  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+# define YYCOPY_NEEDED 1
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined JPARSE_LTYPE_IS_TRIVIAL && JPARSE_LTYPE_IS_TRIVIAL \
+             && defined JPARSE_STYPE_IS_TRIVIAL && JPARSE_STYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  22
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   30
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  15
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  11
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  21
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  31
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   269
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14
+};
+
+#if JPARSE_DEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   245,   245,   303,   334,   365,   396,   427,   457,   487,
+     519,   553,   583,   617,   656,   692,   730,   760,   799,   837,
+     870,   903
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if JPARSE_DEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"{\"", "\"}\"",
+  "\"[\"", "\"]\"", "\",\"", "\":\"", "\"null\"", "\"true\"", "\"false\"",
+  "JSON_STRING", "JSON_NUMBER", "token", "$accept", "json", "json_value",
+  "json_object", "json_members", "json_member", "json_array",
+  "json_elements", "json_element", "json_string", "json_number", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-6)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int8 yypact[] =
+{
+      17,     2,    -1,    -6,    -6,    -6,    -6,    -6,     3,    -6,
+      -6,    -6,    -6,    -6,    -6,    -6,     9,    -6,     7,    -6,
+      11,    -6,    -6,    -6,    -5,    17,    -6,    17,    -6,    -6,
+      -6
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     9,     7,     8,    20,    21,     0,    19,
+       3,     4,     2,     5,     6,    11,     0,    12,     0,    16,
+       0,    17,     1,    10,     0,     0,    15,     0,    13,    14,
+      18
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int8 yypgoto[] =
+{
+      -6,    -6,    -6,    -6,    -6,    -3,    -6,    -6,    -2,     0,
+      -6
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     8,     9,    10,    16,    17,    11,    20,    12,    13,
+      14
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
+{
+      21,    18,     1,    22,     2,    19,    15,     6,     3,     4,
+       5,     6,     7,    23,     6,    25,    24,    26,    27,     0,
+       1,    28,     2,    29,    18,    30,     3,     4,     5,     6,
+       7
+};
+
+static const yytype_int8 yycheck[] =
+{
+       2,     1,     3,     0,     5,     6,     4,    12,     9,    10,
+      11,    12,    13,     4,    12,     8,     7,     6,     7,    -1,
+       3,    24,     5,    25,    24,    27,     9,    10,    11,    12,
+      13
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     3,     5,     9,    10,    11,    12,    13,    16,    17,
+      18,    21,    23,    24,    25,     4,    19,    20,    24,     6,
+      22,    23,     0,     4,     7,     8,     6,     7,    20,    23,
+      23
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    15,    16,    17,    17,    17,    17,    17,    17,    17,
+      18,    18,    19,    19,    20,    21,    21,    22,    22,    23,
+      24,    25
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     2,     1,     3,     3,     3,     2,     1,     3,     1,
+       1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = JPARSE_EMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == JPARSE_EMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        YY_LAC_DISCARD ("YYBACKUP");                              \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, tree, scanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use JPARSE_error or JPARSE_UNDEF. */
+#define YYERRCODE JPARSE_UNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if JPARSE_DEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined JPARSE_LTYPE_IS_TRIVIAL && JPARSE_LTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, tree, scanner); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, struct json **tree, yyscan_t scanner)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (tree);
+  YY_USE (scanner);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, struct json **tree, yyscan_t scanner)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, tree, scanner);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, struct json **tree, yyscan_t scanner)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), tree, scanner);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, tree, scanner); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !JPARSE_DEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !JPARSE_DEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Given a state stack such that *YYBOTTOM is its bottom, such that
+   *YYTOP is either its top or is YYTOP_EMPTY to indicate an empty
+   stack, and such that *YYCAPACITY is the maximum number of elements it
+   can hold without a reallocation, make sure there is enough room to
+   store YYADD more elements.  If not, allocate a new stack using
+   YYSTACK_ALLOC, copy the existing elements, and adjust *YYBOTTOM,
+   *YYTOP, and *YYCAPACITY to reflect the new capacity and memory
+   location.  If *YYBOTTOM != YYBOTTOM_NO_FREE, then free the old stack
+   using YYSTACK_FREE.  Return 0 if successful or if no reallocation is
+   required.  Return YYENOMEM if memory is exhausted.  */
+static int
+yy_lac_stack_realloc (YYPTRDIFF_T *yycapacity, YYPTRDIFF_T yyadd,
+#if JPARSE_DEBUG
+                      char const *yydebug_prefix,
+                      char const *yydebug_suffix,
+#endif
+                      yy_state_t **yybottom,
+                      yy_state_t *yybottom_no_free,
+                      yy_state_t **yytop, yy_state_t *yytop_empty)
+{
+  YYPTRDIFF_T yysize_old =
+    *yytop == yytop_empty ? 0 : *yytop - *yybottom + 1;
+  YYPTRDIFF_T yysize_new = yysize_old + yyadd;
+  if (*yycapacity < yysize_new)
+    {
+      YYPTRDIFF_T yyalloc = 2 * yysize_new;
+      yy_state_t *yybottom_new;
+      /* Use YYMAXDEPTH for maximum stack size given that the stack
+         should never need to grow larger than the main state stack
+         needs to grow without LAC.  */
+      if (YYMAXDEPTH < yysize_new)
+        {
+          YYDPRINTF ((stderr, "%smax size exceeded%s", yydebug_prefix,
+                      yydebug_suffix));
+          return YYENOMEM;
+        }
+      if (YYMAXDEPTH < yyalloc)
+        yyalloc = YYMAXDEPTH;
+      yybottom_new =
+        YY_CAST (yy_state_t *,
+                 YYSTACK_ALLOC (YY_CAST (YYSIZE_T,
+                                         yyalloc * YYSIZEOF (*yybottom_new))));
+      if (!yybottom_new)
+        {
+          YYDPRINTF ((stderr, "%srealloc failed%s", yydebug_prefix,
+                      yydebug_suffix));
+          return YYENOMEM;
+        }
+      if (*yytop != yytop_empty)
+        {
+          YYCOPY (yybottom_new, *yybottom, yysize_old);
+          *yytop = yybottom_new + (yysize_old - 1);
+        }
+      if (*yybottom != yybottom_no_free)
+        YYSTACK_FREE (*yybottom);
+      *yybottom = yybottom_new;
+      *yycapacity = yyalloc;
+    }
+  return 0;
+}
+
+/* Establish the initial context for the current lookahead if no initial
+   context is currently established.
+
+   We define a context as a snapshot of the parser stacks.  We define
+   the initial context for a lookahead as the context in which the
+   parser initially examines that lookahead in order to select a
+   syntactic action.  Thus, if the lookahead eventually proves
+   syntactically unacceptable (possibly in a later context reached via a
+   series of reductions), the initial context can be used to determine
+   the exact set of tokens that would be syntactically acceptable in the
+   lookahead's place.  Moreover, it is the context after which any
+   further semantic actions would be erroneous because they would be
+   determined by a syntactically unacceptable token.
+
+   YY_LAC_ESTABLISH should be invoked when a reduction is about to be
+   performed in an inconsistent state (which, for the purposes of LAC,
+   includes consistent states that don't know they're consistent because
+   their default reductions have been disabled).  Iff there is a
+   lookahead token, it should also be invoked before reporting a syntax
+   error.  This latter case is for the sake of the debugging output.
+
+   For parse.lac=full, the implementation of YY_LAC_ESTABLISH is as
+   follows.  If no initial context is currently established for the
+   current lookahead, then check if that lookahead can eventually be
+   shifted if syntactic actions continue from the current context.
+   Report a syntax error if it cannot.  */
+#define YY_LAC_ESTABLISH                                                \
+do {                                                                    \
+  if (!yy_lac_established)                                              \
+    {                                                                   \
+      YYDPRINTF ((stderr,                                               \
+                  "LAC: initial context established for %s\n",          \
+                  yysymbol_name (yytoken)));                            \
+      yy_lac_established = 1;                                           \
+      switch (yy_lac (yyesa, &yyes, &yyes_capacity, yyssp, yytoken))    \
+        {                                                               \
+        case YYENOMEM:                                                  \
+          YYNOMEM;                                                      \
+        case 1:                                                         \
+          goto yyerrlab;                                                \
+        }                                                               \
+    }                                                                   \
+} while (0)
+
+/* Discard any previous initial lookahead context because of Event,
+   which may be a lookahead change or an invalidation of the currently
+   established initial context for the current lookahead.
+
+   The most common example of a lookahead change is a shift.  An example
+   of both cases is syntax error recovery.  That is, a syntax error
+   occurs when the lookahead is syntactically erroneous for the
+   currently established initial context, so error recovery manipulates
+   the parser stacks to try to find a new initial context in which the
+   current lookahead is syntactically acceptable.  If it fails to find
+   such a context, it discards the lookahead.  */
+#if JPARSE_DEBUG
+# define YY_LAC_DISCARD(Event)                                           \
+do {                                                                     \
+  if (yy_lac_established)                                                \
+    {                                                                    \
+      YYDPRINTF ((stderr, "LAC: initial context discarded due to "       \
+                  Event "\n"));                                          \
+      yy_lac_established = 0;                                            \
+    }                                                                    \
+} while (0)
+#else
+# define YY_LAC_DISCARD(Event) yy_lac_established = 0
+#endif
+
+/* Given the stack whose top is *YYSSP, return 0 iff YYTOKEN can
+   eventually (after perhaps some reductions) be shifted, return 1 if
+   not, or return YYENOMEM if memory is exhausted.  As preconditions and
+   postconditions: *YYES_CAPACITY is the allocated size of the array to
+   which *YYES points, and either *YYES = YYESA or *YYES points to an
+   array allocated with YYSTACK_ALLOC.  yy_lac may overwrite the
+   contents of either array, alter *YYES and *YYES_CAPACITY, and free
+   any old *YYES other than YYESA.  */
+static int
+yy_lac (yy_state_t *yyesa, yy_state_t **yyes,
+        YYPTRDIFF_T *yyes_capacity, yy_state_t *yyssp, yysymbol_kind_t yytoken)
+{
+  yy_state_t *yyes_prev = yyssp;
+  yy_state_t *yyesp = yyes_prev;
+  /* Reduce until we encounter a shift and thereby accept the token.  */
+  YYDPRINTF ((stderr, "LAC: checking lookahead %s:", yysymbol_name (yytoken)));
+  if (yytoken == YYSYMBOL_YYUNDEF)
+    {
+      YYDPRINTF ((stderr, " Always Err\n"));
+      return 1;
+    }
+  while (1)
+    {
+      int yyrule = yypact[+*yyesp];
+      if (yypact_value_is_default (yyrule)
+          || (yyrule += yytoken) < 0 || YYLAST < yyrule
+          || yycheck[yyrule] != yytoken)
+        {
+          /* Use the default action.  */
+          yyrule = yydefact[+*yyesp];
+          if (yyrule == 0)
+            {
+              YYDPRINTF ((stderr, " Err\n"));
+              return 1;
+            }
+        }
+      else
+        {
+          /* Use the action from yytable.  */
+          yyrule = yytable[yyrule];
+          if (yytable_value_is_error (yyrule))
+            {
+              YYDPRINTF ((stderr, " Err\n"));
+              return 1;
+            }
+          if (0 < yyrule)
+            {
+              YYDPRINTF ((stderr, " S%d\n", yyrule));
+              return 0;
+            }
+          yyrule = -yyrule;
+        }
+      /* By now we know we have to simulate a reduce.  */
+      YYDPRINTF ((stderr, " R%d", yyrule - 1));
+      {
+        /* Pop the corresponding number of values from the stack.  */
+        YYPTRDIFF_T yylen = yyr2[yyrule];
+        /* First pop from the LAC stack as many tokens as possible.  */
+        if (yyesp != yyes_prev)
+          {
+            YYPTRDIFF_T yysize = yyesp - *yyes + 1;
+            if (yylen < yysize)
+              {
+                yyesp -= yylen;
+                yylen = 0;
+              }
+            else
+              {
+                yyesp = yyes_prev;
+                yylen -= yysize;
+              }
+          }
+        /* Only afterwards look at the main stack.  */
+        if (yylen)
+          yyesp = yyes_prev -= yylen;
+      }
+      /* Push the resulting state of the reduction.  */
+      {
+        yy_state_fast_t yystate;
+        {
+          const int yylhs = yyr1[yyrule] - YYNTOKENS;
+          const int yyi = yypgoto[yylhs] + *yyesp;
+          yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyesp
+                     ? yytable[yyi]
+                     : yydefgoto[yylhs]);
+        }
+        if (yyesp == yyes_prev)
+          {
+            yyesp = *yyes;
+            YY_IGNORE_USELESS_CAST_BEGIN
+            *yyesp = YY_CAST (yy_state_t, yystate);
+            YY_IGNORE_USELESS_CAST_END
+          }
+        else
+          {
+            if (yy_lac_stack_realloc (yyes_capacity, 1,
+#if JPARSE_DEBUG
+                                      " (", ")",
+#endif
+                                      yyes, yyesa, &yyesp, yyes_prev))
+              {
+                YYDPRINTF ((stderr, "\n"));
+                return YYENOMEM;
+              }
+            YY_IGNORE_USELESS_CAST_BEGIN
+            *++yyesp = YY_CAST (yy_state_t, yystate);
+            YY_IGNORE_USELESS_CAST_END
+          }
+        YYDPRINTF ((stderr, " G%d", yystate));
+      }
+    }
+}
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, struct json **tree, yyscan_t scanner)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (tree);
+  YY_USE (scanner);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (struct json **tree, yyscan_t scanner)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined JPARSE_LTYPE_IS_TRIVIAL && JPARSE_LTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+    yy_state_t yyesa[20];
+    yy_state_t *yyes = yyesa;
+    YYPTRDIFF_T yyes_capacity = 20 < YYMAXDEPTH ? 20 : YYMAXDEPTH;
+
+  /* Whether LAC context is established.  A Boolean.  */
+  int yy_lac_established = 0;
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = JPARSE_EMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == JPARSE_EMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
+    }
+
+  if (yychar <= JPARSE_EOF)
+    {
+      yychar = JPARSE_EOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == JPARSE_error)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = JPARSE_UNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    {
+      YY_LAC_ESTABLISH;
+      goto yydefault;
+    }
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      YY_LAC_ESTABLISH;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = JPARSE_EMPTY;
+  YY_LAC_DISCARD ("shift");
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  {
+    int yychar_backup = yychar;
+    switch (yyn)
+      {
+  case 2: /* json: json_element  */
+#line 246 "./jparse.y"
+    {
+	/*
+	 * $$ = $json
+	 * $1 = $json_element
+	 */
+
+	/* pre action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json: starting: "
+					      "json: json_element");
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json: $json_element type: %s",
+					     json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json: about to perform: "
+					     "$json = $json_element;");
+	}
+
+	/* action */
+	yyval = yyvsp[0];	/* magic: json_value becomes json_element's type */
+
+	/* post action debugging */
+	if (json_dbg_allowed(JSON_DBG_MED)) {
+	    if (json_dbg_allowed(JSON_DBG_HIGH)) {
+		json_dbg(JSON_DBG_HIGH, __func__, "under json: returning $json_element type: %s",
+						  json_item_type_name(yyval));
+	    }
+	    json_dbg_tree_print(JSON_DBG_MED, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	}
+
+	if (tree == NULL) {
+	    warn(__func__, "under json: tree == NULL");
+	} else {
+	    /* return the JSON parse tree */
+	    if (yyval == NULL) {
+		/* Magic: See below magic note for how *tree will be set to NULL */
+		warn(__func__, "under json: $json == NULL: about to perform: "
+			       "*tree = NULL;");
+	    }
+	    if (json_dbg_allowed(JSON_DBG_HIGH)) {
+		json_dbg(JSON_DBG_HIGH, __func__, "under json: about to also perform: "
+						  "*tree = $json;");
+	    }
+	    /*
+	     * Magic: If $json == NULL then *tree will be set to NULL. If it's
+	     * not NULL, however, *tree will be set to the parse tree itself
+	     * ($json).
+	     */
+	    *tree = yyval;	/* more magic: set jparse_parse(tree) arg to point to JSON parse tree */
+	}
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json: ending: "
+					      "json: json_element");
+	}
+    }
+#line 1567 "jparse.tab.c"
+    break;
+
+  case 3: /* json_value: json_object  */
+#line 304 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 * $1 = $json_object
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: json_object");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: $json_object type: %s",
+					     json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = $json_object;");
+	}
+
+	/* action */
+	yyval = yyvsp[0];	/* magic: json_value becomes JTYPE_OBJECT type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: json_object");
+	}
+    }
+#line 1600 "jparse.tab.c"
+    break;
+
+  case 4: /* json_value: json_array  */
+#line 335 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 * $1 = $json_array
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: json_array");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: $json_array type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = $json_array;");
+	}
+
+	/* action */
+	yyval = yyvsp[0];	/* magic: json_value becomes JTYPE_ARRAY type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: json_array");
+	}
+    }
+#line 1633 "jparse.tab.c"
+    break;
+
+  case 5: /* json_value: json_string  */
+#line 366 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 * $1 = $json_string
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: json_string");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: $json_string type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = $json_string;");
+	}
+
+	/* action */
+	yyval = yyvsp[0]; /* magic: json_value becomes JTYPE_STRING type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: json_string");
+	}
+    }
+#line 1666 "jparse.tab.c"
+    break;
+
+  case 6: /* json_value: json_number  */
+#line 397 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 * $1 = $json_number
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: json_number");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: $json_number type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = $json_number;");
+	}
+
+	/* action */
+	yyval = yyvsp[0]; /* magic: json_value becomes JTYPE_NUMBER type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: json_number");
+	}
+    }
+#line 1699 "jparse.tab.c"
+    break;
+
+  case 7: /* json_value: "true"  */
+#line 428 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: JSON_TRUE");
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%ju>", (intmax_t)jparse_leng(scanner));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = parse_json_bool(jparse_text(scanner));");
+	}
+
+	/* action */
+	yyval = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: JSON_TRUE");
+	}
+    }
+#line 1731 "jparse.tab.c"
+    break;
+
+  case 8: /* json_value: "false"  */
+#line 458 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: JSON_FALSE");
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = parse_json_bool(jparse_text(scanner))");
+	}
+
+	/* action */
+	yyval = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					     "json_value: JSON_FALSE");
+	}
+    }
+#line 1763 "jparse.tab.c"
+    break;
+
+  case 9: /* json_value: "null"  */
+#line 488 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_value
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
+					       "json_value: JSON_NULL");
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
+					       "$json_value = parse_json_null(jparse_text(scanner));");
+	}
+
+	/* action */
+	yyval = parse_json_null(jparse_text(scanner)); /* magic: json_value becomes JTYPE_NULL type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_value: returning $json_value type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: ending: "
+					       "json_value: JSON_NULL");
+	}
+    }
+#line 1795 "jparse.tab.c"
+    break;
+
+  case 10: /* json_object: "{" json_members "}"  */
+#line 520 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_object
+	 * $1 = $json_members
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: starting: "
+					       "json_object: JSON_OPEN_BRACE json_members JSON_CLOSE_BRACE");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: $json_members type: %s",
+					       json_item_type_name(yyvsp[-1]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to perform: "
+					       "$json_object = $json_members;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to also perform: "
+					       "json_set_shrink($json_object);");
+	}
+
+	/* action */
+	yyval = yyvsp[-1]; /* magic: json_value becomes JTYPE_OBJECT type */
+	json_set_shrink(yyval);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_object: returning $json_object type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: ending: "
+					       "json_object: JSON_OPEN_BRACE json_members JSON_CLOSE_BRACE");
+	}
+    }
+#line 1831 "jparse.tab.c"
+    break;
+
+  case 11: /* json_object: "{" "}"  */
+#line 554 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_object
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: starting: "
+					       "json_object: JSON_OPEN_BRACE JSON_CLOSE_BRACE");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to perform: "
+					       "$json_object = json_create_object();");
+	}
+
+	/* action */
+	yyval = json_create_object(); /* json_object becomes JTYPE_OBJECT */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_object: returning $json_object type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: ending: "
+					       "json_object: JSON_OPEN_BRACE JSON_CLOSE_BRACE");
+	}
+    }
+#line 1861 "jparse.tab.c"
+    break;
+
+  case 12: /* json_members: json_member  */
+#line 584 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_members
+	 * $1 = $json_member
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: starting: "
+					       "json_members: json_member");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: $json_member type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: about to perform: "
+					       "$json_members = json_create_object();");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: about to also perform: "
+					       "$json_members = json_object_add_member($json_members, $json_member);");
+	}
+
+	/* action */
+	yyval = json_create_object();
+	yyval = json_object_add_member(yyval, yyvsp[0]);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: returning $json_members type: %s",
+					       json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_VHIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_members: ending: "
+					      "json_members: json_member");
+	}
+    }
+#line 1897 "jparse.tab.c"
+    break;
+
+  case 13: /* json_members: json_members "," json_member  */
+#line 618 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_members
+	 * $1 = $json_members
+	 * $3 = $json_member
+	 *
+	 * NOTE: Cannot use $json_members due to ambiguity.
+	 *       But we can use $3 for $json_member.
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: starting: "
+					       "json_members: json_members JSON_COMMA json_member");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: $1 ($json_members) type: %s",
+					       json_item_type_name(yyvsp[-2]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: $3 ($json_member) type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: about to perform: "
+					       "$$ = json_object_add_member($1, $json_member)");
+	}
+
+	/* action */
+	yyval = json_object_add_member(yyvsp[-2], yyvsp[0]);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_members: returning $$ ($json_members) type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_members: ending: "
+					       "json_members: json_members JSON_COMMA json_member");
+	}
+    }
+#line 1936 "jparse.tab.c"
+    break;
+
+  case 14: /* json_member: json_string ":" json_element  */
+#line 657 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_member
+	 * $1 = $json_string
+	 * $3 = $json_element
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_member: starting: "
+					       "json_member: json_string JSON_COLON json_element");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_member: $json_string type: %s",
+					       json_item_type_name(yyvsp[-2]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_member: $json_element type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_member: about to perform: "
+					       "$json_member = parse_json_member($json_string, $json_element);");
+	}
+
+	/* action */
+	yyval = parse_json_member(yyvsp[-2], yyvsp[0]);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_member: returning $json_member type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_member: ending: "
+					       "json_member: json_string JSON_COLON json_element");
+	}
+    }
+#line 1972 "jparse.tab.c"
+    break;
+
+  case 15: /* json_array: "[" json_elements "]"  */
+#line 693 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_array
+	 * $2 = $json_elements
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: starting: "
+					       "json_array: JSON_OPEN_BRACKET json_elements JSON_CLOSE_BRACKET");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: $json_elements type: %s",
+					       json_item_type_name(yyvsp[-1]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to perform: "
+					       "$json_array = $json_elements;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to also perform: "
+					       "json_set_shrink($json_array);");
+	}
+
+	/*
+	 * action
+	 *
+	 * NOTE: json_elements is already the JTYPE_ARRAY: see json_elements below.
+	 */
+	yyval = yyvsp[-1];
+	json_set_shrink(yyval);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_array: returning $json_array type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: ending: "
+					       "json_array: JSON_OPEN_BRACKET json_elements JSON_CLOSE_BRACKET");
+	}
+    }
+#line 2012 "jparse.tab.c"
+    break;
+
+  case 16: /* json_array: "[" "]"  */
+#line 731 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_array
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: starting: "
+					       "json_array: JSON_OPEN_BRACKET JSON_CLOSE_BRACKET");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to perform: "
+					     "$json_array = json_create_array();");
+	}
+
+	/* action */
+	yyval = json_create_array();
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_array: returning $json_array type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: ending: "
+					       "json_array: JSON_OPEN_BRACKET JSON_CLOSE_BRACKET");
+	}
+    }
+#line 2042 "jparse.tab.c"
+    break;
+
+  case 17: /* json_elements: json_element  */
+#line 761 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_elements
+	 * $1 = $json_element
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: starting: "
+					       "json_elements: json_element");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $json_element type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
+					       "$json_elements = json_create_array();");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to also perform: "
+					       "$json_elements = json_array_add_value($json_elements, $json_element);");
+	}
+
+	/*
+	 * action
+	 *
+	 * NOTE: The values are added to the JTYPE_ARRAY that json_array returns,
+	 *	 so no JTYPE_ELEMENTS node has to be converted into it.
+	 */
+	yyval = json_create_array();
+	yyval = json_array_add_value(yyval, yyvsp[0]);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_elements: returning $json_elements type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: ending: "
+					       "json_elements: json_element");
+	}
+    }
+#line 2083 "jparse.tab.c"
+    break;
+
+  case 18: /* json_elements: json_elements "," json_element  */
+#line 800 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_elements
+	 * $3 = $json_element
+	 *
+	 * NOTE: Cannot use $json_elements due to ambiguity.
+	 *	 But we can use $3 for $json_element.
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: starting: "
+					       "json_elements: json_elements JSON_COMMA json_element");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $1 ($json_elements) type: %s",
+					       json_item_type_name(yyvsp[-2]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $3 ($json_element) type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
+					       "$$ = json_array_add_value($1, $json_element);");
+	}
+
+	/* action */
+	yyval = json_array_add_value(yyvsp[-2], yyvsp[0]);
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_elements: returning $$ ($json_elements) type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: ending: "
+					       "json_elements: json_elements JSON_COMMA json_element");
+	}
+    }
+#line 2121 "jparse.tab.c"
+    break;
+
+  case 19: /* json_element: json_value  */
+#line 838 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_element
+	 * $1 = $json_value
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_element: starting: "
+					       "json_element: json_value");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_element: $json_value type: %s",
+					       json_item_type_name(yyvsp[0]));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_element: about to perform: "
+					       "$json_element = $json_value;");
+	}
+
+	/* action */
+	yyval = yyvsp[0]; /* magic: json_element becomes json_value's type */
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_element: returning $json_element type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_element: ending: "
+					       "json_element: json_value");
+	}
+    }
+#line 2154 "jparse.tab.c"
+    break;
+
+  case 20: /* json_string: JSON_STRING  */
+#line 871 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_string
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: starting: "
+					       "json_string: JSON_STRING");
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yytext: <%.*s>",
+					     (int)jparse_leng(scanner), jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: about to perform: "
+					       "$json_string = parse_json_string(jparse_text(scanner), jparse_leng(scanner);");
+	}
+
+	/* action */
+	yyval = parse_json_string(jparse_text(scanner), jparse_leng(scanner));
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_string: returning $json_string type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: ending: "
+					       "json_string: JSON_STRING");
+	}
+    }
+#line 2187 "jparse.tab.c"
+    break;
+
+  case 21: /* json_number: JSON_NUMBER  */
+#line 904 "./jparse.y"
+    {
+	/*
+	 * $$ = $json_number
+	 */
+
+	/* pre-action debugging */
+	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: starting: "
+					       "json_number: JSON_NUMBER");
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: about to perform: "
+					       "$json_number = parse_json_number(jparse_text(scanner));");
+	}
+
+	/* action */
+	yyval = parse_json_number(jparse_text(scanner));
+
+	/* post-action debugging */
+	if (json_dbg_allowed(JSON_DBG_HIGH)) {
+	    json_dbg(JSON_DBG_HIGH, __func__, "under json_number: returning $json_number type: %s",
+					      json_item_type_name(yyval));
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: ending: "
+					       "json_number: JSON_NUMBER");
+	}
+    }
+#line 2219 "jparse.tab.c"
+    break;
+
+
+#line 2223 "jparse.tab.c"
+
+        default: break;
+      }
+    if (yychar_backup != yychar)
+      YY_LAC_DISCARD ("yychar change");
+  }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == JPARSE_EMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, tree, scanner, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= JPARSE_EOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == JPARSE_EOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, tree, scanner);
+          yychar = JPARSE_EMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, tree, scanner);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  /* If the stack popping above didn't lose the initial context for the
+     current lookahead token, the shift below will for sure.  */
+  YY_LAC_DISCARD ("error recovery");
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, tree, scanner, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != JPARSE_EMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, tree, scanner);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, tree, scanner);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yyes != yyesa)
+    YYSTACK_FREE (yyes);
+
+  return yyresult;
+}
+
+#line 934 "./jparse.y"
+
+
+
+/* Section 2: C code */
+
+
+/*
+ * yyerror	- generate an error message for the scanner/parser
+ *
+ * given:
+ *
+ *	yyltype	    location type
+ *	node	    pointer to struct json * or NULL
+ *	scanner	    scanner instance
+ *	format	    printf style format string
+ *	...	    optional parameters based on the format
+ *
+ */
+void
+yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const *format, ...)
+{
+    va_list ap;		/* variable argument list */
+    int ret;		/* libc function return value */
+    struct json_extra *extra;	/* scanner extra data */
+    FILE *errs = stderr;	/* where the message goes */
+
+    /*
+     * firewall
+     */
+    if (scanner == NULL) {
+	err(56, __func__, "NULL scanner");
+	not_reached();
+    }
+    /*
+     * stdarg variable argument list setup
+     */
+    va_start(ap, format);
+
+
+    /*
+     * the structural index scanner only works out locations when asked
+     */
+    extra = jparse_get_extra(scanner);
+    if (yyltype != NULL && extra != NULL && extra->scan != NULL) {
+	json_scan_locate(extra->scan, extra->filename, yyltype);
+    }
+    if (extra != NULL && extra->ctx != NULL && extra->ctx->errs != NULL) {
+	errs = extra->ctx->errs;
+    }
+
+    /*
+     * generate an error message for the JSON parser and scanner
+     */
+    vfpr(errs, __func__, format, ap);
+    if (node != NULL && *node != NULL) {
+	fprint(errs, " node type %s", json_item_type_name(*node));
+    }
+    if (yyltype != NULL) {
+	    if (yyltype->filename != NULL) {
+		fprint(errs, " in file %s", yyltype->filename);
+	    }
+	    fprint(errs, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
+    }
+    if (jparse_text(scanner) != NULL && jparse_leng(scanner) > 0 && *jparse_text(scanner) != '\0') {
+	fprint(errs, "<%.*s>\n", (int)jparse_leng(scanner), jparse_text(scanner));
+    } else if (jparse_text(scanner) == NULL) {
+	fprstr(errs, "text == NULL\n");
+    } else {
+	fprstr(errs, "empty text\n");
+    }
+
+    /*
+     * flush errs
+     */
+    clearerr(errs);             /* pre-clear ferror() status */
+    errno = 0;                  /* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+        if (ferror(errs)) {
+            warnp(__func__, "called from %s: error flushing stream", __func__);
+        } else if (feof(errs)) {
+            warnp(__func__, "called from %s: EOF while flushing stream", __func__);
+        } else {
+            warnp(__func__, "called from %s: unexpected fflush error while flushing stream", __func__);
+        }
+    }
+
+    /*
+     * stdarg variable argument list clean up
+     */
+    va_end(ap);
+}
+
+
+/*
+ * jparse_token - obtain the next token for the parser
+ *
+ * given:
+ *
+ *	yylval_param	semantic value of the token (not used)
+ *	yylloc_param	location of the token
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	the next token from jparse_lex() or, if the scanner extra data has a
+ *	structural index scanner, from json_scan_lex(), or JPARSE_error if the
+ *	token opens an object or array deeper than the context max_depth,
+ *	exceeds another limit of the context (see jparse_limit_token()) or is
+ *	a string with a \-escape that cannot be decoded
+ *
+ * NOTE: the structural index scanner does not update *yylloc_param as it goes:
+ *	 yyerror() asks it for the location when it is needed.
+ *
+ * NOTE: bison stops without calling yyerror() when given JPARSE_error, so the
+ *	 depth, limit and \-escape errors are reported here.
+ *
+ * NOTE: a string with a NUL byte in it sets the context nul_seen, see
+ *	 parse_json_stream_ctx().
+ */
+static int
+jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+    struct jparse_ctx *ctx;
+    int tok;
+
+    if (extra == NULL || extra->scan == NULL) {
+	tok = jparse_lex(yylval_param, yylloc_param, scanner);
+
+	/*
+	 * note a NUL byte in a string as the structural index scanner does
+	 */
+	if (tok == JSON_STRING && extra != NULL && extra->ctx != NULL &&
+	    memchr(jparse_get_text(scanner), '\0', (size_t)jparse_get_leng(scanner)) != NULL) {
+	    extra->ctx->nul_seen = true;
+	}
+    } else {
+	tok = json_scan_lex(extra->scan);
+    }
+
+    /*
+     * enforce the context limits, if any
+     */
+    ctx = (extra != NULL) ? extra->ctx : NULL;
+    if (ctx != NULL && !jparse_limit_token(ctx, tok, jparse_leng(scanner))) {
+	if (extra->scan != NULL) {
+	    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+	}
+	jparse_limit_error(ctx, extra->filename, yylloc_param);
+	return JPARSE_error;
+    }
+    if (ctx != NULL && ctx->max_depth != JSON_INFINITE_DEPTH) {
+	if (tok == JSON_OPEN_BRACE || tok == JSON_OPEN_BRACKET) {
+	    if (++ctx->depth > ctx->max_depth) {
+		if (extra->scan != NULL) {
+		    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+		}
+		ctx->limit = JPARSE_LIMIT_DEPTH;
+		jparse_depth_error(ctx->errs, ctx->max_depth, yylloc_param, jparse_text(scanner));
+		return JPARSE_error;
+	    }
+	} else if ((tok == JSON_CLOSE_BRACE || tok == JSON_CLOSE_BRACKET) && ctx->depth > 0) {
+	    --ctx->depth;
+	}
+    }
+
+    /*
+     * a bad \-escape is a syntax error, not a reason for parse_json_string() to exit
+     */
+    if (tok == JSON_STRING && !json_string_escapes_valid(jparse_text(scanner), jparse_leng(scanner))) {
+	yyerror(yylloc_param, NULL, scanner, "syntax error");
+	return JPARSE_error;
+    }
+    return tok;
+}
+
+
+/*
+ * jparse_limit_token - count a token against the limits of a parser context
+ *
+ * given:
+ *
+ *	ctx		parser context
+ *	tok		token kind
+ *	leng		length of the token, including the quotes of a string
+ *
+ * returns:
+ *	true ==> within the limits, false ==> ctx->limit is set to the limit the
+ *	token exceeds
+ *
+ * Each object, array, member name, string, number, true, false and null
+ * counts as one value against ctx->max_nodes.  The nesting of objects and
+ * arrays is checked against ctx->max_depth by each parser.
+ */
+bool
+jparse_limit_token(struct jparse_ctx *ctx, int tok, size_t leng)
+{
+    switch (tok) {
+    case JSON_STRING:
+	if (ctx->max_string != 0 && leng >= 2 && leng - 2 > ctx->max_string) {
+	    ctx->limit = JPARSE_LIMIT_STRING;
+	    return false;
+	}
+	break;
+    case JSON_NUMBER:
+	if (ctx->max_number != 0 && leng > ctx->max_number) {
+	    ctx->limit = JPARSE_LIMIT_NUMBER;
+	    return false;
+	}
+	break;
+    case JSON_OPEN_BRACE:
+    case JSON_OPEN_BRACKET:
+    case JSON_TRUE:
+    case JSON_FALSE:
+    case JSON_NULL:
+	break;
+    default:
+	return true;
+    }
+    if (ctx->max_nodes != 0 && ++ctx->nodes > ctx->max_nodes) {
+	ctx->limit = JPARSE_LIMIT_NODES;
+	return false;
+    }
+    return true;
+}
+
+
+/*
+ * jparse_limit_error - report that a limit of a parser context was exceeded
+ *
+ * given:
+ *
+ *	ctx		parser context whose limit member says which limit
+ *	filename	name of what was being parsed or NULL
+ *	loc		location of the token that exceeded it or NULL
+ *
+ * The text of the token is not given as a string that is too long may be
+ * very long indeed.
+ */
+void
+jparse_limit_error(struct jparse_ctx const *ctx, char const *filename, JPARSE_LTYPE const *loc)
+{
+    FILE *errs = (ctx->errs != NULL) ? ctx->errs : stderr;	/* stream to write to */
+    char const *what = NULL;	/* what exceeded the limit */
+    char const *name = NULL;	/* name of the limit */
+    uintmax_t max = 0;		/* value of the limit */
+    int ret;			/* libc function return value */
+
+    switch (ctx->limit) {
+    case JPARSE_LIMIT_DEPTH:
+	jparse_depth_error(ctx->errs, ctx->max_depth, loc, NULL);
+	return;
+    case JPARSE_LIMIT_BYTES:
+	what = "JSON length";
+	name = "max_bytes";
+	max = (uintmax_t)ctx->max_bytes;
+	break;
+    case JPARSE_LIMIT_NODES:
+	what = "number of values";
+	name = "max_nodes";
+	max = ctx->max_nodes;
+	break;
+    case JPARSE_LIMIT_STRING:
+	what = "string length";
+	name = "max_string";
+	max = (uintmax_t)ctx->max_string;
+	break;
+    case JPARSE_LIMIT_NUMBER:
+	what = "number length";
+	name = "max_number";
+	max = (uintmax_t)ctx->max_number;
+	break;
+    default:
+	return;
+    }
+    fprint(errs, "%s exceeds %s %ju", what, name, max);
+    if (loc != NULL && loc->filename != NULL) {
+	filename = loc->filename;
+    }
+    if (filename != NULL) {
+	fprint(errs, " in file %s", filename);
+    }
+    if (loc != NULL) {
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    fprstr(errs, "\n");
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_depth_error - report that the nesting of objects and arrays is too deep
+ *
+ * given:
+ *
+ *	errs		stream to write to, NULL ==> stderr
+ *	max_depth	nesting limit that was exceeded
+ *	loc		location of the token that exceeded it or NULL
+ *	text		text of that token or NULL
+ */
+void
+jparse_depth_error(FILE *errs, unsigned int max_depth, JPARSE_LTYPE const *loc, char const *text)
+{
+    int ret;		/* libc function return value */
+
+    if (errs == NULL) {
+	errs = stderr;
+    }
+    fprint(errs, "nesting depth exceeds max_depth %u", max_depth);
+    if (loc != NULL) {
+	if (loc->filename != NULL) {
+	    fprint(errs, " in file %s", loc->filename);
+	}
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    if (text != NULL && *text != '\0') {
+	fprint(errs, ": <%s>\n", text);
+    } else {
+	fprstr(errs, "\n");
+    }
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_text - text of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	text of the current token
+ *
+ * NOTE: the text of a JSON_STRING from the structural index scanner is NOT NUL
+ *	 terminated: use jparse_leng().
+ */
+static char const *
+jparse_text(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return jparse_get_text(scanner);
+    }
+    return json_scan_text(extra->scan);
+}
+
+
+/*
+ * jparse_leng - length of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	length of the current token
+ */
+static size_t
+jparse_leng(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return (size_t)jparse_get_leng(scanner);
+    }
+    return extra->scan->leng;
+}
@@ -159,8 +159,23 @@ const char *const jparse_library_version = JPARSE_LIBRARY_VERSION;  /* jparse li
 const char *const jparse_version = JPARSE_VERSION;		    /* jparse tool version */
 const char *const jparse_utf8_version = JPARSE_UTF8_VERSION;	    /* jparse utf8 version */
 
+/*
+ * token source
+ *
+ * The parser obtains tokens through jparse_token() rather than directly from
+ * jparse_lex() so that they may come from the structural index scanner in
+ * json_scan.c instead: see the scan member of struct json_extra. For the same
+ * reason the actions use jparse_text() and jparse_leng() and not
+ * jparse_get_text() and jparse_get_leng().
+ */
+static int jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
+static char const *jparse_text(yyscan_t scanner);
+static size_t jparse_leng(yyscan_t scanner);
+#undef yylex
+#define yylex jparse_token
 
-#line 113 "jparse.tab.c"
+
+#line 128 "jparse.tab.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -580,9 +595,9 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   230,   230,   288,   319,   350,   381,   412,   442,   472,
-     504,   535,   565,   599,   638,   674,   705,   735,   769,   807,
-     840,   872
+       0,   245,   245,   303,   334,   365,   396,   427,   457,   487,
+     519,   553,   583,   617,   656,   692,   730,   760,   799,   837,
+     870,   903
 };
 #endif
 
@@ -1545,7 +1560,7 @@ yyreduce:
     switch (yyn)
       {
   case 2: /* json: json_element  */
-#line 231 "./jparse.y"
+#line 246 "./jparse.y"
     {
 	/*
 	 * $$ = $json
@@ -1599,11 +1614,11 @@ yyreduce:
 					      "json: json_element");
 	}
     }
-#line 1552 "jparse.tab.c"
+#line 1567 "jparse.tab.c"
     break;
 
   case 3: /* json_value: json_object  */
-#line 289 "./jparse.y"
+#line 304 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1632,11 +1647,11 @@ yyreduce:
 					       "json_value: json_object");
 	}
     }
-#line 1585 "jparse.tab.c"
+#line 1600 "jparse.tab.c"
     break;
 
   case 4: /* json_value: json_array  */
-#line 320 "./jparse.y"
+#line 335 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1665,11 +1680,11 @@ yyreduce:
 					       "json_value: json_array");
 	}
     }
-#line 1618 "jparse.tab.c"
+#line 1633 "jparse.tab.c"
     break;
 
   case 5: /* json_value: json_string  */
-#line 351 "./jparse.y"
+#line 366 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1698,11 +1713,11 @@ yyreduce:
 					       "json_value: json_string");
 	}
     }
-#line 1651 "jparse.tab.c"
+#line 1666 "jparse.tab.c"
     break;
 
   case 6: /* json_value: json_number  */
-#line 382 "./jparse.y"
+#line 397 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1731,11 +1746,11 @@ yyreduce:
 					       "json_value: json_number");
 	}
     }
-#line 1684 "jparse.tab.c"
+#line 1699 "jparse.tab.c"
     break;
 
   case 7: /* json_value: "true"  */
-#line 413 "./jparse.y"
+#line 428 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1745,14 +1760,14 @@ yyreduce:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_TRUE");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%ju>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%ju>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_bool(jparse_get_text(scanner));");
+					       "$json_value = parse_json_bool(jparse_text(scanner));");
 	}
 
 	/* action */
-	yyval = parse_json_bool(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+	yyval = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -1763,11 +1778,11 @@ yyreduce:
 					       "json_value: JSON_TRUE");
 	}
     }
-#line 1716 "jparse.tab.c"
+#line 1731 "jparse.tab.c"
     break;
 
   case 8: /* json_value: "false"  */
-#line 443 "./jparse.y"
+#line 458 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1777,14 +1792,14 @@ yyreduce:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_FALSE");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_bool(jparse_get_text(scanner))");
+					       "$json_value = parse_json_bool(jparse_text(scanner))");
 	}
 
 	/* action */
-	yyval = parse_json_bool(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+	yyval = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -1795,11 +1810,11 @@ yyreduce:
 					     "json_value: JSON_FALSE");
 	}
     }
-#line 1748 "jparse.tab.c"
+#line 1763 "jparse.tab.c"
     break;
 
   case 9: /* json_value: "null"  */
-#line 473 "./jparse.y"
+#line 488 "./jparse.y"
     {
 	/*
 	 * $$ = $json_value
@@ -1809,14 +1824,14 @@ yyreduce:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_NULL");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_null(jparse_get_text(scanner));");
+					       "$json_value = parse_json_null(jparse_text(scanner));");
 	}
 
 	/* action */
-	yyval = parse_json_null(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_NULL type */
+	yyval = parse_json_null(jparse_text(scanner)); /* magic: json_value becomes JTYPE_NULL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -1827,11 +1842,11 @@ yyreduce:
 					       "json_value: JSON_NULL");
 	}
     }
-#line 1780 "jparse.tab.c"
+#line 1795 "jparse.tab.c"
     break;
 
   case 10: /* json_object: "{" json_members "}"  */
-#line 505 "./jparse.y"
+#line 520 "./jparse.y"
     {
 	/*
 	 * $$ = $json_object
@@ -1846,10 +1861,13 @@ yyreduce:
 					       json_item_type_name(yyvsp[-1]));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to perform: "
 					       "$json_object = $json_members;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to also perform: "
+					       "json_set_shrink($json_object);");
 	}
 
 	/* action */
 	yyval = yyvsp[-1]; /* magic: json_value becomes JTYPE_OBJECT type */
+	json_set_shrink(yyval);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -1860,11 +1878,11 @@ yyreduce:
 					       "json_object: JSON_OPEN_BRACE json_members JSON_CLOSE_BRACE");
 	}
     }
-#line 1813 "jparse.tab.c"
+#line 1831 "jparse.tab.c"
     break;
 
   case 11: /* json_object: "{" "}"  */
-#line 536 "./jparse.y"
+#line 554 "./jparse.y"
     {
 	/*
 	 * $$ = $json_object
@@ -1890,11 +1908,11 @@ yyreduce:
 					       "json_object: JSON_OPEN_BRACE JSON_CLOSE_BRACE");
 	}
     }
-#line 1843 "jparse.tab.c"
+#line 1861 "jparse.tab.c"
     break;
 
   case 12: /* json_members: json_member  */
-#line 566 "./jparse.y"
+#line 584 "./jparse.y"
     {
 	/*
 	 * $$ = $json_members
@@ -1926,11 +1944,11 @@ yyreduce:
 					      "json_members: json_member");
 	}
     }
-#line 1879 "jparse.tab.c"
+#line 1897 "jparse.tab.c"
     break;
 
   case 13: /* json_members: json_members "," json_member  */
-#line 600 "./jparse.y"
+#line 618 "./jparse.y"
     {
 	/*
 	 * $$ = $json_members
@@ -1965,11 +1983,11 @@ yyreduce:
 					       "json_members: json_members JSON_COMMA json_member");
 	}
     }
-#line 1918 "jparse.tab.c"
+#line 1936 "jparse.tab.c"
     break;
 
   case 14: /* json_member: json_string ":" json_element  */
-#line 639 "./jparse.y"
+#line 657 "./jparse.y"
     {
 	/*
 	 * $$ = $json_member
@@ -2001,11 +2019,11 @@ yyreduce:
 					       "json_member: json_string JSON_COLON json_element");
 	}
     }
-#line 1954 "jparse.tab.c"
+#line 1972 "jparse.tab.c"
     break;
 
   case 15: /* json_array: "[" json_elements "]"  */
-#line 675 "./jparse.y"
+#line 693 "./jparse.y"
     {
 	/*
 	 * $$ = $json_array
@@ -2019,26 +2037,33 @@ yyreduce:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: $json_elements type: %s",
 					       json_item_type_name(yyvsp[-1]));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to perform: "
-					       "$json_array = parse_json_array($json_elements);");
+					       "$json_array = $json_elements;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to also perform: "
+					       "json_set_shrink($json_array);");
 	}
 
-	/* action */
-	yyval = parse_json_array(yyvsp[-1]);
+	/*
+	 * action
+	 *
+	 * NOTE: json_elements is already the JTYPE_ARRAY: see json_elements below.
+	 */
+	yyval = yyvsp[-1];
+	json_set_shrink(yyval);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
 	    json_dbg(JSON_DBG_HIGH, __func__, "under json_array: returning $json_array type: %s",
 					      json_item_type_name(yyval));
-	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyvsp[-1], JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, yyval, JSON_DEFAULT_MAX_DEPTH);
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: ending: "
 					       "json_array: JSON_OPEN_BRACKET json_elements JSON_CLOSE_BRACKET");
 	}
     }
-#line 1987 "jparse.tab.c"
+#line 2012 "jparse.tab.c"
     break;
 
   case 16: /* json_array: "[" "]"  */
-#line 706 "./jparse.y"
+#line 731 "./jparse.y"
     {
 	/*
 	 * $$ = $json_array
@@ -2064,11 +2089,11 @@ yyreduce:
 					       "json_array: JSON_OPEN_BRACKET JSON_CLOSE_BRACKET");
 	}
     }
-#line 2017 "jparse.tab.c"
+#line 2042 "jparse.tab.c"
     break;
 
   case 17: /* json_elements: json_element  */
-#line 736 "./jparse.y"
+#line 761 "./jparse.y"
     {
 	/*
 	 * $$ = $json_elements
@@ -2082,14 +2107,19 @@ yyreduce:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $json_element type: %s",
 					       json_item_type_name(yyvsp[0]));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
-					       "$json_elements = json_create_elements();");
+					       "$json_elements = json_create_array();");
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to also perform: "
-					       "$json_elements = json_elements_add_value($json_elements, $json_element);");
+					       "$json_elements = json_array_add_value($json_elements, $json_element);");
 	}
 
-	/* action */
-	yyval = json_create_elements();
-	yyval = json_elements_add_value(yyval, yyvsp[0]);
+	/*
+	 * action
+	 *
+	 * NOTE: The values are added to the JTYPE_ARRAY that json_array returns,
+	 *	 so no JTYPE_ELEMENTS node has to be converted into it.
+	 */
+	yyval = json_create_array();
+	yyval = json_array_add_value(yyval, yyvsp[0]);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -2100,11 +2130,11 @@ yyreduce:
 					       "json_elements: json_element");
 	}
     }
-#line 2053 "jparse.tab.c"
+#line 2083 "jparse.tab.c"
     break;
 
   case 18: /* json_elements: json_elements "," json_element  */
-#line 770 "./jparse.y"
+#line 800 "./jparse.y"
     {
 	/*
 	 * $$ = $json_elements
@@ -2123,11 +2153,11 @@ yyreduce:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $3 ($json_element) type: %s",
 					       json_item_type_name(yyvsp[0]));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
-					       "$$ = json_elements_add_value($1, $json_element);");
+					       "$$ = json_array_add_value($1, $json_element);");
 	}
 
 	/* action */
-	yyval = json_elements_add_value(yyvsp[-2], yyvsp[0]);
+	yyval = json_array_add_value(yyvsp[-2], yyvsp[0]);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -2138,11 +2168,11 @@ yyreduce:
 					       "json_elements: json_elements JSON_COMMA json_element");
 	}
     }
-#line 2091 "jparse.tab.c"
+#line 2121 "jparse.tab.c"
     break;
 
   case 19: /* json_element: json_value  */
-#line 808 "./jparse.y"
+#line 838 "./jparse.y"
     {
 	/*
 	 * $$ = $json_element
@@ -2171,11 +2201,11 @@ yyreduce:
 					       "json_element: json_value");
 	}
     }
-#line 2124 "jparse.tab.c"
+#line 2154 "jparse.tab.c"
     break;
 
   case 20: /* json_string: JSON_STRING  */
-#line 841 "./jparse.y"
+#line 871 "./jparse.y"
     {
 	/*
 	 * $$ = $json_string
@@ -2185,14 +2215,15 @@ yyreduce:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: starting: "
 					       "json_string: JSON_STRING");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yytext: <%.*s>",
+					     (int)jparse_leng(scanner), jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: about to perform: "
-					       "$json_string = parse_json_string(jparse_get_text(scanner), (size_t)jparse_get_leng(scanner);");
+					       "$json_string = parse_json_string(jparse_text(scanner), jparse_leng(scanner);");
 	}
 
 	/* action */
-	yyval = parse_json_string(jparse_get_text(scanner), (size_t)jparse_get_leng(scanner));
+	yyval = parse_json_string(jparse_text(scanner), jparse_leng(scanner));
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -2203,11 +2234,11 @@ yyreduce:
 					       "json_string: JSON_STRING");
 	}
     }
-#line 2156 "jparse.tab.c"
+#line 2187 "jparse.tab.c"
     break;
 
   case 21: /* json_number: JSON_NUMBER  */
-#line 873 "./jparse.y"
+#line 904 "./jparse.y"
     {
 	/*
 	 * $$ = $json_number
@@ -2217,14 +2248,14 @@ yyreduce:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: starting: "
 					       "json_number: JSON_NUMBER");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: about to perform: "
-					       "$json_number = parse_json_number(jparse_get_text(scanner));");
+					       "$json_number = parse_json_number(jparse_text(scanner));");
 	}
 
 	/* action */
-	yyval = parse_json_number(jparse_get_text(scanner));
+	yyval = parse_json_number(jparse_text(scanner));
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -2235,11 +2266,11 @@ yyreduce:
 					       "json_number: JSON_NUMBER");
 	}
     }
-#line 2188 "jparse.tab.c"
+#line 2219 "jparse.tab.c"
     break;
 
 
-#line 2192 "jparse.tab.c"
+#line 2223 "jparse.tab.c"
 
         default: break;
       }
@@ -2446,7 +2477,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 903 "./jparse.y"
+#line 934 "./jparse.y"
 
 
 
@@ -2470,6 +2501,8 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
 {
     va_list ap;		/* variable argument list */
     int ret;		/* libc function return value */
+    struct json_extra *extra;	/* scanner extra data */
+    FILE *errs = stderr;	/* where the message goes */
 
     /*
      * firewall
@@ -2484,37 +2517,48 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
     va_start(ap, format);
 
 
+    /*
+     * the structural index scanner only works out locations when asked
+     */
+    extra = jparse_get_extra(scanner);
+    if (yyltype != NULL && extra != NULL && extra->scan != NULL) {
+	json_scan_locate(extra->scan, extra->filename, yyltype);
+    }
+    if (extra != NULL && extra->ctx != NULL && extra->ctx->errs != NULL) {
+	errs = extra->ctx->errs;
+    }
+
     /*
      * generate an error message for the JSON parser and scanner
      */
-    vfpr(stderr, __func__, format, ap);
+    vfpr(errs, __func__, format, ap);
     if (node != NULL && *node != NULL) {
-	fprint(stderr, " node type %s", json_item_type_name(*node));
+	fprint(errs, " node type %s", json_item_type_name(*node));
     }
     if (yyltype != NULL) {
 	    if (yyltype->filename != NULL) {
-		fprint(stderr, " in file %s", yyltype->filename);
+		fprint(errs, " in file %s", yyltype->filename);
 	    }
-	    fprint(stderr, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
+	    fprint(errs, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
     }
-    if (jparse_get_text(scanner) != NULL && *jparse_get_text(scanner) != '\0') {
-	fprint(stderr, "<%s>\n", jparse_get_text(scanner));
-    } else if (jparse_get_text(scanner) == NULL) {
-	fprstr(stderr, "text == NULL\n");
+    if (jparse_text(scanner) != NULL && jparse_leng(scanner) > 0 && *jparse_text(scanner) != '\0') {
+	fprint(errs, "<%.*s>\n", (int)jparse_leng(scanner), jparse_text(scanner));
+    } else if (jparse_text(scanner) == NULL) {
+	fprstr(errs, "text == NULL\n");
     } else {
-	fprstr(stderr, "empty text\n");
+	fprstr(errs, "empty text\n");
     }
 
     /*
-     * flush stderr
+     * flush errs
      */
-    clearerr(stderr);           /* pre-clear ferror() status */
+    clearerr(errs);             /* pre-clear ferror() status */
     errno = 0;                  /* pre-clear errno for warnp() */
-    ret = fflush(stderr);
+    ret = fflush(errs);
     if (ret == EOF) {
-        if (ferror(stderr)) {
+        if (ferror(errs)) {
             warnp(__func__, "called from %s: error flushing stream", __func__);
-        } else if (feof(stderr)) {
+        } else if (feof(errs)) {
             warnp(__func__, "called from %s: EOF while flushing stream", __func__);
         } else {
             warnp(__func__, "called from %s: unexpected fflush error while flushing stream", __func__);
@@ -2526,3 +2570,298 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
      */
     va_end(ap);
 }
+
+
+/*
+ * jparse_token - obtain the next token for the parser
+ *
+ * given:
+ *
+ *	yylval_param	semantic value of the token (not used)
+ *	yylloc_param	location of the token
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	the next token from jparse_lex() or, if the scanner extra data has a
+ *	structural index scanner, from json_scan_lex(), or JPARSE_error if the
+ *	token opens an object or array deeper than the context max_depth,
+ *	exceeds another limit of the context (see jparse_limit_token()) or is
+ *	a string with a \-escape that cannot be decoded
+ *
+ * NOTE: the structural index scanner does not update *yylloc_param as it goes:
+ *	 yyerror() asks it for the location when it is needed.
+ *
+ * NOTE: bison stops without calling yyerror() when given JPARSE_error, so the
+ *	 depth, limit and \-escape errors are reported here.
+ *
+ * NOTE: a string with a NUL byte in it sets the context nul_seen, see
+ *	 parse_json_stream_ctx().
+ */
+static int
+jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+    struct jparse_ctx *ctx;
+    int tok;
+
+    if (extra == NULL || extra->scan == NULL) {
+	tok = jparse_lex(yylval_param, yylloc_param, scanner);
+
+	/*
+	 * note a NUL byte in a string as the structural index scanner does
+	 */
+	if (tok == JSON_STRING && extra != NULL && extra->ctx != NULL &&
+	    memchr(jparse_get_text(scanner), '\0', (size_t)jparse_get_leng(scanner)) != NULL) {
+	    extra->ctx->nul_seen = true;
+	}
+    } else {
+	tok = json_scan_lex(extra->scan);
+    }
+
+    /*
+     * enforce the context limits, if any
+     */
+    ctx = (extra != NULL) ? extra->ctx : NULL;
+    if (ctx != NULL && !jparse_limit_token(ctx, tok, jparse_leng(scanner))) {
+	if (extra->scan != NULL) {
+	    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+	}
+	jparse_limit_error(ctx, extra->filename, yylloc_param);
+	return JPARSE_error;
+    }
+    if (ctx != NULL && ctx->max_depth != JSON_INFINITE_DEPTH) {
+	if (tok == JSON_OPEN_BRACE || tok == JSON_OPEN_BRACKET) {
+	    if (++ctx->depth > ctx->max_depth) {
+		if (extra->scan != NULL) {
+		    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+		}
+		ctx->limit = JPARSE_LIMIT_DEPTH;
+		jparse_depth_error(ctx->errs, ctx->max_depth, yylloc_param, jparse_text(scanner));
+		return JPARSE_error;
+	    }
+	} else if ((tok == JSON_CLOSE_BRACE || tok == JSON_CLOSE_BRACKET) && ctx->depth > 0) {
+	    --ctx->depth;
+	}
+    }
+
+    /*
+     * a bad \-escape is a syntax error, not a reason for parse_json_string() to exit
+     */
+    if (tok == JSON_STRING && !json_string_escapes_valid(jparse_text(scanner), jparse_leng(scanner))) {
+	yyerror(yylloc_param, NULL, scanner, "syntax error");
+	return JPARSE_error;
+    }
+    return tok;
+}
+
+
+/*
+ * jparse_limit_token - count a token against the limits of a parser context
+ *
+ * given:
+ *
+ *	ctx		parser context
+ *	tok		token kind
+ *	leng		length of the token, including the quotes of a string
+ *
+ * returns:
+ *	true ==> within the limits, false ==> ctx->limit is set to the limit the
+ *	token exceeds
+ *
+ * Each object, array, member name, string, number, true, false and null
+ * counts as one value against ctx->max_nodes.  The nesting of objects and
+ * arrays is checked against ctx->max_depth by each parser.
+ */
+bool
+jparse_limit_token(struct jparse_ctx *ctx, int tok, size_t leng)
+{
+    switch (tok) {
+    case JSON_STRING:
+	if (ctx->max_string != 0 && leng >= 2 && leng - 2 > ctx->max_string) {
+	    ctx->limit = JPARSE_LIMIT_STRING;
+	    return false;
+	}
+	break;
+    case JSON_NUMBER:
+	if (ctx->max_number != 0 && leng > ctx->max_number) {
+	    ctx->limit = JPARSE_LIMIT_NUMBER;
+	    return false;
+	}
+	break;
+    case JSON_OPEN_BRACE:
+    case JSON_OPEN_BRACKET:
+    case JSON_TRUE:
+    case JSON_FALSE:
+    case JSON_NULL:
+	break;
+    default:
+	return true;
+    }
+    if (ctx->max_nodes != 0 && ++ctx->nodes > ctx->max_nodes) {
+	ctx->limit = JPARSE_LIMIT_NODES;
+	return false;
+    }
+    return true;
+}
+
+
+/*
+ * jparse_limit_error - report that a limit of a parser context was exceeded
+ *
+ * given:
+ *
+ *	ctx		parser context whose limit member says which limit
+ *	filename	name of what was being parsed or NULL
+ *	loc		location of the token that exceeded it or NULL
+ *
+ * The text of the token is not given as a string that is too long may be
+ * very long indeed.
+ */
+void
+jparse_limit_error(struct jparse_ctx const *ctx, char const *filename, JPARSE_LTYPE const *loc)
+{
+    FILE *errs = (ctx->errs != NULL) ? ctx->errs : stderr;	/* stream to write to */
+    char const *what = NULL;	/* what exceeded the limit */
+    char const *name = NULL;	/* name of the limit */
+    uintmax_t max = 0;		/* value of the limit */
+    int ret;			/* libc function return value */
+
+    switch (ctx->limit) {
+    case JPARSE_LIMIT_DEPTH:
+	jparse_depth_error(ctx->errs, ctx->max_depth, loc, NULL);
+	return;
+    case JPARSE_LIMIT_BYTES:
+	what = "JSON length";
+	name = "max_bytes";
+	max = (uintmax_t)ctx->max_bytes;
+	break;
+    case JPARSE_LIMIT_NODES:
+	what = "number of values";
+	name = "max_nodes";
+	max = ctx->max_nodes;
+	break;
+    case JPARSE_LIMIT_STRING:
+	what = "string length";
+	name = "max_string";
+	max = (uintmax_t)ctx->max_string;
+	break;
+    case JPARSE_LIMIT_NUMBER:
+	what = "number length";
+	name = "max_number";
+	max = (uintmax_t)ctx->max_number;
+	break;
+    default:
+	return;
+    }
+    fprint(errs, "%s exceeds %s %ju", what, name, max);
+    if (loc != NULL && loc->filename != NULL) {
+	filename = loc->filename;
+    }
+    if (filename != NULL) {
+	fprint(errs, " in file %s", filename);
+    }
+    if (loc != NULL) {
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    fprstr(errs, "\n");
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_depth_error - report that the nesting of objects and arrays is too deep
+ *
+ * given:
+ *
+ *	errs		stream to write to, NULL ==> stderr
+ *	max_depth	nesting limit that was exceeded
+ *	loc		location of the token that exceeded it or NULL
+ *	text		text of that token or NULL
+ */
+void
+jparse_depth_error(FILE *errs, unsigned int max_depth, JPARSE_LTYPE const *loc, char const *text)
+{
+    int ret;		/* libc function return value */
+
+    if (errs == NULL) {
+	errs = stderr;
+    }
+    fprint(errs, "nesting depth exceeds max_depth %u", max_depth);
+    if (loc != NULL) {
+	if (loc->filename != NULL) {
+	    fprint(errs, " in file %s", loc->filename);
+	}
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    if (text != NULL && *text != '\0') {
+	fprint(errs, ": <%s>\n", text);
+    } else {
+	fprstr(errs, "\n");
+    }
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_text - text of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	text of the current token
+ *
+ * NOTE: the text of a JSON_STRING from the structural index scanner is NOT NUL
+ *	 terminated: use jparse_leng().
+ */
+static char const *
+jparse_text(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return jparse_get_text(scanner);
+    }
+    return json_scan_text(extra->scan);
+}
+
+
+/*
+ * jparse_leng - length of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	length of the current token
+ */
+static size_t
+jparse_leng(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return (size_t)jparse_get_leng(scanner);
+    }
+    return extra->scan->leng;
+}
@@ -104,7 +104,7 @@
 extern int jparse_debug;
 #endif
 /* "%code requires" blocks.  */
-#line 119 "./jparse.y"
+#line 134 "./jparse.y"
 
     #if !defined(JPARSE_LTYPE_IS_DECLARED)
     struct JPARSE_LTYPE
@@ -195,7 +195,7 @@ struct JPARSE_LTYPE
 int jparse_parse (struct json **tree, yyscan_t scanner);
 
 /* "%code provides" blocks.  */
-#line 111 "./jparse.y"
+#line 126 "./jparse.y"
 
 #ifndef YY_DECL
 #define YY_DECL int jparse_lex(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t yyscanner)
@@ -106,6 +106,21 @@ const char *const jparse_library_version = JPARSE_LIBRARY_VERSION;  /* jparse li
 const char *const jparse_version = JPARSE_VERSION;		    /* jparse tool version */
 const char *const jparse_utf8_version = JPARSE_UTF8_VERSION;	    /* jparse utf8 version */
 
+/*
+ * token source
+ *
+ * The parser obtains tokens through jparse_token() rather than directly from
+ * jparse_lex() so that they may come from the structural index scanner in
+ * json_scan.c instead: see the scan member of struct json_extra. For the same
+ * reason the actions use jparse_text() and jparse_leng() and not
+ * jparse_get_text() and jparse_get_leng().
+ */
+static int jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner);
+static char const *jparse_text(yyscan_t scanner);
+static size_t jparse_leng(yyscan_t scanner);
+#undef yylex
+#define yylex jparse_token
+
 %}
 
 %code provides {
@@ -419,14 +434,14 @@ json_value:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_TRUE");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%ju>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%ju>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_bool(jparse_get_text(scanner));");
+					       "$json_value = parse_json_bool(jparse_text(scanner));");
 	}
 
 	/* action */
-	$json_value = parse_json_bool(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+	$json_value = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -449,14 +464,14 @@ json_value:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_FALSE");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_bool(jparse_get_text(scanner))");
+					       "$json_value = parse_json_bool(jparse_text(scanner))");
 	}
 
 	/* action */
-	$json_value = parse_json_bool(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
+	$json_value = parse_json_bool(jparse_text(scanner)); /* magic: json_value becomes JTYPE_BOOL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -479,14 +494,14 @@ json_value:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: starting: "
 					       "json_value: JSON_NULL");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_value: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_value: about to perform: "
-					       "$json_value = parse_json_null(jparse_get_text(scanner));");
+					       "$json_value = parse_json_null(jparse_text(scanner));");
 	}
 
 	/* action */
-	$json_value = parse_json_null(jparse_get_text(scanner)); /* magic: json_value becomes JTYPE_NULL type */
+	$json_value = parse_json_null(jparse_text(scanner)); /* magic: json_value becomes JTYPE_NULL type */
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -516,10 +531,13 @@ json_object:
 					       json_item_type_name($json_members));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to perform: "
 					       "$json_object = $json_members;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_object: about to also perform: "
+					       "json_set_shrink($json_object);");
 	}
 
 	/* action */
 	$json_object = $json_members; /* magic: json_value becomes JTYPE_OBJECT type */
+	json_set_shrink($json_object);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -685,17 +703,24 @@ json_array:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: $json_elements type: %s",
 					       json_item_type_name($json_elements));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to perform: "
-					       "$json_array = parse_json_array($json_elements);");
+					       "$json_array = $json_elements;");
+	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: about to also perform: "
+					       "json_set_shrink($json_array);");
 	}
 
-	/* action */
-	$json_array = parse_json_array($json_elements);
+	/*
+	 * action
+	 *
+	 * NOTE: json_elements is already the JTYPE_ARRAY: see json_elements below.
+	 */
+	$json_array = $json_elements;
+	json_set_shrink($json_array);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
 	    json_dbg(JSON_DBG_HIGH, __func__, "under json_array: returning $json_array type: %s",
 					      json_item_type_name($json_array));
-	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, $json_elements, JSON_DEFAULT_MAX_DEPTH);
+	    json_dbg_tree_print(JSON_DBG_HIGH, __func__, $json_array, JSON_DEFAULT_MAX_DEPTH);
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_array: ending: "
 					       "json_array: JSON_OPEN_BRACKET json_elements JSON_CLOSE_BRACKET");
 	}
@@ -746,14 +771,19 @@ json_elements:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $json_element type: %s",
 					       json_item_type_name($json_element));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
-					       "$json_elements = json_create_elements();");
+					       "$json_elements = json_create_array();");
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to also perform: "
-					       "$json_elements = json_elements_add_value($json_elements, $json_element);");
+					       "$json_elements = json_array_add_value($json_elements, $json_element);");
 	}
 
-	/* action */
-	$json_elements = json_create_elements();
-	$json_elements = json_elements_add_value($json_elements, $json_element);
+	/*
+	 * action
+	 *
+	 * NOTE: The values are added to the JTYPE_ARRAY that json_array returns,
+	 *	 so no JTYPE_ELEMENTS node has to be converted into it.
+	 */
+	$json_elements = json_create_array();
+	$json_elements = json_array_add_value($json_elements, $json_element);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -785,11 +815,11 @@ json_elements:
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: $3 ($json_element) type: %s",
 					       json_item_type_name($3));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_elements: about to perform: "
-					       "$$ = json_elements_add_value($1, $json_element);");
+					       "$$ = json_array_add_value($1, $json_element);");
 	}
 
 	/* action */
-	$$ = json_elements_add_value($1, $json_element);
+	$$ = json_array_add_value($1, $json_element);
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -847,14 +877,15 @@ json_string:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: starting: "
 					       "json_string: JSON_STRING");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yytext: <%.*s>",
+					     (int)jparse_leng(scanner), jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_string: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_string: about to perform: "
-					       "$json_string = parse_json_string(jparse_get_text(scanner), (size_t)jparse_get_leng(scanner);");
+					       "$json_string = parse_json_string(jparse_text(scanner), jparse_leng(scanner);");
 	}
 
 	/* action */
-	$json_string = parse_json_string(jparse_get_text(scanner), (size_t)jparse_get_leng(scanner));
+	$json_string = parse_json_string(jparse_text(scanner), jparse_leng(scanner));
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -879,14 +910,14 @@ json_number:
 	if (json_dbg_allowed(JSON_DBG_VHIGH)) {
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: starting: "
 					       "json_number: JSON_NUMBER");
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yytext: <%s>", jparse_get_text(scanner));
-	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yyleng: <%jd>", (intmax_t)jparse_get_leng(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yytext: <%s>", jparse_text(scanner));
+	    json_dbg(JSON_DBG_VVHIGH, __func__, "under json_number: yyleng: <%jd>", (intmax_t)jparse_leng(scanner));
 	    json_dbg(JSON_DBG_VHIGH, __func__, "under json_number: about to perform: "
-					       "$json_number = parse_json_number(jparse_get_text(scanner));");
+					       "$json_number = parse_json_number(jparse_text(scanner));");
 	}
 
 	/* action */
-	$json_number = parse_json_number(jparse_get_text(scanner));
+	$json_number = parse_json_number(jparse_text(scanner));
 
 	/* post-action debugging */
 	if (json_dbg_allowed(JSON_DBG_HIGH)) {
@@ -923,6 +954,8 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
 {
     va_list ap;		/* variable argument list */
     int ret;		/* libc function return value */
+    struct json_extra *extra;	/* scanner extra data */
+    FILE *errs = stderr;	/* where the message goes */
 
     /*
      * firewall
@@ -937,37 +970,48 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
     va_start(ap, format);
 
 
+    /*
+     * the structural index scanner only works out locations when asked
+     */
+    extra = jparse_get_extra(scanner);
+    if (yyltype != NULL && extra != NULL && extra->scan != NULL) {
+	json_scan_locate(extra->scan, extra->filename, yyltype);
+    }
+    if (extra != NULL && extra->ctx != NULL && extra->ctx->errs != NULL) {
+	errs = extra->ctx->errs;
+    }
+
     /*
      * generate an error message for the JSON parser and scanner
      */
-    vfpr(stderr, __func__, format, ap);
+    vfpr(errs, __func__, format, ap);
     if (node != NULL && *node != NULL) {
-	fprint(stderr, " node type %s", json_item_type_name(*node));
+	fprint(errs, " node type %s", json_item_type_name(*node));
     }
     if (yyltype != NULL) {
 	    if (yyltype->filename != NULL) {
-		fprint(stderr, " in file %s", yyltype->filename);
+		fprint(errs, " in file %s", yyltype->filename);
 	    }
-	    fprint(stderr, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
+	    fprint(errs, " at line %d column %d: ", yyltype->first_line, yyltype->first_column);
     }
-    if (jparse_get_text(scanner) != NULL && *jparse_get_text(scanner) != '\0') {
-	fprint(stderr, "<%s>\n", jparse_get_text(scanner));
-    } else if (jparse_get_text(scanner) == NULL) {
-	fprstr(stderr, "text == NULL\n");
+    if (jparse_text(scanner) != NULL && jparse_leng(scanner) > 0 && *jparse_text(scanner) != '\0') {
+	fprint(errs, "<%.*s>\n", (int)jparse_leng(scanner), jparse_text(scanner));
+    } else if (jparse_text(scanner) == NULL) {
+	fprstr(errs, "text == NULL\n");
     } else {
-	fprstr(stderr, "empty text\n");
+	fprstr(errs, "empty text\n");
     }
 
     /*
-     * flush stderr
+     * flush errs
      */
-    clearerr(stderr);           /* pre-clear ferror() status */
+    clearerr(errs);             /* pre-clear ferror() status */
     errno = 0;                  /* pre-clear errno for warnp() */
-    ret = fflush(stderr);
+    ret = fflush(errs);
     if (ret == EOF) {
-        if (ferror(stderr)) {
+        if (ferror(errs)) {
             warnp(__func__, "called from %s: error flushing stream", __func__);
-        } else if (feof(stderr)) {
+        } else if (feof(errs)) {
             warnp(__func__, "called from %s: EOF while flushing stream", __func__);
         } else {
             warnp(__func__, "called from %s: unexpected fflush error while flushing stream", __func__);
@@ -979,3 +1023,298 @@ yyerror(JPARSE_LTYPE *yyltype, struct json **node, yyscan_t scanner, char const
      */
     va_end(ap);
 }
+
+
+/*
+ * jparse_token - obtain the next token for the parser
+ *
+ * given:
+ *
+ *	yylval_param	semantic value of the token (not used)
+ *	yylloc_param	location of the token
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	the next token from jparse_lex() or, if the scanner extra data has a
+ *	structural index scanner, from json_scan_lex(), or JPARSE_error if the
+ *	token opens an object or array deeper than the context max_depth,
+ *	exceeds another limit of the context (see jparse_limit_token()) or is
+ *	a string with a \-escape that cannot be decoded
+ *
+ * NOTE: the structural index scanner does not update *yylloc_param as it goes:
+ *	 yyerror() asks it for the location when it is needed.
+ *
+ * NOTE: bison stops without calling yyerror() when given JPARSE_error, so the
+ *	 depth, limit and \-escape errors are reported here.
+ *
+ * NOTE: a string with a NUL byte in it sets the context nul_seen, see
+ *	 parse_json_stream_ctx().
+ */
+static int
+jparse_token(JPARSE_STYPE *yylval_param, JPARSE_LTYPE *yylloc_param, yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+    struct jparse_ctx *ctx;
+    int tok;
+
+    if (extra == NULL || extra->scan == NULL) {
+	tok = jparse_lex(yylval_param, yylloc_param, scanner);
+
+	/*
+	 * note a NUL byte in a string as the structural index scanner does
+	 */
+	if (tok == JSON_STRING && extra != NULL && extra->ctx != NULL &&
+	    memchr(jparse_get_text(scanner), '\0', (size_t)jparse_get_leng(scanner)) != NULL) {
+	    extra->ctx->nul_seen = true;
+	}
+    } else {
+	tok = json_scan_lex(extra->scan);
+    }
+
+    /*
+     * enforce the context limits, if any
+     */
+    ctx = (extra != NULL) ? extra->ctx : NULL;
+    if (ctx != NULL && !jparse_limit_token(ctx, tok, jparse_leng(scanner))) {
+	if (extra->scan != NULL) {
+	    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+	}
+	jparse_limit_error(ctx, extra->filename, yylloc_param);
+	return JPARSE_error;
+    }
+    if (ctx != NULL && ctx->max_depth != JSON_INFINITE_DEPTH) {
+	if (tok == JSON_OPEN_BRACE || tok == JSON_OPEN_BRACKET) {
+	    if (++ctx->depth > ctx->max_depth) {
+		if (extra->scan != NULL) {
+		    json_scan_locate(extra->scan, extra->filename, yylloc_param);
+		}
+		ctx->limit = JPARSE_LIMIT_DEPTH;
+		jparse_depth_error(ctx->errs, ctx->max_depth, yylloc_param, jparse_text(scanner));
+		return JPARSE_error;
+	    }
+	} else if ((tok == JSON_CLOSE_BRACE || tok == JSON_CLOSE_BRACKET) && ctx->depth > 0) {
+	    --ctx->depth;
+	}
+    }
+
+    /*
+     * a bad \-escape is a syntax error, not a reason for parse_json_string() to exit
+     */
+    if (tok == JSON_STRING && !json_string_escapes_valid(jparse_text(scanner), jparse_leng(scanner))) {
+	yyerror(yylloc_param, NULL, scanner, "syntax error");
+	return JPARSE_error;
+    }
+    return tok;
+}
+
+
+/*
+ * jparse_limit_token - count a token against the limits of a parser context
+ *
+ * given:
+ *
+ *	ctx		parser context
+ *	tok		token kind
+ *	leng		length of the token, including the quotes of a string
+ *
+ * returns:
+ *	true ==> within the limits, false ==> ctx->limit is set to the limit the
+ *	token exceeds
+ *
+ * Each object, array, member name, string, number, true, false and null
+ * counts as one value against ctx->max_nodes.  The nesting of objects and
+ * arrays is checked against ctx->max_depth by each parser.
+ */
+bool
+jparse_limit_token(struct jparse_ctx *ctx, int tok, size_t leng)
+{
+    switch (tok) {
+    case JSON_STRING:
+	if (ctx->max_string != 0 && leng >= 2 && leng - 2 > ctx->max_string) {
+	    ctx->limit = JPARSE_LIMIT_STRING;
+	    return false;
+	}
+	break;
+    case JSON_NUMBER:
+	if (ctx->max_number != 0 && leng > ctx->max_number) {
+	    ctx->limit = JPARSE_LIMIT_NUMBER;
+	    return false;
+	}
+	break;
+    case JSON_OPEN_BRACE:
+    case JSON_OPEN_BRACKET:
+    case JSON_TRUE:
+    case JSON_FALSE:
+    case JSON_NULL:
+	break;
+    default:
+	return true;
+    }
+    if (ctx->max_nodes != 0 && ++ctx->nodes > ctx->max_nodes) {
+	ctx->limit = JPARSE_LIMIT_NODES;
+	return false;
+    }
+    return true;
+}
+
+
+/*
+ * jparse_limit_error - report that a limit of a parser context was exceeded
+ *
+ * given:
+ *
+ *	ctx		parser context whose limit member says which limit
+ *	filename	name of what was being parsed or NULL
+ *	loc		location of the token that exceeded it or NULL
+ *
+ * The text of the token is not given as a string that is too long may be
+ * very long indeed.
+ */
+void
+jparse_limit_error(struct jparse_ctx const *ctx, char const *filename, JPARSE_LTYPE const *loc)
+{
+    FILE *errs = (ctx->errs != NULL) ? ctx->errs : stderr;	/* stream to write to */
+    char const *what = NULL;	/* what exceeded the limit */
+    char const *name = NULL;	/* name of the limit */
+    uintmax_t max = 0;		/* value of the limit */
+    int ret;			/* libc function return value */
+
+    switch (ctx->limit) {
+    case JPARSE_LIMIT_DEPTH:
+	jparse_depth_error(ctx->errs, ctx->max_depth, loc, NULL);
+	return;
+    case JPARSE_LIMIT_BYTES:
+	what = "JSON length";
+	name = "max_bytes";
+	max = (uintmax_t)ctx->max_bytes;
+	break;
+    case JPARSE_LIMIT_NODES:
+	what = "number of values";
+	name = "max_nodes";
+	max = ctx->max_nodes;
+	break;
+    case JPARSE_LIMIT_STRING:
+	what = "string length";
+	name = "max_string";
+	max = (uintmax_t)ctx->max_string;
+	break;
+    case JPARSE_LIMIT_NUMBER:
+	what = "number length";
+	name = "max_number";
+	max = (uintmax_t)ctx->max_number;
+	break;
+    default:
+	return;
+    }
+    fprint(errs, "%s exceeds %s %ju", what, name, max);
+    if (loc != NULL && loc->filename != NULL) {
+	filename = loc->filename;
+    }
+    if (filename != NULL) {
+	fprint(errs, " in file %s", filename);
+    }
+    if (loc != NULL) {
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    fprstr(errs, "\n");
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_depth_error - report that the nesting of objects and arrays is too deep
+ *
+ * given:
+ *
+ *	errs		stream to write to, NULL ==> stderr
+ *	max_depth	nesting limit that was exceeded
+ *	loc		location of the token that exceeded it or NULL
+ *	text		text of that token or NULL
+ */
+void
+jparse_depth_error(FILE *errs, unsigned int max_depth, JPARSE_LTYPE const *loc, char const *text)
+{
+    int ret;		/* libc function return value */
+
+    if (errs == NULL) {
+	errs = stderr;
+    }
+    fprint(errs, "nesting depth exceeds max_depth %u", max_depth);
+    if (loc != NULL) {
+	if (loc->filename != NULL) {
+	    fprint(errs, " in file %s", loc->filename);
+	}
+	fprint(errs, " at line %d column %d", loc->first_line, loc->first_column);
+    }
+    if (text != NULL && *text != '\0') {
+	fprint(errs, ": <%s>\n", text);
+    } else {
+	fprstr(errs, "\n");
+    }
+
+    /*
+     * flush the stream
+     */
+    clearerr(errs);		/* pre-clear ferror() status */
+    errno = 0;			/* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * jparse_text - text of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	text of the current token
+ *
+ * NOTE: the text of a JSON_STRING from the structural index scanner is NOT NUL
+ *	 terminated: use jparse_leng().
+ */
+static char const *
+jparse_text(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return jparse_get_text(scanner);
+    }
+    return json_scan_text(extra->scan);
+}
+
+
+/*
+ * jparse_leng - length of the current token
+ *
+ * given:
+ *
+ *	scanner		scanner instance
+ *
+ * returns:
+ *	length of the current token
+ */
+static size_t
+jparse_leng(yyscan_t scanner)
+{
+    struct json_extra *extra = jparse_get_extra(scanner);
+
+    if (extra == NULL || extra->scan == NULL) {
+	return (size_t)jparse_get_leng(scanner);
+    }
+    return extra->scan->leng;
+}
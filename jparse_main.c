@@ -23,6 +23,7 @@
 
 
 #include <stdio.h>
+#include <limits.h>
 #include <unistd.h>
 
 /*
@@ -40,7 +41,7 @@
  * usage message
  */
 static const char * const usage_msg =
-    "usage: %s [-h] [-v level] [-J level] [-q] [-V] [-s] arg\n"
+    "usage: %s [-h] [-v level] [-J level] [-q] [-V] [-s] [-B backend] [-P parser] [-m depth] [-L name=max] [-c size] [-l] [-r] [-n] [-a] [-i] [-w indent] [-e count] arg\n"
     "\n"
     "\t-h\t\tprint help message and exit\n"
     "\t-v level\tset verbosity level (def level: %d)\n"
@@ -48,6 +49,30 @@ static const char * const usage_msg =
     "\t-q\t\tquiet mode: silence msg(), warn(), warnp() if -v 0 (def: not quiet)\n"
     "\t-V\t\tprint version string and exit\n"
     "\t-s\t\targ is a string (def: arg is a filename)\n"
+    "\t-B backend\tscanner backend: flex or index (def: flex)\n"
+    "\t-P parser\tparser: bison or fast (def: bison)\n"
+    "\t\t\tNOTE: the fast parser always uses the index scanner backend\n"
+    "\t-m depth\tfail if objects and arrays nest deeper than depth, 0 ==> no limit (def: 0)\n"
+    "\t-L name=max\tfail as soon as the JSON exceeds a limit, 0 ==> no limit (def: 0), name is one of:\n"
+    "\t\t\t    bytes\tlength of the JSON in bytes\n"
+    "\t\t\t    nodes\tnumber of objects, arrays, names, strings, numbers, true, false and null\n"
+    "\t\t\t    string\tlength of a string or member name in bytes\n"
+    "\t\t\t    number\tlength of a number in bytes\n"
+    "\t\t\tNOTE: -L may be given more than once\n"
+    "\t-c size\t\tfeed the push parser size bytes at a time (def: parse all at once)\n"
+    "\t\t\tNOTE: the push parser is the fast parser\n"
+    "\t-l\t\targ is a sequence of JSON texts, one per line (NDJSON / JSON Lines)\n"
+    "\t-r\t\targ is a sequence of JSON texts, each starting with a RS byte (RFC 7464)\n"
+    "\t\t\tNOTE: with -l or -r, each invalid record is reported and arg is invalid if any record is\n"
+    "\t-n\t\tonly check that arg is valid JSON, without building a parse tree\n"
+    "\t-a\t\tbuild the parse tree in an arena, freed all at once (def: allocate each node on its own)\n"
+    "\t-i\t\tintern member names: each different name is stored once (def: store each name on its own)\n"
+    "\t\t\tNOTE: with -l or -r, the names are shared by all records\n"
+    "\t-w indent\twrite the parse tree to stdout as JSON, compact if indent is 0, else indent spaces per level\n"
+    "\t\t\tNOTE: with -l or -r, each valid record is written on a line of its own\n"
+    "\t-e count\tparse with parse_json_events() and write the JSON its callbacks are given to stdout,\n"
+    "\t\t\tcompact, stopping after count callbacks, 0 ==> no limit\n"
+    "\t\t\tNOTE: JSON that is valid as far as the callbacks were called is valid\n"
     "\n"
     "\targ\t\tparse JSON for string (if -s), file (w/o -s), or stdin (if arg is -)\n"
     "\n"
@@ -63,10 +88,41 @@ static const char * const usage_msg =
     "jparse library version: %s";
 
 
+/*
+ * struct write_events - what the event_*() callbacks of -e write to
+ */
+struct write_events
+{
+    struct json_buf out;	/* what is to be written to stdout */
+    bool comma;			/* true ==> a value was just written, so the next one needs a ',' */
+    uintmax_t count;		/* callbacks called so far */
+    uintmax_t max;		/* callbacks to call before stopping, 0 ==> no limit */
+};
+
+
 /*
  * static functions
  */
 static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
+static struct json *parse_chunks(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, size_t size,
+				 bool *is_valid);
+static bool validate_only(char const *arg, bool string_flag_used, unsigned int max_depth);
+static bool parse_limit(char const *arg, struct jparse_ctx *limits);
+static bool check_record(struct json *tree, struct json_seq_record const *rec, void *arg);
+static void parse_records(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, enum json_seq_mode mode,
+			  unsigned int *write_indent, bool *is_valid);
+static void write_tree(struct json const *tree, unsigned int indent);
+static bool events_only(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, uintmax_t count);
+static bool event_put(struct write_events *we, bool value, char const *ptr, size_t len, bool quoted);
+static bool event_object_start(void *arg);
+static bool event_object_end(void *arg);
+static bool event_array_start(void *arg);
+static bool event_array_end(void *arg);
+static bool event_member_name(char const *ptr, size_t len, void *arg);
+static bool event_string(char const *ptr, size_t len, void *arg);
+static bool event_number(char const *ptr, size_t len, void *arg);
+static bool event_boolean(bool value, void *arg);
+static bool event_null(void *arg);
 
 int
 main(int argc, char **argv)
@@ -77,6 +133,21 @@ main(int argc, char **argv)
     bool string_flag_used = false;  /* true ==> -S string was used */
     bool valid_json = false;	    /* true ==> JSON parse was valid */
     struct json *tree = NULL;	    /* JSON parse tree or NULL */
+    struct jparse_ctx *ctx = NULL;  /* parser context */
+    uintmax_t max_depth = JSON_INFINITE_DEPTH;	/* -m depth */
+    struct jparse_ctx limits;	    /* -L name=max limits, only the max_ members are used */
+    bool limit_flag_used = false;   /* true ==> -L was used */
+    uintmax_t chunk_size = 0;	    /* -c size, 0 ==> parse all at once */
+    bool seq_flag_used = false;	    /* true ==> -l or -r was used */
+    enum json_seq_mode seq_mode = JSON_SEQ_LINES;	/* -l or -r record delimiter */
+    bool validate_flag_used = false;	/* true ==> -n was used */
+    struct json_arena *arena = NULL;	/* -a arena to build the parse tree in, or NULL */
+    struct json_intern *intern = NULL;	/* -i intern table of member names, or NULL */
+    intmax_t write_indent = 0;	    /* -w indent */
+    bool write_flag_used = false;   /* true ==> -w was used */
+    unsigned int indent = 0;	    /* write_indent as an unsigned int */
+    intmax_t event_count = 0;	    /* -e count, 0 ==> no limit */
+    bool events_flag_used = false;  /* true ==> -e was used */
     int arg_count = 0;		    /* number of args to process */
     int i;
 
@@ -84,7 +155,8 @@ main(int argc, char **argv)
      * parse args
      */
     program = argv[0];
-    while ((i = getopt(argc, argv, ":hv:qVsJ:")) != -1) {
+    memset(&limits, 0, sizeof(limits));
+    while ((i = getopt(argc, argv, ":hv:qVsJ:B:P:m:L:c:lrnaiw:e:")) != -1) {
 	switch (i) {
 	case 'h':		/* -h - print help to stderr and exit 0 */
 	    usage(2, program, ""); /*ooo*/
@@ -123,6 +195,81 @@ main(int argc, char **argv)
 	case 's':
 	    string_flag_used = true;
 	    break;
+	case 'B':		/* -B backend - select the scanner backend */
+	    if (strcmp(optarg, "flex") == 0) {
+		json_scanner_backend = JSON_SCANNER_FLEX;
+	    } else if (strcmp(optarg, "index") == 0) {
+		json_scanner_backend = JSON_SCANNER_INDEX;
+	    } else {
+		usage(3, program, "invalid -B backend"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'P':		/* -P parser - select the parser */
+	    if (strcmp(optarg, "bison") == 0) {
+		json_parser_backend = JSON_PARSER_BISON;
+	    } else if (strcmp(optarg, "fast") == 0) {
+		json_parser_backend = JSON_PARSER_FAST;
+	    } else {
+		usage(3, program, "invalid -P parser"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'm':		/* -m depth - limit the nesting of objects and arrays */
+	    if (!string_to_uintmax(optarg, &max_depth) || max_depth > UINT_MAX) {
+		usage(3, program, "invalid -m depth"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'L':		/* -L name=max - fail as soon as the JSON exceeds a limit */
+	    if (!parse_limit(optarg, &limits)) {
+		usage(3, program, "invalid -L name=max"); /*ooo*/
+		not_reached();
+	    }
+	    limit_flag_used = true;
+	    break;
+	case 'c':		/* -c size - feed the push parser size bytes at a time */
+	    if (!string_to_uintmax(optarg, &chunk_size) || chunk_size == 0 || chunk_size > SIZE_MAX) {
+		usage(3, program, "invalid -c size"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'l':		/* -l - arg is JSON texts one per line */
+	    seq_flag_used = true;
+	    seq_mode = JSON_SEQ_LINES;
+	    break;
+	case 'r':		/* -r - arg is RFC 7464 JSON texts */
+	    seq_flag_used = true;
+	    seq_mode = JSON_SEQ_RS;
+	    break;
+	case 'n':		/* -n - only check that arg is valid JSON */
+	    validate_flag_used = true;
+	    break;
+	case 'a':		/* -a - build the parse tree in an arena */
+	    if (arena == NULL) {
+		arena = json_arena_create();
+	    }
+	    break;
+	case 'i':		/* -i - intern member names */
+	    if (intern == NULL) {
+		intern = json_intern_create();
+	    }
+	    break;
+	case 'w':		/* -w indent - write the parse tree as JSON */
+	    if (!string_to_intmax(optarg, &write_indent) || write_indent < 0 || write_indent > UINT_MAX) {
+		usage(3, program, "invalid -w indent"); /*ooo*/
+		not_reached();
+	    }
+	    write_flag_used = true;
+	    indent = (unsigned int)write_indent;
+	    break;
+	case 'e':		/* -e count - write the JSON parse_json_events() calls back with */
+	    if (!string_to_intmax(optarg, &event_count) || event_count < 0) {
+		usage(3, program, "invalid -e count"); /*ooo*/
+		not_reached();
+	    }
+	    events_flag_used = true;
+	    break;
 	case ':':   /* option requires an argument */
 	case '?':   /* illegal option */
 	default:    /* anything else but should not actually happen */
@@ -137,16 +284,100 @@ main(int argc, char **argv)
 	usage(3, program, "wrong number of arguments"); /*ooo*/
 	not_reached();
     }
+    if (seq_flag_used && chunk_size > 0) {
+	usage(3, program, "-c cannot be used with -l or -r"); /*ooo*/
+	not_reached();
+    }
+    if (validate_flag_used && (seq_flag_used || chunk_size > 0 || limit_flag_used || arena != NULL ||
+				intern != NULL || write_flag_used)) {
+	usage(3, program, "-n cannot be used with -a, -c, -i, -L, -l, -r or -w"); /*ooo*/
+	not_reached();
+    }
+    if (events_flag_used && (validate_flag_used || seq_flag_used || chunk_size > 0 || arena != NULL ||
+			     intern != NULL || write_flag_used)) {
+	usage(3, program, "-e cannot be used with -a, -c, -i, -l, -n, -r or -w"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * case: only check the JSON, no parser context or parse tree is needed
+     */
+    if (validate_flag_used) {
+	dbg(DBG_HIGH, "Calling validate_only(\"%s\", %s, %ju):",
+		      argv[argc-1], string_flag_used ? "true" : "false", max_depth);
+	if (!validate_only(argv[argc-1], string_flag_used, (unsigned int)max_depth)) {
+	    err(1, program, "invalid JSON"); /*ooo*/
+	    not_reached();
+	}
+	if (verbosity_level > 0) {
+	    msg("valid JSON");
+	}
+	exit(0); /*ooo*/
+    }
+
+    /*
+     * setup the parser context
+     *
+     * jparse_ctx_create() picks up the -B and -P backends from the globals set above.
+     */
+    ctx = jparse_ctx_create();
+    ctx->max_depth = (unsigned int)max_depth;
+    ctx->max_bytes = limits.max_bytes;
+    ctx->max_nodes = limits.max_nodes;
+    ctx->max_string = limits.max_string;
+    ctx->max_number = limits.max_number;
+
+    /*
+     * with -a every node of the parse tree comes from the arena
+     */
+    if (arena != NULL) {
+	(void) json_arena_use(arena);
+    }
+
+    /*
+     * with -i each member name is looked up in the intern table
+     */
+    if (intern != NULL) {
+	(void) json_intern_use(intern);
+    }
+
+    /*
+     * case: write the JSON that the parse_json_events() callbacks are given
+     */
+    if (events_flag_used) {
+
+	dbg(DBG_HIGH, "Calling events_only(ctx, \"%s\", %s, %jd):",
+		      argv[argc-1], string_flag_used ? "true" : "false", event_count);
+	valid_json = events_only(ctx, argv[argc-1], string_flag_used, (uintmax_t)event_count);
+
+    /*
+     * case: parse each record of a sequence of JSON texts
+     */
+    } else if (seq_flag_used) {
+
+	dbg(DBG_HIGH, "Calling parse_records(ctx, \"%s\", %s, %s, &valid_json):",
+		      argv[argc-1], string_flag_used ? "true" : "false",
+		      seq_mode == JSON_SEQ_RS ? "JSON_SEQ_RS" : "JSON_SEQ_LINES");
+	parse_records(ctx, argv[argc-1], string_flag_used, seq_mode, write_flag_used ? &indent : NULL, &valid_json);
+
+    /*
+     * case: feed arg to the push parser a chunk at a time
+     */
+    } else if (chunk_size > 0) {
+
+	dbg(DBG_HIGH, "Calling parse_chunks(ctx, \"%s\", %s, %ju, &valid_json):",
+		      argv[argc-1], string_flag_used ? "true" : "false", chunk_size);
+	tree = parse_chunks(ctx, argv[argc-1], string_flag_used, (size_t)chunk_size, &valid_json);
 
     /*
      * case: process -s arg
      */
-    if (string_flag_used == true) {
+    } else if (string_flag_used == true) {
 
 	/* parse arg as a block of json input */
-	dbg(DBG_HIGH, "Calling parse_json(\"%s\", %ju, NULL, &valid_json):",
+	dbg(DBG_HIGH, "Calling parse_json_ctx(ctx, \"%s\", %ju, NULL, &valid_json):",
 		      argv[argc-1], (uintmax_t)strlen(argv[argc-1]));
-	tree = parse_json(argv[argc-1], strlen(argv[argc-1]), NULL, &valid_json);
+	tree = parse_json_ctx(ctx, argv[argc-1], strlen(argv[argc-1]), NULL, &valid_json);
 
     /*
      * case: process file arg
@@ -154,21 +385,39 @@ main(int argc, char **argv)
     } else {
 
 	/* parse arg as a json filename */
-	dbg(DBG_HIGH, "Calling parse_json_file(\"%s\", &valid_json):", argv[argc-1]);
-	tree = parse_json_file(argv[argc-1], &valid_json);
+	dbg(DBG_HIGH, "Calling parse_json_file_ctx(ctx, \"%s\", &valid_json):", argv[argc-1]);
+	tree = parse_json_file_ctx(ctx, argv[argc-1], &valid_json);
     }
+    jparse_ctx_free(ctx);
+    ctx = NULL;
 
     if (tree == NULL) {
-	warn(program, "JSON parse tree is NULL");
+	if (!seq_flag_used && !events_flag_used) {
+	    warn(program, "JSON parse tree is NULL");
+	}
     }
     /*
-     * free the JSON parse tree
+     * with -w write the JSON parse tree and then free it
      */
     else {
-	json_tree_free(tree, JSON_INFINITE_DEPTH);
-	free(tree);
+	if (write_flag_used && valid_json) {
+	    write_tree(tree, indent);
+	}
+	json_tree_release(tree);
 	tree = NULL;
     }
+    if (arena != NULL) {
+	dbg(DBG_HIGH, "the parse tree took %ju bytes of the arena", (uintmax_t)arena->bytes);
+	(void) json_arena_use(NULL);
+	json_arena_free(arena);
+	arena = NULL;
+    }
+    if (intern != NULL) {
+	dbg(DBG_HIGH, "interned %ju member names in %ju bytes", (uintmax_t)intern->count, (uintmax_t)intern->bytes);
+	(void) json_intern_use(NULL);
+	json_intern_free(intern);
+	intern = NULL;
+    }
 
     /*
      * firewall - JSON parser must have returned a valid JSON parse tree
@@ -229,3 +478,542 @@ usage(int exitcode, char const *prog, char const *str)
     exit(exitcode); /*ooo*/
     not_reached();
 }
+
+
+/*
+ * parse_chunks - feed a string or file to the push parser a chunk at a time
+ *
+ * given:
+ *	ctx		parser context
+ *	arg		JSON string or filename ("-" ==> stdin)
+ *	string_flag_used    true ==> arg is a string, false ==> arg is a filename
+ *	size		bytes to give jparse_push_feed() at a time
+ *	is_valid	pointer to boolean to set depending on JSON validity
+ *
+ * returns:
+ *	JSON parse tree
+ *
+ * A file is read a chunk at a time, so it is never held in memory all at once.
+ */
+static struct json *
+parse_chunks(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, size_t size, bool *is_valid)
+{
+    FILE *stream = NULL;	/* file to read from */
+    char *buf = NULL;		/* chunk read from stream */
+    size_t len = 0;		/* length of arg or bytes read */
+    size_t i;
+
+    /*
+     * case: feed the string
+     */
+    if (string_flag_used) {
+	jparse_push_begin(ctx, NULL);
+	len = strlen(arg);
+	for (i = 0; i < len; i += size) {
+	    if (!jparse_push_feed(ctx, arg + i, (len - i < size) ? len - i : size)) {
+		break;
+	    }
+	}
+	return jparse_push_end(ctx, is_valid);
+    }
+
+    /*
+     * case: feed the file
+     */
+    if (strcmp(arg, "-") == 0) {
+	stream = stdin;
+    } else {
+	errno = 0;	/* pre-clear errno for warnp() */
+	stream = fopen(arg, "r");
+	if (stream == NULL) {
+	    warnp(__func__, "couldn't open file %s", arg);
+	    *is_valid = false;
+	    return NULL;
+	}
+    }
+    errno = 0;		/* pre-clear errno for errp() */
+    buf = malloc(size);
+    if (buf == NULL) {
+	errp(4, __func__, "malloc of %ju bytes failed", (uintmax_t)size);
+	not_reached();
+    }
+    jparse_push_begin(ctx, arg);
+    while ((len = fread(buf, 1, size, stream)) > 0) {
+	if (!jparse_push_feed(ctx, buf, len)) {
+	    break;
+	}
+    }
+    if (ferror(stream)) {
+	warnp(__func__, "error reading %s", arg);
+    }
+    free(buf);
+    buf = NULL;
+    clearerr_or_fclose(stream);
+    return jparse_push_end(ctx, is_valid);
+}
+
+
+/*
+ * parse_limit - parse the name=max argument of -L
+ *
+ * given:
+ *	arg	    bytes=max, nodes=max, string=max or number=max
+ *	limits	    where to set the max_bytes, max_nodes, max_string or max_number member
+ *
+ * returns:
+ *	true ==> the limit was set, false ==> arg is not valid
+ */
+static bool
+parse_limit(char const *arg, struct jparse_ctx *limits)
+{
+    char const *eq = NULL;	/* the = in arg */
+    uintmax_t max = 0;		/* the value after the = */
+    size_t name_len = 0;	/* length of the name before the = */
+
+    eq = strchr(arg, '=');
+    if (eq == NULL || !string_to_uintmax(eq + 1, &max)) {
+	return false;
+    }
+    name_len = (size_t)(eq - arg);
+    if (name_len == sizeof("nodes")-1 && strncmp(arg, "nodes", name_len) == 0) {
+	limits->max_nodes = max;
+	return true;
+    }
+    if (max > SIZE_MAX) {
+	return false;
+    }
+    if (name_len == sizeof("bytes")-1 && strncmp(arg, "bytes", name_len) == 0) {
+	limits->max_bytes = (size_t)max;
+    } else if (name_len == sizeof("string")-1 && strncmp(arg, "string", name_len) == 0) {
+	limits->max_string = (size_t)max;
+    } else if (name_len == sizeof("number")-1 && strncmp(arg, "number", name_len) == 0) {
+	limits->max_number = (size_t)max;
+    } else {
+	return false;
+    }
+    return true;
+}
+
+
+/*
+ * validate_only - check a string or file without building a parse tree
+ *
+ * given:
+ *	arg		    string or filename (- means stdin)
+ *	string_flag_used    true ==> arg is a string
+ *	max_depth	    most nested objects and arrays, JSON_INFINITE_DEPTH ==> no limit
+ *
+ * returns:
+ *	true ==> arg is valid JSON, false ==> it is not (where was reported)
+ */
+static bool
+validate_only(char const *arg, bool string_flag_used, unsigned int max_depth)
+{
+    struct json_validator v;	/* validator state */
+    FILE *stream = NULL;	/* file to read from */
+    bool valid = false;		/* true ==> arg is valid JSON */
+
+    json_validator_init(&v);
+    v.max_depth = max_depth;
+
+    /*
+     * case: check the string
+     */
+    if (string_flag_used) {
+	valid = json_validator_feed(&v, arg, strlen(arg)) && json_validator_end(&v);
+
+    /*
+     * case: check the file a block at a time
+     */
+    } else {
+	if (strcmp(arg, "-") == 0) {
+	    stream = stdin;
+	} else {
+	    errno = 0;	/* pre-clear errno for warnp() */
+	    stream = fopen(arg, "r");
+	    if (stream == NULL) {
+		warnp(__func__, "couldn't open file %s", arg);
+		json_validator_fini(&v);
+		return false;
+	    }
+	}
+	valid = json_validate_stream(&v, stream);
+	clearerr_or_fclose(stream);
+    }
+    if (!valid) {
+	warn(__func__, "invalid JSON in %s at line %ju column %ju byte offset %ju",
+		       string_flag_used ? "-" : arg, v.line, v.column, v.offset);
+    }
+    json_validator_fini(&v);
+    return valid;
+}
+
+/*
+ * check_record - report a record of a sequence of JSON texts
+ *
+ * given:
+ *	tree	    parse tree of the record, or NULL
+ *	rec	    the record
+ *	arg	    pointer to the -w indent, or NULL if the record is not written
+ *
+ * returns:
+ *	true, to parse every record
+ */
+static bool
+check_record(struct json *tree, struct json_seq_record const *rec, void *arg)
+{
+    unsigned int const *write_indent = arg;	/* -w indent or NULL */
+
+    if (rec->is_valid) {
+	dbg(DBG_MED, "record %ju at line %ju byte offset %ju: valid JSON", rec->number, rec->line, rec->offset);
+	if (write_indent != NULL && tree != NULL) {
+	    write_tree(tree, *write_indent);
+	}
+    } else {
+	warn(__func__, "record %ju at line %ju byte offset %ju: invalid JSON", rec->number, rec->line, rec->offset);
+    }
+    if (tree != NULL) {
+	json_tree_release(tree);
+    }
+
+    /*
+     * with -a the record was built in the arena: free it for the next one
+     */
+    if (json_arena_in_use() != NULL) {
+	json_arena_reset(json_arena_in_use());
+    }
+    return true;
+}
+
+
+/*
+ * parse_records - parse each record of a string or file of JSON texts
+ *
+ * given:
+ *	ctx		    parser context to parse every record with
+ *	arg		    string or filename (- means stdin)
+ *	string_flag_used    true ==> arg is a string
+ *	mode		    how the records are delimited
+ *	write_indent	    pointer to the -w indent, or NULL if the records are not written
+ *	is_valid	    set to true if every record is valid JSON
+ */
+static void
+parse_records(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, enum json_seq_mode mode,
+	      unsigned int *write_indent, bool *is_valid)
+{
+    FILE *stream = NULL;	/* file to read from */
+    uintmax_t count = 0;	/* number of records parsed */
+
+    /*
+     * case: parse the string
+     */
+    if (string_flag_used) {
+	count = parse_json_seq_ctx(ctx, arg, strlen(arg), NULL, mode, check_record, write_indent, is_valid);
+
+    /*
+     * case: parse the file
+     */
+    } else {
+	if (strcmp(arg, "-") == 0) {
+	    stream = stdin;
+	} else {
+	    errno = 0;	/* pre-clear errno for warnp() */
+	    stream = fopen(arg, "r");
+	    if (stream == NULL) {
+		warnp(__func__, "couldn't open file %s", arg);
+		*is_valid = false;
+		return;
+	    }
+	}
+	count = parse_json_seq_stream_ctx(ctx, stream, arg, mode, check_record, write_indent, is_valid);
+	clearerr_or_fclose(stream);
+    }
+    dbg(DBG_LOW, "parsed %ju record%s", count, count == 1 ? "" : "s");
+    return;
+}
+
+
+/*
+ * write_tree - write a parse tree to stdout as JSON, followed by a newline
+ *
+ * given:
+ *	tree	    parse tree to write
+ *	indent	    0 ==> compact JSON, else spaces per level of pretty JSON
+ *
+ * NOTE: This function does not return if the tree cannot be written.
+ */
+static void
+write_tree(struct json const *tree, unsigned int indent)
+{
+    struct json_buf out;	/* what is to be written to stdout */
+    bool written = false;	/* true ==> tree was written */
+
+    json_buf_init_stream(&out, stdout);
+    written = json_tree_write(tree, &out, indent) && json_buf_putc(&out, '\n');
+    if (!json_buf_fini(&out) || !written || fflush(stdout) != 0) {
+	err(5, __func__, "could not write the JSON parse tree"); /*ooo*/
+	not_reached();
+    }
+    return;
+}
+
+
+/*
+ * events_only - write the JSON that the parse_json_events() callbacks are given
+ *
+ * given:
+ *	ctx		    parser context
+ *	arg		    string or filename (- means stdin)
+ *	string_flag_used    true ==> arg is a string
+ *	count		    callbacks to call before stopping the parse, 0 ==> no limit
+ *
+ * returns:
+ *	true ==> arg is valid JSON or the parse was stopped, false ==> it is not valid
+ *
+ * The JSON is written to stdout compact, with a newline after it, from the
+ * parts of it that the callbacks are given, so it is the same JSON as arg
+ * without the whitespace between tokens.  When the parse is stopped only the
+ * parts before the stop are written.
+ *
+ * NOTE: This function does not return if the JSON cannot be written.
+ */
+static bool
+events_only(struct jparse_ctx *ctx, char const *arg, bool string_flag_used, uintmax_t count)
+{
+    static struct json_events const events = {
+	event_object_start, event_object_end, event_array_start, event_array_end,
+	event_member_name, event_string, event_number, event_boolean, event_null
+    };
+    struct write_events we;		/* callback state */
+    FILE *stream = NULL;		/* file to read from */
+    char *data = NULL;			/* contents of the file */
+    size_t len = 0;			/* length of arg or of data */
+    enum json_events_result result = JSON_EVENTS_INVALID;	/* what parse_json_events_ctx() returned */
+    bool written = false;		/* true ==> the JSON was written */
+
+    memset(&we, 0, sizeof(we));
+    we.max = count;
+    json_buf_init_stream(&we.out, stdout);
+
+    /*
+     * case: parse the string
+     */
+    if (string_flag_used) {
+	result = parse_json_events_ctx(ctx, arg, strlen(arg), NULL, &events, &we);
+
+    /*
+     * case: parse the file
+     */
+    } else {
+	if (strcmp(arg, "-") == 0) {
+	    stream = stdin;
+	} else {
+	    errno = 0;	/* pre-clear errno for warnp() */
+	    stream = fopen(arg, "r");
+	    if (stream == NULL) {
+		warnp(__func__, "couldn't open file %s", arg);
+		(void) json_buf_fini(&we.out);
+		return false;
+	    }
+	}
+	data = read_all(stream, &len);
+	clearerr_or_fclose(stream);
+	if (data == NULL) {
+	    warn(__func__, "couldn't read %s", arg);
+	    (void) json_buf_fini(&we.out);
+	    return false;
+	}
+	result = parse_json_events_ctx(ctx, data, len, arg, &events, &we);
+	free(data);
+	data = NULL;
+    }
+    if (result == JSON_EVENTS_STOPPED) {
+	dbg(DBG_MED, "parse stopped after %ju callbacks", we.count);
+    }
+    written = json_buf_putc(&we.out, '\n');
+    if (!json_buf_fini(&we.out) || !written || fflush(stdout) != 0) {
+	err(6, __func__, "could not write the JSON"); /*ooo*/
+	not_reached();
+    }
+    return result != JSON_EVENTS_INVALID;
+}
+
+
+/*
+ * event_put - write a part of the JSON for an event_*() callback
+ *
+ * given:
+ *	we	    callback state
+ *	value	    true ==> ptr starts a value or a member name, which needs a ','
+ *		    after a value, false ==> ptr ends an object or array
+ *	ptr	    text to write
+ *	len	    length of ptr
+ *	quoted	    true ==> write ptr between '"'s
+ *
+ * returns:
+ *	true ==> go on with the parse, false ==> the -e count has been reached
+ */
+static bool
+event_put(struct write_events *we, bool value, char const *ptr, size_t len, bool quoted)
+{
+    if (we->max > 0 && we->count >= we->max) {
+	return false;
+    }
+    ++we->count;
+    if (value && we->comma) {
+	(void) json_buf_putc(&we->out, ',');
+    }
+    if (quoted) {
+	(void) json_buf_putc(&we->out, '"');
+    }
+    (void) json_buf_write(&we->out, ptr, len);
+    if (quoted) {
+	(void) json_buf_putc(&we->out, '"');
+    }
+    return true;
+}
+
+
+/*
+ * event_object_start - parse_json_events() callback for '{'
+ */
+static bool
+event_object_start(void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, "{", 1, false)) {
+	return false;
+    }
+    we->comma = false;
+    return true;
+}
+
+
+/*
+ * event_object_end - parse_json_events() callback for '}'
+ */
+static bool
+event_object_end(void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, false, "}", 1, false)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
+
+
+/*
+ * event_array_start - parse_json_events() callback for '['
+ */
+static bool
+event_array_start(void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, "[", 1, false)) {
+	return false;
+    }
+    we->comma = false;
+    return true;
+}
+
+
+/*
+ * event_array_end - parse_json_events() callback for ']'
+ */
+static bool
+event_array_end(void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, false, "]", 1, false)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
+
+
+/*
+ * event_member_name - parse_json_events() callback for the name of a member
+ */
+static bool
+event_member_name(char const *ptr, size_t len, void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, ptr, len, true)) {
+	return false;
+    }
+    (void) json_buf_putc(&we->out, ':');
+    we->comma = false;
+    return true;
+}
+
+
+/*
+ * event_string - parse_json_events() callback for a string
+ */
+static bool
+event_string(char const *ptr, size_t len, void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, ptr, len, true)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
+
+
+/*
+ * event_number - parse_json_events() callback for a number
+ */
+static bool
+event_number(char const *ptr, size_t len, void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, ptr, len, false)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
+
+
+/*
+ * event_boolean - parse_json_events() callback for true or false
+ */
+static bool
+event_boolean(bool value, void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, value ? "true" : "false", value ? 4 : 5, false)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
+
+
+/*
+ * event_null - parse_json_events() callback for null
+ */
+static bool
+event_null(void *arg)
+{
+    struct write_events *we = arg;	/* callback state */
+
+    if (!event_put(we, true, "null", 4, false)) {
+	return false;
+    }
+    we->comma = true;
+    return true;
+}
@@ -610,7 +610,7 @@ vupdate_tbl(struct json *node, unsigned int depth, va_list ap)
 	 * case: if JTYPE_MEMBER - match non-NULL non-empty JSON encoded name
 	 */
 	if (node->type == JTYPE_MEMBER && p->type == JTYPE_MEMBER && p->name != NULL) {
-	    struct json_member const *item = &(node->item.member);
+	    struct json_member const *item = json_get_member(node);
 
 	    /*
 	     * match encoded name
@@ -646,7 +646,7 @@ vupdate_tbl(struct json *node, unsigned int depth, va_list ap)
 	new.depth = depth;
 	new.type = node->type;
 	if (node->type == JTYPE_MEMBER) {
-	    struct json_member const *item = &(node->item.member);
+	    struct json_member const *item = json_get_member(node);
 	    new.name = item->name_str;
 	    new.name_len = item->name_str_len;
 	} else {
@@ -0,0 +1,414 @@
+/*
+ * json_arena - bump allocator for JSON parse trees
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * json_arena - bump allocator for JSON parse trees
+ */
+#include "json_arena.h"
+
+
+/*
+ * definitions
+ */
+#define ARENA_ALIGN (_Alignof(max_align_t))	/* alignment of what an arena hands out */
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))	/* n rounded up to ARENA_ALIGN */
+#define ARENA_HEADER ARENA_ROUND(sizeof(struct json_arena_block))	/* bytes before the data of a block */
+#define ARENA_DATA(b) ((char *)(b) + ARENA_HEADER)	/* data of block b */
+
+
+/*
+ * static variables
+ */
+static _Thread_local struct json_arena *arena_in_use = NULL;	/* arena of this thread, see json_arena_use() */
+
+
+/*
+ * static functions
+ */
+static struct json_arena_block *arena_block(struct json_arena *arena, size_t size);
+
+
+/*
+ * arena_block - find or allocate the block to hand out size bytes from
+ *
+ * given:
+ *	arena	    arena to allocate from
+ *	size	    bytes needed, a multiple of ARENA_ALIGN
+ *
+ * returns:
+ *	block with at least size bytes unused
+ *
+ * The unused blocks after arena->cur, kept by json_arena_reset(), are tried
+ * first.  A new block holds block_size bytes or, for a bigger allocation,
+ * just that allocation: it then goes after arena->cur so that what is left in
+ * arena->cur is not wasted.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static struct json_arena_block *
+arena_block(struct json_arena *arena, size_t size)
+{
+    struct json_arena_block *b = NULL;	/* block to hand out from */
+    size_t block_size = 0;		/* bytes after the header of a new block */
+
+    /*
+     * case: a block kept by json_arena_reset() is big enough
+     */
+    for (b = arena->cur; b != NULL; b = b->next) {
+	if (b->size - b->used >= size) {
+	    arena->cur = b;
+	    return b;
+	}
+    }
+
+    /*
+     * allocate a new block
+     */
+    block_size = ARENA_ROUND(arena->block_size > 0 ? arena->block_size : JSON_ARENA_BLOCK);
+    if (size > block_size / 2) {
+	block_size = size;
+    }
+    if (block_size > SIZE_MAX - ARENA_HEADER) {
+	err(114, __func__, "arena block of %ju bytes is too big", (uintmax_t)block_size);
+	not_reached();
+    }
+    errno = 0;		/* pre-clear errno for errp() */
+    b = malloc(ARENA_HEADER + block_size);
+    if (b == NULL) {
+	errp(115, __func__, "malloc of arena block of %ju bytes failed", (uintmax_t)block_size);
+	not_reached();
+    }
+    b->size = block_size;
+    b->used = 0;
+
+    /*
+     * link the block in
+     */
+    if (arena->cur == NULL) {
+	b->next = arena->first;
+	arena->first = b;
+	arena->cur = b;
+    } else {
+	b->next = arena->cur->next;
+	arena->cur->next = b;
+	if (block_size != size) {
+	    arena->cur = b;
+	}
+    }
+    return b;
+}
+
+
+/*
+ * json_arena_init - initialise an arena
+ *
+ * given:
+ *	arena	    arena to initialise
+ *
+ * No block is allocated until something is allocated from the arena.
+ *
+ * NOTE: this function does not return on NULL arena.
+ */
+void
+json_arena_init(struct json_arena *arena)
+{
+    /*
+     * firewall
+     */
+    if (arena == NULL) {
+	err(116, __func__, "arena is NULL");
+	not_reached();
+    }
+
+    memset(arena, 0, sizeof(*arena));
+    arena->block_size = JSON_ARENA_BLOCK;
+    arena->first = NULL;
+    arena->cur = NULL;
+    arena->bytes = 0;
+}
+
+
+/*
+ * json_arena_fini - free the blocks of an arena
+ *
+ * given:
+ *	arena	    arena from json_arena_init(), may be NULL
+ *
+ * Everything allocated from the arena is freed.  The struct json_arena itself
+ * is not freed: it may be used again as if json_arena_init() had been called.
+ */
+void
+json_arena_fini(struct json_arena *arena)
+{
+    struct json_arena_block *b = NULL;	/* block to free */
+
+    if (arena == NULL) {
+	return;
+    }
+    if (arena_in_use == arena) {
+	arena_in_use = NULL;
+    }
+    while (arena->first != NULL) {
+	b = arena->first;
+	arena->first = b->next;
+	free(b);
+    }
+    arena->cur = NULL;
+    arena->bytes = 0;
+}
+
+
+/*
+ * json_arena_create - allocate and initialise an arena
+ *
+ * returns:
+ *	pointer to an arena to pass to json_arena_use() and later to json_arena_free()
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+struct json_arena *
+json_arena_create(void)
+{
+    struct json_arena *arena = NULL;
+
+    errno = 0;	/* pre-clear errno for errp() */
+    arena = malloc(sizeof(*arena));
+    if (arena == NULL) {
+	errp(117, __func__, "malloc of struct json_arena failed");
+	not_reached();
+    }
+    json_arena_init(arena);
+    return arena;
+}
+
+
+/*
+ * json_arena_free - free an arena from json_arena_create()
+ *
+ * given:
+ *	arena	    arena to free, may be NULL
+ */
+void
+json_arena_free(struct json_arena *arena)
+{
+    if (arena == NULL) {
+	return;
+    }
+    json_arena_fini(arena);
+    free(arena);
+}
+
+
+/*
+ * json_arena_reset - free everything allocated from an arena, keeping its blocks
+ *
+ * given:
+ *	arena	    arena from json_arena_init() or json_arena_create()
+ *
+ * Each parse tree built in the arena is freed at once, without walking it.
+ * The blocks are kept for what is allocated next, so parsing one document
+ * after another with a reset in between soon needs no malloc() at all.
+ *
+ * NOTE: this function does not return on NULL arena.
+ */
+void
+json_arena_reset(struct json_arena *arena)
+{
+    struct json_arena_block *b = NULL;	/* block to mark unused */
+
+    /*
+     * firewall
+     */
+    if (arena == NULL) {
+	err(118, __func__, "arena is NULL");
+	not_reached();
+    }
+
+    for (b = arena->first; b != NULL; b = b->next) {
+	b->used = 0;
+    }
+    arena->cur = arena->first;
+    arena->bytes = 0;
+}
+
+
+/*
+ * json_arena_alloc - allocate zeroed memory from an arena
+ *
+ * given:
+ *	arena	    arena to allocate from
+ *	size	    bytes to allocate
+ *
+ * returns:
+ *	pointer to size zeroed bytes, aligned for any type
+ *
+ * The memory is freed by json_arena_reset() or json_arena_fini(), not by free().
+ *
+ * NOTE: this function does not return on NULL arena or on allocation failure.
+ */
+void *
+json_arena_alloc(struct json_arena *arena, size_t size)
+{
+    struct json_arena_block *b = NULL;	/* block to hand out from */
+    char *ret = NULL;			/* allocated memory */
+
+    /*
+     * firewall
+     */
+    if (arena == NULL) {
+	err(119, __func__, "arena is NULL");
+	not_reached();
+    }
+    if (size > SIZE_MAX - ARENA_ALIGN) {
+	err(120, __func__, "cannot allocate %ju bytes", (uintmax_t)size);
+	not_reached();
+    }
+
+    /*
+     * hand out the next bytes of a block
+     */
+    size = ARENA_ROUND(size > 0 ? size : 1);
+    b = arena->cur;
+    if (b == NULL || b->size - b->used < size) {
+	b = arena_block(arena, size);
+    }
+    ret = ARENA_DATA(b) + b->used;
+    b->used += size;
+    arena->bytes += size;
+    memset(ret, 0, size);
+    return ret;
+}
+
+
+/*
+ * json_arena_grow - make memory from an arena bigger
+ *
+ * given:
+ *	arena	    arena ptr was allocated from
+ *	ptr	    memory from json_arena_alloc() or json_arena_grow(), or NULL
+ *	old_size    bytes asked for when ptr was allocated
+ *	size	    bytes needed now, not less than old_size
+ *
+ * returns:
+ *	pointer to size bytes, the first old_size of which are those of ptr, and
+ *	the rest zeroed
+ *
+ * When ptr is the last allocation of the arena and its block has room, it is
+ * made bigger where it is.  Otherwise it is copied to a new allocation and the
+ * old one is not used again until the arena is reset.
+ *
+ * NOTE: this function does not return on NULL arena or on allocation failure.
+ */
+void *
+json_arena_grow(struct json_arena *arena, void *ptr, size_t old_size, size_t size)
+{
+    struct json_arena_block *b = NULL;	/* block being handed out */
+    char *ret = NULL;			/* grown memory */
+    size_t old_round = 0;		/* bytes handed out for ptr */
+    size_t new_round = 0;		/* bytes to hand out for size */
+
+    if (ptr == NULL) {
+	return json_arena_alloc(arena, size);
+    }
+    if (size <= old_size) {
+	return ptr;
+    }
+
+    /*
+     * case: ptr is the last allocation of the block being handed out
+     */
+    b = arena != NULL ? arena->cur : NULL;
+    old_round = ARENA_ROUND(old_size > 0 ? old_size : 1);
+    if (b != NULL && size <= SIZE_MAX - ARENA_ALIGN && (char *)ptr + old_round == ARENA_DATA(b) + b->used) {
+	new_round = ARENA_ROUND(size);
+	if (new_round - old_round <= b->size - b->used) {
+	    memset(ARENA_DATA(b) + b->used, 0, new_round - old_round);
+	    b->used += new_round - old_round;
+	    arena->bytes += new_round - old_round;
+	    return ptr;
+	}
+    }
+
+    /*
+     * copy to a new allocation
+     */
+    ret = json_arena_alloc(arena, size);
+    memcpy(ret, ptr, old_size);
+    return ret;
+}
+
+
+/*
+ * json_arena_use - set the arena that this thread builds JSON parse trees in
+ *
+ * given:
+ *	arena	    arena to build in, NULL ==> allocate each node on its own
+ *
+ * returns:
+ *	the arena that was in use by this thread, or NULL
+ *
+ * Until the next call, every node that json_alloc() and the parsers make in
+ * this thread is built in arena: the parse_json*() functions, the push parser
+ * and parse_json_seq*() all build their trees there.  A tree built in an arena
+ * is freed by json_arena_reset() or json_arena_fini() and must not be given to
+ * free(): json_tree_free() and json_tree_release() do nothing to it.  Each
+ * number, object and array points to its arena, so what is later added to
+ * its objects and arrays, and the C values json_number_convert() finds for
+ * its numbers, are put in that arena, whichever arena is in use then.
+ *
+ * Each thread has an arena of its own, so threads may each build in an arena
+ * of their own at the same time.
+ */
+struct json_arena *
+json_arena_use(struct json_arena *arena)
+{
+    struct json_arena *prev = arena_in_use;	/* arena that was in use */
+
+    arena_in_use = arena;
+    return prev;
+}
+
+
+/*
+ * json_arena_in_use - return the arena that this thread builds JSON parse trees in
+ *
+ * returns:
+ *	arena set by json_arena_use(), or NULL if nodes are allocated on their own
+ */
+struct json_arena *
+json_arena_in_use(void)
+{
+    return arena_in_use;
+}
@@ -0,0 +1,84 @@
+/*
+ * json_arena - bump allocator for JSON parse trees
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_ARENA_H)
+#    define  INCLUDE_JSON_ARENA_H
+
+
+#include <stddef.h>
+
+
+/*
+ * definitions
+ */
+#define JSON_ARENA_BLOCK (65536)	/* default bytes in an arena block */
+
+
+/*
+ * struct json_arena_block - a block of an arena
+ *
+ * The bytes handed out follow the header, which is padded to keep them aligned.
+ */
+struct json_arena_block
+{
+    struct json_arena_block *next;	/* next block of the arena or NULL */
+    size_t size;			/* bytes after the header */
+    size_t used;			/* bytes of them handed out */
+};
+
+/*
+ * struct json_arena - memory that JSON parse trees are built in
+ *
+ * While json_arena_use() has made an arena the one in use by a thread, every
+ * node that thread allocates, with the strings, numbers and child arrays in
+ * it, is carved out of the blocks of the arena instead of being allocated on
+ * its own.  The nodes are then freed all at once by json_arena_reset(), which
+ * keeps the blocks for the next document, or by json_arena_fini().
+ *
+ * Use json_arena_create() / json_arena_free() for an arena on the heap or
+ * json_arena_init() / json_arena_fini() for one embedded in something else.
+ */
+struct json_arena
+{
+    /* option: json_arena_init() sets the default */
+    size_t block_size;			/* bytes in a new block (def: JSON_ARENA_BLOCK) */
+
+    /* state */
+    struct json_arena_block *first;	/* first block or NULL */
+    struct json_arena_block *cur;	/* block being handed out, the blocks after it are unused */
+    size_t bytes;			/* bytes handed out since json_arena_init() or json_arena_reset() */
+};
+
+
+/*
+ * external function declarations
+ */
+extern void json_arena_init(struct json_arena *arena);
+extern void json_arena_fini(struct json_arena *arena);
+extern struct json_arena *json_arena_create(void);
+extern void json_arena_free(struct json_arena *arena);
+extern void json_arena_reset(struct json_arena *arena);
+extern void *json_arena_alloc(struct json_arena *arena, size_t size);
+extern void *json_arena_grow(struct json_arena *arena, void *ptr, size_t old_size, size_t size);
+extern struct json_arena *json_arena_use(struct json_arena *arena);
+extern struct json_arena *json_arena_in_use(void);
+
+
+#endif /* INCLUDE_JSON_ARENA_H */
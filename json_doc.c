@@ -0,0 +1,775 @@
+/*
+ * json_doc - JSON document read on demand from a flat tape
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * json_doc - JSON document read on demand from a flat tape
+ */
+#include "json_doc.h"
+
+
+/*
+ * static functions
+ */
+static size_t doc_add(struct jdoc *doc, enum jdoc_type type, size_t start, size_t len);
+static bool doc_open(struct jdoc *doc, enum jdoc_type type);
+static bool doc_close(struct jdoc *doc);
+static bool doc_object_start(void *arg);
+static bool doc_array_start(void *arg);
+static bool doc_end(void *arg);
+static bool doc_name(char const *ptr, size_t len, void *arg);
+static bool doc_string(char const *ptr, size_t len, void *arg);
+static bool doc_number(char const *ptr, size_t len, void *arg);
+static bool doc_boolean(bool value, void *arg);
+static bool doc_null(void *arg);
+
+
+/*
+ * doc_add - add a token to the tape
+ *
+ * given:
+ *	doc	    document being parsed
+ *	type	    what the token is
+ *	start	    offset of its text or a tape index, see enum jdoc_type
+ *	len	    length of its text or a count, see enum jdoc_type
+ *
+ * returns:
+ *	tape index of the token
+ *
+ * A token that is a value, not a name or JDOC_END, is counted in the
+ * innermost open object or array.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static size_t
+doc_add(struct jdoc *doc, enum jdoc_type type, size_t start, size_t len)
+{
+    struct jdoc_token *new_tape;
+    size_t new_size;
+
+    if (doc->count >= doc->size) {
+	new_size = (doc->size > 0) ? doc->size * 2 : JDOC_TAPE;
+	errno = 0;	/* pre-clear errno for errp() */
+	new_tape = realloc(doc->tape, new_size * sizeof(*doc->tape));
+	if (new_tape == NULL) {
+	    errp(109, __func__, "realloc of %ju tape tokens failed", (uintmax_t)new_size);
+	    not_reached();
+	}
+	doc->tape = new_tape;
+	doc->size = new_size;
+    }
+    if (doc->depth > 0 && type != JDOC_NAME && type != JDOC_END) {
+	++doc->tape[doc->open[doc->depth-1]].len;
+    }
+    doc->tape[doc->count].type = type;
+    doc->tape[doc->count].start = start;
+    doc->tape[doc->count].len = len;
+    return doc->count++;
+}
+
+
+/*
+ * doc_open - add the JDOC_OBJECT or JDOC_ARRAY token of a value being opened
+ *
+ * given:
+ *	doc	    document being parsed
+ *	type	    JDOC_OBJECT or JDOC_ARRAY
+ *
+ * returns:
+ *	true
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static bool
+doc_open(struct jdoc *doc, enum jdoc_type type)
+{
+    size_t *new_open;
+    size_t new_size;
+    size_t index;
+
+    index = doc_add(doc, type, 0, 0);
+    if (doc->depth >= doc->open_size) {
+	new_size = (doc->open_size > 0) ? doc->open_size * 2 : JSON_FAST_STACK;
+	errno = 0;	/* pre-clear errno for errp() */
+	new_open = realloc(doc->open, new_size * sizeof(*doc->open));
+	if (new_open == NULL) {
+	    errp(110, __func__, "realloc of %ju open levels failed", (uintmax_t)new_size);
+	    not_reached();
+	}
+	doc->open = new_open;
+	doc->open_size = new_size;
+    }
+    doc->open[doc->depth++] = index;
+    return true;
+}
+
+
+/*
+ * doc_close - add the JDOC_END token of the innermost open object or array
+ *
+ * given:
+ *	doc	    document being parsed
+ *
+ * returns:
+ *	true
+ */
+static bool
+doc_close(struct jdoc *doc)
+{
+    size_t index;
+
+    index = doc->open[--doc->depth];
+    doc_add(doc, JDOC_END, index, 0);
+    doc->tape[index].start = doc->count;
+    return true;
+}
+
+
+/*
+ * doc_object_start, doc_array_start, doc_end, doc_name, doc_string, doc_number,
+ * doc_boolean, doc_null - parse_json_events() callbacks that fill in the tape
+ *
+ * given:
+ *	ptr	    text of the name, string or number
+ *	len	    length of ptr
+ *	value	    true or false
+ *	arg	    struct jdoc being parsed
+ *
+ * returns:
+ *	true
+ */
+static bool
+doc_object_start(void *arg)
+{
+    return doc_open(arg, JDOC_OBJECT);
+}
+
+static bool
+doc_array_start(void *arg)
+{
+    return doc_open(arg, JDOC_ARRAY);
+}
+
+static bool
+doc_end(void *arg)
+{
+    return doc_close(arg);
+}
+
+static bool
+doc_name(char const *ptr, size_t len, void *arg)
+{
+    struct jdoc *doc = arg;
+
+    doc_add(doc, JDOC_NAME, (size_t)(ptr - doc->data), len);
+    return true;
+}
+
+static bool
+doc_string(char const *ptr, size_t len, void *arg)
+{
+    struct jdoc *doc = arg;
+
+    doc_add(doc, JDOC_STRING, (size_t)(ptr - doc->data), len);
+    return true;
+}
+
+static bool
+doc_number(char const *ptr, size_t len, void *arg)
+{
+    struct jdoc *doc = arg;
+
+    doc_add(doc, JDOC_NUMBER, (size_t)(ptr - doc->data), len);
+    return true;
+}
+
+static bool
+doc_boolean(bool value, void *arg)
+{
+    doc_add(arg, value ? JDOC_TRUE : JDOC_FALSE, 0, 0);
+    return true;
+}
+
+static bool
+doc_null(void *arg)
+{
+    doc_add(arg, JDOC_NULL, 0, 0);
+    return true;
+}
+
+
+/*
+ * jdoc_parse_ctx - parse a JSON document into a tape with a parser context
+ *
+ * The JSON is checked and its tokens put on the tape in one pass of
+ * parse_json_events_ctx(), so the validity and the syntax error messages are
+ * those of parse_json_fast_ctx().  No struct json is made: values are
+ * converted only when asked for by the jdoc_ accessors.
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob, which must not change while the document is in use
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a document to be freed with jdoc_free(), or NULL if the JSON is invalid
+ *
+ * NOTE: this function does not return on allocation failure or NULL is_valid.
+ */
+struct jdoc *
+jdoc_parse_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    static struct json_events const events = {
+	doc_object_start, doc_end, doc_array_start, doc_end,
+	doc_name, doc_string, doc_number, doc_boolean, doc_null
+    };
+    struct jdoc *doc = NULL;		/* document being parsed */
+
+    /*
+     * firewall
+     */
+    if (is_valid == NULL) {
+	err(111, __func__, "is_valid == NULL");
+	not_reached();
+    }
+
+    errno = 0;	/* pre-clear errno for errp() */
+    doc = calloc(1, sizeof(*doc));
+    if (doc == NULL) {
+	errp(112, __func__, "calloc of struct jdoc failed");
+	not_reached();
+    }
+    doc->data = ptr;
+    doc->data_len = len;
+
+    *is_valid = (parse_json_events_ctx(ctx, ptr, len, filename, &events, doc) == JSON_EVENTS_VALID);
+    if (doc->open != NULL) {
+	free(doc->open);
+	doc->open = NULL;
+	doc->open_size = 0;
+    }
+    if (!*is_valid) {
+	jdoc_free(doc);
+	return NULL;
+    }
+    return doc;
+}
+
+
+/*
+ * jdoc_parse - parse a JSON document into a tape
+ *
+ * This is jdoc_parse_ctx() with a context that lasts for just this call.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob, which must not change while the document is in use
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a document to be freed with jdoc_free(), or NULL if the JSON is invalid
+ */
+struct jdoc *
+jdoc_parse(char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct jdoc *doc = NULL;		/* the parsed document */
+
+    jparse_ctx_init(&ctx);
+    doc = jdoc_parse_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+    return doc;
+}
+
+
+/*
+ * jdoc_free - free a document
+ *
+ * given:
+ *	doc	    document from jdoc_parse() or NULL
+ *
+ * The data the document was parsed from is not freed.
+ */
+void
+jdoc_free(struct jdoc *doc)
+{
+    if (doc == NULL) {
+	return;
+    }
+    if (doc->tape != NULL) {
+	free(doc->tape);
+	doc->tape = NULL;
+    }
+    if (doc->open != NULL) {
+	free(doc->open);
+	doc->open = NULL;
+    }
+    free(doc);
+}
+
+
+/*
+ * jdoc_type - determine the type of a value
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the value
+ *
+ * returns:
+ *	type of the token at v, JDOC_UNSET if doc is NULL or v is not on the tape
+ */
+enum jdoc_type
+jdoc_type(struct jdoc const *doc, size_t v)
+{
+    if (doc == NULL || v >= doc->count) {
+	return JDOC_UNSET;
+    }
+    return doc->tape[v].type;
+}
+
+
+/*
+ * jdoc_length - number of members of an object or elements of an array
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the object or array
+ *
+ * returns:
+ *	number of members or elements, 0 if v is not an object or array
+ */
+size_t
+jdoc_length(struct jdoc const *doc, size_t v)
+{
+    enum jdoc_type type = jdoc_type(doc, v);
+
+    return (type == JDOC_OBJECT || type == JDOC_ARRAY) ? doc->tape[v].len : 0;
+}
+
+
+/*
+ * jdoc_skip - find what follows a value on the tape
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the value
+ *
+ * returns:
+ *	tape index after the value and everything in it, JDOC_NONE if v is not on the tape
+ */
+size_t
+jdoc_skip(struct jdoc const *doc, size_t v)
+{
+    switch (jdoc_type(doc, v)) {
+    case JDOC_UNSET:
+	return JDOC_NONE;
+    case JDOC_OBJECT:
+    case JDOC_ARRAY:
+	return doc->tape[v].start;
+    default:
+	break;
+    }
+    return v + 1;
+}
+
+
+/*
+ * jdoc_first - find the first element of an array or the value of the first member of an object
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the object or array
+ *
+ * returns:
+ *	tape index of the first value, JDOC_NONE if it is empty or is not an object or array
+ */
+size_t
+jdoc_first(struct jdoc const *doc, size_t v)
+{
+    if (jdoc_length(doc, v) == 0) {
+	return JDOC_NONE;
+    }
+    return (doc->tape[v].type == JDOC_OBJECT) ? v + 2 : v + 1;
+}
+
+
+/*
+ * jdoc_next - find the value that follows a value in the same object or array
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of a value from jdoc_first() or jdoc_next()
+ *
+ * returns:
+ *	tape index of the next value, JDOC_NONE if v is the last
+ *
+ * NOTE: the name of a member value v is the JDOC_NAME token at v - 1.
+ */
+size_t
+jdoc_next(struct jdoc const *doc, size_t v)
+{
+    size_t next = jdoc_skip(doc, v);
+
+    switch (jdoc_type(doc, next)) {
+    case JDOC_UNSET:
+    case JDOC_END:
+	return JDOC_NONE;
+    case JDOC_NAME:
+	return next + 1;
+    default:
+	break;
+    }
+    return next;
+}
+
+
+/*
+ * jdoc_get_member - find the value of a member of an object by name
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the object
+ *	name	    decoded name to look for
+ *	len	    length of name
+ *
+ * returns:
+ *	tape index of the value of the first member with that name, JDOC_NONE if
+ *	there is none or v is not an object
+ *
+ * Only the names of the object are looked at: the values of the other members
+ * are skipped.  A name with an escape in it is decoded to be compared, on the
+ * stack unless name is JDOC_NAME_BUF bytes or longer.
+ */
+size_t
+jdoc_get_member(struct jdoc const *doc, size_t v, char const *name, size_t len)
+{
+    struct jdoc_token const *tok = NULL;	/* name being compared */
+    char const *text = NULL;			/* text of that name */
+    char buf[JDOC_NAME_BUF];			/* decoding of a name that fits */
+    char *decoded = NULL;			/* decoding of a longer name */
+    size_t dlen = 0;				/* length of the decoding */
+    bool match = false;				/* true ==> the name is the one looked for */
+    size_t i;
+
+    if (name == NULL || jdoc_type(doc, v) != JDOC_OBJECT) {
+	return JDOC_NONE;
+    }
+    for (i = v + 1; doc->tape[i].type == JDOC_NAME; i = jdoc_skip(doc, i + 1)) {
+	tok = &doc->tape[i];
+	text = doc->data + tok->start;
+	if (memchr(text, '\\', tok->len) == NULL) {
+	    match = (tok->len == len && memcmp(text, name, len) == 0);
+	} else if (len < sizeof(buf)) {
+	    /* a decoding that does not fit in len+1 bytes is not name */
+	    match = (json_encode_buf(text, tok->len, buf, len + 1, &dlen) && dlen == len &&
+		     memcmp(buf, name, len) == 0);
+	} else {
+	    decoded = json_encode(text, tok->len, &dlen);
+	    match = (decoded != NULL && dlen == len && memcmp(decoded, name, len) == 0);
+	    if (decoded != NULL) {
+		free(decoded);
+		decoded = NULL;
+	    }
+	}
+	if (match) {
+	    return i + 1;
+	}
+    }
+    return JDOC_NONE;
+}
+
+
+/*
+ * jdoc_array_at - find an element of an array by index
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the array
+ *	i	    index of the element, starting at 0
+ *
+ * returns:
+ *	tape index of the element, JDOC_NONE if there is no such element or v
+ *	is not an array
+ *
+ * The elements before it are skipped without looking at what is in them.
+ */
+size_t
+jdoc_array_at(struct jdoc const *doc, size_t v, size_t i)
+{
+    size_t e;
+
+    if (jdoc_type(doc, v) != JDOC_ARRAY || i >= doc->tape[v].len) {
+	return JDOC_NONE;
+    }
+    for (e = v + 1; i > 0; --i) {
+	e = jdoc_skip(doc, e);
+    }
+    return e;
+}
+
+
+/*
+ * jdoc_raw - find the text of a value
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the value or name
+ *	len	    if != NULL, where to store the length of the text
+ *
+ * returns:
+ *	the text as it is in the JSON, without the quotes of a name or string
+ *	and not NUL terminated, or NULL if v is an object or array or is not on
+ *	the tape
+ */
+char const *
+jdoc_raw(struct jdoc const *doc, size_t v, size_t *len)
+{
+    char const *text = NULL;	/* text of the value */
+    size_t tlen = 0;		/* length of text */
+
+    switch (jdoc_type(doc, v)) {
+    case JDOC_NAME:
+    case JDOC_STRING:
+    case JDOC_NUMBER:
+	text = doc->data + doc->tape[v].start;
+	tlen = doc->tape[v].len;
+	break;
+    case JDOC_TRUE:
+	text = "true";
+	tlen = sizeof("true")-1;
+	break;
+    case JDOC_FALSE:
+	text = "false";
+	tlen = sizeof("false")-1;
+	break;
+    case JDOC_NULL:
+	text = "null";
+	tlen = sizeof("null")-1;
+	break;
+    default:
+	break;
+    }
+    if (len != NULL) {
+	*len = tlen;
+    }
+    return text;
+}
+
+
+/*
+ * jdoc_as_string - decode a string or name
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the string or name
+ *	len	    if != NULL, where to store the length of the decoding
+ *
+ * returns:
+ *	allocated decoding as json_encode() returns it, or NULL if v is not a
+ *	string or name
+ */
+char *
+jdoc_as_string(struct jdoc const *doc, size_t v, size_t *len)
+{
+    enum jdoc_type type = jdoc_type(doc, v);
+
+    if (type != JDOC_STRING && type != JDOC_NAME) {
+	if (len != NULL) {
+	    *len = 0;
+	}
+	return NULL;
+    }
+    return json_encode(doc->data + doc->tape[v].start, doc->tape[v].len, len);
+}
+
+
+/*
+ * jdoc_as_int64 - convert a number that is an integer
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the number
+ *	ret	    where to store the value
+ *
+ * returns:
+ *	true ==> converted, false ==> v is not a number, has a fraction or
+ *	exponent or does not fit in an int64_t
+ */
+bool
+jdoc_as_int64(struct jdoc const *doc, size_t v, int64_t *ret)
+{
+    char const *text = NULL;	/* text of the number */
+    size_t len = 0;		/* length of text */
+    bool neg = false;		/* true ==> number is negative */
+    uint64_t max;		/* largest magnitude that fits */
+    uint64_t val = 0;		/* magnitude of the number */
+    unsigned int digit;		/* value of a digit */
+    size_t i = 0;
+
+    if (ret == NULL || jdoc_type(doc, v) != JDOC_NUMBER) {
+	return false;
+    }
+    text = jdoc_raw(doc, v, &len);
+    if (text[0] == '-') {
+	neg = true;
+	i = 1;
+    }
+    max = neg ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    for (; i < len; ++i) {
+	if (text[i] < '0' || text[i] > '9') {
+	    return false;	/* '.', 'e' or 'E' */
+	}
+	digit = (unsigned int)(text[i] - '0');
+	if (val > (max - digit) / 10) {
+	    return false;
+	}
+	val = val * 10 + digit;
+    }
+    if (neg) {
+	*ret = (val == (uint64_t)INT64_MAX + 1) ? INT64_MIN : -(int64_t)val;
+    } else {
+	*ret = (int64_t)val;
+    }
+    return true;
+}
+
+
+/*
+ * jdoc_as_double - convert a number
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the number
+ *	ret	    where to store the value
+ *
+ * returns:
+ *	true ==> converted, false ==> v is not a number or is too big for a double
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+bool
+jdoc_as_double(struct jdoc const *doc, size_t v, double *ret)
+{
+    char buf[64];		/* NUL terminated copy of a number that fits */
+    char *copy = NULL;		/* NUL terminated copy of the number */
+    char const *text = NULL;	/* text of the number */
+    size_t len = 0;		/* length of text */
+    double val;			/* converted value */
+    int saved_errno;		/* errno from strtod() */
+
+    if (ret == NULL || jdoc_type(doc, v) != JDOC_NUMBER) {
+	return false;
+    }
+
+    /*
+     * the text is not NUL terminated
+     */
+    text = jdoc_raw(doc, v, &len);
+    if (len < sizeof(buf)) {
+	copy = buf;
+    } else {
+	errno = 0;	/* pre-clear errno for errp() */
+	copy = malloc(len + 1);
+	if (copy == NULL) {
+	    errp(113, __func__, "malloc of %ju bytes failed", (uintmax_t)len + 1);
+	    not_reached();
+	}
+    }
+    memcpy(copy, text, len);
+    copy[len] = '\0';
+
+    errno = 0;	/* pre-clear errno for strtod() */
+    val = json_strtod(copy, NULL);
+    saved_errno = errno;
+    if (copy != buf) {
+	free(copy);
+	copy = NULL;
+    }
+    if (saved_errno == ERANGE && (val == HUGE_VAL || val == -HUGE_VAL)) {
+	return false;
+    }
+    *ret = val;
+    return true;
+}
+
+
+/*
+ * jdoc_as_bool - convert true or false
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the value
+ *	ret	    where to store the value
+ *
+ * returns:
+ *	true ==> converted, false ==> v is not true or false
+ */
+bool
+jdoc_as_bool(struct jdoc const *doc, size_t v, bool *ret)
+{
+    enum jdoc_type type = jdoc_type(doc, v);
+
+    if (ret == NULL || (type != JDOC_TRUE && type != JDOC_FALSE)) {
+	return false;
+    }
+    *ret = (type == JDOC_TRUE);
+    return true;
+}
+
+
+/*
+ * jdoc_is_null - determine if a value is null
+ *
+ * given:
+ *	doc	    document
+ *	v	    tape index of the value
+ *
+ * returns:
+ *	true ==> v is null, false ==> it is not or is not on the tape
+ */
+bool
+jdoc_is_null(struct jdoc const *doc, size_t v)
+{
+    return jdoc_type(doc, v) == JDOC_NULL;
+}
@@ -0,0 +1,118 @@
+/*
+ * json_doc - JSON document read on demand from a flat tape
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_DOC_H)
+#    define  INCLUDE_JSON_DOC_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+ * definitions
+ */
+#define JDOC_TAPE (256)			/* initial number of tokens the tape can hold */
+#define JDOC_NONE (SIZE_MAX)		/* tape index of a value that is not there */
+#define JDOC_ROOT ((size_t)0)		/* tape index of the top level value */
+#define JDOC_NAME_BUF (256)		/* bytes of a name jdoc_get_member() decodes on the stack */
+
+
+/*
+ * what a token of the tape is
+ */
+enum jdoc_type
+{
+    JDOC_UNSET = 0,	/* not a token: JDOC_NONE or beyond the tape (must be 0) */
+    JDOC_OBJECT,	/* '{': start is the index after the matching JDOC_END, len is the number of members */
+    JDOC_ARRAY,		/* '[': start is the index after the matching JDOC_END, len is the number of elements */
+    JDOC_END,		/* '}' or ']': start is the index of the matching JDOC_OBJECT or JDOC_ARRAY */
+    JDOC_NAME,		/* member name: start and len are the offset and length of its text */
+    JDOC_STRING,	/* string: start and len are the offset and length of its text */
+    JDOC_NUMBER,	/* number: start and len are the offset and length of its text */
+    JDOC_TRUE,		/* true */
+    JDOC_FALSE,		/* false */
+    JDOC_NULL,		/* null */
+};
+
+/*
+ * struct jdoc_token - a token of the tape
+ *
+ * The text of a name or string is given without its quotes and is not
+ * decoded: see jdoc_as_string().
+ */
+struct jdoc_token
+{
+    enum jdoc_type type;	/* what the token is */
+    size_t start;		/* offset of the text in the data, or a tape index (see enum jdoc_type) */
+    size_t len;			/* length of the text, or a count (see enum jdoc_type) */
+};
+
+/*
+ * struct jdoc - a JSON document as a tape of tokens
+ *
+ * A value is known by the index of its first token on the tape.  An object
+ * is its JDOC_OBJECT token, then a JDOC_NAME token and a value for each
+ * member, then a JDOC_END token; an array is the same without the names.
+ * As the JDOC_OBJECT and JDOC_ARRAY tokens hold the index after their
+ * JDOC_END, a value is skipped without looking at what is in it.
+ *
+ * The text of names, strings and numbers is not copied: the data given to
+ * jdoc_parse() must not change or be freed while the document is in use.
+ */
+struct jdoc
+{
+    char const *data;		/* data the document was parsed from */
+    size_t data_len;		/* length of data */
+    struct jdoc_token *tape;	/* tokens of the document */
+    size_t count;		/* number of tokens on the tape */
+    size_t size;		/* number of tokens allocated */
+    size_t *open;		/* while parsing: tape index of each open object and array */
+    size_t depth;		/* while parsing: number of open objects and arrays */
+    size_t open_size;		/* while parsing: number of indices allocated in open */
+};
+
+struct jparse_ctx;
+
+
+/*
+ * external function declarations
+ */
+extern struct jdoc *jdoc_parse_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename,
+				   bool *is_valid);
+extern struct jdoc *jdoc_parse(char const *ptr, size_t len, char const *filename, bool *is_valid);
+extern void jdoc_free(struct jdoc *doc);
+extern enum jdoc_type jdoc_type(struct jdoc const *doc, size_t v);
+extern size_t jdoc_length(struct jdoc const *doc, size_t v);
+extern size_t jdoc_skip(struct jdoc const *doc, size_t v);
+extern size_t jdoc_first(struct jdoc const *doc, size_t v);
+extern size_t jdoc_next(struct jdoc const *doc, size_t v);
+extern size_t jdoc_get_member(struct jdoc const *doc, size_t v, char const *name, size_t len);
+extern size_t jdoc_array_at(struct jdoc const *doc, size_t v, size_t i);
+extern char const *jdoc_raw(struct jdoc const *doc, size_t v, size_t *len);
+extern char *jdoc_as_string(struct jdoc const *doc, size_t v, size_t *len);
+extern bool jdoc_as_int64(struct jdoc const *doc, size_t v, int64_t *ret);
+extern bool jdoc_as_double(struct jdoc const *doc, size_t v, double *ret);
+extern bool jdoc_as_bool(struct jdoc const *doc, size_t v, bool *ret);
+extern bool jdoc_is_null(struct jdoc const *doc, size_t v);
+
+
+#endif /* INCLUDE_JSON_DOC_H */
@@ -0,0 +1,1239 @@
+/*
+ * json_fast - JSON parser without the bison tables
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * json_fast - JSON parser without the bison tables
+ */
+#include "json_fast.h"
+
+
+/*
+ * global variables
+ */
+enum json_parser json_parser_backend = JSON_PARSER_BISON;	/* parser used by parse_json(), set by -P in jparse */
+
+
+/*
+ * static functions
+ */
+static void fast_push(struct jparse_ctx *ctx, size_t depth, struct json *node, bool object);
+static struct json *fast_scalar(struct json_scan *scan);
+static enum json_fast_status fast_step(struct jparse_ctx *ctx, struct json_fast_state *st, struct json_scan *scan,
+				       int tok, char const *name);
+static void fast_report(struct jparse_ctx *ctx, enum json_fast_status status, struct json_scan const *scan,
+			JPARSE_LTYPE *loc, struct json *tree);
+static void fast_error(FILE *errs, JPARSE_LTYPE const *loc, char const *text, size_t leng, struct json *tree);
+static void fast_free(struct json_fast_frame *stack, size_t depth);
+static enum json_fast_status events_step(struct jparse_ctx *ctx, struct json_fast_state *st, struct json_scan *scan,
+					 int tok, struct json_events const *events, void *arg);
+static bool push_boundary(struct json_push *push, char const *chunk, size_t len, size_t *first, size_t *last);
+static void push_carry(struct json_push *push, char const *data, size_t len);
+static bool push_slice(struct jparse_ctx *ctx, char const *data, size_t len);
+
+
+/*
+ * fast_push - open an object or array
+ *
+ * given:
+ *	ctx	    parser context that holds the parse stack
+ *	depth	    number of frames in use
+ *	node	    JTYPE_OBJECT or JTYPE_ARRAY just opened, NULL for parse_json_events()
+ *	object	    true ==> an object was opened, false ==> an array
+ *
+ * The stack grows by doubling so that deeply nested input does not cost a
+ * realloc() for each level.  It is kept in the context for the next parse.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static void
+fast_push(struct jparse_ctx *ctx, size_t depth, struct json *node, bool object)
+{
+    struct json_fast_frame *new_stack;
+    size_t new_size;
+
+    if (depth >= ctx->stack_size) {
+	new_size = (ctx->stack_size > 0) ? ctx->stack_size * 2 : JSON_FAST_STACK;
+	errno = 0;	/* pre-clear errno for errp() */
+	new_stack = realloc(ctx->stack, new_size * sizeof(*ctx->stack));
+	if (new_stack == NULL) {
+	    errp(64, __func__, "realloc of %ju parse stack frames failed", (uintmax_t)new_size);
+	    not_reached();
+	}
+	ctx->stack = new_stack;
+	ctx->stack_size = new_size;
+    }
+    ctx->stack[depth].node = node;
+    ctx->stack[depth].name = NULL;
+    ctx->stack[depth].object = object;
+}
+
+
+/*
+ * fast_scalar - convert the current scalar token
+ *
+ * given:
+ *	scan	    scanner state positioned on a token
+ *
+ * returns:
+ *	pointer to a struct json for a JSON_STRING, JSON_NUMBER, JSON_TRUE,
+ *	JSON_FALSE or JSON_NULL token, NULL for any other token
+ */
+static struct json *
+fast_scalar(struct json_scan *scan)
+{
+    switch (scan->token) {
+    case JSON_STRING:
+	return parse_json_string(json_scan_text(scan), scan->leng);
+    case JSON_NUMBER:
+	return parse_json_number(json_scan_text(scan));
+    case JSON_TRUE:
+    case JSON_FALSE:
+	return parse_json_bool(json_scan_text(scan));
+    case JSON_NULL:
+	return parse_json_null(json_scan_text(scan));
+    default:
+	break;
+    }
+    return NULL;
+}
+
+
+/*
+ * fast_error - report a syntax error
+ *
+ * The message is the same as the one yyerror() in jparse.y prints when the
+ * bison parser takes its tokens from the structural index scanner.
+ *
+ * given:
+ *	errs	    stream to write to, NULL ==> stderr
+ *	loc	    location of the offending token
+ *	text	    text of the offending token
+ *	leng	    length of text
+ *	tree	    top level value if it was complete, else NULL
+ */
+static void
+fast_error(FILE *errs, JPARSE_LTYPE const *loc, char const *text, size_t leng, struct json *tree)
+{
+    int ret;			/* libc function return value */
+
+    if (errs == NULL) {
+	errs = stderr;
+    }
+
+    fprstr(errs, "syntax error");
+    if (tree != NULL) {
+	fprint(errs, " node type %s", json_item_type_name(tree));
+    }
+    if (loc->filename != NULL) {
+	fprint(errs, " in file %s", loc->filename);
+    }
+    fprint(errs, " at line %d column %d: ", loc->first_line, loc->first_column);
+    if (leng > 0 && *text != '\0') {
+	fprint(errs, "<%.*s>\n", (int)leng, text);
+    } else {
+	fprstr(errs, "empty text\n");
+    }
+
+    /*
+     * flush errs
+     */
+    clearerr(errs);             /* pre-clear ferror() status */
+    errno = 0;                  /* pre-clear errno for warnp() */
+    ret = fflush(errs);
+    if (ret == EOF) {
+	warnp(__func__, "error flushing stream");
+    }
+}
+
+
+/*
+ * fast_report - report why fast_step() stopped
+ *
+ * given:
+ *	ctx	    parser context
+ *	status	    JSON_FAST_SYNTAX, JSON_FAST_DEEP or JSON_FAST_LIMIT
+ *	scan	    scanner state positioned on the offending token
+ *	loc	    location of the offending token
+ *	tree	    top level value if it was complete, else NULL
+ */
+static void
+fast_report(struct jparse_ctx *ctx, enum json_fast_status status, struct json_scan const *scan,
+	    JPARSE_LTYPE *loc, struct json *tree)
+{
+    if (status == JSON_FAST_DEEP) {
+	jparse_depth_error(ctx->errs, ctx->max_depth, loc, json_scan_text(scan));
+    } else if (status == JSON_FAST_LIMIT) {
+	jparse_limit_error(ctx, NULL, loc);
+    } else {
+	fast_error(ctx->errs, loc, json_scan_text(scan), scan->leng, tree);
+    }
+}
+
+
+/*
+ * fast_free - free the objects and arrays left open by a failed parse
+ *
+ * given:
+ *	stack	    parse stack
+ *	depth	    number of frames in use
+ */
+static void
+fast_free(struct json_fast_frame *stack, size_t depth)
+{
+    while (depth > 0) {
+	--depth;
+	if (stack[depth].name != NULL) {
+	    json_tree_release(stack[depth].name);
+	    stack[depth].name = NULL;
+	}
+	json_tree_release(stack[depth].node);
+	stack[depth].node = NULL;
+    }
+}
+
+
+/*
+ * fast_step - give the parser its next token
+ *
+ * given:
+ *	ctx	    parser context that holds the parse stack
+ *	st	    parser state
+ *	scan	    scanner state positioned on the token
+ *	tok	    token kind
+ *	name	    name of the calling function for debug messages
+ *
+ * returns:
+ *	JSON_FAST_MORE ==> token accepted, JSON_FAST_DONE ==> end of data accepted,
+ *	JSON_FAST_SYNTAX ==> syntax error, JSON_FAST_DEEP ==> nested too deep,
+ *	JSON_FAST_LIMIT ==> another limit of the context was exceeded
+ *
+ * Nothing is reported here: the caller knows where the token is.
+ */
+static enum json_fast_status
+fast_step(struct jparse_ctx *ctx, struct json_fast_state *st, struct json_scan *scan, int tok, char const *name)
+{
+    struct json_fast_frame *top = NULL;		/* innermost open object or array */
+    struct json *value = NULL;			/* value just completed */
+    struct json *member = NULL;			/* member formed from a name and value */
+
+    if (!jparse_limit_token(ctx, tok, scan->leng)) {
+	return JSON_FAST_LIMIT;
+    }
+    /* a bad \-escape is a syntax error, not a reason for parse_json_string() to exit */
+    if (tok == JSON_STRING && !json_string_escapes_valid(json_scan_text(scan), scan->leng)) {
+	return JSON_FAST_SYNTAX;
+    }
+    top = (st->depth > 0) ? &ctx->stack[st->depth-1] : NULL;
+    switch (st->expect) {
+    case JSON_FAST_NAME_OR_CLOSE:
+	if (tok == JSON_CLOSE_BRACE) {
+	    value = top->node;
+	    --st->depth;
+	    break;
+	}
+	/*FALLTHRU*/
+    case JSON_FAST_NAME:
+	if (tok != JSON_STRING) {
+	    return JSON_FAST_SYNTAX;
+	}
+	top->name = parse_json_name(json_scan_text(scan), scan->leng);
+	st->expect = JSON_FAST_COLON;
+	return JSON_FAST_MORE;
+
+    case JSON_FAST_COLON:
+	if (tok != JSON_COLON) {
+	    return JSON_FAST_SYNTAX;
+	}
+	st->expect = JSON_FAST_VALUE;
+	return JSON_FAST_MORE;
+
+    case JSON_FAST_VALUE_OR_CLOSE:
+	if (tok == JSON_CLOSE_BRACKET) {
+	    value = top->node;
+	    --st->depth;
+	    break;
+	}
+	/*FALLTHRU*/
+    case JSON_FAST_VALUE:
+	if (tok == JSON_OPEN_BRACE || tok == JSON_OPEN_BRACKET) {
+	    if (ctx->max_depth != JSON_INFINITE_DEPTH && st->depth >= ctx->max_depth) {
+		ctx->limit = JPARSE_LIMIT_DEPTH;
+		return JSON_FAST_DEEP;
+	    }
+	    if (tok == JSON_OPEN_BRACE) {
+		fast_push(ctx, st->depth++, json_create_object(), true);
+		st->expect = JSON_FAST_NAME_OR_CLOSE;
+	    } else {
+		fast_push(ctx, st->depth++, json_create_array(), false);
+		st->expect = JSON_FAST_VALUE_OR_CLOSE;
+	    }
+	    return JSON_FAST_MORE;
+	}
+	value = fast_scalar(scan);
+	if (value == NULL) {
+	    return JSON_FAST_SYNTAX;
+	}
+	break;
+
+    case JSON_FAST_COMMA_OR_CLOSE:
+	if (top->node->type == JTYPE_ARRAY) {
+	    if (tok == JSON_COMMA) {
+		st->expect = JSON_FAST_VALUE;
+		return JSON_FAST_MORE;
+	    } else if (tok != JSON_CLOSE_BRACKET) {
+		return JSON_FAST_SYNTAX;
+	    }
+	} else {
+	    if (tok == JSON_COMMA) {
+		st->expect = JSON_FAST_NAME;
+		return JSON_FAST_MORE;
+	    } else if (tok != JSON_CLOSE_BRACE) {
+		return JSON_FAST_SYNTAX;
+	    }
+	}
+	value = top->node;
+	json_set_shrink(value);
+	--st->depth;
+	break;
+
+    case JSON_FAST_EOF:
+	if (tok != JPARSE_EOF) {
+	    return JSON_FAST_SYNTAX;
+	}
+	return JSON_FAST_DONE;
+
+    default:
+	err(67, __func__, "unexpected parser state: %d", (int)st->expect);
+	not_reached();
+    }
+
+    /*
+     * a value is complete: it is either the top level value or it goes
+     * into the innermost open array or object
+     */
+    top = (st->depth > 0) ? &ctx->stack[st->depth-1] : NULL;
+    if (top == NULL) {
+	st->tree = value;
+	if (json_dbg_allowed(JSON_DBG_MED)) {
+	    json_dbg_tree_print(JSON_DBG_MED, name, st->tree, JSON_DEFAULT_MAX_DEPTH);
+	}
+	st->expect = JSON_FAST_EOF;
+    } else if (top->node->type == JTYPE_ARRAY) {
+	json_array_add_value(top->node, value);
+	st->expect = JSON_FAST_COMMA_OR_CLOSE;
+    } else {
+	member = parse_json_member(top->name, value);
+	top->name = NULL;
+	json_object_add_member(top->node, member);
+	st->expect = JSON_FAST_COMMA_OR_CLOSE;
+    }
+    return JSON_FAST_MORE;
+}
+
+
+/*
+ * parse_json_fast_ctx - parse a JSON document of a given length with a parser context
+ *
+ * This is a drop in replacement for parse_json_ctx() that does not use the
+ * bison generated parser.  Tokens come from the structural index scanner (see
+ * json_scan.c) and the objects and arrays that are still open are kept on a
+ * heap allocated stack, so the depth of nesting is limited only by memory and
+ * the context max_depth.  Arrays are built as JTYPE_ARRAY directly: no
+ * JTYPE_ELEMENTS node is formed.
+ *
+ * The parse tree, the validity and the syntax error messages (including the
+ * line and column) are the same as those of parse_json().
+ *
+ * The parse stops at the first token that exceeds a limit of the context, so
+ * no more is allocated for JSON that is too big: ctx->limit says which limit.
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: as with parse_json(), if the top level value is complete but is
+ *	 followed by something other than whitespace, *is_valid is set to false
+ *	 but the top level value is returned.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error.
+ */
+struct json *
+parse_json_fast_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct json_fast_state st;			/* parser state */
+    struct json_scan *scan = NULL;		/* structural index scanner */
+    enum json_fast_status status;		/* what the parser made of the last token */
+    JPARSE_LTYPE loc;				/* location of an offending token */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(71, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(65, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    *is_valid = true;
+    ctx->nodes = 0;
+    ctx->limit = JPARSE_LIMIT_NONE;
+    if (ptr == NULL) {
+	werr(66, __func__, "ptr is NULL");
+	*is_valid = false;
+	return json_alloc(JTYPE_UNSET);
+    }
+    if (filename == NULL) {
+	filename = "-";	/* assume stdin */
+    }
+    if (ctx->max_bytes != 0 && len > ctx->max_bytes) {
+	ctx->limit = JPARSE_LIMIT_BYTES;
+	jparse_limit_error(ctx, filename, NULL);
+	*is_valid = false;
+	return json_alloc(JTYPE_UNSET);
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.expect = JSON_FAST_VALUE;
+    scan = &ctx->scan;
+    json_scan_init(scan, ptr, len);
+
+    /*
+     * parse until the end of data or the first error
+     */
+    do {
+	status = fast_step(ctx, &st, scan, json_scan_lex(scan), __func__);
+    } while (status == JSON_FAST_MORE);
+
+    if (status != JSON_FAST_DONE) {
+	json_scan_locate(scan, filename, &loc);
+	fast_report(ctx, status, scan, &loc, st.tree);
+	fast_free(ctx->stack, st.depth);
+	*is_valid = false;
+    }
+    ctx->nul_seen = scan->nul;
+    json_scan_free(scan);
+
+    if (json_dbg_allowed(JSON_DBG_LOW)) {
+	json_dbg(JSON_DBG_LOW, __func__, "%s JSON", *is_valid ? "valid" : "invalid");
+    }
+
+    /*
+     * return parse tree
+     */
+    return st.tree;
+}
+
+
+/*
+ * parse_json_fast - parse a JSON document of a given length
+ *
+ * This is parse_json_fast_ctx() with a context that lasts for just this call.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ */
+struct json *
+parse_json_fast(char const *ptr, size_t len, char const *filename, bool *is_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    struct json *tree = NULL;		/* the JSON parse tree */
+
+    jparse_ctx_init(&ctx);
+    tree = parse_json_fast_ctx(&ctx, ptr, len, filename, is_valid);
+    jparse_ctx_fini(&ctx);
+
+    /*
+     * return parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * events_step - give the event parser its next token
+ *
+ * This is fast_step() without the parse tree: the parts of the JSON go to the
+ * callbacks instead, and the stack frames only record whether each open
+ * level is an object or an array.
+ *
+ * given:
+ *	ctx	    parser context that holds the parse stack
+ *	st	    parser state
+ *	scan	    scanner state positioned on the token
+ *	tok	    token kind
+ *	events	    callbacks to call
+ *	arg	    argument passed to each callback
+ *
+ * returns:
+ *	JSON_FAST_MORE ==> token accepted, JSON_FAST_DONE ==> end of data accepted,
+ *	JSON_FAST_SYNTAX ==> syntax error, JSON_FAST_DEEP ==> nested too deep,
+ *	JSON_FAST_LIMIT ==> another limit of the context was exceeded,
+ *	JSON_FAST_STOP ==> a callback returned false
+ */
+static enum json_fast_status
+events_step(struct jparse_ctx *ctx, struct json_fast_state *st, struct json_scan *scan, int tok,
+	    struct json_events const *events, void *arg)
+{
+    char const *text = scan->data + scan->start;	/* the token, in place */
+    size_t leng = scan->leng;				/* length of the token */
+    bool object = false;				/* true ==> the innermost open level is an object */
+    bool go = true;					/* false ==> a callback asked to stop */
+
+    if (!jparse_limit_token(ctx, tok, leng)) {
+	return JSON_FAST_LIMIT;
+    }
+    switch (st->expect) {
+    case JSON_FAST_NAME_OR_CLOSE:
+	if (tok == JSON_CLOSE_BRACE) {
+	    --st->depth;
+	    go = (events->object_end == NULL) || events->object_end(arg);
+	    break;
+	}
+	/*FALLTHRU*/
+    case JSON_FAST_NAME:
+	/*
+	 * the scanner has checked the bytes of a string, the escapes are checked here
+	 */
+	if (tok != JSON_STRING || !json_string_escapes_valid(text, leng)) {
+	    return JSON_FAST_SYNTAX;
+	}
+	st->expect = JSON_FAST_COLON;
+	if (events->member_name != NULL && !events->member_name(text+1, leng-2, arg)) {
+	    return JSON_FAST_STOP;
+	}
+	return JSON_FAST_MORE;
+
+    case JSON_FAST_COLON:
+	if (tok != JSON_COLON) {
+	    return JSON_FAST_SYNTAX;
+	}
+	st->expect = JSON_FAST_VALUE;
+	return JSON_FAST_MORE;
+
+    case JSON_FAST_VALUE_OR_CLOSE:
+	if (tok == JSON_CLOSE_BRACKET) {
+	    --st->depth;
+	    go = (events->array_end == NULL) || events->array_end(arg);
+	    break;
+	}
+	/*FALLTHRU*/
+    case JSON_FAST_VALUE:
+	switch (tok) {
+	case JSON_OPEN_BRACE:
+	case JSON_OPEN_BRACKET:
+	    if (ctx->max_depth != JSON_INFINITE_DEPTH && st->depth >= ctx->max_depth) {
+		ctx->limit = JPARSE_LIMIT_DEPTH;
+		return JSON_FAST_DEEP;
+	    }
+	    if (tok == JSON_OPEN_BRACE) {
+		fast_push(ctx, st->depth++, NULL, true);
+		st->expect = JSON_FAST_NAME_OR_CLOSE;
+		go = (events->object_start == NULL) || events->object_start(arg);
+	    } else {
+		fast_push(ctx, st->depth++, NULL, false);
+		st->expect = JSON_FAST_VALUE_OR_CLOSE;
+		go = (events->array_start == NULL) || events->array_start(arg);
+	    }
+	    return go ? JSON_FAST_MORE : JSON_FAST_STOP;
+	case JSON_STRING:
+	    if (!json_string_escapes_valid(text, leng)) {
+		return JSON_FAST_SYNTAX;
+	    }
+	    go = (events->string == NULL) || events->string(text+1, leng-2, arg);
+	    break;
+	case JSON_NUMBER:
+	    go = (events->number == NULL) || events->number(text, leng, arg);
+	    break;
+	case JSON_TRUE:
+	case JSON_FALSE:
+	    go = (events->boolean == NULL) || events->boolean(tok == JSON_TRUE, arg);
+	    break;
+	case JSON_NULL:
+	    go = (events->null == NULL) || events->null(arg);
+	    break;
+	default:
+	    return JSON_FAST_SYNTAX;
+	}
+	break;
+
+    case JSON_FAST_COMMA_OR_CLOSE:
+	object = ctx->stack[st->depth-1].object;
+	if (tok == JSON_COMMA) {
+	    st->expect = object ? JSON_FAST_NAME : JSON_FAST_VALUE;
+	    return JSON_FAST_MORE;
+	} else if (tok != (object ? JSON_CLOSE_BRACE : JSON_CLOSE_BRACKET)) {
+	    return JSON_FAST_SYNTAX;
+	}
+	--st->depth;
+	if (object) {
+	    go = (events->object_end == NULL) || events->object_end(arg);
+	} else {
+	    go = (events->array_end == NULL) || events->array_end(arg);
+	}
+	break;
+
+    case JSON_FAST_EOF:
+	if (tok != JPARSE_EOF) {
+	    return JSON_FAST_SYNTAX;
+	}
+	return JSON_FAST_DONE;
+
+    default:
+	err(105, __func__, "unexpected parser state: %d", (int)st->expect);
+	not_reached();
+    }
+
+    /*
+     * a value is complete
+     */
+    st->expect = (st->depth > 0) ? JSON_FAST_COMMA_OR_CLOSE : JSON_FAST_EOF;
+    return go ? JSON_FAST_MORE : JSON_FAST_STOP;
+}
+
+
+/*
+ * parse_json_events_ctx - parse a JSON document with callbacks instead of a parse tree
+ *
+ * The tokens come from the structural index scanner and the grammar is that
+ * of parse_json_fast_ctx(), but no struct json is ever formed: each part of the
+ * JSON is given to a callback in events as it is met (see struct json_events in
+ * json_fast.h).  Strings, member names and numbers are given in place, so
+ * nothing is copied or allocated for them.
+ *
+ * Syntax errors and the limits of the context (max_depth, max_bytes, ...) are
+ * reported as parse_json_fast_ctx() reports them.  As the callbacks are called before the
+ * rest of the JSON is looked at, they may have been called for the part of
+ * an invalid document that comes before the error.
+ *
+ * given:
+ *
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	events	    - callbacks to call
+ *	arg	    - argument passed to each callback
+ *
+ * return:
+ *	JSON_EVENTS_VALID ==> the JSON is valid,
+ *	JSON_EVENTS_INVALID ==> the JSON is invalid,
+ *	JSON_EVENTS_STOPPED ==> a callback returned false
+ *
+ * NOTE: if filename is NULL we set it to "-" for stdin.
+ *
+ * NOTE: a NUL byte anywhere in the data makes it invalid, as it does for
+ *	 jparse_push_end().  This is only known once the data has been
+ *	 scanned, so the callbacks may already have been called.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or events, in
+ *       which case it is an error.
+ */
+enum json_events_result
+parse_json_events_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename,
+		      struct json_events const *events, void *arg)
+{
+    struct json_fast_state st;			/* parser state */
+    struct json_scan *scan = NULL;		/* structural index scanner */
+    enum json_fast_status status;		/* what the parser made of the last token */
+    enum json_events_result result = JSON_EVENTS_VALID;	/* what to return */
+    JPARSE_LTYPE loc;				/* location of an offending token */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(106, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (events == NULL) {
+	err(107, __func__, "events is NULL");
+	not_reached();
+    }
+    ctx->nodes = 0;
+    ctx->limit = JPARSE_LIMIT_NONE;
+    if (ptr == NULL) {
+	werr(108, __func__, "ptr is NULL");
+	return JSON_EVENTS_INVALID;
+    }
+    if (filename == NULL) {
+	filename = "-";	/* assume stdin */
+    }
+    if (ctx->max_bytes != 0 && len > ctx->max_bytes) {
+	ctx->limit = JPARSE_LIMIT_BYTES;
+	jparse_limit_error(ctx, filename, NULL);
+	return JSON_EVENTS_INVALID;
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.expect = JSON_FAST_VALUE;
+    scan = &ctx->scan;
+    json_scan_init(scan, ptr, len);
+
+    /*
+     * parse until the end of data, the first error or a callback that says stop
+     */
+    do {
+	status = events_step(ctx, &st, scan, json_scan_lex(scan), events, arg);
+    } while (status == JSON_FAST_MORE);
+
+    if (status == JSON_FAST_STOP) {
+	result = JSON_EVENTS_STOPPED;
+    } else if (status != JSON_FAST_DONE) {
+	json_scan_locate(scan, filename, &loc);
+	fast_report(ctx, status, scan, &loc, NULL);
+	result = JSON_EVENTS_INVALID;
+    }
+    ctx->nul_seen = scan->nul;
+
+    /*
+     * as with jparse_push_end(), a NUL byte makes the data invalid
+     */
+    if (result == JSON_EVENTS_VALID && ctx->nul_seen) {
+	werr(109, __func__, "NUL byte detected: data is NOT valid JSON");
+	result = JSON_EVENTS_INVALID;
+    }
+    json_scan_free(scan);
+
+    if (json_dbg_allowed(JSON_DBG_LOW)) {
+	json_dbg(JSON_DBG_LOW, __func__, "%s JSON",
+		 (result == JSON_EVENTS_VALID) ? "valid" : ((result == JSON_EVENTS_INVALID) ? "invalid" : "stopped"));
+    }
+    return result;
+}
+
+
+/*
+ * parse_json_events - parse a JSON document with callbacks instead of a parse tree
+ *
+ * This is parse_json_events_ctx() with a context that lasts for just this call.
+ *
+ * given:
+ *
+ *	ptr	    - pointer to start of JSON blob
+ *	len	    - length of the JSON blob
+ *	filename    - filename or NULL for stdin
+ *	events	    - callbacks to call
+ *	arg	    - argument passed to each callback
+ *
+ * return:
+ *	JSON_EVENTS_VALID ==> the JSON is valid,
+ *	JSON_EVENTS_INVALID ==> the JSON is invalid,
+ *	JSON_EVENTS_STOPPED ==> a callback returned false
+ */
+enum json_events_result
+parse_json_events(char const *ptr, size_t len, char const *filename, struct json_events const *events, void *arg)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    enum json_events_result result;	/* what parse_json_events_ctx() returned */
+
+    jparse_ctx_init(&ctx);
+    result = parse_json_events_ctx(&ctx, ptr, len, filename, events, arg);
+    jparse_ctx_fini(&ctx);
+    return result;
+}
+
+
+/*
+ * push_boundary - find where the complete tokens of a chunk end
+ *
+ * given:
+ *	push	    push parser state, updated to the end of the chunk
+ *	chunk	    data just fed
+ *	len	    length of chunk
+ *	first	    where to store the offset of the first token boundary
+ *	last	    where to store the offset of the last token boundary
+ *
+ * returns:
+ *	true ==> chunk has a token boundary, false ==> it does not
+ *
+ * A token boundary is an offset at which a token that jparse_lex() would
+ * return is known to start: after a structural byte or closing quote, or
+ * where a run of whitespace or of newlines ends.  Strings and escapes are
+ * followed the way the structural index scanner follows them, so the text
+ * between two boundaries scans the same on its own as it does as part of the
+ * whole document, down to the location of each token.
+ */
+static bool
+push_boundary(struct json_push *push, char const *chunk, size_t len, size_t *first, size_t *last)
+{
+    bool found = false;		/* true ==> a boundary was found */
+    size_t b = 0;		/* offset of a boundary */
+    size_t i;
+    char c;
+
+    for (i = 0; i < len; ++i) {
+	c = chunk[i];
+
+	/*
+	 * a whitespace or newline run ends before this byte
+	 */
+	if ((push->pending == JSON_PUSH_WS && c != ' ' && c != '\t' && c != '\r') ||
+	    (push->pending == JSON_PUSH_NL && c != '\n')) {
+	    b = i;
+	    if (!found) {
+		*first = b;
+		found = true;
+	    }
+	    *last = b;
+	}
+	push->pending = JSON_PUSH_NONE;
+
+	/*
+	 * follow escapes and strings
+	 */
+	if (push->escaped) {
+	    push->escaped = false;
+	    if (c == '"' || push->in_string) {
+		continue;
+	    }
+	} else if (c == '\\') {
+	    push->escaped = true;
+	    continue;
+	} else if (c == '"') {
+	    push->in_string = !push->in_string;
+	    if (push->in_string) {
+		continue;
+	    }
+	    c = ',';	/* a closing quote ends its token as a structural byte does */
+	}
+	if (push->in_string) {
+	    continue;
+	}
+
+	switch (c) {
+	case ' ': case '\t': case '\r':
+	    push->pending = JSON_PUSH_WS;
+	    break;
+	case '\n':
+	    push->pending = JSON_PUSH_NL;
+	    break;
+	case '{': case '}': case '[': case ']': case ':': case ',':
+	    b = i + 1;
+	    if (!found) {
+		*first = b;
+		found = true;
+	    }
+	    *last = b;
+	    break;
+	default:
+	    break;
+	}
+    }
+    return found;
+}
+
+
+/*
+ * push_carry - keep data that does not end with a complete token
+ *
+ * given:
+ *	push	    push parser state
+ *	data	    data to add to the end of carry
+ *	len	    length of data
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static void
+push_carry(struct json_push *push, char const *data, size_t len)
+{
+    size_t size;
+
+    if (len == 0) {
+	return;
+    }
+    if (push->carry_len + len > push->carry_size) {
+	size = (push->carry_size > 0) ? push->carry_size : JSON_SCAN_BLOCK;
+	while (size < push->carry_len + len) {
+	    size *= 2;
+	}
+	errno = 0;	/* pre-clear errno for errp() */
+	push->carry = realloc(push->carry, size);
+	if (push->carry == NULL) {
+	    errp(84, __func__, "realloc of %ju bytes failed", (uintmax_t)size);
+	    not_reached();
+	}
+	push->carry_size = size;
+    }
+    memcpy(push->carry + push->carry_len, data, len);
+    push->carry_len += len;
+}
+
+
+/*
+ * push_slice - parse data that ends with a complete token
+ *
+ * given:
+ *	ctx	    parser context
+ *	data	    data that starts and ends on a token boundary
+ *	len	    length of data
+ *
+ * returns:
+ *	true ==> all tokens accepted, false ==> an error was reported
+ *
+ * The location state is carried from slice to slice so that errors are
+ * reported at the line and column they would be if the whole text had been
+ * given to parse_json_fast().
+ */
+static bool
+push_slice(struct jparse_ctx *ctx, char const *data, size_t len)
+{
+    struct json_push *push = &ctx->push;	/* push parser state */
+    struct json_scan *scan = &ctx->scan;	/* structural index scanner */
+    enum json_fast_status status = JSON_FAST_MORE;	/* what the parser made of the last token */
+    JPARSE_LTYPE loc;				/* location of an offending token */
+    int tok;					/* current token kind */
+    size_t i;
+
+    if (len == 0) {
+	return true;
+    }
+    json_scan_init(scan, data, len);
+    scan->line = push->line;
+    scan->column = push->column;
+
+    /*
+     * give the parser the tokens of the slice
+     */
+    for (tok = json_scan_lex(scan); tok != JPARSE_EOF; tok = json_scan_lex(scan)) {
+	status = fast_step(ctx, &push->state, scan, tok, "jparse_push_feed");
+	if (status != JSON_FAST_MORE) {
+	    json_scan_locate(scan, push->filename, &loc);
+	    fast_report(ctx, status, scan, &loc, push->state.tree);
+	    break;
+	}
+    }
+
+    /*
+     * note where the slice ends for the next one, and where its last token
+     * is in case the end of data turns out to be a syntax error
+     */
+    if (status == JSON_FAST_MORE) {
+	json_scan_locate(scan, push->filename, &loc);
+	push->line = loc.last_line;
+	push->column = loc.last_column;
+	for (i = len; i > 0 && data[i-1] == '\n'; --i) {
+	    ;
+	}
+	if (i > 0) {
+	    push->have_last = true;
+	    push->last_line = loc.first_line;
+	    push->last_column = loc.first_column;
+	}
+    }
+    ctx->nul_seen |= scan->nul;
+    json_scan_free(scan);
+    return status == JSON_FAST_MORE;
+}
+
+
+/*
+ * jparse_push_begin - start parsing a JSON document that arrives in chunks
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	filename    - name to report errors with or NULL for stdin
+ *
+ * The document is then given to jparse_push_feed() a chunk at a time, as it
+ * arrives, and jparse_push_end() returns the parse tree.  Chunks may split
+ * the document anywhere: the parser takes each complete token as soon as it
+ * has it, so only the part of a token that has not been completed is kept.
+ *
+ * The push parser is parse_json_fast(): the tree, the validity and the error
+ * messages are the same as if the chunks were joined and given to it.
+ *
+ * NOTE: a push parse that was begun but not ended is abandoned.
+ *
+ * NOTE: this function does not return on NULL ctx.
+ */
+void
+jparse_push_begin(struct jparse_ctx *ctx, char const *filename)
+{
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(77, __func__, "ctx is NULL");
+	not_reached();
+    }
+
+    jparse_push_abort(ctx);
+    ctx->push.filename = (filename == NULL) ? "-" : filename;
+    ctx->push.state.expect = JSON_FAST_VALUE;
+    ctx->push.active = true;
+    ctx->nul_seen = false;
+    ctx->nodes = 0;
+    ctx->limit = JPARSE_LIMIT_NONE;
+}
+
+
+/*
+ * jparse_push_feed - parse the next chunk of a JSON document
+ *
+ * given:
+ *	ctx	    - parser context given to jparse_push_begin()
+ *	chunk	    - next chunk of the document
+ *	len	    - length of chunk
+ *
+ * returns:
+ *	true ==> no error so far, false ==> the document is invalid (the error
+ *	has been reported) and further chunks will be ignored
+ *
+ * NOTE: chunk is not kept: it may be reused as soon as this function returns.
+ *
+ * NOTE: this function does not return on NULL ctx.
+ */
+bool
+jparse_push_feed(struct jparse_ctx *ctx, char const *chunk, size_t len)
+{
+    struct json_push *push = NULL;	/* push parser state */
+    size_t first = 0;			/* offset of the first token boundary in chunk */
+    size_t last = 0;			/* offset of the last token boundary in chunk */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(78, __func__, "ctx is NULL");
+	not_reached();
+    }
+    push = &ctx->push;
+    if (!push->active) {
+	werr(79, __func__, "called without jparse_push_begin()");
+	return false;
+    }
+    if (chunk == NULL && len > 0) {
+	werr(80, __func__, "chunk is NULL");
+	push->failed = true;
+	return false;
+    }
+    if (push->failed) {
+	return false;
+    }
+    push->fed += len;
+    if (ctx->max_bytes != 0 && push->fed > ctx->max_bytes) {
+	ctx->limit = JPARSE_LIMIT_BYTES;
+	jparse_limit_error(ctx, push->filename, NULL);
+	push->failed = true;
+	return false;
+    }
+
+    /*
+     * without a token boundary the chunk only adds to the unfinished token
+     */
+    if (!push_boundary(push, chunk, len, &first, &last)) {
+	push_carry(push, chunk, len);
+	return true;
+    }
+
+    /*
+     * finish the token left over from earlier chunks, then parse the rest of
+     * the complete tokens where they are and keep what follows them
+     */
+    if (push->carry_len > 0) {
+	push_carry(push, chunk, first);
+	if (!push_slice(ctx, push->carry, push->carry_len)) {
+	    push->failed = true;
+	    return false;
+	}
+	push->carry_len = 0;
+    } else {
+	first = 0;
+    }
+    if (!push_slice(ctx, chunk + first, last - first)) {
+	push->failed = true;
+	return false;
+    }
+    push_carry(push, chunk + last, len - last);
+    return true;
+}
+
+
+/*
+ * jparse_push_end - finish parsing a JSON document given in chunks
+ *
+ * given:
+ *	ctx	    - parser context given to jparse_push_begin()
+ *	is_valid    - non-NULL pointer to boolean to set depending on JSON validity
+ *
+ * return:
+ *	pointer to a JSON parse tree
+ *
+ * NOTE: as with parse_json_fast(), if the top level value is complete but is
+ *	 followed by something other than whitespace, *is_valid is set to false
+ *	 but the top level value is returned.
+ *
+ * NOTE: as with parse_json_stream(), a NUL byte in a string makes the data
+ *	 invalid: a blank JSON tree is returned.
+ *
+ * NOTE: this function only warns on error, except for NULL ctx or is_valid, in
+ *       which case it is an error.
+ */
+struct json *
+jparse_push_end(struct jparse_ctx *ctx, bool *is_valid)
+{
+    struct json_push *push = NULL;	/* push parser state */
+    struct json *tree = NULL;		/* the JSON parse tree */
+    enum json_fast_status status;	/* what the parser made of the end of data */
+    JPARSE_LTYPE loc;			/* location of the end of data */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(81, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (is_valid == NULL) {
+	err(82, __func__, "is_valid == NULL");
+	not_reached();
+    }
+    push = &ctx->push;
+    if (!push->active) {
+	werr(83, __func__, "called without jparse_push_begin()");
+	*is_valid = false;
+	return json_alloc(JTYPE_UNSET);
+    }
+    *is_valid = true;
+
+    /*
+     * parse what is left and then the end of data
+     */
+    if (!push->failed && push_slice(ctx, push->carry, push->carry_len)) {
+	push->carry_len = 0;
+	json_scan_init(&ctx->scan, "", 0);
+	status = fast_step(ctx, &push->state, &ctx->scan, json_scan_lex(&ctx->scan), __func__);
+	if (status != JSON_FAST_DONE) {
+	    memset(&loc, 0, sizeof(loc));
+	    if (push->have_last) {
+		loc.filename = push->filename;
+		loc.first_line = push->last_line;
+		loc.first_column = push->last_column;
+	    }
+	    fast_report(ctx, status, &ctx->scan, &loc, push->state.tree);
+	    push->failed = true;
+	}
+	json_scan_free(&ctx->scan);
+    } else {
+	push->failed = true;
+    }
+
+    if (push->failed) {
+	fast_free(ctx->stack, push->state.depth);
+	push->state.depth = 0;
+	*is_valid = false;
+    }
+
+    /*
+     * as with parse_json_stream(), a NUL byte makes the data invalid
+     */
+    if (*is_valid && ctx->nul_seen) {
+	werr(85, __func__, "NUL byte detected: data is NOT valid JSON");
+	json_tree_release(push->state.tree);
+	push->state.tree = json_alloc(JTYPE_UNSET);
+	*is_valid = false;
+    }
+    if (json_dbg_allowed(JSON_DBG_LOW)) {
+	json_dbg(JSON_DBG_LOW, __func__, "%s JSON", *is_valid ? "valid" : "invalid");
+    }
+
+    /*
+     * the tree now belongs to the caller
+     */
+    tree = push->state.tree;
+    push->state.tree = NULL;
+    jparse_push_abort(ctx);
+
+    /*
+     * return parse tree
+     */
+    return tree;
+}
+
+
+/*
+ * jparse_push_abort - abandon a JSON document given in chunks
+ *
+ * given:
+ *	ctx	    - parser context given to jparse_push_begin()
+ *
+ * Whatever has been parsed is freed and ctx is ready for another parse.  The
+ * carry buffer is kept for the next push parse.
+ *
+ * NOTE: a NULL ctx or one with no push parse in progress is ignored.
+ */
+void
+jparse_push_abort(struct jparse_ctx *ctx)
+{
+    struct json_push *push = NULL;	/* push parser state */
+    char *carry = NULL;			/* carry buffer to keep */
+    size_t carry_size = 0;		/* allocated size of carry */
+
+    if (ctx == NULL || !ctx->push.active) {
+	return;
+    }
+    push = &ctx->push;
+    fast_free(ctx->stack, push->state.depth);
+    if (push->state.tree != NULL) {
+	json_tree_release(push->state.tree);
+    }
+    carry = push->carry;
+    carry_size = push->carry_size;
+    memset(push, 0, sizeof(*push));
+    push->carry = carry;
+    push->carry_size = carry_size;
+}
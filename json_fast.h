@@ -0,0 +1,198 @@
+/*
+ * json_fast - JSON parser without the bison tables
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_FAST_H)
+#    define  INCLUDE_JSON_FAST_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * json_parse - JSON parser support code
+ */
+#include "json_parse.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_FAST_STACK (64)		/* initial number of open objects and arrays the parse stack can hold */
+
+
+/*
+ * JSON parser backends
+ *
+ * JSON_PARSER_BISON is the bison generated jparse_parse() in jparse.y.
+ *
+ * JSON_PARSER_FAST is parse_json_fast(): a hand-written parser that takes its
+ * tokens from the structural index scanner and keeps the open objects and
+ * arrays on a heap allocated stack, so the depth of nesting is limited only by
+ * memory.
+ */
+enum json_parser
+{
+    JSON_PARSER_BISON = 0,	/* bison generated parser (must be first) */
+    JSON_PARSER_FAST = 1,	/* parse_json_fast() */
+};
+
+/*
+ * what parse_json_fast() expects the next token to be
+ */
+enum json_fast_expect
+{
+    JSON_FAST_VALUE = 0,	/* a value: at the top level, after ',' in an array or after ':' */
+    JSON_FAST_VALUE_OR_CLOSE,	/* a value or ']': just after '[' */
+    JSON_FAST_NAME,		/* a member name: after ',' in an object */
+    JSON_FAST_NAME_OR_CLOSE,	/* a member name or '}': just after '{' */
+    JSON_FAST_COLON,		/* ':' after a member name */
+    JSON_FAST_COMMA_OR_CLOSE,	/* ',' or the close of the innermost array or object */
+    JSON_FAST_EOF,		/* end of data after the top level value */
+};
+
+/*
+ * struct json_fast_frame - an object or array that has been opened but not closed
+ */
+struct json_fast_frame
+{
+    struct json *node;		/* JTYPE_OBJECT or JTYPE_ARRAY being filled in */
+    struct json *name;		/* JTYPE_STRING name of the member whose value comes next, or NULL */
+    bool object;		/* true ==> an object, false ==> an array */
+};
+
+/*
+ * what parse_json_fast() makes of a token
+ */
+enum json_fast_status
+{
+    JSON_FAST_MORE = 0,		/* token accepted: more tokens are needed */
+    JSON_FAST_DONE,		/* end of data accepted: the parse is complete */
+    JSON_FAST_SYNTAX,		/* syntax error */
+    JSON_FAST_DEEP,		/* object or array nested deeper than the context max_depth */
+    JSON_FAST_STOP,		/* a parse_json_events() callback asked to stop */
+    JSON_FAST_LIMIT,		/* another limit of the context was exceeded, see jparse_limit_token() */
+};
+
+/*
+ * struct json_fast_state - parse_json_fast() state between tokens
+ */
+struct json_fast_state
+{
+    enum json_fast_expect expect;	/* what the next token must be */
+    size_t depth;			/* number of frames of the context parse stack in use */
+    struct json *tree;			/* top level value once it is complete, else NULL */
+};
+
+/*
+ * what ends the token jparse_push_feed() is in the middle of
+ */
+enum json_push_pending
+{
+    JSON_PUSH_NONE = 0,		/* nothing yet known */
+    JSON_PUSH_WS,		/* a run of ' ', '\t' and '\r' ends at the next byte that is not one of them */
+    JSON_PUSH_NL,		/* a run of newlines ends at the next byte that is not a newline */
+};
+
+/*
+ * struct json_push - jparse_push_feed() state between chunks
+ *
+ * Whatever follows the last complete token of the data fed so far is kept in
+ * carry until the chunk that completes it arrives, so the memory used depends
+ * on the longest token and not on the size of the document.
+ */
+struct json_push
+{
+    char const *filename;		/* name of what is being parsed */
+    struct json_fast_state state;	/* parser state */
+    bool active;			/* true ==> between jparse_push_begin() and jparse_push_end() */
+    bool failed;			/* true ==> an error has been reported, the rest is ignored */
+    bool in_string;			/* true ==> the data fed so far ends inside a string */
+    bool escaped;			/* true ==> the next byte fed is escaped by a backslash */
+    enum json_push_pending pending;	/* what ends the whitespace run the data fed so far ends with */
+    char *carry;			/* data fed after the last complete token */
+    size_t carry_len;			/* bytes in carry */
+    size_t carry_size;			/* allocated size of carry */
+    int line;				/* location line state at the start of carry, see json_scan_locate() */
+    int column;				/* location column state at the start of carry */
+    bool have_last;			/* true ==> last_line and last_column are set */
+    int last_line;			/* line of the last token scanned so far that is not a newline */
+    int last_column;			/* column of that token */
+    uintmax_t fed;			/* bytes fed so far, checked against the context max_bytes */
+};
+
+/*
+ * struct json_events - what parse_json_events() calls as it meets each part of the JSON
+ *
+ * Any callback may be NULL, in which case that part is only checked.  Each
+ * callback returns true to go on, or false to stop the parse there.
+ *
+ * Strings, member names and numbers are given as a pointer into the data
+ * being parsed and a length, without the enclosing quotes: the text is not
+ * NUL terminated and escapes are not decoded (see json_encode()).
+ */
+struct json_events
+{
+    bool (*object_start)(void *arg);					/* '{' */
+    bool (*object_end)(void *arg);					/* '}' */
+    bool (*array_start)(void *arg);					/* '[' */
+    bool (*array_end)(void *arg);					/* ']' */
+    bool (*member_name)(char const *ptr, size_t len, void *arg);	/* name of a member, its value follows */
+    bool (*string)(char const *ptr, size_t len, void *arg);		/* string value */
+    bool (*number)(char const *ptr, size_t len, void *arg);		/* number as it is in the JSON */
+    bool (*boolean)(bool value, void *arg);				/* true or false */
+    bool (*null)(void *arg);						/* null */
+};
+
+/*
+ * what parse_json_events() returns
+ */
+enum json_events_result
+{
+    JSON_EVENTS_VALID = 0,	/* the JSON is valid and every callback returned true */
+    JSON_EVENTS_INVALID,	/* the JSON is invalid: the error has been reported */
+    JSON_EVENTS_STOPPED,	/* a callback returned false: the rest of the JSON was not looked at */
+};
+
+struct jparse_ctx;
+
+
+/*
+ * global variables
+ */
+extern enum json_parser json_parser_backend;	/* parser used by parse_json(), set by -P in jparse */
+
+
+/*
+ * external function declarations
+ */
+extern struct json *parse_json_fast(char const *ptr, size_t len, char const *filename, bool *is_valid);
+extern struct json *parse_json_fast_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename,
+					bool *is_valid);
+extern void jparse_push_begin(struct jparse_ctx *ctx, char const *filename);
+extern bool jparse_push_feed(struct jparse_ctx *ctx, char const *chunk, size_t len);
+extern struct json *jparse_push_end(struct jparse_ctx *ctx, bool *is_valid);
+extern void jparse_push_abort(struct jparse_ctx *ctx);
+extern enum json_events_result parse_json_events_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len,
+						     char const *filename, struct json_events const *events, void *arg);
+extern enum json_events_result parse_json_events(char const *ptr, size_t len, char const *filename,
+						 struct json_events const *events, void *arg);
+
+
+#endif /* INCLUDE_JSON_FAST_H */
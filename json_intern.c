@@ -0,0 +1,415 @@
+/*
+ * json_intern - intern table of JSON member names
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * util - common utility functions for the JSON parser
+ */
+#include "util.h"
+
+/*
+ * json_intern - intern table of JSON member names
+ */
+#include "json_intern.h"
+
+
+/*
+ * static variables
+ */
+static _Thread_local struct json_intern *intern_in_use = NULL;	/* table of this thread, see json_intern_use() */
+
+
+/*
+ * static functions
+ */
+static void intern_resize(struct json_intern *table, size_t slots);
+
+
+/*
+ * intern_resize - move the names of an intern table to a new set of slots
+ *
+ * given:
+ *	table	    intern table
+ *	slots	    number of new slots, a power of 2 more than table->count
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static void
+intern_resize(struct json_intern *table, size_t slots)
+{
+    struct json_intern_name **slot = NULL;	/* new slots */
+    size_t i;
+    size_t j;
+
+    errno = 0;		/* pre-clear errno for errp() */
+    slot = calloc(slots, sizeof(*slot));
+    if (slot == NULL) {
+	errp(121, __func__, "calloc of %ju intern table slots failed", (uintmax_t)slots);
+	not_reached();
+    }
+    for (i=0; i < table->slots; ++i) {
+	if (table->slot[i] != NULL) {
+	    for (j = table->slot[i]->hash & (slots-1); slot[j] != NULL; j = (j+1) & (slots-1)) {
+		;
+	    }
+	    slot[j] = table->slot[i];
+	}
+    }
+    if (table->slot != NULL) {
+	free(table->slot);
+    }
+    table->slot = slot;
+    table->slots = slots;
+}
+
+
+/*
+ * json_intern_init - initialise an intern table
+ *
+ * given:
+ *	table	    intern table to initialise
+ *
+ * No slot is allocated until a name is added to the table.
+ *
+ * NOTE: this function does not return on NULL table.
+ */
+void
+json_intern_init(struct json_intern *table)
+{
+    /*
+     * firewall
+     */
+    if (table == NULL) {
+	err(122, __func__, "table is NULL");
+	not_reached();
+    }
+
+    memset(table, 0, sizeof(*table));
+    table->max_len = JSON_INTERN_MAX_LEN;
+    table->slot = NULL;
+    table->slots = 0;
+    table->count = 0;
+    table->bytes = 0;
+}
+
+
+/*
+ * json_intern_clear - free the names of an intern table
+ *
+ * given:
+ *	table	    intern table from json_intern_init() or json_intern_create()
+ *
+ * The slots are kept for the names added next.
+ *
+ * NOTE: a parse tree whose member names are in the table must not be used
+ *	 after the table is cleared.
+ *
+ * NOTE: this function does not return on NULL table.
+ */
+void
+json_intern_clear(struct json_intern *table)
+{
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (table == NULL) {
+	err(123, __func__, "table is NULL");
+	not_reached();
+    }
+
+    for (i=0; i < table->slots; ++i) {
+	if (table->slot[i] != NULL) {
+	    free(table->slot[i]);
+	    table->slot[i] = NULL;
+	}
+    }
+    table->count = 0;
+    table->bytes = 0;
+}
+
+
+/*
+ * json_intern_fini - free the names and slots of an intern table
+ *
+ * given:
+ *	table	    intern table from json_intern_init(), may be NULL
+ *
+ * The struct json_intern itself is not freed: it may be used again as if
+ * json_intern_init() had been called.
+ */
+void
+json_intern_fini(struct json_intern *table)
+{
+    if (table == NULL) {
+	return;
+    }
+    if (intern_in_use == table) {
+	intern_in_use = NULL;
+    }
+    json_intern_clear(table);
+    if (table->slot != NULL) {
+	free(table->slot);
+	table->slot = NULL;
+    }
+    table->slots = 0;
+}
+
+
+/*
+ * json_intern_create - allocate and initialise an intern table
+ *
+ * returns:
+ *	pointer to a table to pass to json_intern_use() and later to json_intern_free()
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+struct json_intern *
+json_intern_create(void)
+{
+    struct json_intern *table = NULL;
+
+    errno = 0;	/* pre-clear errno for errp() */
+    table = malloc(sizeof(*table));
+    if (table == NULL) {
+	errp(124, __func__, "malloc of struct json_intern failed");
+	not_reached();
+    }
+    json_intern_init(table);
+    return table;
+}
+
+
+/*
+ * json_intern_free - free an intern table from json_intern_create()
+ *
+ * given:
+ *	table	    intern table to free, may be NULL
+ */
+void
+json_intern_free(struct json_intern *table)
+{
+    if (table == NULL) {
+	return;
+    }
+    json_intern_fini(table);
+    free(table);
+}
+
+
+/*
+ * json_intern_hash - hash the bytes of a name
+ *
+ * given:
+ *	ptr	    first byte of the name
+ *	len	    number of bytes
+ *
+ * returns:
+ *	64 bit FNV-1a hash of the bytes, folded into a size_t
+ *
+ * NOTE: a NULL ptr hashes as an empty name.
+ */
+size_t
+json_intern_hash(char const *ptr, size_t len)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);	/* FNV-1a offset basis */
+    size_t i;
+
+    if (ptr == NULL) {
+	len = 0;
+    }
+    for (i=0; i < len; ++i) {
+	hash ^= (uint8_t)ptr[i];
+	hash *= UINT64_C(0x100000001b3);		/* FNV-1a prime */
+    }
+    return (size_t)(hash ^ (hash >> 32));
+}
+
+
+/*
+ * json_intern_find - look up a name in an intern table
+ *
+ * given:
+ *	table	    intern table, may be NULL
+ *	as_str	    name as in the JSON, without the '"'s
+ *	len	    length of as_str
+ *	hash	    json_intern_hash(as_str, len)
+ *
+ * returns:
+ *	the name in the table, or NULL if it is not there
+ */
+struct json_intern_name *
+json_intern_find(struct json_intern const *table, char const *as_str, size_t len, size_t hash)
+{
+    struct json_intern_name *name = NULL;	/* name in a slot */
+    size_t i;
+
+    if (table == NULL || table->slots == 0 || as_str == NULL) {
+	return NULL;
+    }
+    for (i = hash & (table->slots-1); (name = table->slot[i]) != NULL; i = (i+1) & (table->slots-1)) {
+	if (name->hash == hash && name->as_str_len == len && memcmp(name->as_str, as_str, len) == 0) {
+	    return name;
+	}
+    }
+    return NULL;
+}
+
+
+/*
+ * json_intern_add - add a name to an intern table
+ *
+ * given:
+ *	table	    intern table
+ *	as_str	    name as in the JSON, without the '"'s
+ *	as_str_len  length of as_str
+ *	str	    encoded name, or as_str if it has no \-escape
+ *	str_len	    length of str
+ *	hash	    json_intern_hash(as_str, as_str_len)
+ *
+ * returns:
+ *	the name in the table, which is the one already there if there is one
+ *
+ * NOTE: this function does not return on NULL pointers or allocation failure.
+ */
+struct json_intern_name *
+json_intern_add(struct json_intern *table, char const *as_str, size_t as_str_len,
+		char const *str, size_t str_len, size_t hash)
+{
+    struct json_intern_name *name = NULL;	/* name to add */
+    size_t size = 0;				/* bytes to allocate for name */
+    bool same = false;				/* true ==> str is as_str */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (table == NULL || as_str == NULL || str == NULL) {
+	err(125, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    /*
+     * case: the name is already there
+     */
+    name = json_intern_find(table, as_str, as_str_len, hash);
+    if (name != NULL) {
+	return name;
+    }
+
+    /*
+     * keep at least half the slots empty
+     */
+    if (table->count + 1 > table->slots / 2) {
+	intern_resize(table, table->slots > 0 ? table->slots * 2 : JSON_INTERN_SLOTS);
+    }
+
+    /*
+     * copy the name
+     */
+    same = (str == as_str || (str_len == as_str_len && memcmp(str, as_str, str_len) == 0));
+    size = sizeof(*name) + as_str_len + 1 + (same ? 0 : str_len + 1);
+    errno = 0;		/* pre-clear errno for errp() */
+    name = malloc(size);
+    if (name == NULL) {
+	errp(126, __func__, "malloc of %ju bytes for interned name failed", (uintmax_t)size);
+	not_reached();
+    }
+    name->hash = hash;
+    name->as_str_len = as_str_len;
+    memcpy(name->as_str, as_str, as_str_len);
+    name->as_str[as_str_len] = '\0';
+    if (same) {
+	name->str = name->as_str;
+    } else {
+	name->str = name->as_str + as_str_len + 1;
+	memcpy(name->str, str, str_len);
+	name->str[str_len] = '\0';
+    }
+    name->str_len = str_len;
+    name->same = same;
+    posix_safe_chk(name->str, name->str_len, &name->slash, &name->posix_safe, &name->first_alphanum, &name->upper);
+
+    /*
+     * put it in the first empty slot
+     */
+    for (i = hash & (table->slots-1); table->slot[i] != NULL; i = (i+1) & (table->slots-1)) {
+	;
+    }
+    table->slot[i] = name;
+    ++table->count;
+    table->bytes += size;
+    return name;
+}
+
+
+/*
+ * json_intern_use - set the intern table of member names of this thread
+ *
+ * given:
+ *	table	    table to intern names in, NULL ==> do not intern names
+ *
+ * returns:
+ *	the table that was in use by this thread, or NULL
+ *
+ * Until the next call, the name of each member that the parsers make in this
+ * thread, and each member that json_conv_member() makes, is looked up in
+ * table and added if it is not there and not longer than table->max_len.
+ * The name then points into table instead of to storage of its own.
+ *
+ * Each thread has a table of its own, so threads may each use a table of
+ * their own at the same time.
+ */
+struct json_intern *
+json_intern_use(struct json_intern *table)
+{
+    struct json_intern *prev = intern_in_use;	/* table that was in use */
+
+    intern_in_use = table;
+    return prev;
+}
+
+
+/*
+ * json_intern_in_use - return the intern table of member names of this thread
+ *
+ * returns:
+ *	table set by json_intern_use(), or NULL if names are not interned
+ */
+struct json_intern *
+json_intern_in_use(void)
+{
+    return intern_in_use;
+}
@@ -0,0 +1,111 @@
+/*
+ * json_intern - intern table of JSON member names
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_INTERN_H)
+#    define  INCLUDE_JSON_INTERN_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/*
+ * definitions
+ */
+#define JSON_INTERN_SLOTS (64)		/* initial number of slots in an intern table, a power of 2 */
+#define JSON_INTERN_MAX_LEN (256)	/* default longest name that is interned */
+
+/* the struct json_intern_name whose as_str is ptr */
+#define JSON_INTERN_NAME(ptr) \
+    ((struct json_intern_name *)((char *)(ptr) - offsetof(struct json_intern_name, as_str)))
+
+
+/*
+ * struct json_intern_name - a member name in an intern table
+ *
+ * The name, as found in the JSON between the '"'s, is as_str.  When it has
+ * a \-escape, the encoded name follows it in the same allocation: str is
+ * then as_str + as_str_len + 1, else str is as_str.  A name never changes or
+ * moves while the table holds it.
+ */
+struct json_intern_name
+{
+    size_t hash;		/* json_intern_hash() of as_str */
+    size_t as_str_len;		/* length of as_str, not including final NUL */
+    size_t str_len;		/* length of str, not including final NUL */
+    char *str;			/* encoded name, NUL terminated */
+
+    /* what json_conv_string() found about str, copied into each node */
+    bool same;			/* true ==> str is as_str */
+    bool slash;			/* true ==> / was found after encoding */
+    bool posix_safe;		/* true ==> all chars are POSIX portable safe plus + and maybe / after encoding */
+    bool first_alphanum;	/* true ==> first char is alphanumeric after encoding */
+    bool upper;			/* true ==> UPPER case chars found after encoding */
+
+    char as_str[];		/* name as in the JSON, NUL terminated, then str if not same */
+};
+
+/*
+ * struct json_intern - intern table of JSON member names
+ *
+ * While json_intern_use() has made a table the one in use by a thread, the
+ * name of each member that thread parses is looked up in the table.  Each
+ * name is stored once, however many members have it, and the nodes of the
+ * names point to that one copy: within a table two names are the same if
+ * and only if their str pointers are the same.
+ *
+ * The table may be kept from one document to the next, or emptied with
+ * json_intern_clear(), but it must not be emptied or freed while a parse tree
+ * that uses its names is still in use.
+ *
+ * Use json_intern_create() / json_intern_free() for a table on the heap or
+ * json_intern_init() / json_intern_fini() for one embedded in something else.
+ */
+struct json_intern
+{
+    /* option: json_intern_init() sets the default */
+    size_t max_len;			/* longer names are not interned (def: JSON_INTERN_MAX_LEN) */
+
+    /* state */
+    struct json_intern_name **slot;	/* open addressed hash table of names, NULL ==> empty slot */
+    size_t slots;			/* number of slots, a power of 2, or 0 */
+    size_t count;			/* number of names in the table */
+    size_t bytes;			/* bytes allocated for the names */
+};
+
+
+/*
+ * external function declarations
+ */
+extern void json_intern_init(struct json_intern *table);
+extern void json_intern_fini(struct json_intern *table);
+extern struct json_intern *json_intern_create(void);
+extern void json_intern_free(struct json_intern *table);
+extern void json_intern_clear(struct json_intern *table);
+extern size_t json_intern_hash(char const *ptr, size_t len);
+extern struct json_intern_name *json_intern_find(struct json_intern const *table, char const *as_str, size_t len,
+						 size_t hash);
+extern struct json_intern_name *json_intern_add(struct json_intern *table, char const *as_str, size_t as_str_len,
+						char const *str, size_t str_len, size_t hash);
+extern struct json_intern *json_intern_use(struct json_intern *table);
+extern struct json_intern *json_intern_in_use(void);
+
+
+#endif /* INCLUDE_JSON_INTERN_H */
@@ -29,8 +29,17 @@
 #include <limits.h>
 #include <inttypes.h>
 #include <math.h>
+#include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define JSON_DECODE_SSE2 1
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define JSON_DECODE_AVX2 1
+#endif
+#endif
+
 /*
  * dbg - info, debug, warning, error, and usage message facility
  */
@@ -55,11 +64,37 @@
  */
 #include "json_util.h"
 
-/* for json string encoding */
-static char *encode_json_string(char const *ptr, size_t len, size_t mlen, size_t *retlen);
+#if defined(JSON_DECODE_SSE2)
+static size_t decode_run_sse2(uint8_t const *ptr, size_t len);
+#endif
+#if defined(JSON_DECODE_AVX2)
+static size_t decode_run_avx2(uint8_t const *ptr, size_t len) __attribute__((target("avx2")));
+#endif
+#if defined(JSON_DECODE_SSE2)
+static size_t encode_run_sse2(uint8_t const *ptr, size_t len);
+#endif
+#if defined(JSON_DECODE_AVX2)
+static size_t encode_run_avx2(uint8_t const *ptr, size_t len) __attribute__((target("avx2")));
+#endif
+static size_t encode_json_run(char const *ptr, size_t len);
+static size_t encode_json_escape(char const *ptr, size_t len, int32_t *code, char const *name);
 /* for json number strings */
 static bool json_process_decimal(struct json_number *item, char const *str, size_t len);
 static bool json_process_floating(struct json_number *item, char const *str, size_t len);
+static bool json_split_floating(char const *str, size_t len, bool *negative, uint64_t *mant, int *exp10);
+static bool json_digits_to_uint64(char const *str, size_t len, uint64_t *ret);
+/* for storage of what a node holds */
+static struct json_arena *json_node_arena(struct json const *node);
+static void *json_node_alloc(struct json const *node, size_t size);
+static void *json_node_grow(struct json const *node, void *ptr, size_t old_size, size_t size);
+static void json_node_set_append(struct json const *node, struct json ***set, intmax_t *len, intmax_t *alloc,
+				 struct json *child);
+/* for member names */
+static struct json_intern_name const *json_string_intern(struct json *node);
+static size_t json_member_name_hash(struct json_member const *member);
+static bool json_member_name_is(struct json_member const *member, char const *name, size_t len);
+static void json_object_index_add(struct json_object_index *index, struct json * const *set, intmax_t i);
+static struct json_object_index *json_object_index(struct json *node, struct json_object *item);
 
 
 /*
@@ -174,6 +209,133 @@ struct byte2asciistr byte2asciistr[JSON_BYTE_VALUES] = {
 };
 
 
+#if defined(JSON_DECODE_SSE2)
+/*
+ * decode_run_sse2 - count the bytes that decode as themselves 16 bytes at a time with SSE2
+ *
+ * given:
+ *	ptr	    bytes to look at
+ *	len	    number of bytes, at least 16
+ *
+ * returns:
+ *	number of bytes before the first one that must be escaped, a multiple
+ *	of 16 if the rest are fewer than 16
+ *
+ * NOTE: the bytes that must be escaped are [\x00-\x1f], '"', '\\' and \x7f,
+ *	 see chkbyte2asciistr().
+ */
+static size_t
+decode_run_sse2(uint8_t const *ptr, size_t len)
+{
+    __m128i const quote = _mm_set1_epi8('"');
+    __m128i const backslash = _mm_set1_epi8('\\');
+    __m128i const del = _mm_set1_epi8(0x7f);
+    __m128i const ctrl = _mm_set1_epi8(0x1f);
+    __m128i v;
+    unsigned int mask;
+    size_t i;
+
+    for (i = 0; len - i >= 16; i += 16) {
+	v = _mm_loadu_si128((__m128i const *)(ptr + i));
+	mask = (unsigned int)_mm_movemask_epi8(
+		_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+			     _mm_or_si128(_mm_cmpeq_epi8(v, del), _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl), v))));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask);
+	}
+    }
+    return i;
+}
+#endif
+
+
+#if defined(JSON_DECODE_AVX2)
+/*
+ * decode_run_avx2 - count the bytes that decode as themselves 32 bytes at a time with AVX2
+ *
+ * given:
+ *	ptr	    bytes to look at
+ *	len	    number of bytes, at least 32
+ *
+ * returns:
+ *	number of bytes before the first one that must be escaped, a multiple
+ *	of 32 if the rest are fewer than 32
+ *
+ * NOTE: only called when the CPU reports AVX2 support, see json_decode_run().
+ */
+static size_t
+decode_run_avx2(uint8_t const *ptr, size_t len)
+{
+    __m256i const quote = _mm256_set1_epi8('"');
+    __m256i const backslash = _mm256_set1_epi8('\\');
+    __m256i const del = _mm256_set1_epi8(0x7f);
+    __m256i const ctrl = _mm256_set1_epi8(0x1f);
+    __m256i v;
+    unsigned int mask;
+    size_t i;
+
+    for (i = 0; len - i >= 32; i += 32) {
+	v = _mm256_loadu_si256((__m256i const *)(ptr + i));
+	mask = (unsigned int)_mm256_movemask_epi8(
+		_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, backslash)),
+				_mm256_or_si256(_mm256_cmpeq_epi8(v, del),
+						_mm256_cmpeq_epi8(_mm256_min_epu8(v, ctrl), v))));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask);
+	}
+    }
+    return i;
+}
+#endif
+
+
+/*
+ * json_decode_run - count the bytes at the start of a block that JSON decode as themselves
+ *
+ * given:
+ *	ptr	    start of memory block
+ *	len	    length of block in bytes
+ *
+ * returns:
+ *	number of bytes before the first one whose byte2asciistr[] decoding is
+ *	not the byte itself, or len if there is none
+ *
+ * Most text has long runs of such bytes, which json_decode() and the writers
+ * copy as they are.  Where SSE2 or AVX2 is available the run is found 16 or
+ * 32 bytes at a time; the last few bytes are looked up in byte2asciistr[].
+ */
+size_t
+json_decode_run(char const *ptr, size_t len)
+{
+    uint8_t const *p = (uint8_t const *)ptr;
+    size_t i = 0;
+
+    if (ptr == NULL) {
+	return 0;
+    }
+
+#if defined(JSON_DECODE_AVX2)
+    if (len >= 32 && __builtin_cpu_supports("avx2")) {
+	i = decode_run_avx2(p, len);
+	if (len - i >= 32) {
+	    return i;
+	}
+    }
+#endif
+#if defined(JSON_DECODE_SSE2)
+    if (len - i >= 16) {
+	i += decode_run_sse2(p + i, len - i);
+	if (len - i >= 16) {
+	    return i;
+	}
+    }
+#endif
+    while (i < len && byte2asciistr[p[i]].len == 1) {
+	++i;
+    }
+    return i;
+}
+
 /*
  * json_decode - return the decoding of a JSON encoded block of memory
  *
@@ -202,10 +364,8 @@ char *
 json_decode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
 {
     char *ret = NULL;	    /* allocated decoding string or NULL */
-    char *beyond = NULL;    /* beyond the end of the allocated decoding string */
-    ssize_t mlen = 0;	    /* length of allocated decoded string */
-    char *p;		    /* next place to decode */
-    size_t i;
+    size_t size = 0;	    /* bytes of decoded string, including the NUL */
+    size_t mlen = 0;	    /* length of decoded string */
 
     /*
      * firewall
@@ -222,33 +382,101 @@ json_decode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
     /*
      * count the bytes that will be in the decoded allocated string
      */
-    for (i=0; i < len; ++i) {
-	mlen += byte2asciistr[(uint8_t)(ptr[i])].len;
-    }
-    if (mlen < 0) { /* paranoia */
+    (void) json_decode_buf(ptr, len, NULL, 0, &size, skip_quote);
+    if (size == 0) { /* paranoia */
 	/* error - clear allocated length */
 	if (retlen != NULL) {
 	    *retlen = 0;
 	}
-	warn(__func__, "mlen #0: %ju < 0", (uintmax_t)mlen);
+	warn(__func__, "size of decoding: %ju == 0", (uintmax_t)size);
 	return NULL;
     }
 
     /*
      * malloc the decoded string
      */
-    ret = malloc((size_t)mlen + 1 + 1);
+    ret = malloc(size + 1);
     if (ret == NULL) {
 	/* error - clear allocated length */
 	if (retlen != NULL) {
 	    *retlen = 0;
 	}
-	warn(__func__, "malloc of %ju bytes failed", (uintmax_t)(mlen + 1 + 1));
+	warn(__func__, "malloc of %ju bytes failed", (uintmax_t)(size + 1));
+	return NULL;
+    }
+    ret[size] = '\0';   /* paranoia */
+
+    /*
+     * JSON decode
+     */
+    if (json_decode_buf(ptr, len, ret, size, &mlen, skip_quote) == false) {
+	/* error - clear allocated length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	free(ret);
+	ret = NULL;
+	warn(__func__, "decoding ran beyond end of allocated decoded string");
 	return NULL;
     }
-    ret[mlen] = '\0';   /* terminate string */
-    ret[mlen + 1] = '\0';   /* paranoia */
-    beyond = &(ret[mlen]);
+
+    /*
+     * return result
+     */
+    dbg(DBG_VVVHIGH, "returning from json_decode(ptr, %ju, *%ju, %s)",
+		     (uintmax_t)len, (uintmax_t)mlen, booltostr(skip_quote));
+    if (retlen != NULL) {
+	*retlen = mlen;
+    }
+    return ret;
+}
+
+
+/*
+ * json_decode_buf - JSON decode a block of memory into a buffer of the caller
+ *
+ * given:
+ *	ptr	start of memory block to decode
+ *	len	length of block to decode in bytes
+ *	buf	where to write the decoding, or NULL if size is 0
+ *	size	bytes buf has room for
+ *	retlen	address of where to store the length, if retlen != NULL
+ *
+ *	skip_quote	true ==> ignore any double quotes if they are both
+ *				 at the start and end of the memory block
+ *
+ * returns:
+ *	true ==> buf holds the decoding, NUL terminated, and *retlen its length,
+ *	false ==> error or buf is too small: *retlen is the size buf needs,
+ *		  including the NUL, or 0 on error
+ *
+ * Nothing is allocated.  A decoding may be up to 6 times as long as len, so
+ * one may call this function with a buf of a likely size, such as an array on
+ * the stack, and only allocate when *retlen says that buf is too small.
+ * Called with a NULL buf and a size of 0 it just finds the size.
+ *
+ * NOTE: when false is returned what is in buf is undefined.
+ */
+bool
+json_decode_buf(char const *ptr, size_t len, char *buf, size_t size, size_t *retlen, bool skip_quote)
+{
+    size_t mlen = 0;	    /* length of the decoding so far */
+    size_t run;		    /* number of bytes that decode as themselves */
+    size_t elen;	    /* length of the decoding of one byte */
+    size_t start;	    /* first byte to decode */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (ptr == NULL || (buf == NULL && size > 0)) {
+	/* error - clear length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	warn(__func__, "called with NULL ptr or buf");
+	return false;
+    }
 
     /*
      * skip any enclosing quotes if requested
@@ -258,51 +486,55 @@ json_decode(char const *ptr, size_t len, size_t *retlen, bool skip_quote)
      * a '"'.
      */
     if (skip_quote == true && len > 1 && ptr[0] == '"' && ptr[len-1] == '"') {
-	i = 1;	/* start decoding on the next byte beyond the " */
-	--len;	/* do not decode the last byte */
+	start = 1;	/* start decoding on the next byte beyond the " */
+	--len;		/* do not decode the last byte */
     } else {
-	i = 0;	/* start decoding at the first byte */
+	start = 0;	/* start decoding at the first byte */
     }
 
     /*
-     * JSON decode each byte
+     * JSON decode each byte, as many as fit
+     *
+     * Runs of bytes that decode as themselves are copied as they are, and
+     * only the other bytes are looked up.
      */
-    for (p=ret; i < len; ++i) {
-	if (p+byte2asciistr[(uint8_t)(ptr[i])].len > beyond) {
-	    /* error - clear allocated length */
-	    if (retlen != NULL) {
-		*retlen = 0;
-	    }
-	    if (ret != NULL) {
-		free(ret);
-		ret = NULL;
-	    }
-	    warn(__func__, "decoding ran beyond end of allocated decoded string");
-	    return NULL;
+    for (i=start; i < len; ++i) {
+	run = json_decode_run(ptr+i, len-i);
+	if (mlen < size && run > 0) {
+	    memcpy(buf+mlen, ptr+i, run < size-mlen ? run : size-mlen);
+	}
+	mlen += run;
+	i += run;
+	if (i >= len) {
+	    break;
 	}
-	strcpy(p, byte2asciistr[(uint8_t)(ptr[i])].enc);
-	p += byte2asciistr[(uint8_t)(ptr[i])].len;
+	elen = byte2asciistr[(uint8_t)(ptr[i])].len;
+	if (mlen < size && elen <= size-mlen) {
+	    memcpy(buf+mlen, byte2asciistr[(uint8_t)(ptr[i])].enc, elen);
+	}
+	mlen += elen;
     }
-    *p = '\0';	/* paranoia */
-    mlen = p - ret; /* paranoia */
-    if (mlen < 0) { /* paranoia */
-	warn(__func__, "mlen #1: %ju < 0", (uintmax_t)mlen);
-	if (ret != NULL) {
-	    free(ret);
-	    ret = NULL;
+
+    /*
+     * case: buf is too small for the decoding and its NUL
+     */
+    if (mlen >= size) {
+	dbg(DBG_VVVHIGH, "json_decode_buf(ptr, %ju, buf, %ju, *%ju, %s): buf is too small",
+			 (uintmax_t)len, (uintmax_t)size, (uintmax_t)(mlen + 1), booltostr(skip_quote));
+	if (retlen != NULL) {
+	    *retlen = mlen + 1;
 	}
-	return NULL;
+	return false;
     }
+    buf[mlen] = '\0';	/* terminate string */
 
     /*
      * return result
      */
-    dbg(DBG_VVVHIGH, "returning from json_decode(ptr, %ju, *%ju, %s)",
-		     (uintmax_t)len, (uintmax_t)mlen, booltostr(skip_quote));
     if (retlen != NULL) {
-	*retlen = (size_t)mlen;
+	*retlen = mlen;
     }
-    return ret;
+    return true;
 }
 
 
@@ -357,6 +589,47 @@ json_decode_str(char const *str, size_t *retlen, bool skip_quote)
     return ret;
 }
 
+
+/*
+ * json_decode_str_buf - JSON decode a string into a buffer of the caller
+ *
+ * This is a simplified interface for json_decode_buf().
+ *
+ * given:
+ *	str		NUL terminated C-style string to decode
+ *	buf		where to write the decoding, or NULL if size is 0
+ *	size		bytes buf has room for
+ *	retlen		address of where to store the length, if retlen != NULL
+ *	skip_quote	true ==> ignore any double quotes if they are both
+ *				 at the start and end of the memory block
+ *			false ==> process all bytes in the block
+ *
+ * returns:
+ *	true ==> buf holds the decoding, NUL terminated, and *retlen its length,
+ *	false ==> error or buf is too small: *retlen is the size buf needs,
+ *		  including the NUL, or 0 on error
+ */
+bool
+json_decode_str_buf(char const *str, char *buf, size_t size, size_t *retlen, bool skip_quote)
+{
+    /*
+     * firewall
+     */
+    if (str == NULL) {
+	/* error - clear length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	warn(__func__, "called with NULL ptr");
+	return false;
+    }
+
+    /*
+     * convert to json_decode_buf() call
+     */
+    return json_decode_buf(str, strlen(str), buf, size, retlen, skip_quote);
+}
+
 /*
  * jdecencchk  - validate that JSON decoding and encoding works
  *
@@ -885,6 +1158,8 @@ chkbyte2asciistr(void)
     size_t mlen = 0;	/* length of allocated decoding string */
     char *mstr2 = NULL;	/* allocated encoding string */
     size_t mlen2 = 0;	/* length of allocated encoding string */
+    char buf[8];	/* decoding in a buffer of the caller */
+    size_t buflen = 0;	/* length of buf */
     unsigned int i;
 
     /*
@@ -1280,6 +1555,26 @@ chkbyte2asciistr(void)
 	    not_reached();
 	}
 
+	/*
+	 * test the variants that write into a buffer of the caller
+	 */
+	if (json_decode_str_buf(str, buf, mlen, &buflen, false) == true || buflen != mlen+1) {
+	    err(52, __func__, "json_decode_str_buf(0x%02x, buf, %ju, *buflen: %ju) did not find buf too small",
+			      i, (uintmax_t)mlen, (uintmax_t)buflen);
+	    not_reached();
+	}
+	if (json_decode_str_buf(str, buf, sizeof(buf), &buflen, false) == false || buflen != mlen ||
+	    strcmp(buf, mstr) != 0) {
+	    err(53, __func__, "json_decode_str_buf(0x%02x, buf, %ju, *buflen: %ju) != <%s>",
+			      i, (uintmax_t)sizeof(buf), (uintmax_t)buflen, mstr);
+	    not_reached();
+	}
+	if (json_encode_inplace(buf, buflen, &buflen) == false || buflen != mlen2 || (uint8_t)(buf[0]) != i) {
+	    err(54, __func__, "json_encode_inplace(<%s>, %ju, *buflen: %ju) did not give 0x%02x",
+			      mstr, (uintmax_t)mlen, (uintmax_t)buflen, i);
+	    not_reached();
+	}
+
 	/* free the allocated decoded string */
 	if (mstr != NULL) {
 	    free(mstr);
@@ -1291,6 +1586,24 @@ chkbyte2asciistr(void)
 	}
     }
 
+    /*
+     * assert: json_decode_run() stops at just the bytes that do not decode as themselves
+     */
+    for (i=0; i < JSON_BYTE_VALUES; ++i) {
+	char block[64];		/* bytes that decode as themselves, with i at indx */
+	size_t run;		/* json_decode_run() of block */
+
+	for (indx=0; indx < (int)sizeof(block); indx += 21) {
+	    memset(block, 'x', sizeof(block));
+	    block[indx] = (char)i;
+	    run = json_decode_run(block, sizeof(block));
+	    if (run != (byte2asciistr[i].len == 1 ? sizeof(block) : (size_t)indx)) {
+		err(51, __func__, "json_decode_run() with 0x%02x at %d: %ju", i, indx, (uintmax_t)run);
+		not_reached();
+	    }
+	}
+    }
+
     /*
      * all seems well with the byte2asciistr[] table
      */
@@ -1298,322 +1611,235 @@ chkbyte2asciistr(void)
     return;
 }
 
+
+#if defined(JSON_DECODE_SSE2)
 /*
- * encode_json_string - return the encoding of a JSON decoded block of memory
+ * encode_run_sse2 - count the bytes that encode as themselves 16 bytes at a time with SSE2
  *
  * given:
- *	ptr	    start of memory block to encode
- *	len	    length of block
- *	mlen	    length of encoded bytes to allocate
- *	retlen	    address of where to store allocated length, if retlen != NULL
+ *	ptr	    bytes to look at
+ *	len	    number of bytes, at least 16
  *
  * returns:
- *	allocated JSON encoding of a block, or NULL ==> error
- *	NOTE: retlen, if non-NULL, is set to 0 on error
- *
- * NOTE: this function is used by json_encode().
+ *	number of bytes before the first '\\', '"', '\b', '\t', '\n', '\f' or
+ *	'\r', a multiple of 16 if the rest are fewer than 16
  */
-char *
-encode_json_string(char const *ptr, size_t len, size_t mlen, size_t *retlen)
+static size_t
+encode_run_sse2(uint8_t const *ptr, size_t len)
 {
-    char *ret = NULL;	    /* allocated decoding string or NULL */
-    char *beyond = NULL;    /* beyond the end of the allocated decoding string */
-    char *p = NULL;	    /* next place to decode */
-    char n = 0;		    /* next character beyond a \\ */
-    int xa = 0;		    /* first hex character numeric value */
-    int xb = 0;		    /* second hex character numeric value */
-    char c = 0;		    /* character to encode or third hex character after \u */
+    __m128i const backslash = _mm_set1_epi8('\\');
+    __m128i const quote = _mm_set1_epi8('"');
+    __m128i const bs = _mm_set1_epi8('\b');
+    __m128i const ht = _mm_set1_epi8('\t');
+    __m128i const nl = _mm_set1_epi8('\n');
+    __m128i const ff = _mm_set1_epi8('\f');
+    __m128i const cr = _mm_set1_epi8('\r');
+    __m128i v;
+    unsigned int mask;
     size_t i;
-    int32_t bytes = 0;
-    int32_t surrogate = 0;
-    char *utf8 = NULL;
-    int scanned = 0;
 
-    /*
-     * firewall
-     */
-    if (ptr == NULL) {
-	/* error - clear allocated length */
-	if (retlen != NULL) {
-	    *retlen = 0;
+    for (i = 0; len - i >= 16; i += 16) {
+	v = _mm_loadu_si128((__m128i const *)(ptr + i));
+	mask = (unsigned int)_mm_movemask_epi8(
+		_mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, backslash), _mm_cmpeq_epi8(v, quote)),
+					  _mm_or_si128(_mm_cmpeq_epi8(v, bs), _mm_cmpeq_epi8(v, ht))),
+			     _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, nl), _mm_cmpeq_epi8(v, ff)),
+					  _mm_cmpeq_epi8(v, cr))));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask);
 	}
-	warn(__func__, "called with NULL ptr");
-	return NULL;
     }
+    return i;
+}
+#endif
 
-    /*
-     * allocated encoded string
-     */
-    ret = malloc(mlen + 1 + 1);
-    if (ret == NULL) {
-	/* error - clear allocated length */
-	if (retlen != NULL) {
-	    *retlen = 0;
+
+#if defined(JSON_DECODE_AVX2)
+/*
+ * encode_run_avx2 - count the bytes that encode as themselves 32 bytes at a time with AVX2
+ *
+ * given:
+ *	ptr	    bytes to look at
+ *	len	    number of bytes, at least 32
+ *
+ * returns:
+ *	number of bytes before the first '\\', '"', '\b', '\t', '\n', '\f' or
+ *	'\r', a multiple of 32 if the rest are fewer than 32
+ *
+ * NOTE: only called when the CPU reports AVX2 support, see encode_json_run().
+ */
+static size_t
+encode_run_avx2(uint8_t const *ptr, size_t len)
+{
+    __m256i const backslash = _mm256_set1_epi8('\\');
+    __m256i const quote = _mm256_set1_epi8('"');
+    __m256i const bs = _mm256_set1_epi8('\b');
+    __m256i const ht = _mm256_set1_epi8('\t');
+    __m256i const nl = _mm256_set1_epi8('\n');
+    __m256i const ff = _mm256_set1_epi8('\f');
+    __m256i const cr = _mm256_set1_epi8('\r');
+    __m256i v;
+    unsigned int mask;
+    size_t i;
+
+    for (i = 0; len - i >= 32; i += 32) {
+	v = _mm256_loadu_si256((__m256i const *)(ptr + i));
+	mask = (unsigned int)_mm256_movemask_epi8(
+		_mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, backslash),
+								_mm256_cmpeq_epi8(v, quote)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(v, bs), _mm256_cmpeq_epi8(v, ht))),
+				_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, nl), _mm256_cmpeq_epi8(v, ff)),
+						_mm256_cmpeq_epi8(v, cr))));
+	if (mask != 0) {
+	    return i + (size_t)__builtin_ctz(mask);
 	}
-	warn(__func__, "malloc of %ju bytes failed", (uintmax_t)(mlen + 1 + 1));
-	return NULL;
     }
-    ret[mlen] = '\0';   /* terminate string */
-    ret[mlen + 1] = '\0';   /* paranoia */
-    beyond = &(ret[mlen]);
-
+    return i;
+}
+#endif
 
-    /*
-     * JSON string encode
-     *
-     * In the counting code in json_encode(), prior to the malloc for the
-     * encoded string, we already determined that the JSON decoded block of
-     * memory is valid.
-     */
-    for (i=0, p=utf8=ret; i < len; ++i, ++utf8) {
-	/*
-	 * paranoia
-	 */
-	if (p >= beyond) {
-	    /* error - clear allocated length and buffer */
-	    if (retlen != NULL) {
-		*retlen = 0;
-	    }
-	    if (ret != NULL) {
-		free(ret);
-		ret = NULL;
-	    }
 
-	    warn(__func__, "ran beyond end of encoded string");
-	    return NULL;
+/*
+ * encode_json_run - count the bytes at the start of a block that JSON encode as themselves
+ *
+ * given:
+ *	ptr	    start of memory block
+ *	len	    length of block in bytes
+ *
+ * returns:
+ *	number of bytes before the first \-escape or byte that must not be in
+ *	a JSON string as it is ('"', '\b', '\t', '\n', '\f' or '\r'), or len if
+ *	there is none
+ *
+ * Where SSE2 or AVX2 is available the run is found 16 or 32 bytes at a time.
+ */
+static size_t
+encode_json_run(char const *ptr, size_t len)
+{
+    uint8_t const *p = (uint8_t const *)ptr;
+    size_t i = 0;
+
+#if defined(JSON_DECODE_AVX2)
+    if (len >= 32 && __builtin_cpu_supports("avx2")) {
+	i = encode_run_avx2(p, len);
+	if (len - i >= 32) {
+	    return i;
+	}
+    }
+#endif
+#if defined(JSON_DECODE_SSE2)
+    if (len - i >= 16) {
+	i += encode_run_sse2(p + i, len - i);
+	if (len - i >= 16) {
+	    return i;
 	}
+    }
+#endif
+    for (; i < len; ++i) {
+	switch (p[i]) {
+	case '\\': case '"': case '\b': case '\t': case '\n': case '\f': case '\r':
+	    return i;
+	default:
+	    break;
+	}
+    }
+    return i;
+}
 
-	/*
-	 * examine the current character
-	 */
-	c = (char)((uint8_t)(ptr[i]));
 
+/*
+ * encode_json_escape - find what a JSON \-escape stands for
+ *
+ * given:
+ *	ptr	    the '\\' that starts the \-escape
+ *	len	    number of bytes from ptr to the end of the block
+ *	code	    where to store the byte or code point the \-escape stands for
+ *	name	    name of the calling function, for warnings
+ *
+ * returns:
+ *	length of the \-escape: 2 for \c, 6 for \uxxxx and 12 for a surrogate
+ *	pair \uxxxx\uxxxx, or 0 if it is not a valid JSON \-escape
+ *
+ * The hex digits of \uxxxx are converted by hex4_to_unicode(), and a \uxxxx
+ * that is half of a surrogate pair must be followed by the other half.
+ */
+static size_t
+encode_json_escape(char const *ptr, size_t len, int32_t *code, char const *name)
+{
+    int32_t lo = 0;	/* low half of a surrogate pair */
+
+    /*
+     * there must be at least one more character beyond \
+     */
+    if (len < 2) {
+	warn(name, "found \\ at end of buffer, missing next character");
+	return 0;
+    }
+
+    switch (ptr[1]) {
+    case 'b':	/* ASCII backspace */
+	*code = '\b';
+	return 2;
+    case 't':	/* ASCII horizontal tab */
+	*code = '\t';
+	return 2;
+    case 'n':	/* ASCII line feed */
+	*code = '\n';
+	return 2;
+    case 'f':	/* ASCII form feed */
+	*code = '\f';
+	return 2;
+    case 'r':	/* ASCII carriage return */
+	*code = '\r';
+	return 2;
+    case '"':	/*fallthrough*/
+    case '/':	/*fallthrough*/
+    case '\\':
+	*code = (uint8_t)ptr[1];	/* escape encodes to itself */
+	return 2;
+
+    /*
+     * encode \uxxxx
+     */
+    case 'u':
 	/*
-	 * case: JSON encode non \-escape character
+	 * there must be at least five more characters beyond \
 	 */
-	if (c != '\\') {
-	    /* no translation decoding */
-	    *p++ = c;
+	if (len < 6) {
+	    warn(name, "found \\u, but not enough for 4 hex chars at end of buffer");
+	    return 0;
+	}
+	*code = hex4_to_unicode(ptr + 2);
+	if (*code < 0) {
+	    warn(name, "did not read \\uxxxx hex value");
+	    return 0;
+	}
 
 	/*
-	 * case: JSON encode \-escape character
+	 * a surrogate pair is two \uxxxx
 	 */
-	} else {
+	if (*code >= UNI_SUR_HIGH_START && *code <= UNI_SUR_HIGH_END && len >= 12 && ptr[6] == '\\' && ptr[7] == 'u') {
+	    lo = hex4_to_unicode(ptr + 8);
+	    if (lo >= UNI_SUR_LOW_START && lo <= UNI_SUR_LOW_END) {
+		*code = surrogates_to_unicode(*code, lo);
+		return 12;
+	    }
+	}
+	if (*code >= UNI_SUR_HIGH_START && *code <= UNI_SUR_LOW_END) {
+	    warn(name, "codepoint: %X: illegal surrogate", (unsigned int)*code);
+	    return 0;
+	}
+	return 6;
 
-	    /*
-	     * look at the next character beyond \
-	     */
-	    n = (char)((uint8_t)(ptr[i+1]));
+    /*
+     * unknown \c escaped pairs
+     */
+    default:
+	warn(name, "found invalid JSON \\-escape: followed by 0x%02x", (uint8_t)ptr[1]);
+	return 0;
+    }
+}
 
-	    /*
-	     * encode single \c escaped pairs
-	     */
-	    switch (n) {
-	    case 'b':	/* ASCII backspace */
-		++i;
-		*p++ = '\b';
-		break;
-	    case 't':	/* ASCII horizontal tab */
-		++i;
-		*p++ = '\t';
-		break;
-	    case 'n':	/* ASCII line feed */
-		++i;
-		*p++ = '\n';
-		break;
-	    case 'f':	/* ASCII form feed */
-		++i;
-		*p++ = '\f';
-		break;
-	    case 'r':	/* ASCII carriage return */
-		++i;
-		*p++ = '\r';
-		break;
-	    case 'a':	/* ASCII bell */
-		++i;
-		*p++ = '\a';
-		break;
-	    case 'v':	/* ASCII vertical tab */
-		++i;
-		*p++ = '\v';
-		break;
-	    case 'e':	/* ASCII escape */
-		++i;
-		*p++ = 0x0b;  /* not all C compilers understand \e */
-		break;
-	    case '"':	/*fallthrough*/
-	    case '/':	/*fallthrough*/
-	    case '\\':
-		++i;
-		*p++ = n;	/* escape encodes to itself */
-		break;
-
-	    /*
-	     * encode \uxxxx
-	     */
-	    case 'u':
-		/*
-		 * there must be at least five more characters beyond \
-		 */
-		if (i+5 >= len) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-
-		    warn(__func__, "found \\u while encoding, but not enough for 4 hex chars at end of buffer");
-		    return NULL;
-		}
-		xa = 0;
-		xb = 0;
-
-		/*
-		 * we check for a second \uxxxx first, in case it is a surrogate
-		 * pair
-		 */
-		scanned = sscanf(ptr + i + 2, "%4x\\u%4x", &xa, &xb);
-		if (scanned == EOF) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-
-		    warn(__func__, "reached EOF trying to scan for hex bytes");
-		    return NULL;
-		} else if (scanned == 1 || (scanned == 2 && surrogates_to_unicode(xa, xb) < 0)) {
-		    /*
-		     * no possible surrogate pair found so proceed like there
-		     * was not another \uxxxx
-		     */
-
-		    bytes = utf8encode(utf8, xa);
-		    if (bytes <= 0) {
-			/* error - clear allocated length and free buffer */
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			/* utf8encode warns on error */
-			return NULL;
-		    }
-		    /*
-		     * bytes - 1 because we increment utf8 in the increment phase
-		     * of the loop
-		     */
-		    utf8 += bytes - 1;
-		    /*
-		     * however, for p we need to update the entire amount
-		     */
-		    p += bytes;
-		    /*
-		     * we increment by 5 because LITLEN("uxxxx") is 5: the for() loop
-		     * increments by 1 at the increment/update phase.
-		     */
-		    i += 5;
-		} else if (scanned == 2) {
-		    /*
-		     * in this case we have to check if we have a valid
-		     * surrogate pair.
-		     */
-		    surrogate = surrogates_to_unicode(xa, xb);
-		    if (surrogate < 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			warn(__func__, "surrogate pair invalid: \\u%x\\u%x", xa, xb);
-
-			return NULL;
-		    }
-
-		    bytes = utf8encode(utf8, surrogate);
-		    if (bytes <= 0) {
-			/* error - clear allocated length and free buffer */
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			if (ret != NULL) {
-			    free(ret);
-			    ret = NULL;
-			}
-			/* utf8encode() warns on error */
-			return NULL;
-		    }
-
-		    /*
-		     * bytes - 1 because we increment utf8 in the increment phase
-		     * of the loop
-		     */
-		    utf8 += bytes - 1;
-		    /*
-		     * however, for p we need to update the entire amount
-		     */
-		    p += bytes;
-
-		    /*
-		     * we increment by 11 because LITLEN("uxxxx") +
-		     * LITLEN("\\uxxxx") is 11.
-		     */
-		    i += 11;
-		} else {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    if (ret != NULL) {
-			free(ret);
-			ret = NULL;
-		    }
-		    warn(__func__, "did not read \\uxxxx hex value");
-		    return NULL;
-		}
-		break;
-
-	    /*
-	     * unknown \c escaped pairs
-	     */
-	    default:
-		/* error - clear allocated length and free buffer */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		if (ret != NULL) {
-		    free(ret);
-		    ret = NULL;
-		}
-
-		warn(__func__, "found invalid JSON \\-escape while encoding: followed by 0x%02x", (uint8_t)c);
-		return NULL;
-	    }
-	}
-     }
-
-    /*
-     * return result
-     */
-
-    dbg(DBG_VVVHIGH, "returning from encode_json_string(ptr, %ju, %ju, *%ju)",
-		 (uintmax_t)len, (uintmax_t)mlen, retlen != NULL ? *retlen : 0);
-    if (retlen != NULL) {
-	*retlen = mlen;
-    }
-
-    return ret;
-}
 
 /*
  * json_encode - return a JSON encoding of a block of memory
@@ -1650,15 +1876,7 @@ char *
 json_encode(char const *ptr, size_t len, size_t *retlen)
 {
     char *ret = NULL;	    /* allocated decoding string or NULL */
-    size_t mlen = 0;	    /* length of allocated decoded string */
-    char n = 0;		    /* next character beyond a \\ */
-    char c = 0;		    /* character to encode or third hex character after \u */
-    int xa = 0;		    /* first hex number for \uxxxx (if surrogates) */
-    int xb = 0;		    /* second hex number for \uxxxx (if surrogates) */
-    int32_t surrogate = 0;  /* for surrogate pairs */
-    int scanned = 0;	    /* for sscanf() */
-    size_t i;
-    size_t bytes = 0;	    /* for utf8len() */
+    size_t mlen = 0;	    /* length of decoded string */
 
     /*
      * firewall
@@ -1673,215 +1891,222 @@ json_encode(char const *ptr, size_t len, size_t *retlen)
     }
 
     /*
-     * count the bytes that will be in the encoded allocated string
+     * allocate the encoded string
+     *
+     * The encoding is never longer than the JSON decoded block, so there is
+     * no need to count its bytes first.
+     */
+    ret = malloc(len + 1 + 1);
+    if (ret == NULL) {
+	/* error - clear allocated length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	warn(__func__, "malloc of %ju bytes failed", (uintmax_t)(len + 1 + 1));
+	return NULL;
+    }
+    ret[len + 1] = '\0';   /* paranoia */
+
+    /*
+     * encode JSON string
      */
-    for (i=0; i < len; ++i) {
+    if (json_encode_buf(ptr, len, ret, len + 1, &mlen) == false) {
+	dbg(DBG_VVVHIGH, "in json_encode(): json_encode_buf(ptr, %ju, ret, %ju, *%ju) returned false",
+			 (uintmax_t)len, (uintmax_t)(len + 1), (uintmax_t)mlen);
+	free(ret);
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	return NULL;
+    }
+
+    /*
+     * return result
+     */
+    dbg(DBG_VVVHIGH, "returning from json_encode(ptr, %ju, *%ju): %s",
+		     (uintmax_t)len, (uintmax_t)mlen, ret);
+    if (retlen != NULL) {
+	*retlen = mlen;
+    }
+    return ret;
+}
+
+
+/*
+ * json_encode_buf - JSON encode a block of memory into a buffer of the caller
+ *
+ * given:
+ *	ptr	start of memory block to encode
+ *	len	length of block to encode in bytes
+ *	buf	where to write the encoding, may be ptr, or NULL if size is 0
+ *	size	bytes buf has room for
+ *	retlen	address of where to store the length, if retlen != NULL
+ *
+ * returns:
+ *	true ==> buf holds the encoding, NUL terminated, and *retlen its length,
+ *	false ==> error or buf is too small: *retlen is the size buf needs,
+ *		  including the NUL, or 0 on error
+ *
+ * The encoding is never longer than len, so a buf of len+1 bytes is always
+ * enough.  Nothing is allocated: runs of bytes without a \-escape are moved
+ * as they are and each \-escape is encoded where it goes.  As the encoding
+ * never gets ahead of what it is made from, buf may be ptr; see
+ * json_encode_inplace().
+ *
+ * NOTE: when false is returned what is in buf is undefined.
+ */
+bool
+json_encode_buf(char const *ptr, size_t len, char *buf, size_t size, size_t *retlen)
+{
+    size_t mlen = 0;	    /* length of the encoding so far */
+    size_t run = 0;	    /* bytes without a \-escape */
+    size_t esc = 0;	    /* length of a \-escape */
+    int32_t code = 0;	    /* byte or code point of a \-escape */
+    int bytes = 0;	    /* UTF-8 bytes of code */
+    char c = 0;		    /* character that ends a run */
+    size_t i;
+
+    /*
+     * firewall
+     */
+    if (ptr == NULL || (buf == NULL && size > 0)) {
+	/* error - clear length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	warn(__func__, "called with NULL ptr or buf");
+	return false;
+    }
+
+    for (i=0; i < len; i += esc) {
 
 	/*
-	 * examine the current character
+	 * move the bytes up to the next \-escape, as many as fit
 	 */
-	c = (char)((uint8_t)(ptr[i]));
+	run = encode_json_run(ptr+i, len-i);
+	if (mlen < size && run > 0) {
+	    memmove(buf+mlen, ptr+i, run < size-mlen ? run : size-mlen);
+	}
+	mlen += run;
+	i += run;
+	if (i >= len) {
+	    break;
+	}
 
 	/*
-	 * valid non-\-escaped characters count as 1
+	 * disallow characters that should have been escaped
 	 */
-        if (c != '\\') {
-
-	    /*
-	     * disallow characters that should have been escaped
-	     */
-	    switch (c) {
-	    case '\b':  /*fallthrough*/
-	    case '\t':  /*fallthrough*/
-	    case '\n':  /*fallthrough*/
-	    case '\f':  /*fallthrough*/
-	    case '\r':
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		warn(__func__, "found non-\\-escaped char: 0x%02x", (uint8_t)c);
-		return NULL;
-		break;
-	    case '"':   /*fallthrough*/
-	    case '\\':
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		warn(__func__, "found \\-escaped char: %c", c);
-		return NULL;
-		break;
-
-	    /*
-	     * count a valid character
-	     */
-	    default:
-		++mlen;
-		break;
+	c = ptr[i];
+	switch (c) {
+	case '\\':
+	    break;
+	case '"':
+	    /* error - clear length */
+	    if (retlen != NULL) {
+		*retlen = 0;
+	    }
+	    warn(__func__, "found \\-escaped char: %c", c);
+	    return false;
+	default:
+	    /* error - clear length */
+	    if (retlen != NULL) {
+		*retlen = 0;
 	    }
+	    warn(__func__, "found non-\\-escaped char: 0x%02x", (uint8_t)c);
+	    return false;
+	}
 
 	/*
-	 * valid \-escaped characters count as 2 or 6
+	 * encode the \-escape as 1 to 4 UTF-8 bytes, if they fit
 	 */
+	esc = encode_json_escape(ptr+i, len-i, &code, __func__);
+	if (esc == 0) {
+	    /* error - clear length */
+	    if (retlen != NULL) {
+		*retlen = 0;
+	    }
+	    /* encode_json_escape() already warns */
+	    return false;
+	}
+	if (esc == 2) {
+	    if (mlen < size) {
+		buf[mlen] = (char)code;
+	    }
+	    mlen += 1;
 	} else {
-
-	    /*
-	     * there must be at least one more character beyond \
-	     */
-	    if (i+1 >= len) {
-		/* error - clear allocated length */
-		if (retlen != NULL) {
-		    *retlen = 0;
-		}
-		warn(__func__, "found \\ at end of buffer, missing next character");
-		return NULL;
+	    bytes = utf8len(NULL, code);
+	    if (bytes > 0 && mlen < size && (size_t)bytes <= size-mlen) {
+		bytes = utf8encode(buf+mlen, (unsigned int)code);
 	    }
-
-	    /*
-	     * look at the next character beyond \
-	     */
-	    n = (char)((uint8_t)(ptr[i+1]));
-
-	    /*
-	     * process single \c escaped pairs
-	     */
-	    switch (n) {
-	    case 'b':	/*fallthrough*/
-	    case 't':	/*fallthrough*/
-	    case 'n':	/*fallthrough*/
-	    case 'f':	/*fallthrough*/
-	    case 'r':	/*fallthrough*/
-	    case '"':	/*fallthrough*/
-	    case '/':	/*fallthrough*/
-	    case '\\':
-		/*
-		 * count \c escaped pair as 1 character
-		 */
-		++mlen;
-		++i;
-		break;
-
-	    /*
-	     * process \uxxxx where x is a hex character
-	     */
-	    case 'u':
-		/*
-		 * there must be at least five more characters beyond \
-		 */
-		if (i+5 >= len) {
-		    /* error - clear allocated length */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    warn(__func__, "found \\u, but not enough for 4 hex chars at end of buffer");
-		    return NULL;
-		}
-		xa = 0;
-		xb = 0;
-		scanned = sscanf(ptr + i + 2, "%4x\\u%4x", &xa, &xb);
-
-		if (scanned == EOF) {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-
-		    warn(__func__, "reached EOF trying to scan for hex bytes");
-		    return NULL;
-		} else if (scanned == 1 || (scanned == 2 && surrogates_to_unicode(xa, xb) < 0)) {
-		    surrogate = xa;
-		    bytes = utf8len(ptr + i, surrogate);
-		    if (bytes <= 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			/* utf8len() already warns */
-			return NULL;
-		    }
-		    dbg(DBG_VVHIGH, "UTF-8 bytes: %ju", (uintmax_t)bytes);
-		    mlen += bytes;
-		    i += 5;
-		} else if (scanned == 2) {
-		    /*
-		     * if there is a \uxxxx\uxxxx then we try for a surrogate
-		     * pair.
-		     */
-		    surrogate = surrogates_to_unicode(xa, xb);
-		    if (surrogate < 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			warn(__func__, "surrogate pair invalid: \\u%x\\u%x", xa, xb);
-
-			return NULL;
-		    }
-
-		    /*
-		     * assuming no error from surrogates_to_unicode(), we will
-		     * try counting the bytes needed.
-		     */
-		    bytes = utf8len(NULL, surrogate);
-		    if (bytes <= 0) {
-			if (retlen != NULL) {
-			    *retlen = 0;
-			}
-			/* utf8len() already warns */
-			return NULL;
-		    }
-		    dbg(DBG_VVHIGH, "UTF-8 bytes: %ju", (uintmax_t)bytes);
-		    mlen += bytes;
-
-		    /*
-		     * we skip 11 instead of 5 because 5 + LITLEN("\\uxxxx") is
-		     * 11.
-		     */
-		    i += 11;
-		} else {
-		    /* error - clear allocated length and free buffer */
-		    if (retlen != NULL) {
-			*retlen = 0;
-		    }
-		    warn(__func__, "did not read \\uxxxx hex value");
-		    return NULL;
-		}
-
-		break;
-
-	    /*
-	     * found invalid JSON \-escape character
-	     */
-	    default:
-		/* error - clear allocated length */
+	    if (bytes <= 0) {
+		/* error - clear length */
 		if (retlen != NULL) {
 		    *retlen = 0;
 		}
-		warn(__func__, "found invalid JSON \\-escape: followed by 0x%02x", (uint8_t)c);
-		return NULL;
+		warn(__func__, "cannot UTF-8 encode codepoint: %X", (unsigned int)code);
+		return false;
 	    }
+	    mlen += (size_t)bytes;
 	}
     }
 
-   /*
-     * encode JSON string
+    /*
+     * case: buf is too small for the encoding and its NUL
+     */
+    if (mlen >= size) {
+	dbg(DBG_VVVHIGH, "json_encode_buf(ptr, %ju, buf, %ju, *%ju): buf is too small",
+			 (uintmax_t)len, (uintmax_t)size, (uintmax_t)(mlen + 1));
+	if (retlen != NULL) {
+	    *retlen = mlen + 1;
+	}
+	return false;
+    }
+    buf[mlen] = '\0';	/* terminate string */
+
+    /*
+     * return result
      */
-    ret = encode_json_string(ptr, (uintmax_t)len, (uintmax_t)mlen, retlen);
+    if (retlen != NULL) {
+	*retlen = mlen;
+    }
+    return true;
+}
+
 
+/*
+ * json_encode_inplace - JSON encode a block of memory where it is
+ *
+ * given:
+ *	ptr	start of memory block to encode, which becomes the encoding
+ *	len	length of block to encode in bytes
+ *	retlen	address of where to store the length, if retlen != NULL
+ *
+ * returns:
+ *	true ==> ptr holds the encoding, NUL terminated, and *retlen its length,
+ *	false ==> error
+ *	NOTE: retlen, if non-NULL, is set to 0 on error
+ *
+ * The encoding is never longer than len.  As for a C string, ptr must have
+ * room for the len+1st byte, where the NUL goes if nothing is encoded.
+ *
+ * NOTE: on error what is in ptr is undefined.
+ */
+bool
+json_encode_inplace(char *ptr, size_t len, size_t *retlen)
+{
     /*
-     * return result, if not NULL
+     * firewall
      */
-    if (ret != NULL) {
-	dbg(DBG_VVVHIGH, "returning from json_encode(ptr, %ju, *%ju): %s",
-			 (uintmax_t)len, (uintmax_t)mlen, ret);
-    } else {
-	dbg(DBG_VVVHIGH, "in json_encode(): encode_json_string(ptr, %ju, *%ju) returned NULL",
-			 (uintmax_t)len, (uintmax_t)mlen);
+    if (ptr == NULL) {
+	/* error - clear length */
 	if (retlen != NULL) {
 	    *retlen = 0;
 	}
-	return NULL;
+	warn(__func__, "called with NULL ptr");
+	return false;
     }
-    return ret;
+
+    return json_encode_buf(ptr, len, ptr, len + 1, retlen);
 }
 
 
@@ -1955,6 +2180,101 @@ json_encode_str(char const *str, size_t *retlen)
 }
 
 
+/*
+ * json_encode_str_buf - JSON encode a string into a buffer of the caller
+ *
+ * This is a simplified interface for json_encode_buf().
+ *
+ * given:
+ *	str	NUL terminated C-style string to encode
+ *	buf	where to write the encoding, may be str, or NULL if size is 0
+ *	size	bytes buf has room for
+ *	retlen	address of where to store the length, if retlen != NULL
+ *
+ * returns:
+ *	true ==> buf holds the encoding, NUL terminated, and *retlen its length,
+ *	false ==> error or buf is too small: *retlen is the size buf needs,
+ *		  including the NUL, or 0 on error
+ */
+bool
+json_encode_str_buf(char const *str, char *buf, size_t size, size_t *retlen)
+{
+    /*
+     * firewall
+     */
+    if (str == NULL) {
+	/* error - clear length */
+	if (retlen != NULL) {
+	    *retlen = 0;
+	}
+	warn(__func__, "called with NULL ptr");
+	return false;
+    }
+
+    /*
+     * convert to json_encode_buf() call
+     */
+    return json_encode_buf(str, strlen(str), buf, size, retlen);
+}
+
+
+/*
+ * json_string_escapes_valid - check the \-escapes of a string token
+ *
+ * given:
+ *	text	    the string token, with its '"'s
+ *	leng	    length of text
+ *
+ * returns:
+ *	true ==> each \-escape is valid JSON, false ==> one is not
+ *
+ * The scanner has checked the other bytes of the string, and a NUL byte is
+ * dealt with by the parsers, so only the bytes after each '\\' are looked at.
+ * A \uxxxx that is half of a surrogate pair must be followed by the other
+ * half.  Unlike parse_json_string(), which does not return on a bad
+ * \-escape, this lets a parser report it as a syntax error of the document.
+ */
+bool
+json_string_escapes_valid(char const *text, size_t leng)
+{
+    char const *p = text + 1;		/* next byte to look at */
+    char const *end = text + leng - 1;	/* the closing '"' */
+    int32_t code = 0;			/* code point of a \uxxxx */
+
+    while (p < end && (p = memchr(p, '\\', (size_t)(end - p))) != NULL) {
+	if (end - p < 2) {
+	    return false;
+	}
+	switch (p[1]) {
+	case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+	    p += 2;
+	    break;
+	case 'u':
+	    if (end - p < 6 || (code = hex4_to_unicode(p + 2)) < 0) {
+		return false;
+	    }
+	    p += 6;
+	    if (code >= UNI_SUR_HIGH_START && code <= UNI_SUR_HIGH_END) {
+		if (end - p < 6 || p[0] != '\\' || p[1] != 'u') {
+		    return false;
+		}
+		code = hex4_to_unicode(p + 2);
+		if (code < UNI_SUR_LOW_START || code > UNI_SUR_LOW_END) {
+		    return false;
+		}
+		p += 6;
+	    } else if (code >= UNI_SUR_LOW_START && code <= UNI_SUR_LOW_END) {
+		return false;
+	    }
+	    break;
+	default:
+	    return false;
+	}
+    }
+    return true;
+}
+
+
 /*
  * parse_json_string - parse a json string
  *
@@ -1996,21 +2316,90 @@ parse_json_string(char const *string, size_t len)
     str = json_conv_string(string, len, true);
     /* paranoia - these tests should never result in an error */
     if (str == NULL) {
-        err(221, __func__, "converting JSON string returned NULL: <%s>", string);
+        err(221, __func__, "converting JSON string returned NULL: <%.*s>", (int)len, string);
         not_reached();
     } else if (str->type != JTYPE_STRING) {
         err(222, __func__, "expected JTYPE_STRING, found type: %s", json_item_type_name(str));
         not_reached();
     }
-    item = &(str->item.string);
+    item = JSON_NODE_ITEM(str, string);
     if (!VALID_JSON_NODE(item)) {
-	err(223, __func__, "couldn't parse string: <%s>", string);
+	err(223, __func__, "couldn't parse string: <%.*s>", (int)len, string);
 	not_reached();
     }
     return str;
 }
 
 
+/*
+ * parse_json_name - parse a json string that is the name of a member
+ *
+ * This is parse_json_string() for a parser that knows the string is a member
+ * name.  When an intern table is in use (see json_intern_use()) and the name
+ * is in it, the node points to the name in the table and nothing is copied or
+ * converted.  Otherwise the string is converted by parse_json_string() and
+ * json_conv_member() interns it later.
+ *
+ * given:
+ *
+ *	string	    - the text that triggered the action, with its '"'s
+ *	len	    - length of string
+ *
+ * Returns a pointer to a struct json with the converted string.
+ *
+ * NOTE: This function does not return if passed a NULL string or if conversion fails.
+ */
+struct json *
+parse_json_name(char const *string, size_t len)
+{
+    struct json_intern *table = NULL;	    /* intern table in use */
+    struct json_intern_name *name = NULL;   /* name in table */
+    struct json *str = NULL;
+    struct json_string *item = NULL;
+
+    /*
+     * case: no intern table, or not a quoted name
+     */
+    table = json_intern_in_use();
+    if (table == NULL || string == NULL || len < 2 || string[0] != '"' || string[len-1] != '"' ||
+	len-2 > table->max_len) {
+	return parse_json_string(string, len);
+    }
+
+    /*
+     * case: the name is not interned yet
+     */
+    name = json_intern_find(table, string+1, len-2, json_intern_hash(string+1, len-2));
+    if (name == NULL) {
+	return parse_json_string(string, len);
+    }
+
+    /*
+     * point a new JSON string node to the interned name
+     */
+    str = json_alloc(JTYPE_STRING);
+    if (str == NULL) {
+	errp(50, __func__, "json_alloc(JTYPE_STRING) returned NULL");
+	not_reached();
+    }
+    item = JSON_NODE_ITEM(str, string);
+    item->as_str = name->as_str;
+    item->str = name->str;
+    item->as_str_len = name->as_str_len;
+    item->str_len = name->str_len;
+    item->quote = true;
+    item->same = name->same;
+    item->slash = name->slash;
+    item->posix_safe = name->posix_safe;
+    item->first_alphanum = name->first_alphanum;
+    item->upper = name->upper;
+    item->interned = true;
+    item->parsed = true;
+    item->converted = true;
+    return str;
+}
+
+
 /*
  * parse_json_bool - parse a json bool
  *
@@ -2046,7 +2435,7 @@ parse_json_bool(char const *string)
         err(226, __func__, "expected JTYPE_BOOL, found type: %s", json_item_type_name(boolean));
         not_reached();
     }
-    item = &(boolean->item.boolean);
+    item = JSON_NODE_ITEM(boolean, boolean);
     if (!VALID_JSON_NODE(item)) {
 	/*
 	 * json_conv_bool_str() calls json_conv_bool() which will warn if the
@@ -2134,7 +2523,7 @@ parse_json_null(char const *string)
         err(236, __func__, "expected JTYPE_NULL, found type: %s", json_item_type_name(null));
         not_reached();
     }
-    item = &(null->item.null);
+    item = JSON_NODE_ITEM(null, null);
     if (!VALID_JSON_NODE(item)) {
 	/* why is it an error if we can't convert nothing ? :-) */
 	err(237,__func__, "couldn't convert null: <%s>", string);
@@ -2183,7 +2572,7 @@ parse_json_number(char const *string)
         err(240, __func__, "expected JTYPE_NUMBER, found type: %s", json_item_type_name(number));
         not_reached();
     }
-    item = &(number->item.number);
+    item = JSON_NODE_ITEM(number, number);
     if (!VALID_JSON_NODE(item)) {
 	err(241, __func__, "couldn't convert number string: <%s>", string);
 	not_reached();
@@ -2197,6 +2586,11 @@ parse_json_number(char const *string)
  *
  * Given a JSON elements, we turn it into a JSON array.
  *
+ * The parsers do not call this function: they add the values of an array to
+ * a JTYPE_ARRAY from json_create_array() with json_array_add_value().  It is
+ * kept for code that builds a JSON elements with json_create_elements() and
+ * json_elements_add_value().
+ *
  * IMPORTANT: The struct json_array must be identical to struct json_elements because
  *	      parse_json_array() converts by just changing the JSON item type.
  *
@@ -2234,7 +2628,7 @@ parse_json_array(struct json *elements)
      */
     elements->type = JTYPE_ARRAY;
     /* paranoia - these tests should never result in an error */
-    item = &(elements->item.array);
+    item = JSON_NODE_ITEM(elements, array);
     if (!VALID_JSON_NODE(item)) {
 	err(244, __func__, "couldn't convert array");
 	not_reached();
@@ -2289,7 +2683,7 @@ parse_json_member(struct json *name, struct json *value)
         err(249, __func__, "expected JTYPE_MEMBER, found type: %s", json_item_type_name(member));
         not_reached();
     }
-    item = &(member->item.member);
+    item = JSON_NODE_ITEM(member, member);
     if (!VALID_JSON_NODE(item)) {
 	err(10, __func__, "couldn't convert member");
 	not_reached();
@@ -2314,40 +2708,68 @@ struct json *
 json_alloc(enum item_type type)
 {
     struct json *ret = NULL;		    /* JSON parser tree node to return */
+    struct json_arena *arena = NULL;	    /* arena the node is built in or NULL */
+    size_t size = 0;			    /* bytes for the node and what it holds */
 
     /*
      * inspect the struct json type for unknown types
+     *
+     * A node is allocated together with what it holds, so a node is only
+     * as large as its type needs.
      */
     switch (type) {
     case JTYPE_UNSET:
+	size = sizeof(struct json);
+	break;
     case JTYPE_NUMBER:
+	size = sizeof(struct json_number_node);
+	break;
     case JTYPE_STRING:
+	size = sizeof(struct json_string_node);
+	break;
     case JTYPE_BOOL:
+	size = sizeof(struct json_boolean_node);
+	break;
     case JTYPE_NULL:
+	size = sizeof(struct json_null_node);
+	break;
     case JTYPE_MEMBER:
+	size = sizeof(struct json_member_node);
+	break;
     case JTYPE_OBJECT:
+	size = sizeof(struct json_object_node);
+	break;
     case JTYPE_ARRAY:
     case JTYPE_ELEMENTS:
+	/* struct json_elements is identical to struct json_array: see parse_json_array() */
+	size = sizeof(struct json_array_node);
 	break;
     default:
 	warn(__func__, "called with unknown JSON type: %d", type);
+	size = sizeof(struct json);
 	break;
     }
 
     /*
-     * allocate the JSON parse tree item
+     * allocate the JSON parse tree item, in the arena in use if there is one
      */
-    errno = 0;			/* pre-clear errno for errp() */
-    ret = calloc(1, sizeof(*ret));
-    if (ret == NULL) {
-	errp(11, __func__, "calloc #0 error allocating %ju bytes", (uintmax_t)sizeof(*ret));
-	not_reached();
+    arena = json_arena_in_use();
+    if (arena != NULL) {
+	ret = json_arena_alloc(arena, size);
+    } else {
+	errno = 0;		/* pre-clear errno for errp() */
+	ret = calloc(1, size);
+	if (ret == NULL) {
+	    errp(11, __func__, "calloc #0 error allocating %ju bytes", (uintmax_t)size);
+	    not_reached();
+	}
     }
 
     /*
      * initialize the JSON parse tree item
      */
     ret->type = type;
+    ret->arena = (arena != NULL);
     ret->parent = NULL;
 
     /*
@@ -2383,26 +2805,29 @@ json_alloc(enum item_type type)
 	break;
     case JTYPE_NUMBER:
 	{
-	    struct json_number *item = &(ret->item.number);
+	    struct json_number *item = JSON_NODE_ITEM(ret, number);
 
 	    item->parsed = false;
 	    item->converted = false;
 	    item->as_str = NULL;
+	    item->value = NULL;
+	    item->arena = arena;
 	};
 	break;
     case JTYPE_STRING:
 	{
-	    struct json_string *item = &(ret->item.string);
+	    struct json_string *item = JSON_NODE_ITEM(ret, string);
 
 	    item->parsed = false;
 	    item->converted = false;
 	    item->as_str = NULL;
 	    item->str = NULL;
+	    item->interned = false;
 	};
 	break;
     case JTYPE_BOOL:
 	{
-	    struct json_boolean *item = &(ret->item.boolean);
+	    struct json_boolean *item = JSON_NODE_ITEM(ret, boolean);
 
 	    item->parsed = false;
 	    item->converted = false;
@@ -2411,7 +2836,7 @@ json_alloc(enum item_type type)
 	break;
     case JTYPE_NULL:
 	{
-	    struct json_null *item = &(ret->item.null);
+	    struct json_null *item = JSON_NODE_ITEM(ret, null);
 
 	    item->parsed = false;
 	    item->converted = false;
@@ -2420,67 +2845,482 @@ json_alloc(enum item_type type)
 	break;
     case JTYPE_MEMBER:
 	{
-	    struct json_member *item = &(ret->item.member);
+	    struct json_member *item = JSON_NODE_ITEM(ret, member);
 
 	    item->parsed = false;
 	    item->converted = false;
 	    item->name_as_str = NULL;
 	    item->name_str = NULL;
+	    item->name_intern = NULL;
 	    item->name = NULL;
 	    item->value = NULL;
 	};
 	break;
     case JTYPE_OBJECT:
 	{
-	    struct json_object *item = &(ret->item.object);
+	    struct json_object *item = JSON_NODE_ITEM(ret, object);
 
 	    item->parsed = false;
 	    item->converted = false;
 	    item->set = NULL;
-	    item->s = NULL;
+	    item->alloc = 0;
+	    item->index = NULL;
+	    item->arena = arena;
 	};
 	break;
     case JTYPE_ARRAY:
 	{
-	    struct json_array *item = &(ret->item.array);
+	    struct json_array *item = JSON_NODE_ITEM(ret, array);
 
 	    item->parsed = false;
 	    item->converted = false;
 	    item->set = NULL;
-	    item->s = NULL;
+	    item->alloc = 0;
+	    item->arena = arena;
 	};
 	break;
     case JTYPE_ELEMENTS:
 	{
-	    struct json_elements *item = &(ret->item.elements);
+	    struct json_elements *item = JSON_NODE_ITEM(ret, elements);
+
+	    item->parsed = false;
+	    item->converted = false;
+	    item->set = NULL;
+	    item->alloc = 0;
+	    item->arena = arena;
+	};
+	break;
+    default:
+	warn(__func__, "attempt to initialize an unknown JSON type: %d", ret->type);
+	break;
+    }
+    json_dbg(JSON_DBG_VHIGH, __func__, "allocated json with type: %s", json_item_type_name(ret));
+
+    /*
+     * return the JSON parse tree item
+     */
+    return ret;
+}
+
+
+/*
+ * json_node_arena - return the arena of a node in an arena
+ *
+ * given:
+ *	node	JSON parse tree node with node->arena == true
+ *
+ * returns:
+ *	the arena of node
+ *
+ * Only a number, object or array allocates after it is made, so only they
+ * keep a pointer to their arena.  Any other node allocates what it holds
+ * just after json_alloc(), while its arena is still in use.
+ *
+ * NOTE: This function will not return if node has no arena to allocate from.
+ */
+static struct json_arena *
+json_node_arena(struct json const *node)
+{
+    struct json_arena *arena = NULL;	    /* arena of node */
+
+    switch (node->type) {
+    case JTYPE_NUMBER:
+	arena = JSON_NODE_ITEM(node, number)->arena;
+	break;
+    case JTYPE_OBJECT:
+	arena = JSON_NODE_ITEM(node, object)->arena;
+	break;
+    case JTYPE_ARRAY:
+	arena = JSON_NODE_ITEM(node, array)->arena;
+	break;
+    case JTYPE_ELEMENTS:
+	arena = JSON_NODE_ITEM(node, elements)->arena;
+	break;
+    default:
+	arena = json_arena_in_use();
+	break;
+    }
+    if (arena == NULL) {
+	err(45, __func__, "%s node is in an arena but has no arena to allocate from", json_item_type_name(node));
+	not_reached();
+    }
+    return arena;
+}
+
+
+/*
+ * json_node_alloc - allocate zeroed storage for what a node holds
+ *
+ * given:
+ *	node	JSON parse tree node the storage is for
+ *	size	bytes to allocate
+ *
+ * returns:
+ *	zeroed storage from the arena of node if it is in one, else from calloc(),
+ *	or NULL if calloc() failed
+ */
+static void *
+json_node_alloc(struct json const *node, size_t size)
+{
+    if (node->arena) {
+	return json_arena_alloc(json_node_arena(node), size);
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    return calloc(1, size);
+}
+
+
+/*
+ * json_node_grow - make storage from json_node_alloc() bigger
+ *
+ * given:
+ *	node	    JSON parse tree node the storage is for
+ *	ptr	    storage from json_node_alloc() or json_node_grow()
+ *	old_size    bytes of ptr
+ *	size	    bytes needed now
+ *
+ * returns:
+ *	storage with the contents of ptr, from the arena of node if it is in one,
+ *	else from realloc(), or NULL if realloc() failed
+ */
+static void *
+json_node_grow(struct json const *node, void *ptr, size_t old_size, size_t size)
+{
+    if (node->arena) {
+	return json_arena_grow(json_node_arena(node), ptr, old_size, size);
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    return realloc(ptr, size);
+}
+
+
+/*
+ * json_node_set_append - append a child to the set of an object or array
+ *
+ * given:
+ *	node	JSON parse tree node of the object or array
+ *	set	pointer to the set of the object or array
+ *	len	pointer to the number of children in *set
+ *	alloc	pointer to the number of children *set has room for
+ *	child	JSON parse tree node to append
+ *
+ * When *set is full, its room is doubled, starting with JSON_SET_MIN
+ * children, so that n children are copied O(n) times in all instead of the
+ * O(n^2) of growing by a fixed amount.  json_set_shrink() gives back the room
+ * that is not used when the object or array is complete.
+ *
+ * NOTE: This function will not return on allocation failure.
+ */
+static void
+json_node_set_append(struct json const *node, struct json ***set, intmax_t *len, intmax_t *alloc,
+		     struct json *child)
+{
+    struct json **new_set = NULL;	    /* set with more room */
+    intmax_t new_alloc = 0;		    /* children new_set has room for */
+
+    if (*len >= *alloc) {
+	new_alloc = (*alloc >= JSON_SET_MIN) ? *alloc : JSON_SET_MIN;
+	while (new_alloc <= *len) {
+	    if (new_alloc > (intmax_t)(SIZE_MAX / sizeof(**set) / 2)) {
+		err(46, __func__, "cannot grow set of %jd children", *len);
+		not_reached();
+	    }
+	    new_alloc *= 2;
+	}
+	new_set = json_node_grow(node, *set, (size_t)*alloc * sizeof(**set), (size_t)new_alloc * sizeof(**set));
+	if (new_set == NULL) {
+	    errp(47, __func__, "json_node_grow() error allocating set of %jd children", new_alloc);
+	    not_reached();
+	}
+	*set = new_set;
+	*alloc = new_alloc;
+    }
+    (*set)[(*len)++] = child;
+}
+
+
+/*
+ * json_string_intern - intern a member name in the intern table in use
+ *
+ * given:
+ *	node	JSON string node of a member name
+ *
+ * returns:
+ *	the name in the intern table, or
+ *	NULL if no table is in use (see json_intern_use()), node is not a
+ *	converted string or its name is longer than the table max_len
+ *
+ * The name of node is looked up in the table and added if it is not there.
+ * node then points to the name in the table and its own copy is freed.
+ */
+static struct json_intern_name const *
+json_string_intern(struct json *node)
+{
+    struct json_intern *table = NULL;	    /* intern table in use */
+    struct json_string *item = NULL;	    /* JSON string of node */
+    struct json_intern_name *name = NULL;   /* name in table */
+
+    if (node == NULL || node->type != JTYPE_STRING) {
+	return NULL;
+    }
+    item = JSON_NODE_ITEM(node, string);
+    if (item->interned) {
+	return JSON_INTERN_NAME(item->as_str);
+    }
+    table = json_intern_in_use();
+    if (table == NULL || !CONVERTED_PARSED_JSON_NODE(item) || item->as_str == NULL || item->str == NULL ||
+	item->as_str_len > table->max_len) {
+	return NULL;
+    }
+
+    /*
+     * point node to the name in table
+     */
+    name = json_intern_add(table, item->as_str, item->as_str_len, item->str, item->str_len,
+			   json_intern_hash(item->as_str, item->as_str_len));
+    if (!node->arena) {
+	free(item->as_str);
+    }
+    item->as_str = name->as_str;
+    item->str = name->str;
+    item->interned = true;
+    return name;
+}
+
+
+/*
+ * json_member_name_hash - hash the encoded name of a JSON member
+ *
+ * given:
+ *	member	    converted JSON member
+ *
+ * returns:
+ *	json_intern_hash() of name_str
+ *
+ * An interned name without a \-escape already has the hash: its name_str
+ * is its name_as_str.
+ */
+static size_t
+json_member_name_hash(struct json_member const *member)
+{
+    if (member->name_intern != NULL && member->name_intern->same) {
+	return member->name_intern->hash;
+    }
+    return json_intern_hash(member->name_str, member->name_str_len);
+}
+
+
+/*
+ * json_member_name_is - determine if a JSON member has a given encoded name
+ *
+ * given:
+ *	member	    JSON member or NULL
+ *	name	    encoded name, need not be NUL terminated
+ *	len	    length of name
+ *
+ * returns:
+ *	true ==> name_str of member is the len bytes of name,
+ *	false ==> it is not, or member is NULL or not converted
+ */
+static bool
+json_member_name_is(struct json_member const *member, char const *name, size_t len)
+{
+    return member != NULL && member->name_str != NULL && member->name_str_len == len &&
+	   memcmp(member->name_str, name, len) == 0;
+}
+
+
+/*
+ * json_object_index_add - add a member of an object to its index
+ *
+ * given:
+ *	index	    index of the object with room for the member
+ *	set	    set of the object
+ *	i	    index in set of the member
+ *
+ * When an earlier member has the same name, the member is not added: the
+ * index finds the first of the members with a name, as a scan of set does.
+ */
+static void
+json_object_index_add(struct json_object_index *index, struct json * const *set, intmax_t i)
+{
+    struct json_member const *member = NULL;	/* member to add */
+    size_t hash = 0;				/* json_member_name_hash() of member */
+    size_t j;
+
+    member = json_get_member(set[i]);
+    if (member == NULL || member->name_str == NULL) {
+	return;
+    }
+    hash = json_member_name_hash(member);
+    for (j = hash & (index->slots-1); index->slot[j].pos != 0; j = (j+1) & (index->slots-1)) {
+	if (index->slot[j].hash == (uint32_t)hash &&
+	    json_member_name_is(json_get_member(set[index->slot[j].pos-1]), member->name_str, member->name_str_len)) {
+	    return;
+	}
+    }
+    index->slot[j].hash = (uint32_t)hash;
+    index->slot[j].pos = (uint32_t)(i+1);
+}
+
+
+/*
+ * json_object_index - bring the index of the members of an object up to date
+ *
+ * given:
+ *	node	    JSON node of type JTYPE_OBJECT
+ *	item	    the JSON object of node
+ *
+ * returns:
+ *	index of every member of item, or
+ *	NULL if item is to be scanned instead
+ *
+ * The index is built the first time json_set_shrink() or
+ * json_object_index_build() is called for an object with JSON_OBJECT_INDEX_MIN
+ * or more members.  Members added since it was last brought up to date are
+ * added to it by the next call, and when it gets more than half full it is
+ * rebuilt with twice the slots.
+ *
+ * An object in an arena is indexed in that arena.  If the index cannot be
+ * allocated NULL is returned: the object is then scanned as if it were small.
+ */
+static struct json_object_index *
+json_object_index(struct json *node, struct json_object *item)
+{
+    struct json_object_index *index = item->index;  /* index to bring up to date */
+    struct json_object_index *new_index = NULL;	    /* index with more slots */
+    size_t slots = 0;				    /* number of slots of new_index */
+    intmax_t i;
+
+    /*
+     * case: the index is up to date
+     */
+    if (index != NULL && index->len == item->len) {
+	return index;
+    }
+
+    /*
+     * case: the object is scanned
+     */
+    if (item->len < JSON_OBJECT_INDEX_MIN || (uintmax_t)item->len >= UINT32_MAX || item->set == NULL) {
+	return NULL;
+    }
+
+    /*
+     * keep at least half the slots empty
+     */
+    i = (index != NULL) ? index->len : 0;
+    if (index == NULL || (uintmax_t)item->len > index->slots / 2) {
+	for (slots = 2*JSON_OBJECT_INDEX_MIN; (uintmax_t)item->len > slots / 2; slots *= 2) {
+	    ;
+	}
+	new_index = json_node_alloc(node, sizeof(*new_index) + slots * sizeof(new_index->slot[0]));
+	if (new_index == NULL) {
+	    return NULL;
+	}
+	new_index->slots = slots;
+	if (index != NULL && !node->arena) {
+	    free(index);
+	}
+	index = new_index;
+	item->index = index;
+	i = 0;
+    }
+
+    /*
+     * add the members that are not yet indexed
+     */
+    for (; i < item->len; ++i) {
+	json_object_index_add(index, item->set, i);
+    }
+    index->len = item->len;
+    return index;
+}
+
+
+/*
+ * json_digits_to_uint64 - convert ASCII decimal digits to an uint64_t
+ *
+ * Eight digits at a time are converted with a few 64 bit multiplies
+ * (SIMD within a register) instead of eight multiply and add steps.
+ *
+ * given:
+ *	str	first digit
+ *	len	number of digits, at most 20
+ *	ret	where to store the value
+ *
+ * returns:
+ *	true ==> *ret is the value of the digits,
+ *	false ==> len is 0 or > 20, a byte is not a digit, or the value is > UINT64_MAX
+ */
+static bool
+json_digits_to_uint64(char const *str, size_t len, uint64_t *ret)
+{
+    unsigned char const *p = (unsigned char const *)str;	/* next digit */
+    size_t head = (len > 19) ? 19 : len;	/* digits that cannot overflow */
+    uint64_t val = 0;			/* value so far */
+    uint64_t chunk = 0;			/* 8 digits, first digit in the low byte */
+    size_t i = 0;
+
+    if (len == 0 || len > 20) {
+	return false;
+    }
+
+    /*
+     * 8 digits at a time
+     */
+    for (i = 0; head - i >= 8; i += 8) {
+	chunk = (uint64_t)p[i] | ((uint64_t)p[i+1] << 8) | ((uint64_t)p[i+2] << 16) | ((uint64_t)p[i+3] << 24) |
+		((uint64_t)p[i+4] << 32) | ((uint64_t)p[i+5] << 40) | ((uint64_t)p[i+6] << 48) |
+		((uint64_t)p[i+7] << 56);
 
-	    item->parsed = false;
-	    item->converted = false;
-	    item->set = NULL;
-	    item->s = NULL;
-	};
-	break;
-    default:
-	warn(__func__, "attempt to initialize an unknown JSON type: %d", ret->type);
-	break;
+	/* each byte must be 0x30 to 0x39 */
+	if (((chunk & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+	     (((chunk + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) !=
+	     UINT64_C(0x3333333333333333)) {
+	    return false;
+	}
+
+	/* pairs of digits, then groups of 4, then all 8 */
+	chunk -= UINT64_C(0x3030303030303030);
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & UINT64_C(0x000000FF000000FF)) * (100 + (UINT64_C(1000000) << 32))) +
+		 (((chunk >> 16) & UINT64_C(0x000000FF000000FF)) * (1 + (UINT64_C(10000) << 32)))) >> 32;
+	val = val * UINT64_C(100000000) + chunk;
     }
-    json_dbg(JSON_DBG_VHIGH, __func__, "allocated json with type: %s", json_item_type_name(ret));
 
     /*
-     * return the JSON parse tree item
+     * the rest of the first 19 digits
      */
-    return ret;
+    for (; i < head; ++i) {
+	if (p[i] < '0' || p[i] > '9') {
+	    return false;
+	}
+	val = val * 10 + (uint64_t)(p[i] - '0');
+    }
+
+    /*
+     * a 20th digit may overflow
+     */
+    if (len == 20) {
+	if (p[19] < '0' || p[19] > '9' || val > (UINT64_MAX - (uint64_t)(p[19] - '0')) / 10) {
+	    return false;
+	}
+	val = val * 10 + (uint64_t)(p[19] - '0');
+    }
+    *ret = val;
+    return true;
 }
 
 
 /*
  * json_process_decimal - process a JSON integer string
  *
- * We will fill out the struct json_number item assuming that ptr, with length len,
+ * We will fill out the C values of the struct json_number item assuming that ptr, with length len,
  * points to a JSON integer string of base 10 ASCII as allowed by the so-called JSON spec.
  *
  * given:
- *	item	pointer to a JSON number structure (struct json_number*)
+ *	item	pointer to a JSON number structure (struct json_number*) with a value
  *	str	JSON integer as a NUL terminated C-style string
  *	len	length of the JSON number that is not whitespace
  *
@@ -2495,8 +3335,11 @@ json_alloc(enum item_type type)
 static bool
 json_process_decimal(struct json_number *item, char const *str, size_t len)
 {
+    struct json_number_value *val = NULL;	/* C values of the JSON number */
     char *endptr;			/* first invalid character or str */
     size_t str_len = 0;			/* length as a C string, of str */
+    uint64_t magnitude = 0;		/* value of the digits, without the sign */
+    bool fast = false;			/* true ==> magnitude was found without strtoimax() or strtoumax() */
 
     /*
      * firewall
@@ -2505,6 +3348,11 @@ json_process_decimal(struct json_number *item, char const *str, size_t len)
 	warn(__func__, "called with NULL item");
 	return false;	/* processing failed */
     }
+    val = item->value;
+    if (val == NULL) {
+	warn(__func__, "called with NULL item->value");
+	return false;	/* processing failed */
+    }
     if (str == NULL) {
 	warn(__func__, "called with NULL str");
 	return false;	/* processing failed */
@@ -2521,11 +3369,6 @@ json_process_decimal(struct json_number *item, char const *str, size_t len)
 	warn(__func__, "str[%ju-1] is not an ASCII digit: 0x%02x for str: %s", (uintmax_t)len, (int)str[len-1], str);
 	return false;	/* processing failed */
     }
-    str_len = strlen(str);
-    if (str_len < len) {
-	warn(__func__, "strlen(%s): %ju < len arg: %ju", str, (uintmax_t)str_len, (uintmax_t)len);
-	return false;	/* processing failed */
-    }
 
     /*
      * determine if JSON integer negative
@@ -2568,230 +3411,264 @@ json_process_decimal(struct json_number *item, char const *str, size_t len)
 	}
     }
 
+    /*
+     * convert the digits without strtoimax() or strtoumax() when possible
+     *
+     * The strto* calls below are only needed for more than 20 digits, or
+     * if intmax_t is not 64 bits, as such numbers do not fit anyway.
+     */
+#if UINTMAX_MAX == UINT64_MAX
+    if (item->is_negative) {
+	fast = json_digits_to_uint64(str+1, len-1, &magnitude);
+    } else {
+	fast = json_digits_to_uint64(str, len, &magnitude);
+    }
+#endif
+    if (fast == false) {
+	str_len = strlen(str);
+	if (str_len < len) {
+	    warn(__func__, "strlen(%s): %ju < len arg: %ju", str, (uintmax_t)str_len, (uintmax_t)len);
+	    return false;	/* processing failed */
+	}
+    }
+
     /*
      * attempt to convert to the largest possible integer
      */
     if (item->is_negative) {
 
 	/* case: negative, try for largest signed integer */
-	errno = 0;			/* pre-clear errno for errp() */
-	item->as_maxint = strtoimax(str, &endptr, 10);
-	if (errno == ERANGE || errno == EINVAL || endptr == str || endptr == NULL) {
-	    if (errno == ERANGE) {
-		dbg(DBG_VVVHIGH, "negative integer out of range, strtoimax failed to convert");
-	    } else {
-		dbg(DBG_VVVHIGH, "invalid negative integer, strtoimax failed to convert");
+	if (fast) {
+	    if (magnitude > (uint64_t)INTMAX_MAX + 1) {
+		val->as_maxint = INTMAX_MIN;	/* as strtoimax() would return */
+		dbg(DBG_VVVHIGH, "negative integer out of range");
+		return false;	/* processing failed */
+	    }
+	    val->as_maxint = (magnitude == (uint64_t)INTMAX_MAX + 1) ? INTMAX_MIN : -(intmax_t)magnitude;
+	} else {
+	    errno = 0;			/* pre-clear errno for errp() */
+	    val->as_maxint = strtoimax(str, &endptr, 10);
+	    if (errno == ERANGE || errno == EINVAL || endptr == str || endptr == NULL) {
+		if (errno == ERANGE) {
+		    dbg(DBG_VVVHIGH, "negative integer out of range, strtoimax failed to convert");
+		} else {
+		    dbg(DBG_VVVHIGH, "invalid negative integer, strtoimax failed to convert");
+		}
+		return false;	/* processing failed */
 	    }
-	    return false;	/* processing failed */
 	}
-	item->maxint_sized = true;
-	dbg(DBG_VVVHIGH, "strtoimax for <%s> returned: %jd", str, item->as_maxint);
+	val->maxint_sized = true;
+	dbg(DBG_VVVHIGH, "<%s> as intmax_t: %jd", str, val->as_maxint);
 
 	/* case int8_t: range check */
-	if (item->as_maxint >= (intmax_t)INT8_MIN && item->as_maxint <= (intmax_t)INT8_MAX) {
-	    item->int8_sized = true;
-	    item->as_int8 = (int8_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)INT8_MIN && val->as_maxint <= (intmax_t)INT8_MAX) {
+	    val->int8_sized = true;
+	    val->as_int8 = (int8_t)val->as_maxint;
 	}
 
 	/* case uint8_t: cannot be because JSON string is < 0 */
-	item->uint8_sized = false;
+	val->uint8_sized = false;
 
 	/* case int16_t: range check */
-	if (item->as_maxint >= (intmax_t)INT16_MIN && item->as_maxint <= (intmax_t)INT16_MAX) {
-	    item->int16_sized = true;
-	    item->as_int16 = (int16_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)INT16_MIN && val->as_maxint <= (intmax_t)INT16_MAX) {
+	    val->int16_sized = true;
+	    val->as_int16 = (int16_t)val->as_maxint;
 	}
 
 	/* case uint16_t: cannot be because JSON string is < 0 */
-	item->uint16_sized = false;
+	val->uint16_sized = false;
 
 	/* case int32_t: range check */
-	if (item->as_maxint >= (intmax_t)INT32_MIN && item->as_maxint <= (intmax_t)INT32_MAX) {
-	    item->int32_sized = true;
-	    item->as_int32 = (int32_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)INT32_MIN && val->as_maxint <= (intmax_t)INT32_MAX) {
+	    val->int32_sized = true;
+	    val->as_int32 = (int32_t)val->as_maxint;
 	}
 
 	/* case uint32_t: cannot be because JSON string is < 0 */
-	item->uint32_sized = false;
+	val->uint32_sized = false;
 
 	/* case int64_t: range check */
-	if (item->as_maxint >= (intmax_t)INT64_MIN && item->as_maxint <= (intmax_t)INT64_MAX) {
-	    item->int64_sized = true;
-	    item->as_int64 = (int64_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)INT64_MIN && val->as_maxint <= (intmax_t)INT64_MAX) {
+	    val->int64_sized = true;
+	    val->as_int64 = (int64_t)val->as_maxint;
 	}
 
 	/* case uint64_t: cannot be because JSON string is < 0 */
-	item->uint64_sized = false;
+	val->uint64_sized = false;
 
 	/* case int: range check */
-	if (item->as_maxint >= (intmax_t)INT_MIN && item->as_maxint <= (intmax_t)INT_MAX) {
-	    item->int_sized = true;
-	    item->as_int = (int)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)INT_MIN && val->as_maxint <= (intmax_t)INT_MAX) {
+	    val->int_sized = true;
+	    val->as_int = (int)val->as_maxint;
 	}
 
 	/* case unsigned int: cannot be because JSON string is < 0 */
-	item->uint_sized = false;
+	val->uint_sized = false;
 
 	/* case long: range check */
-	if (item->as_maxint >= (intmax_t)LONG_MIN && item->as_maxint <= (intmax_t)LONG_MAX) {
-	    item->long_sized = true;
-	    item->as_long = (long)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)LONG_MIN && val->as_maxint <= (intmax_t)LONG_MAX) {
+	    val->long_sized = true;
+	    val->as_long = (long)val->as_maxint;
 	}
 
 	/* case unsigned long: cannot be because JSON string is < 0 */
-	item->ulong_sized = false;
+	val->ulong_sized = false;
 
 	/* case long long: range check */
-	if (item->as_maxint >= (intmax_t)LLONG_MIN && item->as_maxint <= (intmax_t)LLONG_MAX) {
-	    item->longlong_sized = true;
-	    item->as_longlong = (long long)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)LLONG_MIN && val->as_maxint <= (intmax_t)LLONG_MAX) {
+	    val->longlong_sized = true;
+	    val->as_longlong = (long long)val->as_maxint;
 	}
 
 	/* case unsigned long long: cannot be because JSON string is < 0 */
-	item->ulonglong_sized = false;
+	val->ulonglong_sized = false;
 
 	/* case size_t: cannot be because JSON string is < 0 */
-	item->size_sized = false;
+	val->size_sized = false;
 
 	/* case ssize_t: range check */
-	if (item->as_maxint >= (intmax_t)SSIZE_MIN && item->as_maxint <= (intmax_t)SSIZE_MAX) {
-	    item->ssize_sized = true;
-	    item->as_ssize = (ssize_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)SSIZE_MIN && val->as_maxint <= (intmax_t)SSIZE_MAX) {
+	    val->ssize_sized = true;
+	    val->as_ssize = (ssize_t)val->as_maxint;
 	}
 
 	/* case off_t: range check */
-	if (item->as_maxint >= (intmax_t)OFF_MIN && item->as_maxint <= (intmax_t)OFF_MAX) {
-	    item->off_sized = true;
-	    item->as_off = (off_t)item->as_maxint;
+	if (val->as_maxint >= (intmax_t)OFF_MIN && val->as_maxint <= (intmax_t)OFF_MAX) {
+	    val->off_sized = true;
+	    val->as_off = (off_t)val->as_maxint;
 	}
 
 	/* case intmax_t: was handled by the above call to strtoimax() */
 
 	/* case uintmax_t: cannot be because JSON string is < 0 */
-	item->umaxint_sized = false;
+	val->umaxint_sized = false;
 
     } else {
 
 	/* case: positive, try for largest unsigned integer */
-	errno = 0;			/* pre-clear errno for errp() */
-	item->as_umaxint = strtoumax(str, &endptr, 10);
-	if (errno == ERANGE || errno == EINVAL || endptr == str || endptr == NULL) {
-	    if (errno == ERANGE) {
-		dbg(DBG_VVVHIGH, "positive integer out of range, strtoumax failed to convert");
-	    } else {
-		dbg(DBG_VVVHIGH, "invalid positive integer, strtoumax failed to convert");
+	if (fast) {
+	    val->as_umaxint = (uintmax_t)magnitude;
+	} else {
+	    errno = 0;			/* pre-clear errno for errp() */
+	    val->as_umaxint = strtoumax(str, &endptr, 10);
+	    if (errno == ERANGE || errno == EINVAL || endptr == str || endptr == NULL) {
+		if (errno == ERANGE) {
+		    dbg(DBG_VVVHIGH, "positive integer out of range, strtoumax failed to convert");
+		} else {
+		    dbg(DBG_VVVHIGH, "invalid positive integer, strtoumax failed to convert");
+		}
+		return false;	/* processing failed */
 	    }
-	    return false;	/* processing failed */
 	}
-	item->umaxint_sized = true;
-	dbg(DBG_VVVHIGH, "strtoumax for <%s> returned: %ju", str, item->as_umaxint);
+	val->umaxint_sized = true;
+	dbg(DBG_VVVHIGH, "<%s> as uintmax_t: %ju", str, val->as_umaxint);
 
 	/* case int8_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INT8_MAX) {
-	    item->int8_sized = true;
-	    item->as_int8 = (int8_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INT8_MAX) {
+	    val->int8_sized = true;
+	    val->as_int8 = (int8_t)val->as_umaxint;
 	}
 
 	/* case uint8_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)UINT8_MAX) {
-	    item->uint8_sized = true;
-	    item->as_uint8 = (uint8_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)UINT8_MAX) {
+	    val->uint8_sized = true;
+	    val->as_uint8 = (uint8_t)val->as_umaxint;
 	}
 
 	/* case int16_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INT16_MAX) {
-	    item->int16_sized = true;
-	    item->as_int16 = (int16_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INT16_MAX) {
+	    val->int16_sized = true;
+	    val->as_int16 = (int16_t)val->as_umaxint;
 	}
 
 	/* case uint16_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)UINT16_MAX) {
-	    item->uint16_sized = true;
-	    item->as_uint16 = (uint16_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)UINT16_MAX) {
+	    val->uint16_sized = true;
+	    val->as_uint16 = (uint16_t)val->as_umaxint;
 	}
 
 	/* case int32_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INT32_MAX) {
-	    item->int32_sized = true;
-	    item->as_int32 = (int32_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INT32_MAX) {
+	    val->int32_sized = true;
+	    val->as_int32 = (int32_t)val->as_umaxint;
 	}
 
 	/* case uint32_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)UINT32_MAX) {
-	    item->uint32_sized = true;
-	    item->as_uint32 = (uint32_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)UINT32_MAX) {
+	    val->uint32_sized = true;
+	    val->as_uint32 = (uint32_t)val->as_umaxint;
 	}
 
 	/* case int64_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INT64_MAX) {
-	    item->int64_sized = true;
-	    item->as_int64 = (int64_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INT64_MAX) {
+	    val->int64_sized = true;
+	    val->as_int64 = (int64_t)val->as_umaxint;
 	}
 
 	/* case uint64_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)UINT64_MAX) {
-	    item->uint64_sized = true;
-	    item->as_uint64 = (uint64_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)UINT64_MAX) {
+	    val->uint64_sized = true;
+	    val->as_uint64 = (uint64_t)val->as_umaxint;
 	}
 
 	/* case int: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INT_MAX) {
-	    item->int_sized = true;
-	    item->as_int = (int)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INT_MAX) {
+	    val->int_sized = true;
+	    val->as_int = (int)val->as_umaxint;
 	}
 
 	/* case unsigned int: bounds check */
-	if (item->as_umaxint <= (uintmax_t)UINT_MAX) {
-	    item->uint_sized = true;
-	    item->as_uint = (unsigned int)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)UINT_MAX) {
+	    val->uint_sized = true;
+	    val->as_uint = (unsigned int)val->as_umaxint;
 	}
 
 	/* case long: bounds check */
-	if (item->as_umaxint <= (uintmax_t)LONG_MAX) {
-	    item->long_sized = true;
-	    item->as_long = (long)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)LONG_MAX) {
+	    val->long_sized = true;
+	    val->as_long = (long)val->as_umaxint;
 	}
 
 	/* case unsigned long: bounds check */
-	if (item->as_umaxint <= (uintmax_t)ULONG_MAX) {
-	    item->ulong_sized = true;
-	    item->as_ulong = (unsigned long)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)ULONG_MAX) {
+	    val->ulong_sized = true;
+	    val->as_ulong = (unsigned long)val->as_umaxint;
 	}
 
 	/* case long long: bounds check */
-	if (item->as_umaxint <= (uintmax_t)LLONG_MAX) {
-	    item->longlong_sized = true;
-	    item->as_longlong = (long long)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)LLONG_MAX) {
+	    val->longlong_sized = true;
+	    val->as_longlong = (long long)val->as_umaxint;
 	}
 
 	/* case unsigned long long: bounds check */
-	if (item->as_umaxint <= (uintmax_t)ULLONG_MAX) {
-	    item->ulonglong_sized = true;
-	    item->as_ulonglong = (unsigned long long)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)ULLONG_MAX) {
+	    val->ulonglong_sized = true;
+	    val->as_ulonglong = (unsigned long long)val->as_umaxint;
 	}
 
 	/* case ssize_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)SSIZE_MAX) {
-	    item->ssize_sized = true;
-	    item->as_ssize = (ssize_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)SSIZE_MAX) {
+	    val->ssize_sized = true;
+	    val->as_ssize = (ssize_t)val->as_umaxint;
 	}
 
 	/* case size_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)SIZE_MAX) {
-	    item->size_sized = true;
-	    item->as_size = (size_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)SIZE_MAX) {
+	    val->size_sized = true;
+	    val->as_size = (size_t)val->as_umaxint;
 	}
 
 	/* case off_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)OFF_MAX) {
-	    item->off_sized = true;
-	    item->as_off = (off_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)OFF_MAX) {
+	    val->off_sized = true;
+	    val->as_off = (off_t)val->as_umaxint;
 	}
 
 	/* case intmax_t: bounds check */
-	if (item->as_umaxint <= (uintmax_t)INTMAX_MAX) {
-	    item->maxint_sized = true;
-	    item->as_maxint = (intmax_t)item->as_umaxint;
+	if (val->as_umaxint <= (uintmax_t)INTMAX_MAX) {
+	    val->maxint_sized = true;
+	    val->as_maxint = (intmax_t)val->as_umaxint;
 	}
 
 	/* case uintmax_t: was handled by the above call to strtoumax() */
@@ -2804,16 +3681,162 @@ json_process_decimal(struct json_number *item, char const *str, size_t len)
 }
 
 
+/*
+ * powers of 10 that are exact in each floating point type
+ *
+ * A value of at most JSON_MANT_*_MAX times or divided by one of these is
+ * a single correctly rounded operation on two exact values, so it is the
+ * same value strtof(), strtod() or strtold() would return (Clinger's fast
+ * path).  FLT_EVAL_METHOD must be 0 so that float and double arithmetic
+ * is not done in a wider type and rounded twice.
+ */
+#define JSON_MANT_FLOAT_MAX ((uint64_t)1 << FLT_MANT_DIG)	/* largest mantissa exact in a float */
+#define JSON_MANT_DOUBLE_MAX ((uint64_t)1 << DBL_MANT_DIG)	/* largest mantissa exact in a double */
+#define JSON_POW10_FLOAT_MAX (10)	/* largest power of 10 exact in a float */
+#define JSON_POW10_DOUBLE_MAX (22)	/* largest power of 10 exact in a double */
+#if LDBL_MANT_DIG >= 64 && LDBL_MANT_DIG != 106
+#define JSON_POW10_LDBL_MAX (27)	/* largest power of 10 exact in a long double */
+#elif LDBL_MANT_DIG == DBL_MANT_DIG
+#define JSON_POW10_LDBL_MAX (22)	/* long double is a double */
+#else
+#define JSON_POW10_LDBL_MAX (-1)	/* double-double or unknown: always use strtold() */
+#endif
+static float const pow10_float[JSON_POW10_FLOAT_MAX+1] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+static double const pow10_double[JSON_POW10_DOUBLE_MAX+1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+static long double const pow10_ldbl[] = {
+    1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L, 1e12L, 1e13L,
+    1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+};
+
+
+/*
+ * json_split_floating - split a JSON number into a decimal mantissa and exponent
+ *
+ * The value of the JSON number is mant * 10^exp10, negated if negative is true.
+ *
+ * given:
+ *	str	JSON floating point or JSON e-notation value
+ *	len	length of the JSON number that is not whitespace
+ *	negative	where to store true if the number has a leading '-'
+ *	mant	where to store the digits of the number without the '.'
+ *	exp10	where to store the power of 10 to multiply mant by
+ *
+ * returns:
+ *	true ==> *negative, *mant and *exp10 are exact,
+ *	false ==> the number has more digits than fit in a uint64_t,
+ *		  an exponent too large to bother with or is not a JSON number
+ *
+ * NOTE: Leading zeros and trailing zeros of the fraction do not count as digits.
+ */
+static bool
+json_split_floating(char const *str, size_t len, bool *negative, uint64_t *mant, int *exp10)
+{
+    char const *p = str;		/* next character of str */
+    char const *end = str + len;	/* beyond the JSON number */
+    uint64_t m = 0;			/* digits so far */
+    int digits = 0;			/* significant digits in m */
+    int zeros = 0;			/* zeros of the fraction not yet put into m */
+    int scale = 0;			/* digits of the fraction in m */
+    int e = 0;				/* value of the exponent */
+    bool e_negative = false;		/* true ==> exponent has a '-' */
+
+    /*
+     * sign
+     */
+    *negative = (p < end && *p == '-');
+    if (*negative) {
+	++p;
+    }
+
+    /*
+     * integer digits
+     */
+    if (p >= end || !isdigit((unsigned char)*p)) {
+	return false;
+    }
+    for (; p < end && isdigit((unsigned char)*p); ++p) {
+	if (m == 0 && *p == '0') {
+	    continue;
+	}
+	if (++digits > 19) {
+	    return false;
+	}
+	m = m * 10 + (uint64_t)(*p - '0');
+    }
+
+    /*
+     * fraction digits
+     */
+    if (p < end && *p == '.') {
+	++p;
+	if (p >= end || !isdigit((unsigned char)*p)) {
+	    return false;
+	}
+	for (; p < end && isdigit((unsigned char)*p); ++p) {
+	    if (*p == '0') {
+		++zeros;
+		continue;
+	    }
+	    /* put the zeros before this digit into m */
+	    for (; zeros > 0; --zeros) {
+		if (m != 0 && ++digits > 19) {
+		    return false;
+		}
+		m *= 10;
+		++scale;
+	    }
+	    if (++digits > 19) {
+		return false;
+	    }
+	    m = m * 10 + (uint64_t)(*p - '0');
+	    ++scale;
+	}
+    }
+
+    /*
+     * exponent
+     */
+    if (p < end && (*p == 'e' || *p == 'E')) {
+	++p;
+	if (p < end && (*p == '+' || *p == '-')) {
+	    e_negative = (*p == '-');
+	    ++p;
+	}
+	if (p >= end || !isdigit((unsigned char)*p)) {
+	    return false;
+	}
+	for (; p < end && isdigit((unsigned char)*p); ++p) {
+	    if (e > 9999) {
+		return false;
+	    }
+	    e = e * 10 + (*p - '0');
+	}
+    }
+    if (p != end) {
+	return false;
+    }
+
+    *mant = m;
+    *exp10 = (e_negative ? -e : e) - scale;
+    return true;
+}
+
+
 /*
  * json_process_floating - process JSON floating point or e-notation string
  *
- * We will fill out the struct json_number item assuming that ptr, with length len,
+ * We will fill out the C values of the struct json_number item assuming that ptr, with length len,
  * points to a JSON floating point string as allowed by the so-called JSON spec.
  * The JSON floating point string can be with a JSON float (what the spec calls
  * integer + faction + exponent).
  *
  * given:
- *	item	pointer to a JSON number structure (struct json_number*)
+ *	item	pointer to a JSON number structure (struct json_number*) with a value
  *	str	JSON floating point or JSON e-notation value as a NUL terminated C-style string
  *	len	length of the JSON number that is not whitespace
  *
@@ -2829,6 +3852,7 @@ json_process_decimal(struct json_number *item, char const *str, size_t len)
 static bool
 json_process_floating(struct json_number *item, char const *str, size_t len)
 {
+    struct json_number_value *val = NULL;	/* C values of the JSON number */
     char *endptr;			/* first invalid character or str */
     char *e_found = NULL;		/* strchr() search for e */
     char *cap_e_found = NULL;		/* strchr() search for E */
@@ -2836,6 +3860,10 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
     char *dot_found = NULL;		/* strchr() search for '.' */
     char *dot = NULL;			/* strrchr() search for '.' */
     size_t str_len = 0;			/* length as a C string, of str */
+    bool exact = false;			/* true ==> mant and exp10 are the exact value of str */
+    bool negative = false;		/* true ==> str has a leading '-' */
+    uint64_t mant = 0;			/* digits of str */
+    int exp10 = 0;			/* power of 10 to multiply mant by */
 
     /*
      * firewall
@@ -2844,6 +3872,11 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
 	warn(__func__, "called with NULL item");
 	return false;	/* processing failed */
     }
+    val = item->value;
+    if (val == NULL) {
+	warn(__func__, "called with NULL item->value");
+	return false;	/* processing failed */
+    }
     if (str == NULL) {
 	warn(__func__, "called with NULL str");
 	return false;	/* processing failed */
@@ -3046,11 +4079,51 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
 	}
     }
 
+    /*
+     * split the number into digits and a power of 10
+     *
+     * When the digits and the power of 10 are small enough, each floating
+     * point value is found with a single multiply or divide, and strtold(),
+     * strtod() and strtof() are only called for the rest, in the "C" locale
+     * so that a '.' is the decimal point whatever the locale of the program.
+     */
+    exact = json_split_floating(str, len, &negative, &mant, &exp10);
+
+    /*
+     * an integer value that fits in an uint64_t is converted to each type
+     * with a single correctly rounded conversion, whatever its size: this
+     * is the case for each JSON integer as they are processed here too
+     */
+    if (exact && exp10 > 0 && exp10 < 20) {
+	uint64_t whole = mant;		/* mant * 10^exp10 */
+	int e = exp10;			/* power of 10 not yet in whole */
+
+	for (; e > 0 && whole <= UINT64_MAX / 10; --e) {
+	    whole *= 10;
+	}
+	if (e == 0) {
+	    mant = whole;
+	    exp10 = 0;
+	}
+    }
+
     /*
      * convert to largest floating point value
      */
-    errno = 0;			/* pre-clear errno for errp() */
-    item->as_longdouble = strtold(str, &endptr);
+    if (exact && JSON_POW10_LDBL_MAX >= 0 && (exp10 == 0 ||
+	(exp10 >= -JSON_POW10_LDBL_MAX && exp10 <= JSON_POW10_LDBL_MAX &&
+	 (LDBL_MANT_DIG >= 64 || mant <= JSON_MANT_DOUBLE_MAX)))) {
+	val->as_longdouble = (exp10 < 0) ? (long double)mant / pow10_ldbl[-exp10] :
+					    (long double)mant * pow10_ldbl[exp10];
+	if (negative) {
+	    val->as_longdouble = -val->as_longdouble;
+	}
+	errno = 0;		/* no range error is possible */
+	endptr = (char *)str + len;
+    } else {
+	errno = 0;			/* pre-clear errno for errp() */
+	val->as_longdouble = json_strtold(str, &endptr);
+    }
     if (errno == ERANGE || endptr == str || endptr == NULL) {
 	if (errno == ERANGE) {
 	    /* if range problem we know it's parsable */
@@ -3059,62 +4132,100 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
 	dbg(DBG_VVVHIGH, "strtold failed to convert");
 	return false;	/* processing failed */
     }
-    item->longdouble_sized = true;
-    item->as_longdouble_int = (item->as_longdouble == floorl(item->as_longdouble));
-    dbg(DBG_VVVHIGH, "strtold for <%s> returned as %%Lg: %.22Lg", str, item->as_longdouble);
-    dbg(DBG_VVVHIGH, "strtold for <%s> returned as %%Le: %.22Le", str, item->as_longdouble);
-    dbg(DBG_VVVHIGH, "strtold for <%s> returned as %%Lf: %.22Lf", str, item->as_longdouble);
-    dbg(DBG_VVVHIGH, "strtold returned an integer value: %s", booltostr(item->as_longdouble_int));
+    val->longdouble_sized = true;
+    val->as_longdouble_int = (val->as_longdouble == floorl(val->as_longdouble));
+    if (dbg_allowed(DBG_VVVHIGH)) {
+	dbg(DBG_VVVHIGH, "<%s> as long double %%Lg: %.22Lg", str, val->as_longdouble);
+	dbg(DBG_VVVHIGH, "<%s> as long double %%Le: %.22Le", str, val->as_longdouble);
+	dbg(DBG_VVVHIGH, "<%s> as long double %%Lf: %.22Lf", str, val->as_longdouble);
+	dbg(DBG_VVVHIGH, "long double is an integer value: %s", booltostr(val->as_longdouble_int));
+    }
 
     /*
      * note if value < 0
      */
-    if (item->as_longdouble < 0) {
+    if (val->as_longdouble < 0) {
 	item->is_negative = true;
     }
 
     /*
      * convert to double
-     */
-    errno = 0;			/* pre-clear conversion test */
-    item->as_double = strtod(str, &endptr);
+     *
+     * A mantissa that is small enough may take some of a power of 10 too
+     * large for the table: 12e25 is 12000e22.
+     */
+#if FLT_EVAL_METHOD == 0
+    for (; exact && exp10 > JSON_POW10_DOUBLE_MAX && mant <= JSON_MANT_DOUBLE_MAX / 10; --exp10) {
+	mant *= 10;
+    }
+    if (exact && (exp10 == 0 ||
+	(exp10 >= -JSON_POW10_DOUBLE_MAX && exp10 <= JSON_POW10_DOUBLE_MAX && mant <= JSON_MANT_DOUBLE_MAX))) {
+	val->as_double = (exp10 < 0) ? (double)mant / pow10_double[-exp10] : (double)mant * pow10_double[exp10];
+	if (negative) {
+	    val->as_double = -val->as_double;
+	}
+	errno = 0;		/* no range error is possible */
+	endptr = (char *)str + len;
+    } else
+#endif
+    {
+	errno = 0;			/* pre-clear conversion test */
+	val->as_double = json_strtod(str, &endptr);
+    }
     if (errno == ERANGE || endptr == str || endptr == NULL) {
 	if (errno == ERANGE) {
 	    /* if range problem we know it's parsable */
 	    item->parsed = true;
 	}
-	item->double_sized = false;
+	val->double_sized = false;
 	dbg(DBG_VVVHIGH, "strtod for <%s> failed", str);
     } else {
-	item->double_sized = true;
+	val->double_sized = true;
 	item->parsed = true;
-	item->as_double_int = (item->as_double == floor(item->as_double));
-	dbg(DBG_VVVHIGH, "strtod for <%s> returned as %%lg: %.22lg", str, item->as_double);
-	dbg(DBG_VVVHIGH, "strtod for <%s> returned as %%le: %.22le", str, item->as_double);
-	dbg(DBG_VVVHIGH, "strtod for <%s> returned as %%lf: %.22lf", str, item->as_double);
-	dbg(DBG_VVVHIGH, "strtod returned an integer value: %s", booltostr(item->as_double_int));
+	val->as_double_int = (val->as_double == floor(val->as_double));
+	if (dbg_allowed(DBG_VVVHIGH)) {
+	    dbg(DBG_VVVHIGH, "<%s> as double %%lg: %.22lg", str, val->as_double);
+	    dbg(DBG_VVVHIGH, "<%s> as double %%le: %.22le", str, val->as_double);
+	    dbg(DBG_VVVHIGH, "<%s> as double %%lf: %.22lf", str, val->as_double);
+	    dbg(DBG_VVVHIGH, "double is an integer value: %s", booltostr(val->as_double_int));
+	}
     }
 
     /*
      * convert to float
      */
-    errno = 0;			/* pre-clear conversion test */
-    item->as_float = strtof(str, &endptr);
+#if FLT_EVAL_METHOD == 0
+    if (exact && (exp10 == 0 ||
+	(exp10 >= -JSON_POW10_FLOAT_MAX && exp10 <= JSON_POW10_FLOAT_MAX && mant <= JSON_MANT_FLOAT_MAX))) {
+	val->as_float = (exp10 < 0) ? (float)mant / pow10_float[-exp10] : (float)mant * pow10_float[exp10];
+	if (negative) {
+	    val->as_float = -val->as_float;
+	}
+	errno = 0;		/* no range error is possible */
+	endptr = (char *)str + len;
+    } else
+#endif
+    {
+	errno = 0;			/* pre-clear conversion test */
+	val->as_float = json_strtof(str, &endptr);
+    }
     if (errno == ERANGE || endptr == str || endptr == NULL) {
 	if (errno == ERANGE) {
 	    /* if range issue we know it's parsable */
 	    item->parsed = true;
 	}
-	item->float_sized = false;
+	val->float_sized = false;
 	dbg(DBG_VVVHIGH, "strtof for <%s> failed", str);
     } else {
 	item->parsed = true;
-	item->float_sized = true;
-	item->as_float_int = (item->as_longdouble == floorl(item->as_longdouble));
-	dbg(DBG_VVVHIGH, "strtof for <%s> returned as %%g: %.22g", str, (double)item->as_float);
-	dbg(DBG_VVVHIGH, "strtof for <%s> returned as %%e: %.22e", str, (double)item->as_float);
-	dbg(DBG_VVVHIGH, "strtof for <%s> returned as %%f: %.22f", str, (double)item->as_float);
-	dbg(DBG_VVVHIGH, "strtof returned an integer value: %s", booltostr(item->as_float_int));
+	val->float_sized = true;
+	val->as_float_int = (val->as_longdouble == floorl(val->as_longdouble));
+	if (dbg_allowed(DBG_VVVHIGH)) {
+	    dbg(DBG_VVVHIGH, "<%s> as float %%g: %.22g", str, (double)val->as_float);
+	    dbg(DBG_VVVHIGH, "<%s> as float %%e: %.22e", str, (double)val->as_float);
+	    dbg(DBG_VVVHIGH, "<%s> as float %%f: %.22f", str, (double)val->as_float);
+	    dbg(DBG_VVVHIGH, "float is an integer value: %s", booltostr(val->as_float_int));
+	}
     }
 
     /*
@@ -3150,6 +4261,10 @@ json_process_floating(struct json_number *item, char const *str, size_t len)
  * returns:
  *	allocated JSON parser tree node of the parsed JSON number
  *
+ * NOTE: Only the kind of JSON number is found here.  The C values of the
+ *	 struct json_number are not set until json_number_convert() or one
+ *	 of the json_number_get_ functions is called for the node.
+ *
  * NOTE: This function will not return on malloc error.
  * NOTE: This function will not return NULL.
  */
@@ -3161,7 +4276,6 @@ json_conv_number(char const *ptr, size_t len)
     bool decimal = false;		    /* true ==> ptr points to a base 10 integer in ASCII */
     bool e_notation = false;		    /* true ==> ptr points to e notation in ASCII */
     bool floating_notation = false;	    /* true ==> ptr points to floating point notation in ASCII */
-    bool success = false;		    /* true ==> processing was successful */
 
     /*
      * allocate an initialized JSON parse tree item
@@ -3175,7 +4289,7 @@ json_conv_number(char const *ptr, size_t len)
     /*
      * initialize the JSON item
      */
-    item = &(ret->item.number);
+    item = JSON_NODE_ITEM(ret, number);
     item->parsed = false;
     item->converted = false;
     item->as_str = NULL;
@@ -3183,37 +4297,8 @@ json_conv_number(char const *ptr, size_t len)
     item->is_negative = false;
     item->is_floating = false;
     item->is_e_notation = false;
-    /* integer values */
     item->is_integer = false;
-    item->int8_sized = false;
-    item->uint8_sized = false;
-    item->int16_sized = false;
-    item->uint16_sized = false;
-    item->int32_sized = false;
-    item->uint32_sized = false;
-    item->int64_sized = false;
-    item->uint64_sized = false;
-    item->int_sized = false;
-    item->uint_sized = false;
-    item->long_sized = false;
-    item->ulong_sized = false;
-    item->longlong_sized = false;
-    item->ulonglong_sized = false;
-    item->ssize_sized = false;
-    item->size_sized = false;
-    item->off_sized = false;
-    item->maxint_sized = false;
-    item->umaxint_sized = false;
-    /* floating point values */
-    item->float_sized = false;
-    item->as_float = 0.0f;
-    item->as_float_int = false;
-    item->double_sized = false;
-    item->as_double = 0.0;
-    item->as_double_int = false;
-    item->longdouble_sized = false;
-    item->as_longdouble = 0.0L;
-    item->as_longdouble_int = false;
+    item->value = NULL;
 
     /*
      * firewall
@@ -3236,9 +4321,9 @@ json_conv_number(char const *ptr, size_t len)
      * duplicate the JSON integer string
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(char));
+    item->as_str = json_node_alloc(ret, len+1+1);
     if (item->as_str == NULL) {
-	errp(13, __func__, "calloc #1 error allocating %ju bytes", (uintmax_t)(len+1+1));
+	errp(13, __func__, "json_node_alloc() error allocating %ju bytes", (uintmax_t)(len+1+1));
 	not_reached();
     }
     strncpy(item->as_str, ptr, len);
@@ -3278,90 +4363,275 @@ json_conv_number(char const *ptr, size_t len)
     item->is_integer = decimal;
 
     /*
-     * case: JSON number is a floating point number
+     * the number is parsed if it is one of the above
+     *
+     * Converting it to C values is left to json_number_convert().
      */
-    if (floating_notation) {
+    if (floating_notation || e_notation || decimal) {
+	item->parsed = true;
+    }
 
-	/* process JSON number as floating point number */
-	success = json_process_floating(item, item->first, item->number_len);
-	if (success == false) {
+    /*
+     * return the JSON parse tree item
+     */
+    return ret;
+}
 
-	    /*
-	     * this JSON number is not a true floating point value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as floating point number failed: <%s>",
-				   item->as_str);
 
-	} else {
+/*
+ * json_number_convert - convert the text of a parsed JSON number to C values
+ *
+ * The first call for a node allocates the struct json_number_value of its
+ * struct json_number and fills in the C values, in the way json_conv_number()
+ * once did for every number it was given.  Later calls return what the first
+ * one found.
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node of type JTYPE_NUMBER
+ *
+ * returns:
+ *	true ==> the JSON number converted to some form of C value,
+ *	false ==> node is NULL, is not a parsed JSON number, or did not convert
+ *
+ * NOTE: The C values of a number in an arena are in the arena of the number,
+ *	 whichever arena, if any, is in use when it is converted.
+ *
+ * NOTE: This function will not return on allocation error.
+ */
+bool
+json_number_convert(struct json *node)
+{
+    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
+    bool success = false;		    /* true ==> processing was successful */
+
+    /*
+     * firewall
+     */
+    item = json_get_number(node);
+    if (item == NULL || item->first == NULL || item->number_len <= 0) {
+	return false;
+    }
+
+    /*
+     * convert the JSON number only once
+     */
+    if (item->value == NULL) {
+
+	/*
+	 * the C values of a number in an arena are in the arena too
+	 */
+	item->value = json_node_alloc(node, sizeof(*item->value));
+	if (item->value == NULL) {
+	    errp(255, __func__, "json_node_alloc() error allocating %ju bytes", (uintmax_t)sizeof(*item->value));
+	    not_reached();
+	}
+
+	/*
+	 * case: JSON number is a floating point number
+	 */
+	if (item->is_floating) {
+
+	    /* process JSON number as floating point number */
+	    success = json_process_floating(item, item->first, item->number_len);
+	    if (success == false) {
+
+		/*
+		 * this JSON number is not a true floating point value
+		 */
+		json_dbg(JSON_DBG_HIGH, __func__, "JSON number as floating point number failed: <%s>",
+				       item->as_str);
+
+	    } else {
+
+		/*
+		 * this JSON number is a converted floating point value
+		 */
+		item->converted = true;
+		json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON floating point number of type %s: <%s>",
+					 json_item_type_name(node), item->as_str);
+	    }
+	    item->parsed = true;	/* floating point number has been parsed, regardless of conversion status */
+	}
+
+	/*
+	 * case: JSON number is an e-notation number
+	 *
+	 * NOTE: There is no need to process the number as floating point twice.
+	 */
+	if (item->is_e_notation && item->is_floating == false) {
+
+	    /* process JSON number as floating point or e-notation number */
+	    success = json_process_floating(item, item->first, item->number_len);
+	    if (success == false) {
+
+		/*
+		 * this JSON number is not a true e_notation value
+		 */
+		json_dbg(JSON_DBG_HIGH, __func__, "JSON number as e-notation number failed: <%s>", item->as_str);
+
+	    } else {
+
+		/*
+		 * this JSON number is a converted e_notation value
+		 */
+		item->converted = true;
+		json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON e-notation number of type %s: <%s>",
+					 json_item_type_name(node), item->as_str);
+	    }
+	    item->parsed = true;	/* e-notation number has been parsed, regardless of conversion status */
+	}
+
+	/*
+	 * case: JSON number is a base 10 integer in ASCII
+	 */
+	if (item->is_integer) {
 
 	    /*
-	     * this JSON number is a converted floating point value
+	     * process JSON number as a base 10 integer in ASCII
 	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON floating point number of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
+	    success = json_process_decimal(item, item->first, item->number_len);
+	    if (success == false) {
+
+		/*
+		 * this JSON number is not a true integer value
+		 */
+		json_dbg(JSON_DBG_HIGH, __func__, "JSON number as base 10 integer in ASCII processing failed: <%s>", item->as_str);
+
+	    } else {
+
+		/*
+		 * this JSON number is a converted integer value
+		 */
+		item->converted = true;
+		json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON integer of type %s: <%s>",
+					 json_item_type_name(node), item->as_str);
+	    }
+	    item->parsed = true;	/* 10 integer has been parsed, regardless of conversion status */
 	}
-	item->parsed = true;	/* floating point number has been parsed, regardless of conversion status */
     }
+    return item->converted;
+}
+
+
+/*
+ * json_number_get_int64 - return a JSON number as a C int64_t
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node of type JTYPE_NUMBER
+ *	ret	address of where to store the value
+ *
+ * returns:
+ *	true ==> *ret was set,
+ *	false ==> node is not a JSON integer that fits in an int64_t
+ *
+ * NOTE: The JSON number is converted on the first call: see json_number_convert().
+ */
+bool
+json_number_get_int64(struct json *node, int64_t *ret)
+{
+    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
+
+    /*
+     * firewall
+     */
+    if (ret == NULL) {
+	warn(__func__, "called with NULL ret");
+	return false;
+    }
+
+    /*
+     * convert, or use what the last conversion found
+     */
+    (void) json_number_convert(node);
+    item = json_get_number(node);
+    if (item == NULL || item->value == NULL || item->value->int64_sized == false) {
+	return false;
+    }
+    *ret = item->value->as_int64;
+    return true;
+}
+
+
+/*
+ * json_number_get_uint64 - return a JSON number as a C uint64_t
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node of type JTYPE_NUMBER
+ *	ret	address of where to store the value
+ *
+ * returns:
+ *	true ==> *ret was set,
+ *	false ==> node is not a JSON integer that fits in an uint64_t
+ *
+ * NOTE: The JSON number is converted on the first call: see json_number_convert().
+ */
+bool
+json_number_get_uint64(struct json *node, uint64_t *ret)
+{
+    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
 
     /*
-     * case: JSON number is an e-notation number
+     * firewall
      */
-    if (e_notation) {
-
-	/* process JSON number as floating point or e-notation number */
-	success = json_process_floating(item, item->first, item->number_len);
-	if (success == false) {
-
-	    /*
-	     * this JSON number is not a true e_notation value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as e-notation number failed: <%s>", item->as_str);
-
-	} else {
-
-	    /*
-	     * this JSON number is a converted e_notation value
-	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON e-notation number of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
-	}
-	item->parsed = true;	/* e-notation number has been parsed, regardless of conversion status */
+    if (ret == NULL) {
+	warn(__func__, "called with NULL ret");
+	return false;
     }
 
     /*
-     * case: JSON number is a base 10 integer in ASCII
+     * convert, or use what the last conversion found
      */
-    if (decimal) {
-
-	/*
-	 * process JSON number as a base 10 integer in ASCII
-	 */
-	success = json_process_decimal(item, item->first, item->number_len);
-	if (success == false) {
+    (void) json_number_convert(node);
+    item = json_get_number(node);
+    if (item == NULL || item->value == NULL || item->value->uint64_sized == false) {
+	return false;
+    }
+    *ret = item->value->as_uint64;
+    return true;
+}
 
-	    /*
-	     * this JSON number is not a true integer value
-	     */
-	    json_dbg(JSON_DBG_HIGH, __func__, "JSON number as base 10 integer in ASCII processing failed: <%s>", item->as_str);
 
-	} else {
+/*
+ * json_number_get_double - return a JSON number as a C double
+ *
+ * A JSON integer is also returned as a double, rounded if it has more
+ * digits than a double holds: is_floating_notation() is true for a JSON
+ * integer too, so json_number_convert() converts it to each floating point
+ * type as well as to each integer type it fits in, however many digits it has.
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node of type JTYPE_NUMBER
+ *	ret	address of where to store the value
+ *
+ * returns:
+ *	true ==> *ret was set,
+ *	false ==> node is not a JSON number or is out of the range of a double
+ *
+ * NOTE: The JSON number is converted on the first call: see json_number_convert().
+ */
+bool
+json_number_get_double(struct json *node, double *ret)
+{
+    struct json_number *item = NULL;	    /* JSON number item inside JSON parser tree node */
 
-	    /*
-	     * this JSON number is a converted integer value
-	     */
-	    item->converted = true;
-	    json_dbg(JSON_DBG_VHIGH, __func__, "converted JSON integer of type %s: <%s>",
-				     json_item_type_name(ret), item->as_str);
-	}
-	item->parsed = true;	/* 10 integer has been parsed, regardless of conversion status */
+    /*
+     * firewall
+     */
+    if (ret == NULL) {
+	warn(__func__, "called with NULL ret");
+	return false;
     }
 
     /*
-     * return the JSON parse tree item
+     * convert, or use what the last conversion found
      */
-    return ret;
+    (void) json_number_convert(node);
+    item = json_get_number(node);
+    if (item == NULL || item->value == NULL || item->value->double_sized == false) {
+	return false;
+    }
+    *ret = item->value->as_double;
+    return true;
 }
 
 
@@ -3452,6 +4722,8 @@ json_conv_string(char const *ptr, size_t len, bool quote)
 {
     struct json *ret = NULL;		    /* JSON parser tree node to return */
     struct json_string *item = NULL;	    /* JSON string item inside JSON parser tree node */
+    char *as_str = NULL;		    /* reallocated as_str */
+    size_t str_len = 0;			    /* length of encoded string */
 
     /*
      * allocate an initialized JSON parse tree item
@@ -3465,7 +4737,7 @@ json_conv_string(char const *ptr, size_t len, bool quote)
     /*
      * initialize the JSON item
      */
-    item = &(ret->item.string);
+    item = JSON_NODE_ITEM(ret, string);
     item->as_str = NULL;
     item->str = NULL;
     item->converted = false;
@@ -3476,6 +4748,7 @@ json_conv_string(char const *ptr, size_t len, bool quote)
     item->posix_safe = false;
     item->first_alphanum = false;
     item->upper = false;
+    item->interned = false;
 
     /*
      * firewall
@@ -3488,7 +4761,6 @@ json_conv_string(char const *ptr, size_t len, bool quote)
     /*
      * case: JSON surrounding '"'s are to be ignored
      */
-    item->as_str_len = len;	/* save length of as_str */
     if (quote == true) {
 
 	/*
@@ -3514,42 +4786,66 @@ json_conv_string(char const *ptr, size_t len, bool quote)
 	++ptr;
 	len -= 2;
     }
+    item->as_str_len = len;	/* save length of as_str */
 
     /*
      * duplicate the JSON string
+     *
+     * NOTE: as_str is the only allocation of the string: str either is
+     * as_str or points into the same allocation, just after as_str.
      */
     errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = calloc(len+1+1, sizeof(char));
+    item->as_str = json_node_alloc(ret, len+1+1);
     if (item->as_str == NULL) {
-	errp(16, __func__, "calloc #1 error allocating %ju bytes", (uintmax_t)(len+1+1));
+	errp(16, __func__, "json_node_alloc() error allocating %ju bytes", (uintmax_t)(len+1+1));
 	not_reached();
     }
-    strncpy(item->as_str, ptr, len);
+    memcpy(item->as_str, ptr, len);
     item->as_str[len] = '\0';	/* paranoia */
     item->as_str[len+1] = '\0';	/* paranoia */
 
     /*
-     * encode the JSON decoded string
+     * case: nothing to encode
+     *
+     * Without a \-escape, and without a char json_encode() would reject, the
+     * encoded string is the JSON decoded string and so is not copied again.
      */
-    /* encode the entire string */
-    item->str = json_encode(item->as_str, len, &(item->str_len));
-    if (item->str == NULL) {
-	warn(__func__, "quote === %s: JSON string encode failed for: <%s>",
-		       booltostr(quote), item->as_str);
-	return ret;
-    }
-    item->parsed = true;	/* JSON parsed successful */
-    item->converted = true;	/* JSON encoding successful */
+    if (encode_json_run(ptr, len) == len) {
+	item->str = item->as_str;
+	item->str_len = len;
+	item->same = true;	/* encoded string same an original JSON decoded string (perhaps sans '"'s) */
 
     /*
-     * determine if encoded string is identical to the original JSON decoded string
-     *
-     * NOTE: We use memcmp() because there might be NUL bytes in the 'char *'
-     * and strcmp() would stop at the first '\0'.
+     * case: encode the JSON decoded string
      */
-    if (item->as_str_len == item->str_len && memcmp(item->as_str, item->str, item->as_str_len) == 0) {
-	item->same = true;	/* encoded string same an original JSON decoded string (perhaps sans '"'s) */
+    } else {
+
+	/*
+	 * make room for the encoded string just after as_str
+	 *
+	 * The encoding is never longer than the JSON decoded string, so it is
+	 * encoded right where it goes, without allocating it on its own.
+	 */
+	errno = 0;		/* pre-clear errno for errp() */
+	as_str = json_node_grow(ret, item->as_str, len+1+1, len+1+len+1);
+	if (as_str == NULL) {
+	    errp(44, __func__, "json_node_grow() error allocating %ju bytes", (uintmax_t)(len+1+len+1));
+	    not_reached();
+	}
+	item->as_str = as_str;
+	item->str = as_str+len+1;
+
+	/* encode the entire string */
+	if (json_encode_buf(item->as_str, len, item->str, len+1, &str_len) == false) {
+	    warn(__func__, "quote === %s: JSON string encode failed for: <%s>",
+			   booltostr(quote), item->as_str);
+	    item->str = NULL;
+	    return ret;
+	}
+	item->str_len = str_len;
     }
+    item->parsed = true;	/* JSON parsed successful */
+    item->converted = true;	/* JSON encoding successful */
 
     /*
      * determine POSIX state of the encoded string
@@ -3660,7 +4956,7 @@ json_conv_bool(char const *ptr, size_t len)
     /*
      * initialize the JSON item
      */
-    item = &(ret->item.boolean);
+    item = JSON_NODE_ITEM(ret, boolean);
     item->as_str = NULL;
     item->converted = false;
     item->parsed = false;
@@ -3683,32 +4979,23 @@ json_conv_bool(char const *ptr, size_t len)
     }
 
     /*
-     * duplicate the JSON decoded string
-     */
-    errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = malloc(len+1+1);
-    if (item->as_str == NULL) {
-	errp(19, __func__, "malloc #1 error allocating %ju bytes", (uintmax_t)(len+1+1));
-	not_reached();
-    }
-    memcpy(item->as_str, ptr, len+1);
-    item->as_str[len] = '\0';	/* paranoia */
-    item->as_str[len+1] = '\0';	/* paranoia */
-    item->as_str_len = len;
-
-    /*
-     * encode the JSON boolean
+     * encode the JSON boolean: as_str is a static string, so nothing is
+     * allocated for it
      */
-    if (strcmp(item->as_str, "true") == 0) {
+    if (len == sizeof("true")-1 && memcmp(ptr, "true", len) == 0) {
+	item->as_str = "true";
+	item->as_str_len = len;
 	item->converted = true;
 	item->parsed = true;
 	item->value = true;
-    } else if (strcmp(item->as_str, "false") == 0) {
+    } else if (len == sizeof("false")-1 && memcmp(ptr, "false", len) == 0) {
+	item->as_str = "false";
+	item->as_str_len = len;
 	item->converted = true;
 	item->parsed = true;
 	item->value = false;
     } else {
-	warn(__func__, "JSON boolean string neither true nor false: <%s>", item->as_str);
+	warn(__func__, "JSON boolean string neither true nor false: <%.*s>", (int)len, ptr);
 	item->converted = false; /* extra sanity - force converted to false */
 	item->parsed = false;	/* extra sanity - force parsed to false */
     }
@@ -3815,9 +5102,8 @@ json_conv_null(char const *ptr, size_t len)
     /*
      * initialize the JSON item
      */
-    item = &(ret->item.null);
+    item = JSON_NODE_ITEM(ret, null);
     item->as_str = NULL;
-    item->value = NULL;
     item->converted = false;
     item->parsed = false;
 
@@ -3838,28 +5124,16 @@ json_conv_null(char const *ptr, size_t len)
     }
 
     /*
-     * duplicate the JSON string
-     */
-    errno = 0;			/* pre-clear errno for errp() */
-    item->as_str = malloc(len+1+1);
-    if (item->as_str == NULL) {
-	errp(22, __func__, "malloc #1 error allocating %ju bytes", (uintmax_t)(len+1+1));
-	not_reached();
-    }
-    memcpy(item->as_str, ptr, len+1);
-    item->as_str[len] = '\0';	/* paranoia */
-    item->as_str[len+1] = '\0';	/* paranoia */
-    item->as_str_len = len;
-
-    /*
-     * encode the JSON null
+     * encode the JSON null: as_str is a static string, so nothing is
+     * allocated for it
      */
-    if (strcmp(item->as_str, "null") == 0) {
+    if (len == sizeof("null")-1 && memcmp(ptr, "null", len) == 0) {
+	item->as_str = "null";
+	item->as_str_len = len;
 	item->converted = true;
 	item->parsed = true;
-	item->value = NULL;
     } else {
-	warn(__func__, "JSON null string is not null: <%s>", item->as_str);
+	warn(__func__, "JSON null string is not null: <%.*s>", (int)len, ptr);
 	item->converted = false;    /* extra sanity - force converted to false */
 	item->parsed = false;	    /* extra sanity - force parsed to false */
     }
@@ -3980,11 +5254,12 @@ json_conv_member(struct json *name, struct json *value)
     /*
      * initialize the JSON item
      */
-    item = &(ret->item.member);
+    item = JSON_NODE_ITEM(ret, member);
     item->converted = false;
     item->parsed = false;
     item->name_as_str = NULL;
     item->name_str = NULL;
+    item->name_intern = NULL;
     item->name = NULL;
     item->value = NULL;
 
@@ -4039,10 +5314,15 @@ json_conv_member(struct json *name, struct json *value)
     item->converted = true;
     item->parsed = true;
 
+    /*
+     * intern the name if a table is in use, unless parse_json_name() has
+     */
+    item->name_intern = json_string_intern(name);
+
     /*
      * copy convenience values related to name
      */
-    item2 = &(name->item.string);
+    item2 = JSON_NODE_ITEM(name, string);
     item->name_as_str = item2->as_str;
     /* paranoia */
     if (item->name_as_str == NULL) {
@@ -4101,27 +5381,13 @@ json_create_object(void)
     /*
      * initialize the JSON object
      */
-    item = &(ret->item.object);
+    item = JSON_NODE_ITEM(ret, object);
     item->converted = false;
     item->parsed = false;
     item->len = 0;
     item->set = NULL;
-    item->s = NULL;
-
-    /*
-     * create a dynamic array to store JSON objects
-     */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(28, __func__, "dyn_array_create() returned NULL");
-	not_reached();
-    }
-
-    /*
-     * initialize accounting for the object
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+    item->alloc = 0;	/* json_node_set_append() allocates set for the first child */
+    item->index = NULL;	/* json_object_index_build() indexes the object */
     item->converted = true;
     item->parsed = true;
 
@@ -4161,7 +5427,6 @@ struct json *
 json_object_add_member(struct json *node, struct json *member)
 {
     struct json_object *item = NULL;	    /* allocated JSON member */
-    bool moved = false;			    /* true == dyn_array_append_value() moved data */
 
     /*
      * firewall
@@ -4188,9 +5453,9 @@ json_object_add_member(struct json *node, struct json *member)
     /*
      * point to object
      */
-    item = &(node->item.object);
-    if (item->s == NULL) {
-	err(33, __func__, "item->s is NULL");
+    item = JSON_NODE_ITEM(node, object);
+    if (item->set == NULL && item->len > 0) {
+	err(33, __func__, "item->set is NULL");
 	not_reached();
     }
 
@@ -4202,17 +5467,7 @@ json_object_add_member(struct json *node, struct json *member)
     /*
      * append member
      */
-    moved = dyn_array_append_value(item->s, &member);
-    if (moved == true) {
-	dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
-		      __func__);
-    }
-
-    /*
-     * update accounting for the object
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+    json_node_set_append(node, &item->set, &item->len, &item->alloc, member);
 
     json_dbg(JSON_DBG_VHIGH, __func__, "JSON object node type: %s", json_item_type_name(node));
     json_dbg(JSON_DBG_VHIGH, __func__, "JSON object member type: %s", json_item_type_name(member));
@@ -4254,27 +5509,12 @@ json_create_elements(void)
     /*
      * initialize the JSON elements
      */
-    item = &(ret->item.array);
+    item = JSON_NODE_ITEM(ret, array);
     item->converted = false;
     item->parsed = false;
     item->len = 0;
     item->set = NULL;
-    item->s = NULL;
-
-    /*
-     * create a dynamic array to store JSON values
-     */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(35, __func__, "dyn_array_create() returned NULL");
-	not_reached();
-    }
-
-    /*
-     * initialize accounting for the array
-     */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+    item->alloc = 0;	/* json_node_set_append() allocates set for the first child */
     item->converted = true;
     item->parsed = true;
 
@@ -4312,7 +5552,6 @@ struct json *
 json_elements_add_value(struct json *node, struct json *value)
 {
     struct json_elements *item = NULL;	    /* allocated JSON member */
-    bool moved = false;			    /* true == dyn_array_append_value() moved data */
 
     /*
      * firewall
@@ -4354,9 +5593,9 @@ json_elements_add_value(struct json *node, struct json *value)
     /*
      * point to array
      */
-    item = &(node->item.elements);
-    if (item->s == NULL) {
-	err(41, __func__, "item->s is NULL");
+    item = JSON_NODE_ITEM(node, elements);
+    if (item->set == NULL && item->len > 0) {
+	err(41, __func__, "item->set is NULL");
 	not_reached();
     }
 
@@ -4368,17 +5607,92 @@ json_elements_add_value(struct json *node, struct json *value)
     /*
      * append value
      */
-    moved = dyn_array_append_value(item->s, &value);
-    if (moved == true) {
-	dbg(DBG_HIGH, "in %s(): dyn_array_append_value moved data",
-		      __func__);
+    json_node_set_append(node, &item->set, &item->len, &item->alloc, value);
+    return node;
+}
+
+
+/*
+ * json_array_add_value - add a JSON value to a JSON array
+ *
+ * A JSON array is of the form:
+ *
+ *      [ ]
+ *      [ values ]
+ *
+ * The pointer to the i-th JSON value in the JSON array, if i < len, is:
+ *
+ *      foo.set[i-1]
+ *
+ * This is the JTYPE_ARRAY counterpart of json_elements_add_value().  The
+ * parsers use it to build each array directly instead of converting a JSON
+ * elements with parse_json_array().
+ *
+ * given:
+ *	node	JSON node of the JSON array being added to
+ *	value	JSON node of the JSON value to add
+ *
+ * returns:
+ *	JSON parser tree as a JSON array
+ *
+ * NOTE: This function will not return given NULL pointers, or
+ *	 if node is not type JTYPE_ARRAY, or
+ *	 if value is type is invalid.
+ */
+struct json *
+json_array_add_value(struct json *node, struct json *value)
+{
+    struct json_array *item = NULL;	    /* allocated JSON array */
+
+    /*
+     * firewall
+     */
+    if (node == NULL) {
+	err(250, __func__, "node is NULL");
+	not_reached();
+    }
+    if (value == NULL) {
+	err(251, __func__, "value is NULL");
+	not_reached();
+    }
+    if (node->type != JTYPE_ARRAY) {
+	err(252, __func__, "node type expected to be JTYPE_ARRAY: %d found type: %d",
+			   JTYPE_ARRAY, node->type);
+	not_reached();
+    }
+    switch (value->type) {
+    case JTYPE_NUMBER:
+    case JTYPE_STRING:
+    case JTYPE_BOOL:
+    case JTYPE_NULL:
+    case JTYPE_MEMBER:
+    case JTYPE_OBJECT:
+    case JTYPE_ARRAY:
+	break;
+    default:
+	err(253, __func__, "expected JSON item, array, string, number, boolean or null, found type: %d",
+			   value->type);
+	not_reached();
+    }
+
+    /*
+     * point to array
+     */
+    item = JSON_NODE_ITEM(node, array);
+    if (item->set == NULL && item->len > 0) {
+	err(254, __func__, "item->set is NULL");
+	not_reached();
     }
 
     /*
-     * update accounting for the array
+     * link JSON parse tree child to this parent node
+     */
+    value->parent = node;
+
+    /*
+     * append value
      */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
+    json_node_set_append(node, &item->set, &item->len, &item->alloc, value);
     return node;
 }
 
@@ -4419,34 +5733,204 @@ json_create_array(void)
     /*
      * initialize the JSON array
      */
-    item = &(ret->item.array);
+    item = JSON_NODE_ITEM(ret, array);
     item->converted = false;
     item->parsed = false;
     item->len = 0;
     item->set = NULL;
-    item->s = NULL;
+    item->alloc = 0;	/* json_node_set_append() allocates set for the first child */
+    item->converted = true;
+    item->parsed = true;
+
+    json_dbg(JSON_DBG_VHIGH, __func__, "JSON return type: %s", json_item_type_name(ret));
+
+    /*
+     * return the JSON parse tree item
+     */
+    return ret;
+}
+
+
+/*
+ * json_set_shrink - cut the set of a JSON object or array down to its length
+ *
+ * While an object or array is built, json_node_set_append() leaves room in
+ * its set for more children.  When it is complete, which for the parsers is
+ * when its closing brace or bracket is parsed, this function gives the room
+ * that is not used back, so that the set holds exactly len children.  More
+ * children may still be added later: the set then grows again.
+ *
+ * An object with JSON_OBJECT_INDEX_MIN or more members is also indexed, as
+ * json_object_index_build() does, so that json_object_get() looks its members
+ * up in the index.
+ *
+ * The set of an object or array in an arena is left as it is: the arena does
+ * not give memory back until it is reset.
+ *
+ * given:
+ *	node	JSON node of type JTYPE_OBJECT, JTYPE_ARRAY or JTYPE_ELEMENTS
+ *
+ * NOTE: This function will not return given a NULL node or a node of another type.
+ */
+void
+json_set_shrink(struct json *node)
+{
+    struct json ***set = NULL;		    /* set of the object or array */
+    intmax_t len = 0;			    /* number of children in *set */
+    intmax_t *alloc = NULL;		    /* number of children *set has room for */
+    struct json **new_set = NULL;	    /* *set cut down to len children */
 
     /*
-     * create a dynamic array to store JSON arrays
+     * firewall
      */
-    item->s = dyn_array_create(sizeof (struct json *), JSON_CHUNK, JSON_CHUNK, true);
-    if (item->s == NULL) {
-	errp(43, __func__, "dyn_array_create() returned NULL");
+    if (node == NULL) {
+	err(48, __func__, "node is NULL");
+	not_reached();
+    }
+    switch (node->type) {
+    case JTYPE_OBJECT:
+	set = &JSON_NODE_ITEM(node, object)->set;
+	len = JSON_NODE_ITEM(node, object)->len;
+	alloc = &JSON_NODE_ITEM(node, object)->alloc;
+	(void) json_object_index(node, JSON_NODE_ITEM(node, object));
+	break;
+    case JTYPE_ARRAY:
+	set = &JSON_NODE_ITEM(node, array)->set;
+	len = JSON_NODE_ITEM(node, array)->len;
+	alloc = &JSON_NODE_ITEM(node, array)->alloc;
+	break;
+    case JTYPE_ELEMENTS:
+	set = &JSON_NODE_ITEM(node, elements)->set;
+	len = JSON_NODE_ITEM(node, elements)->len;
+	alloc = &JSON_NODE_ITEM(node, elements)->alloc;
+	break;
+    default:
+	err(49, __func__, "expected JSON object, array or elements, found type: %s (%d)",
+			  json_item_type_name(node), node->type);
 	not_reached();
     }
+    if (node->arena || *alloc <= len) {
+	return;
+    }
 
     /*
-     * initialize accounting for the array
+     * give back the room that is not used
      */
-    item->len = dyn_array_tell(item->s);
-    item->set = dyn_array_addr(item->s, struct json *, 0);
-    item->converted = true;
-    item->parsed = true;
+    if (len == 0) {
+	free(*set);
+	*set = NULL;
+	*alloc = 0;
+	return;
+    }
+    new_set = realloc(*set, (size_t)len * sizeof(**set));
+    if (new_set != NULL) {	/* else keep the bigger set: it still holds the children */
+	*set = new_set;
+	*alloc = len;
+    }
+    return;
+}
 
-    json_dbg(JSON_DBG_VHIGH, __func__, "JSON return type: %s", json_item_type_name(ret));
+
+/*
+ * json_object_index_build - index the members of a JSON object by name
+ *
+ * given:
+ *	node	JSON node of type JTYPE_OBJECT
+ *
+ * returns:
+ *	true ==> json_object_get() finds every member of node in its index,
+ *	false ==> node is NULL or not a JSON object, has fewer than
+ *		  JSON_OBJECT_INDEX_MIN members or the index could not be allocated
+ *
+ * The parsers index each object when it is complete, see json_set_shrink(),
+ * so this function is only needed for an object built or added to by other
+ * means.  The first call for an object builds a hash table index of its
+ * members, and later calls add the members added to the object since.  The index does
+ * not change the order of set, which is still the order of the members in
+ * the JSON.
+ *
+ * NOTE: as it changes the index of node, this function must not be called
+ *	 for an object while another thread calls it or json_object_get() for
+ *	 the same object.
+ */
+bool
+json_object_index_build(struct json *node)
+{
+    struct json_object *item = NULL;	/* JSON object of node */
 
     /*
-     * return the JSON parse tree item
+     * firewall
      */
-    return ret;
+    item = json_get_object(node);
+    if (item == NULL) {
+	return false;
+    }
+
+    return json_object_index(node, item) != NULL;
+}
+
+
+/*
+ * json_object_get - find a member of a JSON object by name
+ *
+ * given:
+ *	node	JSON node of type JTYPE_OBJECT
+ *	name	encoded name of the member, need not be NUL terminated
+ *	len	length of name
+ *
+ * returns:
+ *	JSON node of type JTYPE_MEMBER of the first member of node named name, or
+ *	NULL if there is none, or node is NULL or not a JSON object, or name is NULL
+ *
+ * The name is compared with name_str of each member, the name with any
+ * \-escape decoded.  The members that are indexed, which for an object the
+ * parsers built is every member if it has JSON_OBJECT_INDEX_MIN or more, are
+ * looked up in the index, so they take about the same time however many
+ * members the object has, and the rest are scanned.  See json_set_shrink()
+ * and json_object_index_build().
+ *
+ * This function does not change node, so threads may search the same object
+ * at the same time.
+ */
+struct json *
+json_object_get(struct json const *node, char const *name, size_t len)
+{
+    struct json_object const *item = NULL;		/* JSON object of node */
+    struct json_object_index const *index = NULL;	/* index of item or NULL */
+    size_t hash = 0;				/* json_intern_hash() of name */
+    uint32_t pos = 0;				/* 1 + index in set of a member */
+    size_t j;
+    intmax_t i = 0;
+
+    /*
+     * firewall
+     */
+    item = json_get_object(node);
+    if (item == NULL || name == NULL || item->set == NULL || item->len <= 0) {
+	return NULL;
+    }
+
+    /*
+     * look name up in the index of the members that are indexed
+     */
+    index = item->index;
+    if (index != NULL && index->len <= item->len) {
+	hash = json_intern_hash(name, len);
+	for (j = hash & (index->slots-1); (pos = index->slot[j].pos) != 0; j = (j+1) & (index->slots-1)) {
+	    if (index->slot[j].hash == (uint32_t)hash && json_member_name_is(json_get_member(item->set[pos-1]), name, len)) {
+		return item->set[pos-1];
+	    }
+	}
+	i = index->len;
+    }
+
+    /*
+     * scan the members that are not indexed
+     */
+    for (; i < item->len; ++i) {
+	if (json_member_name_is(json_get_member(item->set[i]), name, len)) {
+	    return item->set[i];
+	}
+    }
+    return NULL;
 }
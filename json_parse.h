@@ -30,6 +30,16 @@
  */
 #include "json_utf8.h"
 
+/*
+ * json_arena - bump allocator for JSON parse trees
+ */
+#include "json_arena.h"
+
+/*
+ * json_intern - intern table of JSON member names
+ */
+#include "json_intern.h"
+
 /*
  * definitions
  */
@@ -44,6 +54,11 @@
 #define CONVERTED_PARSED_JSON_NODE(item) ((item) != NULL && (((item)->parsed == true) && ((item)->converted == true)))
 #define CONVERTED_JSON_NODE(item) ((item) != NULL && (item)->converted == true)
 
+/*
+ * fewest members an object has for json_set_shrink() and json_object_index_build() to index it
+ */
+#define JSON_OBJECT_INDEX_MIN (16)
+
 
 /*
  * byte2asciistr - a trivial way to map an 8-bit byte into string of ASCII characters
@@ -88,6 +103,12 @@ struct byte2asciistr
  * the number of bytes, starting with first, that contain the actual
  * JSON number string.
  *
+ * The C values of the JSON number are in a struct json_number_value that
+ * json_number_convert() allocates the first time it is called for the node:
+ * until then value == NULL.  A parsed JSON number is only text and a few
+ * booleans, so a document with many numbers that are never looked at does
+ * not pay for 20 or so C values of each.
+ *
  * If is_floating == false, then the JSON number was attempted to be converted
  * as an integer.  In this case the "integer values" fields will be used and
  * the "floating point values" fields will be unused (set to false, or 0.0);
@@ -120,18 +141,30 @@ struct json_number
     bool parsed;		/* true ==> able to parse correctly */
     bool converted;		/* true ==> able to convert JSON number string to some form of C value */
 
+    bool is_negative;		/* true ==> value < 0 */
+
+    bool is_floating;		/* true ==> as_str had a '.' in it such as 1.234, false ==> no '.' found */
+    bool is_e_notation;		/* true ==> e notation used such as 1e10, false ==> no e notation found */
+    bool is_integer;		/* true ==> JSON integer, see the integer values of struct json_number_value */
+
     char *as_str;		/* allocated copy of the original allocated JSON number, NUL terminated */
     char *first;		/* first whitespace character */
 
     size_t as_str_len;		/* length of as_str */
     size_t number_len;		/* length of JSON number, w/o leading or trailing whitespace and NUL bytes */
 
-    bool is_negative;		/* true ==> value < 0 */
+    struct json_number_value *value;	/* C values, NULL ==> json_number_convert() not yet called */
+    struct json_arena *arena;		/* arena the node is in, for value, or NULL */
+};
 
-    bool is_floating;		/* true ==> as_str had a '.' in it such as 1.234, false ==> no '.' found */
-    bool is_e_notation;		/* true ==> e notation used such as 1e10, false ==> no e notation found */
-    bool is_integer;		/* true ==> converted to some integer type below */
 
+/*
+ * C values of a parsed JSON number
+ *
+ * See struct json_number and json_number_convert().
+ */
+struct json_number_value
+{
     /* integer values */
 
     bool int8_sized;		/* true ==> converted JSON integer to C int8_t */
@@ -231,7 +264,7 @@ struct json_string
     bool converted;		/* true ==> able to encode JSON string, false ==> str is invalid or not encoded */
 
     char *as_str;		/* allocated non-encoded JSON string, NUL terminated (perhaps sans JSON '"'s) */
-    char *str;			/* allocated encoded JSON string, NUL terminated */
+    char *str;			/* encoded JSON string, NUL terminated: as_str if same, else just after as_str */
 
     size_t as_str_len;		/* length of as_str, not including final NUL */
     size_t str_len;		/* length of str, not including final NUL */
@@ -244,6 +277,8 @@ struct json_string
     bool posix_safe;		/* true ==> all chars are POSIX portable safe plus + and maybe / after encoding */
     bool first_alphanum;	/* true ==> first char is alphanumeric after encoding */
     bool upper;			/* true ==> UPPER case chars found after encoding */
+
+    bool interned;		/* true ==> as_str and str are in a struct json_intern, see json_intern_use() */
 };
 
 
@@ -263,10 +298,10 @@ struct json_boolean
     bool parsed;		/* true ==> able to parse correctly */
     bool converted;		/* true ==> able to encode JSON boolean, false ==> as_str is invalid or not encoded */
 
-    char *as_str;		/* allocated JSON boolean string, NUL terminated */
-    size_t as_str_len;		/* length of as_str */
-
     bool value;			/* converted JSON boolean value */
+
+    char const *as_str;		/* static "true" or "false", not allocated */
+    size_t as_str_len;		/* length of as_str */
 };
 
 
@@ -285,10 +320,8 @@ struct json_null
     bool parsed;		/* true ==> able to parse correctly */
     bool converted;		/* true ==> able to encode JSON null, false ==> as_str is invalid or not encoded */
 
-    char *as_str;		/* allocated JSON null string, NUL terminated */
+    char const *as_str;		/* static "null", not allocated */
     size_t as_str_len;		/* length of as_str */
-
-    void *value;		/* NULL */
 };
 
 
@@ -318,10 +351,15 @@ struct json_null
  * These 4 items are copies of information from the JSON string name
  * and serve as a convenience for accessing JSON member name information.
  *
- * The name_as_str is a pointer copy of name->item.string.as_str pointer.
- * The name_str is a pointer copy of name->item.string.str pointer.
- * The name_as_str_len is a copy of name->item.string.as_str_len.
- * The name_str_len is a copy of name->item.string.str_len.
+ * The name_as_str is a pointer copy of json_get_string(name)->as_str pointer.
+ * The name_str is a pointer copy of json_get_string(name)->str pointer.
+ * The name_as_str_len is a copy of json_get_string(name)->as_str_len.
+ * The name_str_len is a copy of json_get_string(name)->str_len.
+ *
+ * When the name is interned (see json_intern_use()), name_intern is where it
+ * is in the intern table: it holds the hash of the name, and two members of
+ * trees parsed with the same table have the same name if and only if they
+ * have the same name_intern.
  */
 struct json_member
 {
@@ -334,6 +372,8 @@ struct json_member
     size_t name_as_str_len;	/* length of name_as_str, not including final NUL */
     size_t name_str_len;	/* length of name_str, not including final NUL */
 
+    struct json_intern_name const *name_intern;	/* interned name, or NULL */
+
     struct json *name;		/* JSON string name */
     struct json *value;		/* JSON value */
 };
@@ -353,7 +393,29 @@ struct json_member
  * The pointer to the i-th JSON member in the JSON object, if i < len, is:
  *
  *	foo.set[i-1]
+ *
+ * While the object is parsed, set has room for alloc members, which doubles
+ * when set is full.  When the closing brace is parsed, set is cut down to
+ * len members by json_set_shrink().
+ *
+ * The order of set is the order of the members in the JSON.  An object with
+ * JSON_OBJECT_INDEX_MIN or more members also gets an index when its closing
+ * brace is parsed, or when it is given to json_object_index_build(): a hash
+ * table of the positions in set of its members, which json_object_get() uses.
  */
+struct json_object_slot
+{
+    uint32_t hash;		/* low 32 bits of json_intern_hash() of the name of the member */
+    uint32_t pos;		/* 1 + index in set of the member, 0 ==> empty slot */
+};
+
+struct json_object_index
+{
+    size_t slots;			/* number of slots, a power of 2 */
+    intmax_t len;			/* members set[0] .. set[len-1] are indexed */
+    struct json_object_slot slot[];	/* open addressed hash table, at most half full */
+};
+
 struct json_object
 {
     bool parsed;		/* true ==> able to parse correctly */
@@ -362,7 +424,9 @@ struct json_object
     intmax_t len;		/* number of JSON members in the object, 0 ==> empty object */
     struct json **set;		/* set of JSON members belonging to the object */
 
-    struct dyn_array *s;	/* dynamic array managed storage for the JSON object */
+    intmax_t alloc;		/* number of JSON members set has room for, see json_set_shrink() */
+    struct json_object_index *index;	/* index of the members by name, see json_set_shrink(), or NULL */
+    struct json_arena *arena;		/* arena the node is in, for set and index, or NULL */
 };
 
 
@@ -381,6 +445,9 @@ struct json_object
  *
  *	foo.set[i-1]
  *
+ * As for a JSON object, set has room for alloc values, doubling when it is
+ * full, and is cut down to len values when the closing bracket is parsed.
+ *
  * IMPORTANT: The struct json_array must be identical to struct json_elements because
  *	      parse_json_array() converts by just changing the JSON item type.
  */
@@ -392,7 +459,8 @@ struct json_array
     intmax_t len;		/* number of JSON values in the JSON array, 0 ==> empty array */
     struct json **set;		/* set of JSON values belonging to the JSON array */
 
-    struct dyn_array *s;	/* dynamic array managed storage for the JSON array */
+    intmax_t alloc;		/* number of JSON values set has room for, see json_set_shrink() */
+    struct json_arena *arena;	/* arena the node is in, for set, or NULL */
 };
 
 
@@ -402,7 +470,9 @@ struct json_array
  * When parsed == false, then all other fields in this structure may be invalid.
  * So you must check the boolean of parsed and only use values if parsed == true.
  *
- * A JSON elements is zero or more JSON values.
+ * A JSON elements is zero or more JSON values.  The parsers build each JSON
+ * array as a JTYPE_ARRAY directly, so a JTYPE_ELEMENTS is only found in a parse
+ * tree that is built with json_create_elements() and json_elements_add_value().
  *
  * The pointer to the i-th JSON value in the JSON array, if i < len, is:
  *
@@ -419,7 +489,8 @@ struct json_elements
     intmax_t len;		/* number of JSON values in the JSON elements, 0 ==> empty array */
     struct json **set;		/* set of JSON values belonging to the JSON elements */
 
-    struct dyn_array *s;	/* dynamic array managed storage for the JSON array */
+    intmax_t alloc;		/* number of JSON values set has room for, see json_set_shrink() */
+    struct json_arena *arena;	/* arena the node is in, for set, or NULL */
 };
 
 
@@ -435,27 +506,24 @@ enum item_type {
     JTYPE_MEMBER,	    /* JSON item is a member */
     JTYPE_OBJECT,	    /* JSON item is a { members } */
     JTYPE_ARRAY,	    /* JSON item is a [ elements ] */
-    JTYPE_ELEMENTS,	    /* JSON item for building a JSON array */
+    JTYPE_ELEMENTS,	    /* JSON item for building a JSON array, see parse_json_array() */
 };
 
 /*
  * struct json - item for the JSON parse tree
  *
- * For the parse tree we have this struct and its associated union.
+ * The node itself is only a type and a parent link.  What the node holds is
+ * as large as its type needs and json_alloc() puts it in the same allocation,
+ * just after the node, so a JSON null does not pay for the bits of a JSON
+ * number, and no node pays for a pointer to what it holds.
+ *
+ * Use json_get_number(), json_get_string() and friends to get what a
+ * node holds: they return NULL when the node is not of that type.
  */
 struct json
 {
-    enum item_type type;		/* union item specifier */
-    union json_union {
-	struct json_number number;	/* JTYPE_NUMBER - value is number (integer or floating point) */
-	struct json_string string;	/* JTYPE_STRING - value is a string */
-	struct json_boolean boolean;	/* JTYPE_BOOL - value is a JSON boolean */
-	struct json_null null;		/* JTYPE_NULL - value is a JSON null value */
-	struct json_member member;	/* JTYPE_MEMBER - value is a JSON member: name : value */
-	struct json_object object;	/* JTYPE_OBJECT - value is a JSON { members } */
-	struct json_array array;	/* JTYPE_ARRAY - value is a JSON [ elements ] */
-	struct json_elements elements;	/* JTYPE_ELEMENTS - zero or more JSON values */
-    } item;
+    enum item_type type;		/* JSON type of the node, see JSON_NODE_ITEM() */
+    bool arena;				/* true ==> node is in a struct json_arena, see json_arena_use() */
 
     /*
      * JSON parse tree links
@@ -464,6 +532,31 @@ struct json
 };
 
 
+/*
+ * a JSON parse tree node and what it holds, as json_alloc() allocates them
+ *
+ * The struct json comes first so that the pointer json_alloc() returns is
+ * also the pointer to free.
+ */
+struct json_number_node { struct json node; struct json_number item; };
+struct json_string_node { struct json node; struct json_string item; };
+struct json_boolean_node { struct json node; struct json_boolean item; };
+struct json_null_node { struct json node; struct json_null item; };
+struct json_member_node { struct json node; struct json_member item; };
+struct json_object_node { struct json node; struct json_object item; };
+struct json_array_node { struct json node; struct json_array item; };
+struct json_elements_node { struct json node; struct json_elements item; };
+
+/*
+ * JSON_NODE_ITEM - what a node holds, given the kind of the node
+ *
+ * For example JSON_NODE_ITEM(node, number) is the struct json_number of a
+ * JTYPE_NUMBER node.  Unlike json_get_number() and friends, the type of node
+ * is not checked.
+ */
+#define JSON_NODE_ITEM(node, kind) (&((struct json_##kind##_node *)(node))->item)
+
+
 /*
  * global variables
  */
@@ -487,13 +580,21 @@ extern struct byte2asciistr byte2asciistr[];
 /*
  * external function declarations
  */
+extern size_t json_decode_run(char const *ptr, size_t len);
 extern char *json_decode(char const *ptr, size_t len, size_t *retlen, bool skip_quote);
 extern char *json_decode_str(char const *str, size_t *retlen, bool skip_quote);
+extern bool json_decode_buf(char const *ptr, size_t len, char *buf, size_t size, size_t *retlen, bool skip_quote);
+extern bool json_decode_str_buf(char const *str, char *buf, size_t size, size_t *retlen, bool skip_quote);
 extern void chkbyte2asciistr(void);
 extern void jdecencchk(int entertainment);
 extern char *json_encode(char const *ptr, size_t len, size_t *retlen);
 extern char *json_encode_str(char const *str, size_t *retlen);
+extern bool json_encode_buf(char const *ptr, size_t len, char *buf, size_t size, size_t *retlen);
+extern bool json_encode_str_buf(char const *str, char *buf, size_t size, size_t *retlen);
+extern bool json_encode_inplace(char *ptr, size_t len, size_t *retlen);
+extern bool json_string_escapes_valid(char const *text, size_t leng);
 extern struct json *parse_json_string(char const *string, size_t len);
+extern struct json *parse_json_name(char const *string, size_t len);
 extern struct json *parse_json_bool(char const *string);
 extern struct json *parse_json_null(char const *string);
 extern struct json *parse_json_number(char const *string);
@@ -502,6 +603,10 @@ extern struct json *parse_json_member(struct json *name, struct json *value);
 extern struct json *json_alloc(enum item_type type);
 extern struct json *json_conv_number(char const *ptr, size_t len);
 extern struct json *json_conv_number_str(char const *str, size_t *retlen);
+extern bool json_number_convert(struct json *node);
+extern bool json_number_get_int64(struct json *node, int64_t *ret);
+extern bool json_number_get_uint64(struct json *node, uint64_t *ret);
+extern bool json_number_get_double(struct json *node, double *ret);
 extern struct json *json_conv_string(char const *ptr, size_t len, bool quote);
 extern struct json *json_conv_string_str(char const *str, size_t *retlen, bool quote);
 extern struct json *json_conv_bool(char const *ptr, size_t len);
@@ -511,9 +616,13 @@ extern struct json *json_conv_null_str(char const *str, size_t *retlen);
 extern struct json *json_conv_member(struct json *name, struct json *value);
 extern struct json *json_create_object(void);
 extern struct json *json_object_add_member(struct json *node, struct json *member);
+extern bool json_object_index_build(struct json *node);
+extern struct json *json_object_get(struct json const *node, char const *name, size_t len);
 extern struct json *json_create_elements(void);
 extern struct json *json_elements_add_value(struct json *node, struct json *value);
 extern struct json *json_create_array(void);
+extern struct json *json_array_add_value(struct json *node, struct json *value);
+extern void json_set_shrink(struct json *node);
 
 
 #endif /* INCLUDE_JSON_PARSE_H */
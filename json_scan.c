@@ -0,0 +1,985 @@
+/*
+ * json_scan - JSON structural index scanner
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define JSON_SCAN_SSE2 1
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define JSON_SCAN_AVX2 1
+#endif
+#endif
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * json_scan - JSON structural index scanner
+ */
+#include "json_scan.h"
+
+
+/*
+ * global variables
+ */
+enum json_scanner json_scanner_backend = JSON_SCANNER_FLEX;	/* scanner used by parse_json(), set by -B in jparse */
+
+
+/*
+ * static functions
+ */
+#if !defined(JSON_SCAN_SSE2)
+static void classify_scalar(uint8_t const *block, struct json_scan_masks *masks);
+#else
+static void classify_sse2(uint8_t const *block, struct json_scan_masks *masks);
+#endif
+#if defined(JSON_SCAN_AVX2)
+static void classify_avx2(uint8_t const *block, struct json_scan_masks *masks) __attribute__((target("avx2")));
+#endif
+static uint64_t prefix_xor(uint64_t bits);
+static void scan_index_window(struct json_scan *scan);
+static bool scan_entry(struct json_scan *scan, size_t *offset, bool consume);
+static int scan_scalar(struct json_scan *scan);
+static size_t scan_number(char const *ptr, size_t len);
+static size_t scan_token_len(char const *ptr, size_t len);
+static void scan_text(struct json_scan *scan);
+static void locate_token(JPARSE_LTYPE *loc, char const *ptr, size_t len);
+
+
+/*
+ * is_delim - determine if a byte ends a run of scalar bytes
+ *
+ * A scalar (number, true, false, null or an invalid byte) runs until the
+ * next whitespace, structural or quote byte.
+ */
+static inline bool
+is_delim(uint8_t c)
+{
+    switch (c) {
+    case ' ': case '\t': case '\r': case '\n':
+    case '{': case '}': case '[': case ']': case ':': case ',':
+    case '"':
+	return true;
+    default:
+	return false;
+    }
+}
+
+
+#if !defined(JSON_SCAN_SSE2)
+/*
+ * classify_scalar - classify a block of bytes one byte at a time
+ *
+ * given:
+ *	block	    JSON_SCAN_BLOCK bytes to classify
+ *	masks	    where to store the classification
+ *
+ * This is the portable fallback for systems without SSE2.
+ */
+static void
+classify_scalar(uint8_t const *block, struct json_scan_masks *masks)
+{
+    uint64_t bit;
+    int i;
+
+    memset(masks, 0, sizeof(*masks));
+    for (i = 0; i < JSON_SCAN_BLOCK; ++i) {
+	bit = (uint64_t)1 << i;
+	switch (block[i]) {
+	case '"':
+	    masks->quote |= bit;
+	    break;
+	case '\\':
+	    masks->backslash |= bit;
+	    break;
+	case '{': case '}': case '[': case ']': case ':': case ',':
+	    masks->structural |= bit;
+	    break;
+	case ' ':
+	    masks->whitespace |= bit;
+	    break;
+	case '\t': case '\r': case '\n':
+	    masks->whitespace |= bit;
+	    masks->control |= bit;
+	    break;
+	case '\0':
+	    masks->nul |= bit;
+	    break;
+	default:
+	    if (block[i] < 0x20) {
+		masks->control |= bit;
+	    }
+	    break;
+	}
+    }
+}
+#endif
+
+
+#if defined(JSON_SCAN_SSE2)
+/*
+ * classify_sse2 - classify a block of bytes 16 bytes at a time with SSE2
+ *
+ * given:
+ *	block	    JSON_SCAN_BLOCK bytes to classify
+ *	masks	    where to store the classification
+ *
+ * NOTE: '[' | 0x20 == '{' and ']' | 0x20 == '}' so one OR folds the four
+ *	 brackets and braces into two compares.
+ */
+static void
+classify_sse2(uint8_t const *block, struct json_scan_masks *masks)
+{
+    __m128i const quote = _mm_set1_epi8('"');
+    __m128i const backslash = _mm_set1_epi8('\\');
+    __m128i const lower = _mm_set1_epi8(0x20);
+    __m128i const open = _mm_set1_epi8('{');
+    __m128i const close = _mm_set1_epi8('}');
+    __m128i const colon = _mm_set1_epi8(':');
+    __m128i const comma = _mm_set1_epi8(',');
+    __m128i const space = _mm_set1_epi8(' ');
+    __m128i const tab = _mm_set1_epi8('\t');
+    __m128i const cr = _mm_set1_epi8('\r');
+    __m128i const nl = _mm_set1_epi8('\n');
+    __m128i const ctrl = _mm_set1_epi8(0x1f);
+    __m128i const nul = _mm_setzero_si128();
+    __m128i v;
+    __m128i folded;
+    __m128i zero;
+    int i;
+
+    memset(masks, 0, sizeof(*masks));
+    for (i = 0; i < JSON_SCAN_BLOCK / 16; ++i) {
+	v = _mm_loadu_si128((__m128i const *)(block + 16 * i));
+	folded = _mm_or_si128(v, lower);
+	masks->quote |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)) << (16 * i);
+	masks->backslash |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)) << (16 * i);
+	masks->structural |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+				_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, open), _mm_cmpeq_epi8(folded, close)),
+					     _mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, comma)))) << (16 * i);
+	masks->whitespace |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+				_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+					     _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, nl)))) << (16 * i);
+	zero = _mm_cmpeq_epi8(v, nul);
+	masks->control |= (uint64_t)(uint16_t)_mm_movemask_epi8(
+				_mm_andnot_si128(zero, _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl), v))) << (16 * i);
+	masks->nul |= (uint64_t)(uint16_t)_mm_movemask_epi8(zero) << (16 * i);
+    }
+}
+#endif
+
+
+#if defined(JSON_SCAN_AVX2)
+/*
+ * classify_avx2 - classify a block of bytes 32 bytes at a time with AVX2
+ *
+ * given:
+ *	block	    JSON_SCAN_BLOCK bytes to classify
+ *	masks	    where to store the classification
+ *
+ * NOTE: only called when the CPU reports AVX2 support, see json_scan_init().
+ */
+static void
+classify_avx2(uint8_t const *block, struct json_scan_masks *masks)
+{
+    __m256i const quote = _mm256_set1_epi8('"');
+    __m256i const backslash = _mm256_set1_epi8('\\');
+    __m256i const lower = _mm256_set1_epi8(0x20);
+    __m256i const open = _mm256_set1_epi8('{');
+    __m256i const close = _mm256_set1_epi8('}');
+    __m256i const colon = _mm256_set1_epi8(':');
+    __m256i const comma = _mm256_set1_epi8(',');
+    __m256i const space = _mm256_set1_epi8(' ');
+    __m256i const tab = _mm256_set1_epi8('\t');
+    __m256i const cr = _mm256_set1_epi8('\r');
+    __m256i const nl = _mm256_set1_epi8('\n');
+    __m256i const ctrl = _mm256_set1_epi8(0x1f);
+    __m256i const nul = _mm256_setzero_si256();
+    __m256i v;
+    __m256i folded;
+    __m256i zero;
+    int i;
+
+    memset(masks, 0, sizeof(*masks));
+    for (i = 0; i < JSON_SCAN_BLOCK / 32; ++i) {
+	v = _mm256_loadu_si256((__m256i const *)(block + 32 * i));
+	folded = _mm256_or_si256(v, lower);
+	masks->quote |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, quote)) << (32 * i);
+	masks->backslash |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, backslash)) << (32 * i);
+	masks->structural |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+				_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(folded, open),
+								_mm256_cmpeq_epi8(folded, close)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(v, colon),
+								_mm256_cmpeq_epi8(v, comma)))) << (32 * i);
+	masks->whitespace |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+				_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+						_mm256_or_si256(_mm256_cmpeq_epi8(v, cr), _mm256_cmpeq_epi8(v, nl)))) << (32 * i);
+	zero = _mm256_cmpeq_epi8(v, nul);
+	masks->control |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+				_mm256_andnot_si256(zero, _mm256_cmpeq_epi8(_mm256_min_epu8(v, ctrl), v))) << (32 * i);
+	masks->nul |= (uint64_t)(uint32_t)_mm256_movemask_epi8(zero) << (32 * i);
+    }
+}
+#endif
+
+
+/*
+ * json_scan_simd - name of the block classifier this CPU will use
+ *
+ * returns:
+ *	"avx2", "sse2" or "scalar"
+ */
+char const *
+json_scan_simd(void)
+{
+#if defined(JSON_SCAN_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+	return "avx2";
+    }
+#endif
+#if defined(JSON_SCAN_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+
+/*
+ * prefix_xor - turn quote bits into in-string bits
+ *
+ * given:
+ *	bits	    unescaped quote bits of a block
+ *
+ * returns:
+ *	bit n set ==> an odd number of quotes are at or before byte n
+ */
+static uint64_t
+prefix_xor(uint64_t bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+
+/*
+ * json_scan_init - prepare to scan a block of JSON text
+ *
+ * given:
+ *	scan	    scanner state to initialise
+ *	data	    JSON text to scan
+ *	len	    length of data
+ *
+ * The index storage of an earlier scan with the same struct is kept.
+ *
+ * NOTE: data is neither copied nor modified, it must remain valid until the
+ *	 scan is finished.
+ *
+ * NOTE: scan must be zeroed before its first call, see struct json_scan.
+ *
+ * NOTE: this function does not return on NULL scan or data.
+ */
+void
+json_scan_init(struct json_scan *scan, char const *data, size_t len)
+{
+    size_t *index = NULL;	/* index storage of an earlier scan */
+
+    /*
+     * firewall
+     */
+    if (scan == NULL) {
+	err(57, __func__, "scan is NULL");
+	not_reached();
+    }
+    if (data == NULL) {
+	err(58, __func__, "data is NULL");
+	not_reached();
+    }
+
+    index = scan->index;
+    memset(scan, 0, sizeof(*scan));
+    scan->index = index;
+    scan->data = data;
+    scan->len = len;
+    scan->token = JPARSE_EMPTY;
+
+    /*
+     * select the block classifier
+     */
+#if defined(JSON_SCAN_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+	scan->classify = classify_avx2;
+    } else {
+	scan->classify = classify_sse2;
+    }
+#elif defined(JSON_SCAN_SSE2)
+    scan->classify = classify_sse2;
+#else
+    scan->classify = classify_scalar;
+#endif
+    if (json_dbg_allowed(JSON_DBG_VHIGH)) {
+	json_dbg(JSON_DBG_VHIGH, __func__, "structural index scanner: %s: %ju bytes",
+					   json_scan_simd(), (uintmax_t)len);
+    }
+}
+
+
+/*
+ * scan_index_window - add the next JSON_SCAN_WINDOW blocks to the structural index
+ *
+ * given:
+ *	scan	    scanner state
+ *
+ * Each block is classified and reduced to the offsets of the bytes the token
+ * reader in json_scan_lex() needs:
+ *
+ *	- structural bytes outside of strings
+ *	- the opening and closing quote of every string
+ *	- control bytes other than NUL inside strings (these make the string invalid)
+ *	- the first byte of every run of scalar bytes outside of strings
+ *
+ * NUL bytes are not indexed (a NUL in a string does not end it) but scan->nul
+ * records that one was seen, so parse_json_stream_ctx() need not look for
+ * them again.
+ *
+ * Escaped quotes are found by looking for odd length runs of backslashes,
+ * carrying the state from block to block, so a string is only ended by a
+ * quote that is not escaped.
+ */
+static void
+scan_index_window(struct json_scan *scan)
+{
+    uint8_t pad[JSON_SCAN_BLOCK];	/* last partial block padded with spaces */
+    struct json_scan_masks masks;	/* classification of the block */
+    uint64_t const even_bits = UINT64_C(0x5555555555555555);
+    uint64_t backslash;			/* backslashes that are not themselves escaped */
+    uint64_t follows_escape;		/* bytes that follow a backslash */
+    uint64_t odd_starts;		/* backslash runs starting on odd bits */
+    uint64_t even_carries;		/* odd_starts + backslash */
+    uint64_t escaped;			/* escaped bytes */
+    uint64_t quote;			/* unescaped quotes */
+    uint64_t in_string;			/* opening quote and string content */
+    uint64_t scalar;			/* bytes of scalars outside of strings */
+    uint64_t entries;			/* bytes to add to the index */
+    uint8_t const *block;
+    size_t base;
+    int w;
+
+    /*
+     * allocate the index on first use
+     */
+    if (scan->index == NULL) {
+	errno = 0;	/* pre-clear errno for errp() */
+	scan->index = malloc(JSON_SCAN_INDEX_MAX * sizeof(*scan->index));
+	if (scan->index == NULL) {
+	    errp(64, __func__, "malloc of %ju index entries failed", (uintmax_t)JSON_SCAN_INDEX_MAX);
+	    not_reached();
+	}
+    }
+
+    scan->count = 0;
+    scan->next = 0;
+    for (w = 0; w < JSON_SCAN_WINDOW && scan->block < scan->len; ++w) {
+
+	/*
+	 * classify the block
+	 */
+	base = scan->block;
+	block = (uint8_t const *)scan->data + base;
+	if (scan->len - base < JSON_SCAN_BLOCK) {
+	    memset(pad, ' ', sizeof(pad));
+	    memcpy(pad, block, scan->len - base);
+	    block = pad;
+	}
+	scan->classify(block, &masks);
+	scan->nul |= (masks.nul != 0);
+
+	/*
+	 * find escaped bytes
+	 */
+	backslash = masks.backslash & ~scan->prev_escaped;
+	follows_escape = (backslash << 1) | scan->prev_escaped;
+	odd_starts = backslash & ~even_bits & ~follows_escape;
+	even_carries = odd_starts + backslash;
+	scan->prev_escaped = even_carries < backslash ? 1 : 0;
+	escaped = (even_bits ^ (even_carries << 1)) & follows_escape;
+
+	/*
+	 * find strings
+	 */
+	quote = masks.quote & ~escaped;
+	in_string = prefix_xor(quote) ^ scan->prev_in_string;
+	scan->prev_in_string = (uint64_t)(-(int64_t)(in_string >> 63));
+
+	/*
+	 * find the start of scalar runs outside of strings
+	 */
+	scalar = ~(masks.whitespace | masks.structural | quote | in_string);
+	entries = (masks.structural & ~in_string) | quote | (masks.control & in_string) |
+		  (scalar & ~((scalar << 1) | scan->prev_scalar));
+	scan->prev_scalar = scalar >> 63;
+
+	/*
+	 * add the block to the index, ignoring the padding of a partial block
+	 */
+	if (scan->len - base < JSON_SCAN_BLOCK) {
+	    entries &= ((uint64_t)1 << (scan->len - base)) - 1;
+	}
+	while (entries != 0) {
+	    scan->index[scan->count++] = base + (size_t)__builtin_ctzll(entries);
+	    entries &= entries - 1;
+	}
+	scan->block += JSON_SCAN_BLOCK;
+    }
+}
+
+
+/*
+ * scan_entry - obtain the next structural index entry
+ *
+ * given:
+ *	scan	    scanner state
+ *	offset	    where to store the offset of the entry
+ *	consume	    true ==> move past the entry, false ==> just peek at it
+ *
+ * returns:
+ *	true ==> *offset set, false ==> no more entries
+ */
+static bool
+scan_entry(struct json_scan *scan, size_t *offset, bool consume)
+{
+    while (scan->next >= scan->count) {
+	if (scan->block >= scan->len) {
+	    return false;
+	}
+	scan_index_window(scan);
+    }
+    *offset = scan->index[scan->next];
+    if (consume) {
+	++scan->next;
+    }
+    return true;
+}
+
+
+/*
+ * scan_number - length of the longest JSON number at the start of a buffer
+ *
+ * given:
+ *	ptr	    start of scalar bytes
+ *	len	    number of bytes
+ *
+ * returns:
+ *	length of the longest prefix matching JSON_NUMBER in jparse.l, or 0
+ */
+static size_t
+scan_number(char const *ptr, size_t len)
+{
+    size_t i = 0;
+    size_t j;
+
+    if (i < len && ptr[i] == '-') {
+	++i;
+    }
+    if (i < len && ptr[i] == '0') {
+	++i;
+    } else if (i < len && ptr[i] >= '1' && ptr[i] <= '9') {
+	while (++i < len && ptr[i] >= '0' && ptr[i] <= '9') {
+	    ;
+	}
+    } else {
+	return 0;
+    }
+    if (i + 1 < len && ptr[i] == '.' && ptr[i+1] >= '0' && ptr[i+1] <= '9') {
+	i += 2;
+	while (i < len && ptr[i] >= '0' && ptr[i] <= '9') {
+	    ++i;
+	}
+    }
+    if (i < len && (ptr[i] == 'e' || ptr[i] == 'E')) {
+	j = i + 1;
+	if (j < len && (ptr[j] == '+' || ptr[j] == '-')) {
+	    ++j;
+	}
+	if (j < len && ptr[j] >= '0' && ptr[j] <= '9') {
+	    while (++j < len && ptr[j] >= '0' && ptr[j] <= '9') {
+		;
+	    }
+	    i = j;
+	}
+    }
+    return i;
+}
+
+
+/*
+ * scan_scalar - return the next token of a run of scalar bytes
+ *
+ * given:
+ *	scan	    scanner state with a non-empty scalar run
+ *
+ * returns:
+ *	token kind
+ *
+ * The run is split the way the flex rules in jparse.l would split it: a
+ * literal, else the longest number, else a single invalid byte.
+ */
+static int
+scan_scalar(struct json_scan *scan)
+{
+    char const *p = scan->data + scan->run;
+    size_t n = scan->run_end - scan->run;
+
+    if (n >= LITLEN("true") && memcmp(p, "true", LITLEN("true")) == 0) {
+	scan->token = JSON_TRUE;
+	scan->leng = LITLEN("true");
+    } else if (n >= LITLEN("false") && memcmp(p, "false", LITLEN("false")) == 0) {
+	scan->token = JSON_FALSE;
+	scan->leng = LITLEN("false");
+    } else if (n >= LITLEN("null") && memcmp(p, "null", LITLEN("null")) == 0) {
+	scan->token = JSON_NULL;
+	scan->leng = LITLEN("null");
+    } else if ((scan->leng = scan_number(p, n)) > 0) {
+	scan->token = JSON_NUMBER;
+    } else {
+	scan->token = token;
+	scan->leng = 1;
+    }
+    scan->start = scan->run;
+    scan->run += scan->leng;
+    scan_text(scan);
+    return scan->token;
+}
+
+
+/*
+ * scan_text - form a NUL terminated copy of the current token
+ *
+ * given:
+ *	scan	    scanner state
+ *
+ * NOTE: only used for tokens other than JSON_STRING, which are short.
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static void
+scan_text(struct json_scan *scan)
+{
+    size_t size;
+
+    if (scan->leng + 1 > scan->text_size) {
+	size = (scan->leng + 1 + JSON_SCAN_BLOCK - 1) & ~((size_t)JSON_SCAN_BLOCK - 1);
+	errno = 0;	/* pre-clear errno for errp() */
+	scan->text = realloc(scan->text, size);
+	if (scan->text == NULL) {
+	    errp(59, __func__, "realloc of %ju bytes failed", (uintmax_t)size);
+	    not_reached();
+	}
+	scan->text_size = size;
+    }
+    memcpy(scan->text, scan->data + scan->start, scan->leng);
+    scan->text[scan->leng] = '\0';
+}
+
+
+/*
+ * json_scan_lex - obtain the next token from the structural index
+ *
+ * given:
+ *	scan	    scanner state from json_scan_init()
+ *
+ * returns:
+ *	token kind as defined in jparse.tab.h, JPARSE_EOF at the end of data
+ *
+ * Tokens are the same as jparse_lex() would return, with one exception: a
+ * backslash inside a string always escapes the next byte, whereas the flex
+ * JSON_STRING pattern can end a string at the quote of "\\\"".
+ *
+ * NOTE: this function does not return on NULL scan.
+ */
+int
+json_scan_lex(struct json_scan *scan)
+{
+    size_t offset;
+    size_t close;
+    size_t end;
+
+    /*
+     * firewall
+     */
+    if (scan == NULL) {
+	err(60, __func__, "scan is NULL");
+	not_reached();
+    }
+
+    /*
+     * finish splitting up a scalar run such as: 01
+     */
+    if (scan->run < scan->run_end) {
+	return scan_scalar(scan);
+    }
+
+    /*
+     * end of data
+     */
+    if (!scan_entry(scan, &offset, true)) {
+	scan->token = JPARSE_EOF;
+	scan->start = scan->len;
+	scan->leng = 0;
+	scan_text(scan);
+	return scan->token;
+    }
+
+    scan->start = offset;
+    scan->leng = 1;
+    switch (scan->data[offset]) {
+    case '{':
+	scan->token = JSON_OPEN_BRACE;
+	break;
+    case '}':
+	scan->token = JSON_CLOSE_BRACE;
+	break;
+    case '[':
+	scan->token = JSON_OPEN_BRACKET;
+	break;
+    case ']':
+	scan->token = JSON_CLOSE_BRACKET;
+	break;
+    case ':':
+	scan->token = JSON_COLON;
+	break;
+    case ',':
+	scan->token = JSON_COMMA;
+	break;
+    case '"':
+	/*
+	 * a string is valid only if the next entry is its closing quote: a
+	 * control byte or the end of data in between leaves just the '"'
+	 * which, like the '.' rule in jparse.l, is an invalid token.
+	 */
+	if (scan_entry(scan, &close, false) && scan->data[close] == '"') {
+	    ++scan->next;
+	    scan->token = JSON_STRING;
+	    scan->leng = close - offset + 1;
+	    return scan->token;	/* strings are not copied */
+	}
+	scan->token = token;
+	break;
+    default:
+	/*
+	 * start of a run of scalar bytes
+	 */
+	for (end = offset + 1; end < scan->len && !is_delim((uint8_t)scan->data[end]); ++end) {
+	    ;
+	}
+	scan->run = offset;
+	scan->run_end = end;
+	return scan_scalar(scan);
+    }
+    scan_text(scan);
+    return scan->token;
+}
+
+
+/*
+ * json_scan_text - text of the current token
+ *
+ * given:
+ *	scan	    scanner state
+ *
+ * returns:
+ *	pointer to the current token text
+ *
+ * NOTE: the text of a JSON_STRING points into the scanned data and is NOT NUL
+ *	 terminated: use scan->leng. All other tokens are NUL terminated copies.
+ *
+ * NOTE: this function does not return on NULL scan.
+ */
+char const *
+json_scan_text(struct json_scan const *scan)
+{
+    /*
+     * firewall
+     */
+    if (scan == NULL) {
+	err(61, __func__, "scan is NULL");
+	not_reached();
+    }
+
+    if (scan->token == JSON_STRING) {
+	return scan->data + scan->start;
+    }
+    return scan->text != NULL ? scan->text : "";
+}
+
+
+/*
+ * scan_token_len - length of the flex token at the start of a buffer
+ *
+ * given:
+ *	ptr	    start of token
+ *	len	    bytes remaining (> 0)
+ *
+ * returns:
+ *	length of the token including whitespace and newline runs
+ */
+static size_t
+scan_token_len(char const *ptr, size_t len)
+{
+    size_t i;
+
+    switch (ptr[0]) {
+    case ' ': case '\t': case '\r':
+	for (i = 1; i < len && (ptr[i] == ' ' || ptr[i] == '\t' || ptr[i] == '\r'); ++i) {
+	    ;
+	}
+	return i;
+    case '\n':
+	for (i = 1; i < len && ptr[i] == '\n'; ++i) {
+	    ;
+	}
+	return i;
+    case '"':
+	for (i = 1; i < len && ptr[i] != '"' && ((uint8_t)ptr[i] >= 0x20 || ptr[i] == '\0'); ++i) {
+	    if (ptr[i] == '\\' && i + 1 < len) {
+		++i;
+	    }
+	}
+	return (i < len && ptr[i] == '"') ? i + 1 : 1;
+    case '{': case '}': case '[': case ']': case ':': case ',':
+	return 1;
+    default:
+	if (len >= LITLEN("true") && memcmp(ptr, "true", LITLEN("true")) == 0) {
+	    return LITLEN("true");
+	} else if (len >= LITLEN("false") && memcmp(ptr, "false", LITLEN("false")) == 0) {
+	    return LITLEN("false");
+	} else if (len >= LITLEN("null") && memcmp(ptr, "null", LITLEN("null")) == 0) {
+	    return LITLEN("null");
+	}
+	i = scan_number(ptr, len);
+	return i > 0 ? i : 1;
+    }
+}
+
+
+/*
+ * locate_token - advance a location over a token
+ *
+ * given:
+ *	loc	    location to update
+ *	ptr	    token text
+ *	len	    token length
+ *
+ * This does exactly what the YY_USER_ACTION macro in jparse.l does so that
+ * error locations do not depend on which scanner found the error.
+ */
+static void
+locate_token(JPARSE_LTYPE *loc, char const *ptr, size_t len)
+{
+    size_t i;
+
+    loc->first_line = loc->last_line + 1;
+    loc->first_column = loc->last_column;
+    for (i = 0; i < len; ++i) {
+	if (ptr[i] == '\n') {
+	    loc->last_line++;
+	    loc->last_column = 0;
+	} else if (ptr[i] == '\t') {
+	    loc->last_column += 8;
+	} else if (loc->first_column == 0 || loc->last_column == 0) {
+	    if (loc->first_column == 0) {
+		loc->first_column = 1;
+	    }
+	    if (loc->last_column == 0) {
+		loc->last_column = 1;
+	    }
+	} else {
+	    loc->last_column++;
+	    loc->first_column++;
+	}
+    }
+}
+
+
+/*
+ * json_scan_locate - compute the location of the current token
+ *
+ * given:
+ *	scan	    scanner state
+ *	filename    name of the file being scanned
+ *	loc	    where to store the location
+ *
+ * The structural index does not track line and column as it goes: that would
+ * mean looking at every byte again. Instead, when a location is needed (i.e.
+ * for a syntax error), the line holding the current token is re-scanned and
+ * the location is computed as jparse_lex() would have computed it. At the end
+ * of data the location is that of the last token, which is also what
+ * jparse_lex() leaves behind.
+ *
+ * If data is a piece of a larger text, scan->line and scan->column give the
+ * location state at its start (they are 0 for the start of a text): the
+ * last_line and last_column this function leaves in *loc at the end of data
+ * are what the next piece should start with.
+ *
+ * NOTE: this function does not return on NULL scan or loc.
+ */
+void
+json_scan_locate(struct json_scan const *scan, char const *filename, JPARSE_LTYPE *loc)
+{
+    size_t target;	/* offset of the token to locate */
+    size_t end;		/* end of the token to locate */
+    size_t line;	/* start of the line holding the token */
+    size_t i;
+    size_t n;
+
+    /*
+     * firewall
+     */
+    if (scan == NULL) {
+	err(62, __func__, "scan is NULL");
+	not_reached();
+    }
+    if (loc == NULL) {
+	err(63, __func__, "loc is NULL");
+	not_reached();
+    }
+
+    memset(loc, 0, sizeof(*loc));
+    if (scan->len == 0) {
+	return;		/* nothing scanned: jparse_lex() leaves the location unset */
+    }
+    loc->filename = filename;
+    loc->last_line = scan->line;
+
+    /*
+     * determine the token to locate: at the end of data it is the last token,
+     * which is either a run of newlines or is on the last line
+     */
+    if (scan->token == JPARSE_EOF) {
+	for (target = scan->len; target > 0 && scan->data[target-1] == '\n'; --target) {
+	    ;
+	}
+	if (target == scan->len) {
+	    --target;
+	}
+	end = scan->len;
+    } else {
+	target = scan->start;
+	end = scan->start + scan->leng;
+    }
+
+    /*
+     * find the start of the line and count the newlines before it
+     */
+    for (line = target; line > 0 && scan->data[line-1] != '\n'; --line) {
+	;
+    }
+    if (line == 0) {
+	loc->last_column = scan->column;
+    }
+    for (i = 0; i < line; ++i) {
+	if (scan->data[i] == '\n') {
+	    loc->last_line++;
+	}
+    }
+
+    /*
+     * replay the tokens of the line up to and including the token
+     */
+    for (i = line; i < end; i += n) {
+	if (scan->token == JPARSE_EOF) {
+	    n = scan_token_len(scan->data + i, end - i);
+	} else if (i < target) {
+	    n = scan_token_len(scan->data + i, target - i);
+	} else {
+	    n = end - i;
+	}
+	locate_token(loc, scan->data + i, n);
+    }
+}
+
+
+/*
+ * json_scan_free - free storage held by a scanner for one scan
+ *
+ * given:
+ *	scan	    scanner state from json_scan_init()
+ *
+ * The index storage is kept for the next scan: json_scan_fini() frees it.
+ *
+ * NOTE: the struct json_scan itself is not freed.
+ */
+void
+json_scan_free(struct json_scan *scan)
+{
+    if (scan == NULL) {
+	return;
+    }
+    if (scan->text != NULL) {
+	free(scan->text);
+	scan->text = NULL;
+    }
+    scan->text_size = 0;
+    scan->count = 0;
+    scan->next = 0;
+}
+
+
+/*
+ * json_scan_fini - free all storage held by a scanner
+ *
+ * given:
+ *	scan	    scanner state, may be NULL
+ *
+ * NOTE: the struct json_scan itself is not freed.
+ */
+void
+json_scan_fini(struct json_scan *scan)
+{
+    if (scan == NULL) {
+	return;
+    }
+    json_scan_free(scan);
+    if (scan->index != NULL) {
+	free(scan->index);
+	scan->index = NULL;
+    }
+}
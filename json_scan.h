@@ -0,0 +1,130 @@
+/*
+ * json_scan - JSON structural index scanner
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_SCAN_H)
+#    define  INCLUDE_JSON_SCAN_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * util - common utility functions for the JSON parser
+ */
+#include "util.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_SCAN_BLOCK (64)		/* bytes classified at a time: one bit per byte in a uint64_t */
+#define JSON_SCAN_WINDOW (16)		/* blocks indexed each time the structural index runs dry */
+#define JSON_SCAN_INDEX_MAX (JSON_SCAN_BLOCK * JSON_SCAN_WINDOW) /* most index entries one window can produce */
+
+
+/*
+ * JSON scanner backends
+ *
+ * JSON_SCANNER_FLEX is the flex generated jparse_lex() in jparse.l.
+ *
+ * JSON_SCANNER_INDEX classifies the input a block at a time (with SSE2 or AVX2
+ * where available) into a structural index and hands the parser tokens from
+ * that index without copying the input.
+ */
+enum json_scanner
+{
+    JSON_SCANNER_FLEX = 0,	/* flex generated scanner (must be first) */
+    JSON_SCANNER_INDEX = 1,	/* structural index scanner */
+};
+
+/*
+ * byte classification of one JSON_SCAN_BLOCK: bit n is byte n of the block
+ */
+struct json_scan_masks
+{
+    uint64_t quote;		/* '"' */
+    uint64_t backslash;		/* '\\' */
+    uint64_t structural;	/* '{', '}', '[', ']', ':' or ',' */
+    uint64_t whitespace;	/* ' ', '\t', '\r' or '\n' */
+    uint64_t control;		/* [\x01-\x1f] */
+    uint64_t nul;		/* '\0' */
+};
+
+/*
+ * struct json_scan - structural index scanner state
+ *
+ * The index is built lazily, JSON_SCAN_WINDOW blocks at a time, so the memory
+ * used does not depend on the size of the input.  Its storage is allocated
+ * when the first window is indexed and kept by json_scan_init() and
+ * json_scan_free() for the next scan, until json_scan_fini().  A struct
+ * json_scan must be zeroed, as jparse_ctx_init() zeroes ctx->scan, before its
+ * first json_scan_init().
+ */
+struct json_scan
+{
+    char const *data;		/* JSON text to scan (need not be NUL terminated) */
+    size_t len;			/* length of data */
+    void (*classify)(uint8_t const *block, struct json_scan_masks *masks); /* SIMD or scalar classifier */
+
+    size_t *index;		/* offsets of structural bytes in the current window, JSON_SCAN_INDEX_MAX long */
+    size_t count;		/* number of offsets in index[] */
+    size_t next;		/* next entry of index[] to consume */
+    size_t block;		/* offset of the next block to index */
+    uint64_t prev_escaped;	/* 1 ==> first byte of the next block is escaped */
+    uint64_t prev_in_string;	/* all bits set ==> next block starts inside a string */
+    uint64_t prev_scalar;	/* 1 ==> last byte of the previous block is part of a scalar */
+
+    bool nul;			/* true ==> a NUL byte has been classified */
+    int line;			/* newlines before data when it follows earlier text (see jparse_push_feed()) */
+    int column;			/* location column state at data[0] when it follows earlier text */
+
+    size_t run;			/* next token of the scalar run being split up */
+    size_t run_end;		/* end of the scalar run being split up */
+
+    int token;			/* current token kind (see jparse.tab.h) */
+    size_t start;		/* offset of current token in data */
+    size_t leng;		/* length of current token */
+    char *text;			/* NUL terminated copy of the current non-string token */
+    size_t text_size;		/* allocated size of text */
+};
+
+struct JPARSE_LTYPE;
+
+
+/*
+ * global variables
+ */
+extern enum json_scanner json_scanner_backend;	/* scanner used by parse_json(), set by -B in jparse */
+
+
+/*
+ * external function declarations
+ */
+extern void json_scan_init(struct json_scan *scan, char const *data, size_t len);
+extern int json_scan_lex(struct json_scan *scan);
+extern char const *json_scan_text(struct json_scan const *scan);
+extern void json_scan_locate(struct json_scan const *scan, char const *filename, struct JPARSE_LTYPE *loc);
+extern void json_scan_free(struct json_scan *scan);
+extern void json_scan_fini(struct json_scan *scan);
+extern char const *json_scan_simd(void);
+
+
+#endif /* INCLUDE_JSON_SCAN_H */
@@ -90,6 +90,7 @@ static struct json_sem_val_err sem_val_err_NULL = {
  * static functions
  */
 static void sem_walk(struct json *node, unsigned int depth, va_list ap);
+static void sem_index_walk(struct json *node, unsigned int depth, va_list ap);
 
 
 /*
@@ -397,7 +398,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_NUMBER:  /* JSON item is number - see struct json_number */
 	{
-	    struct json_number const *item = &(node->item.number);
+	    struct json_number const *item = json_get_number(node);
 
 	    /* converted check */
 	    if (!VALID_JSON_NODE(item)) {
@@ -425,7 +426,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_STRING:  /* JSON item is a string - see struct json_string */
 	{
-	    struct json_string const *item = &(node->item.string);
+	    struct json_string const *item = json_get_string(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -453,7 +454,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_BOOL:    /* JSON item is a boolean - see struct json_boolean */
 	{
-	    struct json_boolean const *item = &(node->item.boolean);
+	    struct json_boolean const *item = json_get_boolean(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -475,7 +476,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_NULL:    /* JSON item is a null - see struct json_null */
 	{
-	    struct json_null const *item = &(node->item.null);
+	    struct json_null const *item = json_get_null(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -492,18 +493,12 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->value != NULL) {	/* yes, value must be NULL for a converted JTYPE_NULL */
-		if (val_err != NULL) {
-		    *val_err = werr_sem_val(24, node, depth, sem, name, "JTYPE_NULL node: ironically value is NOT NULL");
-		}
-		return false;
-	    }
 	}
 	break;
 
     case JTYPE_MEMBER:  /* JSON item is a member */
 	{
-	    struct json_member const *item = &(node->item.member);
+	    struct json_member const *item = json_get_member(node);
 	    struct json *member_name = NULL;		/* name part of JTYPE_MEMBER */
 	    struct json_string *member_name_string;	/* name part of JTYPE_MEMBER as JTYPE_STRING */
 
@@ -551,7 +546,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    member_name_string = &(member_name->item.string);
+	    member_name_string = json_get_string(member_name);
 	    if (!CONVERTED_PARSED_JSON_NODE(member_name_string)) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(31, node, depth, sem, name, "JTYPE_MEMBER name node: converted is false");
@@ -575,7 +570,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_OBJECT:  /* JSON item is a { members } */
 	{
-	    struct json_object const *item = &(node->item.object);
+	    struct json_object const *item = json_get_object(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -593,15 +588,16 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->set == NULL) {
+	    if (item->set == NULL && item->len > 0) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(36, node, depth, sem, name, "JTYPE_OBJECT node: set is NULL");
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->len > item->alloc) {
 		if (val_err != NULL) {
-		    *val_err = werr_sem_val(37, node, depth, sem, name, "JTYPE_OBJECT node: s is NULL");
+		    *val_err = werr_sem_val(37, node, depth, sem, name, "JTYPE_OBJECT node: len: %ju > alloc: %ju",
+					    item->len, item->alloc);
 		}
 		return false;
 	    }
@@ -610,7 +606,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_ARRAY:   /* JSON item is a [ elements ] */
 	{
-	    struct json_array const *item = &(node->item.array);
+	    struct json_array const *item = json_get_array(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -628,15 +624,16 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->set == NULL) {
+	    if (item->set == NULL && item->len > 0) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(40, node, depth, sem, name, "JTYPE_ARRAY node: set is NULL");
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->len > item->alloc) {
 		if (val_err != NULL) {
-		    *val_err = werr_sem_val(41, node, depth, sem, name, "JTYPE_ARRAY node: s is NULL");
+		    *val_err = werr_sem_val(41, node, depth, sem, name, "JTYPE_ARRAY node: len: %ju > alloc: %ju",
+					    item->len, item->alloc);
 		}
 		return false;
 	    }
@@ -645,7 +642,7 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 
     case JTYPE_ELEMENTS:        /* JSON elements is zero or more JSON values */
 	{
-	    struct json_elements const *item = &(node->item.elements);
+	    struct json_elements const *item = json_get_elements(node);
 
 	    /* converted check */
 	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
@@ -663,15 +660,16 @@ sem_node_valid(struct json const *node, unsigned int depth, struct json_sem *sem
 		}
 		return false;
 	    }
-	    if (item->set == NULL) {
+	    if (item->set == NULL && item->len > 0) {
 		if (val_err != NULL) {
 		    *val_err = werr_sem_val(44, node, depth, sem, name, "JTYPE_ELEMENTS node: set is NULL");
 		}
 		return false;
 	    }
-	    if (item->s == NULL) {
+	    if (item->len > item->alloc) {
 		if (val_err != NULL) {
-		    *val_err = werr_sem_val(45, node, depth, sem, name, "JTYPE_ARRAY node: s is NULL");
+		    *val_err = werr_sem_val(45, node, depth, sem, name, "JTYPE_ELEMENTS node: len: %ju > alloc: %ju",
+					    item->len, item->alloc);
 		}
 		return false;
 	    }
@@ -746,7 +744,7 @@ sem_member_name(struct json const *node, unsigned int depth, struct json_sem *se
 	}
 	return NULL;
     }
-    item = &(node->item.member);
+    item = json_get_member(node);
     if (!CONVERTED_PARSED_JSON_NODE(item)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(48, node, depth, sem, name, "JTYPE_MEMBER node converted is false");
@@ -835,7 +833,7 @@ sem_member_value(struct json const *node, unsigned int depth, struct json_sem *s
 	}
 	return NULL;
     }
-    item = &(node->item.member);
+    item = json_get_member(node);
     if (!CONVERTED_PARSED_JSON_NODE(item)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(52, node, depth, sem, name, "JTYPE_MEMBER node converted is false");
@@ -913,7 +911,7 @@ sem_member_name_encoded_str(struct json const *node, unsigned int depth, struct
 	}
 	return NULL;
     }
-    istr = &(n->item.string);
+    istr = json_get_string(n);
     if (!CONVERTED_PARSED_JSON_NODE(istr)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(55, node, depth, sem, name, "node name JTYPE_STRING converted is false");
@@ -990,7 +988,7 @@ sem_member_value_encoded_str(struct json const *node, unsigned int depth, struct
 	}
 	return NULL;
     }
-    istr = &(value->item.string);
+    istr = json_get_string(value);
     if (!CONVERTED_PARSED_JSON_NODE(istr)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(58, node, depth, sem, name, "node value JTYPE_STRING converted is false");
@@ -1066,7 +1064,7 @@ sem_member_value_bool(struct json const *node, unsigned int depth, struct json_s
 	}
 	return NULL;
     }
-    ibool = &(value->item.boolean);
+    ibool = json_get_boolean(value);
     if (!CONVERTED_PARSED_JSON_NODE(ibool)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(61, node, depth, sem, name, "node value JTYPE_BOOL converted is false");
@@ -1155,7 +1153,7 @@ sem_member_value_str_or_null(struct json const *node, unsigned int depth, struct
 	/*
 	 * firewall - value
 	 */
-	istr = &(value->item.string);
+	istr = json_get_string(value);
 	if (!CONVERTED_PARSED_JSON_NODE(istr)) {
 	    if (val_err != NULL) {
 		*val_err = werr_sem_val(62, node, depth, sem, name, "node value JTYPE_STRING converted is false");
@@ -1184,7 +1182,7 @@ sem_member_value_str_or_null(struct json const *node, unsigned int depth, struct
 	/*
 	 * firewall - value
 	 */
-	inull = &(value->item.null);
+	inull = json_get_null(value);
 	if (!CONVERTED_PARSED_JSON_NODE(inull)) {
 	    if (val_err != NULL) {
 		*val_err = werr_sem_val(64, node, depth, sem, name, "node value JTYPE_NULL converted is false");
@@ -1265,7 +1263,8 @@ sem_member_value_int(struct json const *node, unsigned int depth, struct json_se
 	}
 	return NULL;
     }
-    inum = &(value->item.number);
+    inum = json_get_number(value);
+    (void) json_number_convert(value);
     if (!VALID_JSON_NODE(inum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(67, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1276,7 +1275,7 @@ sem_member_value_int(struct json const *node, unsigned int depth, struct json_se
     /*
      * validate JTYPE_NUMBER was able to be converted into an int
      */
-    if (inum->int_sized == false) {
+    if (inum->value == NULL || inum->value->int_sized == false) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(68, node, depth, sem, name, "node value JTYPE_NUMBER was unable to convert to an int");
 	}
@@ -1286,7 +1285,7 @@ sem_member_value_int(struct json const *node, unsigned int depth, struct json_se
     /*
      * case success: return JSON boolean
      */
-    return &(inum->as_int);
+    return &(inum->value->as_int);
 }
 
 
@@ -1342,7 +1341,8 @@ sem_member_value_size_t(struct json const *node, unsigned int depth, struct json
 	}
 	return NULL;
     }
-    snum = &(value->item.number);
+    snum = json_get_number(value);
+    (void) json_number_convert(value);
     if (!VALID_JSON_NODE(snum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(70, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1353,7 +1353,7 @@ sem_member_value_size_t(struct json const *node, unsigned int depth, struct json
     /*
      * validate JTYPE_NUMBER was able to be converted into a size_t
      */
-    if (snum->size_sized == false) {
+    if (snum->value == NULL || snum->value->size_sized == false) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(71, node, depth, sem, name, "node value JTYPE_NUMBER was unable to convert to a size_t");
 	}
@@ -1363,7 +1363,7 @@ sem_member_value_size_t(struct json const *node, unsigned int depth, struct json
     /*
      * case success: return JSON boolean
      */
-    return &(snum->as_size);
+    return &(snum->value->as_size);
 }
 
 
@@ -1420,7 +1420,8 @@ sem_member_value_time_t(struct json const *node, unsigned int depth, struct json
 	}
 	return NULL;
     }
-    inum = &(value->item.number);
+    inum = json_get_number(value);
+    (void) json_number_convert(value);
     if (!VALID_JSON_NODE(inum)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(73, node, depth, sem, name, "node value JTYPE_NUMBER converted is false");
@@ -1442,26 +1443,26 @@ sem_member_value_time_t(struct json const *node, unsigned int depth, struct json
 	    }
 	    return NULL;
 	}
-	if (inum->umaxint_sized == false) {
+	if (inum->value == NULL || inum->value->umaxint_sized == false) {
 	    if (val_err != NULL) {
 		*val_err = werr_sem_val(75, node, depth, sem, name, "JTYPE_NUMBER umaxint_sized false with unsigned time_t");
 	    }
 	    return NULL;
 	}
-	ret = (time_t *)&(inum->as_umaxint);
+	ret = (time_t *)&(inum->value->as_umaxint);
 
     } else {
 
 	/*
 	 * case: time_t is signed
 	 */
-	if (inum->maxint_sized == false) {
+	if (inum->value == NULL || inum->value->maxint_sized == false) {
 	    if (val_err != NULL) {
 		*val_err = werr_sem_val(76, node, depth, sem, name, "JTYPE_NUMBER maxint_sized false with signed time_t");
 	    }
 	    return NULL;
 	}
-	ret = (time_t *)&(inum->as_maxint);
+	ret = (time_t *)&(inum->value->as_maxint);
     }
 
     /*
@@ -1585,6 +1586,7 @@ sem_object_find_name(struct json const *node, unsigned int depth, struct json_se
 		     char const *memname)
 {
     struct json_object const *item = NULL;	/* JSON member */
+    struct json *s = NULL;			/* named JTYPE_MEMBER */
     bool valid = false;				/* true ==> JSON node is converted and valid JTYPE */
     int i;
 
@@ -1612,7 +1614,7 @@ sem_object_find_name(struct json const *node, unsigned int depth, struct json_se
 	}
 	return NULL;
     }
-    item = &(node->item.object);
+    item = json_get_object(node);
     if (!CONVERTED_PARSED_JSON_NODE(item)) {
 	if (val_err != NULL) {
 	    *val_err = werr_sem_val(81, node, depth, sem, name, "JTYPE_OBJECT node converted is false");
@@ -1639,13 +1641,31 @@ sem_object_find_name(struct json const *node, unsigned int depth, struct json_se
 	return NULL;
     }
 
+    /*
+     * look the named member up by json_object_get(), which uses the index
+     * that json_sem_check() built for a large object, and validate what it found
+     */
+    s = json_object_get(node, memname, strlen(memname));
+    if (s != NULL) {
+	valid = sem_node_valid(s, depth+1, sem, name, val_err);
+	if (valid == false) {
+	    /* sem_node_valid() will have set *val_err */
+	    return NULL;
+	}
+	return s;
+    }
+
     /*
      * search the JSON member array for the named member
+     *
+     * This reports why the member was not found, or the set member that is
+     * not valid.
      */
     for (i=0; i < item->len; ++i) {
-	struct json *s = item->set[i];		/* set member under the JTYPE_OBJECT */
 	char *smemname = NULL;			/* name of set member */
 
+	s = item->set[i];			/* set member under the JTYPE_OBJECT */
+
 	/*
 	 * firewall - validate set member (must be a valid JTYPE_MEMBER with non-NULL
 	 */
@@ -1927,6 +1947,33 @@ json_sem_find(struct json *node, unsigned int depth, struct json_sem *sem)
 }
 
 
+/*
+ * sem_index_walk - index the members of a JSON object before the semantic check
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *	depth	current tree depth (0 ==> top of tree)
+ *	ap	variable argument list, no ap args are used
+ *
+ * The validate functions of a JSON semantic table only get a const parse
+ * tree, so json_object_get() finds members of large objects in the index
+ * built here.
+ *
+ * NOTE: This function does nothing if node is not a JTYPE_OBJECT.
+ */
+static void
+sem_index_walk(struct json *node, unsigned int depth, va_list ap)
+{
+    UNUSED_ARG(depth);
+    UNUSED_ARG(ap);
+
+    if (node != NULL && node->type == JTYPE_OBJECT) {
+	(void) json_object_index_build(node);
+    }
+    return;
+}
+
+
 /*
  * sem_walk - JSON parse tree semantic tree check walk
  *
@@ -2239,6 +2286,11 @@ json_sem_check(struct json *node, unsigned int max_depth, struct json_sem *sem,
      */
     json_sem_zero_count(sem);
 
+    /*
+     * index the members of large objects for sem_object_find_name()
+     */
+    json_tree_walk(node, max_depth, 0, false, sem_index_walk);
+
     /*
      * perform a semantic scan of the JSON parse tree
      */
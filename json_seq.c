@@ -0,0 +1,523 @@
+/*
+ * json_seq - parse a stream of JSON texts one record at a time
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * json_seq - parse a stream of JSON texts one record at a time
+ */
+#include "json_seq.h"
+
+
+/*
+ * struct seq_state - what parse_json_seq_ctx() and parse_json_seq_stream_ctx() keep between records
+ */
+struct seq_state
+{
+    struct jparse_ctx *ctx;		/* parser context used for every record */
+    char const *filename;		/* name to report errors with */
+    char delim;				/* byte that separates records */
+    bool (*callback)(struct json *, struct json_seq_record const *, void *);	/* called for each record or NULL */
+    void *arg;				/* passed to callback */
+    struct json_seq_record rec;		/* record being parsed */
+    uintmax_t offset;			/* offset of the data not yet split into records */
+    uintmax_t line;			/* line of the data not yet split into records */
+    bool stop;				/* true ==> callback asked to stop */
+    bool all_valid;			/* true ==> every record so far is valid JSON */
+};
+
+
+/*
+ * static functions
+ */
+static bool seq_begin(struct seq_state *st, struct jparse_ctx *ctx, char const *filename, enum json_seq_mode mode,
+		      bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg);
+static bool seq_blank(char const *ptr, size_t len);
+static uintmax_t seq_lines(char const *ptr, size_t len);
+static void seq_record(struct seq_state *st, char *inplace);
+static size_t seq_split(struct seq_state *st, char const *ptr, char *inplace, size_t len, bool final);
+
+
+/*
+ * seq_begin - set up the state of a JSON text sequence parse
+ *
+ * given:
+ *	st	    state to set up
+ *	ctx	    parser context to parse every record with
+ *	filename    name to report errors with or NULL for stdin
+ *	mode	    how the records are delimited
+ *	callback    function to give each record to or NULL
+ *	arg	    passed to callback
+ *
+ * returns:
+ *	true ==> st is set up, false ==> mode is not valid (a warning was issued)
+ */
+static bool
+seq_begin(struct seq_state *st, struct jparse_ctx *ctx, char const *filename, enum json_seq_mode mode,
+	  bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg)
+{
+    memset(st, 0, sizeof(*st));
+    switch (mode) {
+    case JSON_SEQ_LINES:
+	st->delim = '\n';
+	break;
+    case JSON_SEQ_RS:
+	st->delim = JSON_SEQ_RS_BYTE;
+	break;
+    default:
+	werr(86, __func__, "invalid JSON text sequence mode: %d", (int)mode);
+	return false;
+    }
+    st->ctx = ctx;
+    st->filename = filename;
+    st->callback = callback;
+    st->arg = arg;
+    st->line = 1;
+    st->all_valid = true;
+    return true;
+}
+
+
+/*
+ * seq_blank - determine if a record holds nothing but whitespace
+ *
+ * given:
+ *	ptr	    text of the record
+ *	len	    length of the text
+ *
+ * returns:
+ *	true ==> the record is blank and is skipped, false ==> it is parsed
+ */
+static bool
+seq_blank(char const *ptr, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+	if (ptr[i] != ' ' && ptr[i] != '\t' && ptr[i] != '\r' && ptr[i] != '\n') {
+	    return false;
+	}
+    }
+    return true;
+}
+
+
+/*
+ * seq_lines - count the newlines in a record
+ *
+ * given:
+ *	ptr	    text of the record
+ *	len	    length of the text
+ *
+ * returns:
+ *	number of newlines in the text
+ */
+static uintmax_t
+seq_lines(char const *ptr, size_t len)
+{
+    char const *end = ptr + len;	/* end of the text */
+    uintmax_t lines = 0;		/* newlines found */
+
+    while (ptr < end && (ptr = memchr(ptr, '\n', (size_t)(end - ptr))) != NULL) {
+	++lines;
+	++ptr;
+    }
+    return lines;
+}
+
+
+/*
+ * seq_record - parse a record and give it to the callback
+ *
+ * given:
+ *	st	    sequence state with st->rec set to the record
+ *	inplace	    st->rec.ptr if it may be written to, including the
+ *		    JPARSE_PADDING bytes after it, else NULL
+ *
+ * A blank record is skipped.  A record that may be written to is parsed with
+ * parse_json_inplace_ctx(): the bytes after the record are set to NUL for the
+ * parse and then put back, so the flex scanner need not copy the record.
+ */
+static void
+seq_record(struct seq_state *st, char *inplace)
+{
+    struct json *tree = NULL;		/* parse tree of the record */
+    char save[JPARSE_PADDING];		/* bytes replaced by the padding */
+
+    if (seq_blank(st->rec.ptr, st->rec.len)) {
+	return;
+    }
+    ++st->rec.number;
+
+    /*
+     * parse the record with the context kept from the record before
+     */
+    if (inplace != NULL) {
+	memcpy(save, inplace + st->rec.len, sizeof(save));
+	memset(inplace + st->rec.len, 0, sizeof(save));
+	tree = parse_json_inplace_ctx(st->ctx, inplace, st->rec.len, st->filename, &st->rec.is_valid);
+	memcpy(inplace + st->rec.len, save, sizeof(save));
+    } else {
+	tree = parse_json_ctx(st->ctx, st->rec.ptr, st->rec.len, st->filename, &st->rec.is_valid);
+    }
+
+    /*
+     * as with parse_json_stream(), a NUL byte makes the record invalid
+     */
+    if (st->rec.is_valid && st->ctx->nul_seen) {
+	werr(87, __func__, "NUL byte detected in record %ju: data is NOT valid JSON", st->rec.number);
+	if (tree != NULL) {
+	    json_tree_release(tree);
+	}
+	tree = json_alloc(JTYPE_UNSET);
+	st->rec.is_valid = false;
+    }
+    if (!st->rec.is_valid) {
+	st->all_valid = false;
+    }
+
+    /*
+     * give the record to the callback, or free it if there is none
+     */
+    if (st->callback != NULL) {
+	st->stop = !st->callback(tree, &st->rec, st->arg);
+    } else if (tree != NULL) {
+	json_tree_release(tree);
+    }
+    return;
+}
+
+
+/*
+ * seq_split - parse the complete records of a block of data
+ *
+ * given:
+ *	st	    sequence state
+ *	ptr	    data that follows what has already been split into records
+ *	inplace	    ptr if the data may be written to, including the
+ *		    JPARSE_PADDING bytes after it, else NULL
+ *	len	    length of the data
+ *	final	    true ==> the data ends the input, so the text after the
+ *		    last delimiter is a record too
+ *
+ * returns:
+ *	bytes of data split into records
+ *
+ * NOTE: splitting stops early if the callback asks to stop.
+ */
+static size_t
+seq_split(struct seq_state *st, char const *ptr, char *inplace, size_t len, bool final)
+{
+    char const *end = NULL;		/* delimiter that ends the record */
+    size_t start = 0;			/* start of the record in ptr */
+    size_t reclen = 0;			/* length of the record */
+
+    while (!st->stop && start < len) {
+
+	/*
+	 * find the end of the record
+	 */
+	end = memchr(ptr + start, st->delim, len - start);
+	if (end != NULL) {
+	    reclen = (size_t)(end - (ptr + start));
+	} else if (final) {
+	    reclen = len - start;
+	} else {
+	    break;
+	}
+
+	/*
+	 * parse the record
+	 */
+	st->rec.ptr = ptr + start;
+	st->rec.len = reclen;
+	st->rec.offset = st->offset + start;
+	st->rec.line = st->line;
+	seq_record(st, inplace != NULL ? inplace + start : NULL);
+
+	/*
+	 * move past the record and its delimiter
+	 */
+	if (st->delim == '\n') {
+	    st->line += (end != NULL);
+	} else {
+	    st->line += seq_lines(ptr + start, reclen);
+	}
+	start += reclen + (end != NULL);
+    }
+    st->offset += start;
+    return start;
+}
+
+
+/*
+ * parse_json_seq_ctx - parse each record of a JSON text sequence
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	ptr	    - pointer to start of the sequence
+ *	len	    - length of the sequence
+ *	filename    - filename or NULL for stdin
+ *	mode	    - JSON_SEQ_LINES: one JSON text per line (NDJSON / JSON Lines)
+ *		      JSON_SEQ_RS: each JSON text starts with a RS byte (RFC 7464)
+ *	callback    - called with the parse tree and record of each record that
+ *		      is not blank, returning false to stop, or NULL
+ *	arg	    - passed to callback
+ *	all_valid   - non-NULL pointer to boolean to set to true if every record
+ *		      is valid JSON
+ *
+ * returns:
+ *	number of records parsed
+ *
+ * Each record is parsed with parse_json_ctx(), so the scanner and the parse
+ * stack of ctx are set up once for all of the records.  The callback owns the
+ * parse tree it is given and must free it with json_tree_release().  Records
+ * that hold nothing but whitespace are skipped.  Syntax error locations are
+ * within the record: the callback is given the line and byte offset of the
+ * record in the sequence.
+ *
+ * NOTE: as with parse_json_stream(), a NUL byte in a string makes a record
+ *	 invalid.
+ *
+ * NOTE: this function does not return on NULL ctx or all_valid.
+ */
+uintmax_t
+parse_json_seq_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename, enum json_seq_mode mode,
+		   bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+		   bool *all_valid)
+{
+    struct seq_state st;		/* sequence state */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(88, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (all_valid == NULL) {
+	err(89, __func__, "all_valid is NULL");
+	not_reached();
+    }
+    *all_valid = false;
+    if (ptr == NULL) {
+	werr(90, __func__, "ptr is NULL");
+	return 0;
+    }
+    if (!seq_begin(&st, ctx, filename, mode, callback, arg)) {
+	return 0;
+    }
+
+    /*
+     * parse the records
+     */
+    (void) seq_split(&st, ptr, NULL, len, true);
+    *all_valid = st.all_valid;
+    return st.rec.number;
+}
+
+
+/*
+ * parse_json_seq - parse each record of a JSON text sequence
+ *
+ * given:
+ *	ptr	    - pointer to start of the sequence
+ *	len	    - length of the sequence
+ *	filename    - filename or NULL for stdin
+ *	mode	    - how the records are delimited, see parse_json_seq_ctx()
+ *	callback    - called with each record, see parse_json_seq_ctx()
+ *	arg	    - passed to callback
+ *	all_valid   - non-NULL pointer to boolean to set to true if every record
+ *		      is valid JSON
+ *
+ * returns:
+ *	number of records parsed
+ *
+ * This is parse_json_seq_ctx() with a context that lasts for just this call.
+ */
+uintmax_t
+parse_json_seq(char const *ptr, size_t len, char const *filename, enum json_seq_mode mode,
+	       bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+	       bool *all_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    uintmax_t count = 0;		/* number of records parsed */
+
+    jparse_ctx_init(&ctx);
+    count = parse_json_seq_ctx(&ctx, ptr, len, filename, mode, callback, arg, all_valid);
+    jparse_ctx_fini(&ctx);
+    return count;
+}
+
+
+/*
+ * parse_json_seq_stream_ctx - parse each record of a JSON text sequence read from a stream
+ *
+ * given:
+ *	ctx	    - parser context from jparse_ctx_create() or jparse_ctx_init()
+ *	stream	    - open file stream to read the sequence from
+ *	filename    - filename or NULL for stdin
+ *	mode	    - how the records are delimited, see parse_json_seq_ctx()
+ *	callback    - called with each record, see parse_json_seq_ctx()
+ *	arg	    - passed to callback
+ *	all_valid   - non-NULL pointer to boolean to set to true if every record
+ *		      is valid JSON
+ *
+ * returns:
+ *	number of records parsed
+ *
+ * The stream is read JSON_SEQ_READ bytes at a time into a buffer that only
+ * grows if a record does not fit, so the memory used depends on the longest
+ * record and not on the size of the stream.  Each record is parsed in the
+ * buffer, where it is, with parse_json_inplace_ctx().
+ *
+ * NOTE: unlike parse_json_stream(), the stream is not closed.
+ *
+ * NOTE: this function does not return on NULL ctx or all_valid or on
+ *	 allocation failure.
+ */
+uintmax_t
+parse_json_seq_stream_ctx(struct jparse_ctx *ctx, FILE *stream, char const *filename, enum json_seq_mode mode,
+			  bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+			  bool *all_valid)
+{
+    struct seq_state st;		/* sequence state */
+    char *buf = NULL;			/* read buffer followed by JPARSE_PADDING bytes */
+    size_t size = JSON_SEQ_READ;	/* size of buf not counting the padding */
+    size_t have = 0;			/* bytes in buf not yet split into records */
+    size_t got = 0;			/* bytes read */
+    size_t used = 0;			/* bytes split into records */
+
+    /*
+     * firewall
+     */
+    if (ctx == NULL) {
+	err(91, __func__, "ctx is NULL");
+	not_reached();
+    }
+    if (all_valid == NULL) {
+	err(92, __func__, "all_valid is NULL");
+	not_reached();
+    }
+    *all_valid = false;
+    if (stream == NULL) {
+	werr(93, __func__, "stream is NULL");
+	return 0;
+    }
+    if (!seq_begin(&st, ctx, filename, mode, callback, arg)) {
+	return 0;
+    }
+    errno = 0;		/* pre-clear errno for errp() */
+    buf = malloc(size + JPARSE_PADDING);
+    if (buf == NULL) {
+	errp(94, __func__, "malloc of %ju bytes failed", (uintmax_t)(size + JPARSE_PADDING));
+	not_reached();
+    }
+
+    /*
+     * read the stream and parse the records as they are completed
+     */
+    do {
+	/*
+	 * make room for a record longer than the buffer
+	 */
+	if (have == size) {
+	    size *= 2;
+	    errno = 0;		/* pre-clear errno for errp() */
+	    buf = realloc(buf, size + JPARSE_PADDING);
+	    if (buf == NULL) {
+		errp(95, __func__, "realloc of %ju bytes failed", (uintmax_t)(size + JPARSE_PADDING));
+		not_reached();
+	    }
+	}
+
+	/*
+	 * read more and parse what it completes, keeping the rest
+	 */
+	errno = 0;		/* pre-clear errno for werrp() */
+	got = fread(buf + have, 1, size - have, stream);
+	if (got == 0 && ferror(stream)) {
+	    werrp(96, __func__, "error reading %s", filename != NULL ? filename : "-");
+	    st.all_valid = false;
+	    break;
+	}
+	have += got;
+	used = seq_split(&st, buf, buf, have, got == 0);
+	if (used > 0) {
+	    memmove(buf, buf + used, have - used);
+	    have -= used;
+	}
+    } while (got > 0 && !st.stop);
+    free(buf);
+    buf = NULL;
+
+    *all_valid = st.all_valid;
+    return st.rec.number;
+}
+
+
+/*
+ * parse_json_seq_stream - parse each record of a JSON text sequence read from a stream
+ *
+ * given:
+ *	stream	    - open file stream to read the sequence from
+ *	filename    - filename or NULL for stdin
+ *	mode	    - how the records are delimited, see parse_json_seq_ctx()
+ *	callback    - called with each record, see parse_json_seq_ctx()
+ *	arg	    - passed to callback
+ *	all_valid   - non-NULL pointer to boolean to set to true if every record
+ *		      is valid JSON
+ *
+ * returns:
+ *	number of records parsed
+ *
+ * This is parse_json_seq_stream_ctx() with a context that lasts for just this
+ * call.
+ */
+uintmax_t
+parse_json_seq_stream(FILE *stream, char const *filename, enum json_seq_mode mode,
+		      bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+		      bool *all_valid)
+{
+    struct jparse_ctx ctx;		/* parser context for this call */
+    uintmax_t count = 0;		/* number of records parsed */
+
+    jparse_ctx_init(&ctx);
+    count = parse_json_seq_stream_ctx(&ctx, stream, filename, mode, callback, arg, all_valid);
+    jparse_ctx_fini(&ctx);
+    return count;
+}
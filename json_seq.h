@@ -0,0 +1,87 @@
+/*
+ * json_seq - parse a stream of JSON texts one record at a time
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_SEQ_H)
+#    define  INCLUDE_JSON_SEQ_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * json_parse - JSON parser support code
+ */
+#include "json_parse.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_SEQ_RS_BYTE (0x1e)	/* RFC 7464 record separator */
+#define JSON_SEQ_READ (65536)		/* initial size of the parse_json_seq_stream() read buffer */
+
+
+/*
+ * how the records of a JSON text sequence are delimited
+ */
+enum json_seq_mode
+{
+    JSON_SEQ_LINES = 0,		/* NDJSON / JSON Lines: one JSON text per line */
+    JSON_SEQ_RS = 1,		/* RFC 7464: each JSON text starts with a RS (0x1e) byte */
+};
+
+/*
+ * struct json_seq_record - a record of a JSON text sequence given to the callback
+ */
+struct json_seq_record
+{
+    uintmax_t number;		/* record number, 1 for the first record that is not blank */
+    uintmax_t line;		/* line of the input the record starts on */
+    uintmax_t offset;		/* byte offset of the record in the input */
+    char const *ptr;		/* text of the record, only valid until the callback returns */
+    size_t len;			/* length of the text of the record */
+    bool is_valid;		/* true ==> the record is valid JSON */
+};
+
+struct jparse_ctx;
+
+
+/*
+ * external function declarations
+ */
+extern uintmax_t parse_json_seq_ctx(struct jparse_ctx *ctx, char const *ptr, size_t len, char const *filename,
+				    enum json_seq_mode mode,
+				    bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+				    bool *all_valid);
+extern uintmax_t parse_json_seq(char const *ptr, size_t len, char const *filename, enum json_seq_mode mode,
+				bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+				bool *all_valid);
+extern uintmax_t parse_json_seq_stream_ctx(struct jparse_ctx *ctx, FILE *stream, char const *filename,
+					   enum json_seq_mode mode,
+					   bool (*callback)(struct json *, struct json_seq_record const *, void *),
+					   void *arg, bool *all_valid);
+extern uintmax_t parse_json_seq_stream(FILE *stream, char const *filename, enum json_seq_mode mode,
+				       bool (*callback)(struct json *, struct json_seq_record const *, void *), void *arg,
+				       bool *all_valid);
+
+
+#endif /* INCLUDE_JSON_SEQ_H */
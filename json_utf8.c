@@ -22,6 +22,63 @@
 #include <ctype.h>
 #include "json_utf8.h"
 
+/*
+ * hexdigit - the value of a hex digit, or 0xff if the byte is not one
+ */
+static uint8_t const hexdigit[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x00 - \x0f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x10 - \x1f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x20 - \x2f */
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* 0 - 9 */
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* A - F */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x50 - \x5f */
+    0xff, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* a - f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x70 - \x7f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x80 - \x8f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \x90 - \x9f */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \xa0 - \xaf */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \xb0 - \xbf */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \xc0 - \xcf */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \xd0 - \xdf */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* \xe0 - \xef */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff  /* \xf0 - \xff */
+};
+
+
+/*
+ * hex4_to_unicode - convert the four hex digits of a \uxxxx to a code point
+ *
+ * given:
+ *	str	    the four hex digits after the \u
+ *
+ * returns:
+ *	the value of the four hex digits, 0 to 0xFFFF, or
+ *	UNICODE_NOT_HEX if one of the four bytes is not a hex digit
+ *
+ * The digits are looked up in a table: no sscanf(3) is needed.  The bytes
+ * are looked at in order, and none after a byte that is not a hex digit (such
+ * as a NUL) is looked at.
+ *
+ * NOTE: str must not be NULL.
+ */
+int32_t
+hex4_to_unicode(char const *str)
+{
+    int32_t x = 0;	/* value of the hex digits so far */
+    uint8_t d;		/* value of a hex digit */
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+	d = hexdigit[(uint8_t)str[i]];
+	if (d > 0x0f) {
+	    return UNICODE_NOT_HEX;
+	}
+	x = (x << 4) | d;
+    }
+    return x;
+}
+
+
 /*
  * count_utf8_bytes	- count bytes needed to encode/decode in str
  *
@@ -32,61 +89,26 @@
  *	bytes	    pointer to the number of bytes
  *
  * NOTE: If str is NULL we use the value in surrogate; otherwise we attempt to
- * extract the value by parsing the string as %4x and then, assuming we extract
- * a value, we count the number of bytes required for the string. It is this
- * value that is returned.
+ * extract the value from the \uxxxx that str starts with and then, assuming
+ * we extract a value, we count the number of bytes required for the string.
+ * It is this value that is returned.
  *
  * NOTE: *str should point to the \u!
  */
 size_t
 utf8len(const char *str, int32_t surrogate)
 {
-    unsigned char xa = 0;   /* first hex digit */
-    unsigned char xb = 0;   /* second hex digit */
-    unsigned char xc = 0;   /* third hex digit */
-    unsigned char xd = 0;   /* fourth hex digit */
-    unsigned int x = 0;	    /* the hex value we attempt to extract */
+    int32_t x = 0;	    /* the hex value we attempt to extract */
     size_t len = 0;	    /* the number of bytes to return */
-    int scanned = 0;	    /* how many values read */
 
     if (str == NULL) {
 	x = surrogate;
-	if (x < 0x80) {
-	    len = 1;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x800) {
-	    len = 2;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x10000) {
-	    len = 3;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x110000) {
-	    len = 4;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else {
-	    warn(__func__, "%X: illegal value\n", x);
-	    len = -1;
-	}
-
-	return len;
-    }
-
-    /*
-     * if we get here we know str != NULL
-     */
-    scanned = sscanf(str, "\\u%c%c%c%c", &xa, &xb, &xc, &xd);
-    if (scanned != 4) {
-	warn(__func__, "did not find \\u followed by four HEX digits: %ju values: <%s>: %x %x %x %x", scanned, str,
-		xa, xb, xc, xd);
-	len = -1;
-
-	return len;
     } else {
 	/*
-	 * extra sanity check
+	 * if we get here we know str != NULL
 	 */
-	if (!isxdigit(xa) || !isxdigit(xb) || !isxdigit(xc) || !isxdigit(xd)) {
-	    warn(__func__, "sscanf() found \\uxxxx but not all values are hex digits!");
+	if (str[0] != '\\' || str[1] != 'u' || (x = hex4_to_unicode(str + 2)) < 0) {
+	    warn(__func__, "did not find \\u followed by four HEX digits: <%s>", str);
 	    len = -1;
 
 	    return len;
@@ -94,38 +116,27 @@ utf8len(const char *str, int32_t surrogate)
     }
 
     /*
-     * we have to perform additional checks
+     * now that we have a SINGLE HEX number, we need to check the number of
+     * bytes required, setting it in len.
      */
-
-    /*
-     * now that we know that there is a \u followed by FOUR HEX digits we can
-     * try and extract it as a SINGLE HEX number
-     */
-    scanned = sscanf(str, "\\u%4x", &x);
-    if (scanned != 1) {
-	err(10, __func__, "found \\uxxxx but NOT a hex value!");
-	not_reached();
+    if (x < 0) {
+	warn(__func__, "%X: illegal value\n", (unsigned int)x);
+	len = -1;
+    } else if (x < 0x80) {
+	len = 1;
+	dbg(DBG_VVHIGH, "%X length %d", x, len);
+    } else if (x < 0x800) {
+	len = 2;
+	dbg(DBG_VVHIGH, "%X length %d", x, len);
+    } else if (x < 0x10000) {
+	len = 3;
+	dbg(DBG_VVHIGH, "%X length %d", x, len);
+    } else if (x < 0x110000) {
+	len = 4;
+	dbg(DBG_VVHIGH, "%X length %d", x, len);
     } else {
-	/*
-	 * now that we have a SINGLE HEX number, we need to check the number of
-	 * bytes required, setting it in len.
-	 */
-	if (x < 0x80) {
-	    len = 1;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x800) {
-	    len = 2;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x10000) {
-	    len = 3;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else if (x < 0x110000) {
-	    len = 4;
-	    dbg(DBG_VVHIGH, "%X length %d", x, len);
-	} else {
-	    warn(__func__, "%X: illegal value\n", x);
-	    len = -1;
-	}
+	warn(__func__, "%X: illegal value\n", x);
+	len = -1;
     }
 
     return len;
@@ -36,10 +36,11 @@
 /*
  * official jparse UTF-8 version
  */
-#define JPARSE_UTF8_VERSION "2.0.3 2024-11-07"	/* format: major.minor YYYY-MM-DD */
+#define JPARSE_UTF8_VERSION "2.0.4 2026-10-17"	/* format: major.minor YYYY-MM-DD */
 
 
 extern size_t utf8len(const char *str, int32_t surrogate);
+extern int32_t hex4_to_unicode(char const *str);
 
 /*
  * The below function and macros are based on code from
@@ -107,6 +108,12 @@ extern int utf8encode(char *str, unsigned int val);
  */
 #define UNICODE_TOO_BIG -7
 
+/*
+ * This return value means that one of the four bytes after a \u was not a hex
+ * digit.
+ */
+#define UNICODE_NOT_HEX -8
+
 extern int32_t surrogates_to_unicode (int32_t hi, int32_t lo);
 
 
@@ -26,6 +26,8 @@
 #include <stdint.h>
 #include <limits.h>
 #include <ctype.h>
+#include <locale.h>
+#include <stdatomic.h>
 
 /*
  * dbg - info, debug, warning, error, and usage message facility
@@ -46,6 +48,11 @@
  */
 #include "json_util.h"
 
+/*
+ * json_write - write JSON parse trees as JSON text
+ */
+#include "json_write.h"
+
 
 /*
  * global variables
@@ -98,6 +105,12 @@ int const hexval[JSON_BYTE_VALUES] = {
  * static declarations
  */
 static void fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, char *poststr);
+static bool json_fprintf_value(FILE *stream, char const *lead, char const *name, char const *middle, char const *value,
+			       size_t len, char const *tail);
+static locale_t json_c_locale(void);
+static locale_t json_c_locale_use(void);
+static void json_c_locale_restore(locale_t old);
+static struct json *json_tree_pop_child(struct json *node);
 
 
 
@@ -407,8 +420,9 @@ json_putc(uint8_t const c, FILE *stream)
 bool
 json_fprintf_str(FILE *stream, char const *str)
 {
-    int ret;			/* libc function return */
-    char const *p;
+    char storage[JSON_FPRINTF_BUF];	/* where the text is gathered */
+    struct json_buf out;		/* what is to be printed on stream */
+    bool ret = false;			/* true ==> the text was gathered */
 
     /*
      * firewall
@@ -419,45 +433,57 @@ json_fprintf_str(FILE *stream, char const *str)
     }
 
     /*
-     * case: NULL
-     */
-    if (str == NULL) {
-	errno = 0;			/* pre-clear errno for warnp() */
-	ret = fprintf(stream, "null");
-	if (chk_stdio_printf_err(stream, ret)) {
-	    warnp(__func__, "fprintf #0 error for null");
-	    return false;
-	}
-	return true;
-    }
-
-    /*
-     * print leading double-quote
+     * print str JSON decoded between double-quotes, or null
      */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fputc('"', stream);
-    if (ret == EOF) {
-	warnp(__func__, "fputc #0 error for leading double-quote");
+    json_buf_init_stream(&out, stream);
+    json_buf_set_storage(&out, storage, sizeof(storage));
+    ret = json_buf_write_str(&out, str);
+    if (!json_buf_fini(&out) || !ret) {
+	warn(__func__, "error printing JSON string");
 	return false;
     }
+    return true;
+}
 
-    /*
-     * print name, JSON decoded
-     */
-    for (p=str; *p != '\0'; ++p) {
-	if (json_putc((uint8_t const)*p, stream) != true) {
-	    warn(__func__, "json_putc #0 error");
-	    return false;
-	}
-    }
 
-    /*
-     * print trailing double-quote
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fputc('"', stream);
-    if (ret == EOF) {
-	warnp(__func__, "fputc #1 error for trailing double-quote");
+/*
+ * json_fprintf_value - print name value pair with the value as it is
+ *
+ * On a stream, we will print:
+ *
+ *	lead "name_decoded" middle value tail
+ *
+ * given:
+ *	stream	- open file stream to print on
+ *	lead	- leading whitespace string to print
+ *	name	- name string to JSON decode or NULL
+ *	middle	- middle string (often " : " )
+ *	value	- value as it is to be printed
+ *	len	- length of value
+ *	tail	- tailing string to print (often ",\n")
+ *
+ * returns:
+ *	true ==> stream print was OK,
+ *	false ==> error printing to stream
+ *
+ * The whole line is gathered and then printed with one fwrite(3).
+ */
+static bool
+json_fprintf_value(FILE *stream, char const *lead, char const *name, char const *middle, char const *value,
+		   size_t len, char const *tail)
+{
+    char storage[JSON_FPRINTF_BUF];	/* where the text is gathered */
+    struct json_buf out;		/* what is to be printed on stream */
+    bool ret = false;			/* true ==> the text was gathered */
+
+    json_buf_init_stream(&out, stream);
+    json_buf_set_storage(&out, storage, sizeof(storage));
+    ret = json_buf_write(&out, lead, strlen(lead)) &&
+	  json_buf_write_str(&out, name) &&
+	  json_buf_write(&out, middle, strlen(middle)) &&
+	  json_buf_write(&out, value, len) &&
+	  json_buf_write(&out, tail, strlen(tail));
+    if (!json_buf_fini(&out) || !ret) {
 	return false;
     }
     return true;
@@ -492,7 +518,9 @@ bool
 json_fprintf_value_string(FILE *stream, char const *lead, char const *name, char const *middle, char const *value,
 			  char const *tail)
 {
-    int ret;			/* libc function return */
+    char storage[JSON_FPRINTF_BUF];	/* where the text is gathered */
+    struct json_buf out;		/* what is to be printed on stream */
+    bool ret = false;			/* true ==> the text was gathered */
 
     /*
      * firewall
@@ -503,48 +531,17 @@ json_fprintf_value_string(FILE *stream, char const *lead, char const *name, char
     }
 
     /*
-     * print leading string
+     * print lead, name and middle, the value as a JSON decoded string and tail
      */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", lead);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing lead");
-	return false;
-    }
-
-    /*
-     * print name as a JSON decoded string
-     */
-    if (json_fprintf_str(stream, name) != true) {
-	warn(__func__, "json_fprintf_str error printing name");
-	return false;
-    }
-
-    /*
-     * print middle string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", middle);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing middle");
-	return false;
-    }
-
-    /*
-     * print value as a JSON decoded string
-     */
-    if (json_fprintf_str(stream, value) != true) {
-	warn(__func__, "json_fprintf_str for value as a string");
-	return false;
-    }
-
-    /*
-     * print trailing string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", tail);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing end of line");
+    json_buf_init_stream(&out, stream);
+    json_buf_set_storage(&out, storage, sizeof(storage));
+    ret = json_buf_write(&out, lead, strlen(lead)) &&
+	  json_buf_write_str(&out, name) &&
+	  json_buf_write(&out, middle, strlen(middle)) &&
+	  json_buf_write_str(&out, value) &&
+	  json_buf_write(&out, tail, strlen(tail));
+    if (!json_buf_fini(&out) || !ret) {
+	warn(__func__, "error printing name and value as a string");
 	return false;
     }
     return true;
@@ -579,7 +576,8 @@ bool
 json_fprintf_value_long(FILE *stream, char const *lead, char const *name, char const *middle, long value,
 			char const *tail)
 {
-    int ret;			/* libc function return */
+    char text[sizeof(long) * 3 + 2];	/* value as a JSON long */
+    int len;				/* length of text */
 
     /*
      * firewall
@@ -590,50 +588,15 @@ json_fprintf_value_long(FILE *stream, char const *lead, char const *name, char c
     }
 
     /*
-     * print leading string
+     * print the value as a JSON long
      */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", lead);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing lead");
+    len = snprintf(text, sizeof(text), "%ld", value);
+    if (len <= 0 || (size_t)len >= sizeof(text)) {
+	warn(__func__, "snprintf of value as a long failed");
 	return false;
     }
-
-    /*
-     * print name as a JSON decoded string
-     */
-    if (json_fprintf_str(stream, name) != true) {
-	warnp(__func__, "json_fprintf_str error printing name");
-	return false;
-    }
-
-    /*
-     * print middle string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", middle);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing middle");
-	return false;
-    }
-
-    /*
-     * print value as a JSON long
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%ld", value);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf for value as a long");
-	return false;
-    }
-
-    /*
-     * print trailing string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", tail);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing end of line");
+    if (json_fprintf_value(stream, lead, name, middle, text, (size_t)len, tail) != true) {
+	warn(__func__, "error printing name and value as a long");
 	return false;
     }
     return true;
@@ -668,7 +631,8 @@ bool
 json_fprintf_value_time_t(FILE *stream, char const *lead, char const *name, char const *middle, time_t value,
 			  char const *tail)
 {
-    int ret;			/* libc function return */
+    char text[sizeof(uintmax_t) * 3 + 2];   /* value as a JSON time_t */
+    int len;				    /* length of text */
 
     /*
      * firewall
@@ -679,56 +643,21 @@ json_fprintf_value_time_t(FILE *stream, char const *lead, char const *name, char
     }
 
     /*
-     * print leading string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", lead);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing lead");
-	return false;
-    }
-
-    /*
-     * print name as a JSON decoded string
-     */
-    if (json_fprintf_str(stream, name) != true) {
-	warnp(__func__, "json_fprintf_str error printing name");
-	return false;
-    }
-
-    /*
-     * print middle string
+     * print the value as a JSON time_t
      */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", middle);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing middle");
-	return false;
-    }
-
-    /*
-     * print value as a JSON time_t
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
     if ((time_t)-1 > 0) {
 	/* case: unsigned time_t */
-	ret = fprintf(stream, "%ju", (uintmax_t)value);
+	len = snprintf(text, sizeof(text), "%ju", (uintmax_t)value);
     } else {
 	/* case: signed time_t */
-	ret = fprintf(stream, "%jd", (intmax_t)value);
+	len = snprintf(text, sizeof(text), "%jd", (intmax_t)value);
     }
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf for value as a time_t");
+    if (len <= 0 || (size_t)len >= sizeof(text)) {
+	warn(__func__, "snprintf of value as a time_t failed");
 	return false;
     }
-
-    /*
-     * print trailing string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", tail);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing end of line");
+    if (json_fprintf_value(stream, lead, name, middle, text, (size_t)len, tail) != true) {
+	warn(__func__, "error printing name and value as a time_t");
 	return false;
     }
     return true;
@@ -760,7 +689,7 @@ bool
 json_fprintf_value_bool(FILE *stream, char const *lead, char const *name, char const *middle, bool value,
 			char const *tail)
 {
-    int ret;			/* libc function return */
+    char const *text = booltostr(value);    /* value as a JSON boolean */
 
     /*
      * firewall
@@ -771,53 +700,190 @@ json_fprintf_value_bool(FILE *stream, char const *lead, char const *name, char c
     }
 
     /*
-     * print leading string
+     * print the value as a JSON boolean
      */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", lead);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing lead");
+    if (json_fprintf_value(stream, lead, name, middle, text, strlen(text), tail) != true) {
+	warn(__func__, "error printing name and value as a boolean");
 	return false;
     }
+    return true;
+}
 
-    /*
-     * print name as a JSON decoded string
-     */
-    if (json_fprintf_str(stream, name) != true) {
-	warn(__func__, "json_fprintf_str error printing name");
-	return false;
-    }
 
-    /*
-     * print middle string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", middle);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing middle");
-	return false;
+/*
+ * json_c_locale - return the "C" locale that JSON numbers are converted in
+ *
+ * returns:
+ *	the "C" locale, or (locale_t)0 if it could not be made
+ *
+ * JSON numbers always use a '.' for the decimal point, whatever LC_NUMERIC
+ * the program has set with setlocale(3), so they are converted to and from
+ * text in the "C" locale.  It is made on first use and kept for the life of
+ * the process: when two threads make it at the same time, one keeps its own
+ * and the other frees its copy.
+ */
+static locale_t
+json_c_locale(void)
+{
+    static _Atomic(locale_t) c_locale = (locale_t)0;	/* the "C" locale once made */
+    locale_t loc = atomic_load(&c_locale);		/* "C" locale */
+    locale_t none = (locale_t)0;			/* c_locale before it is made */
+
+    if (loc != (locale_t)0) {
+	return loc;
+    }
+    loc = newlocale(LC_ALL_MASK, "C", (locale_t)0);
+    if (loc == (locale_t)0) {
+	warn(__func__, "newlocale of the C locale failed, using the current locale");
+	return loc;
+    }
+    if (!atomic_compare_exchange_strong(&c_locale, &none, loc)) {
+	freelocale(loc);
+	loc = none;
     }
+    return loc;
+}
 
-    /*
-     * print value as a JSON boolean
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", booltostr(value));
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf for value as a boolean");
-	return false;
+
+/*
+ * json_c_locale_use - use the "C" locale in this thread
+ *
+ * returns:
+ *	the locale that was in use by this thread, or (locale_t)0 if it was not changed
+ *
+ * NOTE: errno is left as it was so that the caller may pre-clear it for the
+ *	 conversion that follows.
+ */
+static locale_t
+json_c_locale_use(void)
+{
+    int saved_errno = errno;	/* errno before the locale is changed */
+    locale_t loc = json_c_locale();
+    locale_t old = (locale_t)0;
+
+    if (loc != (locale_t)0) {
+	old = uselocale(loc);
     }
+    errno = saved_errno;
+    return old;
+}
 
-    /*
-     * print trailing string
-     */
-    errno = 0;			/* pre-clear errno for warnp() */
-    ret = fprintf(stream, "%s", tail);
-    if (chk_stdio_printf_err(stream, ret)) {
-	warnp(__func__, "fprintf printing end of line");
-	return false;
+
+/*
+ * json_c_locale_restore - use again the locale json_c_locale_use() replaced
+ *
+ * given:
+ *	old	the locale returned by json_c_locale_use()
+ *
+ * NOTE: errno is left as the conversion before this call set it.
+ */
+static void
+json_c_locale_restore(locale_t old)
+{
+    int saved_errno = errno;	/* errno from the conversion */
+
+    if (old != (locale_t)0) {
+	(void) uselocale(old);
     }
-    return true;
+    errno = saved_errno;
+}
+
+
+/*
+ * json_strtold - convert JSON number text to a long double
+ *
+ * given:
+ *	str	    JSON number text
+ *	endptr	    as for strtold(3)
+ *
+ * returns:
+ *	what strtold(3) returns for str in the "C" locale
+ *
+ * Like strtold(3) but a '.' is the decimal point whatever the locale of the
+ * program.  errno is set as strtold(3) sets it.
+ */
+long double
+json_strtold(char const *str, char **endptr)
+{
+    locale_t old = json_c_locale_use();	/* locale to restore */
+    long double val = strtold(str, endptr);
+
+    json_c_locale_restore(old);
+    return val;
+}
+
+
+/*
+ * json_strtod - convert JSON number text to a double
+ *
+ * given:
+ *	str	    JSON number text
+ *	endptr	    as for strtod(3)
+ *
+ * returns:
+ *	what strtod(3) returns for str in the "C" locale
+ *
+ * Like strtod(3) but a '.' is the decimal point whatever the locale of the
+ * program.  errno is set as strtod(3) sets it.
+ */
+double
+json_strtod(char const *str, char **endptr)
+{
+    locale_t old = json_c_locale_use();	/* locale to restore */
+    double val = strtod(str, endptr);
+
+    json_c_locale_restore(old);
+    return val;
+}
+
+
+/*
+ * json_strtof - convert JSON number text to a float
+ *
+ * given:
+ *	str	    JSON number text
+ *	endptr	    as for strtof(3)
+ *
+ * returns:
+ *	what strtof(3) returns for str in the "C" locale
+ *
+ * Like strtof(3) but a '.' is the decimal point whatever the locale of the
+ * program.  errno is set as strtof(3) sets it.
+ */
+float
+json_strtof(char const *str, char **endptr)
+{
+    locale_t old = json_c_locale_use();	/* locale to restore */
+    float val = strtof(str, endptr);
+
+    json_c_locale_restore(old);
+    return val;
+}
+
+
+/*
+ * json_fmt_double - format a double as JSON number text
+ *
+ * given:
+ *	buf	    where to write the text
+ *	size	    size of buf
+ *	prec	    significant digits, as for %.*g
+ *	value	    finite number to format
+ *
+ * returns:
+ *	what snprintf(3) returns for "%.*g" in the "C" locale
+ *
+ * Like snprintf(buf, size, "%.*g", prec, value) but a '.' is the decimal point
+ * whatever the locale of the program.
+ */
+int
+json_fmt_double(char *buf, size_t size, int prec, double value)
+{
+    locale_t old = json_c_locale_use();	/* locale to restore */
+    int len = snprintf(buf, size, "%.*g", prec, value);
+
+    json_c_locale_restore(old);
+    return len;
 }
 
 
@@ -943,7 +1009,7 @@ json_get_type_str(struct json *node, bool decoded)
     switch (node->type) {
 	case JTYPE_NUMBER:
 	    {
-		struct json_number *item = &(node->item.number);
+		struct json_number *item = json_get_number(node);
 		if (item != NULL && VALID_JSON_NODE(item)) {
 		    str = item->as_str;
 		}
@@ -951,7 +1017,7 @@ json_get_type_str(struct json *node, bool decoded)
 	    break;
 	case JTYPE_STRING:
 	    {
-		struct json_string *item = &(node->item.string);
+		struct json_string *item = json_get_string(node);
 
 		if (item != NULL && CONVERTED_PARSED_JSON_NODE(item)) {
 		    str = decoded ? item->as_str : item->str;
@@ -960,7 +1026,7 @@ json_get_type_str(struct json *node, bool decoded)
 	    break;
 	case JTYPE_BOOL:
 	    {
-		struct json_boolean *item = &(node->item.boolean);
+		struct json_boolean *item = json_get_boolean(node);
 
 		if (item != NULL && CONVERTED_PARSED_JSON_NODE(item)) {
 		    str = item->as_str;
@@ -969,7 +1035,7 @@ json_get_type_str(struct json *node, bool decoded)
 	    break;
 	case JTYPE_NULL:
 	    {
-		struct json_null *item = &(node->item.null);
+		struct json_null *item = json_get_null(node);
 
 		if (item != NULL && CONVERTED_PARSED_JSON_NODE(item)) {
 		    str = item->as_str;
@@ -978,7 +1044,7 @@ json_get_type_str(struct json *node, bool decoded)
 	    break;
 	case JTYPE_MEMBER:
 	    {
-		struct json_member *item = &(node->item.member);
+		struct json_member *item = json_get_member(node);
 
 		if (item != NULL && CONVERTED_PARSED_JSON_NODE(item)) {
 		    str = decoded ? item->name_as_str : item->name_str;
@@ -999,6 +1065,182 @@ json_get_type_str(struct json *node, bool decoded)
     return str;
 }
 
+/*
+ * json_get_number - what a JSON parse tree node of type JTYPE_NUMBER holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_number of node, or
+ *	NULL if node is NULL or is not of type JTYPE_NUMBER
+ */
+struct json_number *
+json_get_number(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_NUMBER) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, number);
+}
+
+/*
+ * json_get_string - what a JSON parse tree node of type JTYPE_STRING holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_string of node, or
+ *	NULL if node is NULL or is not of type JTYPE_STRING
+ */
+struct json_string *
+json_get_string(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_STRING) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, string);
+}
+
+/*
+ * json_get_boolean - what a JSON parse tree node of type JTYPE_BOOL holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_boolean of node, or
+ *	NULL if node is NULL or is not of type JTYPE_BOOL
+ */
+struct json_boolean *
+json_get_boolean(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_BOOL) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, boolean);
+}
+
+/*
+ * json_get_null - what a JSON parse tree node of type JTYPE_NULL holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_null of node, or
+ *	NULL if node is NULL or is not of type JTYPE_NULL
+ */
+struct json_null *
+json_get_null(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_NULL) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, null);
+}
+
+/*
+ * json_get_member - what a JSON parse tree node of type JTYPE_MEMBER holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_member of node, or
+ *	NULL if node is NULL or is not of type JTYPE_MEMBER
+ */
+struct json_member *
+json_get_member(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_MEMBER) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, member);
+}
+
+/*
+ * json_get_object - what a JSON parse tree node of type JTYPE_OBJECT holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_object of node, or
+ *	NULL if node is NULL or is not of type JTYPE_OBJECT
+ */
+struct json_object *
+json_get_object(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_OBJECT) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, object);
+}
+
+/*
+ * json_get_array - what a JSON parse tree node of type JTYPE_ARRAY holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_array of node, or
+ *	NULL if node is NULL or is not of type JTYPE_ARRAY
+ */
+struct json_array *
+json_get_array(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_ARRAY) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, array);
+}
+
+/*
+ * json_get_elements - what a JSON parse tree node of type JTYPE_ELEMENTS holds
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	pointer to the struct json_elements of node, or
+ *	NULL if node is NULL or is not of type JTYPE_ELEMENTS
+ */
+struct json_elements *
+json_get_elements(struct json const *node)
+{
+    /*
+     * firewall
+     */
+    if (node == NULL || node->type != JTYPE_ELEMENTS) {
+	return NULL;
+    }
+    return JSON_NODE_ITEM(node, elements);
+}
+
 
 
 /*
@@ -1086,6 +1328,13 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 	return;
     }
 
+    /*
+     * a node in an arena is freed with the arena, see json_arena_reset()
+     */
+    if (node->arena) {
+	return;
+    }
+
     /*
      * free internals based in node type
      */
@@ -1099,13 +1348,17 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_NUMBER:	/* JSON item is number - see struct json_number */
 	{
-	    struct json_number *item = &(node->item.number);
+	    struct json_number *item = json_get_number(node);
 
 	    /* free internal storage */
 	    if (item->as_str != NULL) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
+	    if (item->value != NULL) {
+		free(item->value);
+		item->value = NULL;
+	    }
 
 	    /* zeroize internal item storage */
 	    memset(item, 0, sizeof(struct json_number));
@@ -1116,17 +1369,17 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_STRING:	/* JSON item is a string - see struct json_string */
 	{
-	    struct json_string *item = &(node->item.string);
+	    struct json_string *item = json_get_string(node);
 
-	    /* free internal storage */
-	    if (item->as_str != NULL) {
+	    /*
+	     * free internal storage: str is in the same allocation as as_str,
+	     * which an interned name shares with its intern table
+	     */
+	    if (item->as_str != NULL && !item->interned) {
 		free(item->as_str);
 		item->as_str = NULL;
 	    }
-	    if (item->str != NULL) {
-		free(item->str);
-		item->str = NULL;
-	    }
+	    item->str = NULL;
 
 	    /* zeroize internal item storage */
 	    memset(item, 0, sizeof(struct json_string));
@@ -1137,13 +1390,9 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_BOOL:	/* JSON item is a boolean - see struct json_boolean */
 	{
-	    struct json_boolean *item = &(node->item.boolean);
+	    struct json_boolean *item = json_get_boolean(node);
 
-	    /* free internal storage */
-	    if (item->as_str != NULL) {
-		free(item->as_str);
-		item->as_str = NULL;
-	    }
+	    /* as_str is a static string: nothing to free */
 
 	    /* zeroize internal item storage */
 	    memset(item, 0, sizeof(struct json_boolean));
@@ -1154,13 +1403,9 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_NULL:	/* JSON item is a null - see struct json_null */
 	{
-	    struct json_null *item = &(node->item.null);
+	    struct json_null *item = json_get_null(node);
 
-	    /* free internal storage */
-	    if (item->as_str != NULL) {
-		free(item->as_str);
-		item->as_str = NULL;
-	    }
+	    /* as_str is a static string: nothing to free */
 
 	    /* zeroize internal item storage */
 	    memset(item, 0, sizeof(struct json_null));
@@ -1171,7 +1416,7 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_MEMBER:	/* JSON item is a member - see struct json_member */
 	{
-	    struct json_member *item = &(node->item.member);
+	    struct json_member *item = json_get_member(node);
 
 	    /* free internal storage */
 	    item->name = NULL;
@@ -1186,14 +1431,18 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_OBJECT:	/* JSON item is { members } - see struct json_object */
 	{
-	    struct json_object *item = &(node->item.object);
+	    struct json_object *item = json_get_object(node);
 
 	    /* free internal storage */
-	    if (item->s != NULL) {
-		dyn_array_free(item->s);
-		item->s = NULL;
+	    if (item->set != NULL) {
+		free(item->set);
 		item->set = NULL;
 		item->len = 0;
+		item->alloc = 0;
+	    }
+	    if (item->index != NULL) {
+		free(item->index);
+		item->index = NULL;
 	    }
 
 	    /* zeroize internal item storage */
@@ -1205,14 +1454,14 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_ARRAY:	/* JSON item is a [ elements ] - see struct json_array */
 	{
-	    struct json_array *item = &(node->item.array);
+	    struct json_array *item = json_get_array(node);
 
 	    /* free internal storage */
-	    if (item->s != NULL) {
-		dyn_array_free(item->s);
-		item->s = NULL;
+	    if (item->set != NULL) {
+		free(item->set);
 		item->set = NULL;
 		item->len = 0;
+		item->alloc = 0;
 	    }
 
 	    /* zeroize internal item storage */
@@ -1224,14 +1473,14 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_ELEMENTS:	/* JSON elements is zero or more JSON values - see struct json_elements */
 	{
-	    struct json_elements *item = &(node->item.elements);
+	    struct json_elements *item = json_get_elements(node);
 
 	    /* free internal storage */
-	    if (item->s != NULL) {
-		dyn_array_free(item->s);
-		item->s = NULL;
+	    if (item->set != NULL) {
+		free(item->set);
 		item->set = NULL;
 		item->len = 0;
+		item->alloc = 0;
 	    }
 
 	    /* zeroize internal item storage */
@@ -1256,11 +1505,70 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 }
 
 
+/*
+ * json_tree_pop_child - take the last child of a JSON parse tree node off it
+ *
+ * given:
+ *	node	pointer to a JSON parser tree node
+ *
+ * returns:
+ *	the last child of node, which node no longer links to, or
+ *	NULL if node has no children left
+ */
+static struct json *
+json_tree_pop_child(struct json *node)
+{
+    struct json *child = NULL;	/* child taken off node */
+
+    switch (node->type) {
+    case JTYPE_MEMBER:
+	{
+	    struct json_member *item = json_get_member(node);
+
+	    if (item->value != NULL) {
+		child = item->value;
+		item->value = NULL;
+	    } else if (item->name != NULL) {
+		child = item->name;
+		item->name = NULL;
+	    }
+	}
+	break;
+    case JTYPE_OBJECT:
+	{
+	    struct json_object *item = json_get_object(node);
+
+	    if (item->set != NULL && item->len > 0) {
+		child = item->set[--item->len];
+	    }
+	}
+	break;
+    case JTYPE_ARRAY:
+    case JTYPE_ELEMENTS:
+	{
+	    /* struct json_elements is identical to struct json_array: see parse_json_array() */
+	    struct json_array *item = JSON_NODE_ITEM(node, array);
+
+	    if (item->set != NULL && item->len > 0) {
+		child = item->set[--item->len];
+	    }
+	}
+	break;
+    default:
+	break;
+    }
+    return child;
+}
+
+
 /*
  * json_tree_free - free storage of a JSON parse tree
  *
- * This function uses the json_tree_walk() interface to walk
- * the JSON parse tree and free all nodes under a given node.
+ * This function frees the internals of a given node and every node under
+ * it, nodes and all.  It does not recurse: it goes down the tree taking each
+ * child off its parent, with the parent link of the child pointing back up,
+ * so that a tree nested as deep as memory allows is freed in constant stack
+ * space.
  *
  * given:
  *	node	    pointer to a JSON parser tree node to free
@@ -1271,8 +1579,10 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
  * NOTE: This function will free the internals of a JSON parser tree node.
  *	 It is up to the caller to free the top level struct json if needed.
  *
- * NOTE: If the pointer to allocated storage == NULL,
- *	 this function does nothing.
+ * NOTE: Nodes deeper than max_depth are not freed.
+ *
+ * NOTE: A tree in an arena is freed with the arena, see json_arena_reset():
+ *	 this function does nothing to it.
  *
  * NOTE: This function does nothing if node == NULL.
  *
@@ -1281,12 +1591,17 @@ vjson_free(struct json *node, unsigned int depth, va_list ap)
 void
 json_tree_free(struct json *node, unsigned int max_depth, ...)
 {
-    va_list ap;		/* variable argument list */
+    va_list ap;			/* variable argument list */
+    struct json *cur = NULL;	/* node being freed */
+    struct json *up = NULL;	/* parent of cur */
+    struct json *child = NULL;	/* child of cur */
+    unsigned int depth = 0;	/* tree depth of cur */
+    bool too_deep = false;	/* true ==> a node deeper than max_depth was not freed */
 
     /*
-     * firewall - nothing to do for a NULL node
+     * firewall - nothing to do for a NULL node or a tree in an arena
      */
-    if (node == NULL) {
+    if (node == NULL || node->arena) {
 	return;
     }
 
@@ -1296,9 +1611,43 @@ json_tree_free(struct json *node, unsigned int max_depth, ...)
     va_start(ap, max_depth);
 
     /*
-     * free the JSON parse tree
+     * free the JSON parse tree, children before their parent
      */
-    vjson_tree_walk(node, max_depth, 0, true, vjson_free, ap);
+    cur = node;
+    for (;;) {
+
+	/*
+	 * go down to the next child of cur, if it has any left
+	 */
+	child = json_tree_pop_child(cur);
+	if (child != NULL) {
+	    if (max_depth != JSON_INFINITE_DEPTH && depth+1 > max_depth) {
+		too_deep = true;
+	    } else {
+		child->parent = cur;
+		cur = child;
+		++depth;
+	    }
+	    continue;
+	}
+
+	/*
+	 * free cur and go back up to its parent
+	 */
+	up = cur->parent;
+	vjson_free(cur, depth, ap);
+	if (cur == node) {
+	    break;
+	}
+	if (!cur->arena) {
+	    free(cur);
+	}
+	cur = up;
+	--depth;
+    }
+    if (too_deep) {
+	warn(__func__, "tree free descent stopped, tree depth > max_depth: %u", max_depth);
+    }
 
     /*
      * stdarg variable argument list cleanup
@@ -1308,6 +1657,44 @@ json_tree_free(struct json *node, unsigned int max_depth, ...)
 }
 
 
+/*
+ * json_tree_release - free a JSON parse tree and its top level node
+ *
+ * given:
+ *	node	    pointer to the top level JSON parser tree node to free
+ *
+ * This is json_tree_free() with no depth limit followed by free() of node,
+ * except that a tree in an arena is left alone: it is freed with the arena,
+ * see json_arena_reset().
+ *
+ * NOTE: This function does nothing if node == NULL.
+ */
+void
+json_tree_release(struct json *node)
+{
+    /*
+     * firewall - nothing to do for a NULL node
+     */
+    if (node == NULL) {
+	return;
+    }
+
+    /*
+     * a tree in an arena is freed with the arena
+     */
+    if (node->arena) {
+	return;
+    }
+
+    /*
+     * free the tree and then its top level node
+     */
+    json_tree_free(node, JSON_INFINITE_DEPTH);
+    free(node);
+    return;
+}
+
+
 /*
  * json_fprint - print a line about a JSON parse tree node
  *
@@ -1391,6 +1778,9 @@ json_fprint(struct json *node, unsigned int depth, ...)
 static void
 fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, char *poststr)
 {
+    static struct json_number_value const no_value;	/* C values of a number not yet converted */
+    struct json_number_value const *val = NULL;	/* C values of item */
+
     /*
      * firewall - must be -J 3 or more
      */
@@ -1416,6 +1806,7 @@ fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, ch
     if (poststr == NULL) {
 	poststr = "((NULL))";
     }
+    val = (item->value != NULL) ? item->value : &no_value;
 
     /*
      * print the first prestr
@@ -1438,31 +1829,31 @@ fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, ch
 			item->is_floating?"F":"",
 			item->is_e_notation?"E":"",
 			item->is_integer?"I":"",
-			item->int8_sized?"8":"",
-			item->uint8_sized?"u8":"",
-			item->int16_sized?"16":"",
-			item->uint16_sized?"u16":"",
-			item->int32_sized?"32":"",
-			item->uint32_sized?"u32":"",
-			item->int64_sized?"64":"",
-			item->uint64_sized?"u64":"",
-			item->int_sized?"i":"",
-			item->uint_sized?"ui":"",
-			item->long_sized?"l":"",
-			item->ulong_sized?"ul":"",
-			item->longlong_sized?"ll":"",
-			item->ulonglong_sized?"ull":"",
-			item->ssize_sized?"SS":"",
-			item->size_sized?"s":"",
-			item->off_sized?"o":"",
-			item->maxint_sized?"m":"",
-			item->umaxint_sized?"um":"",
-			item->float_sized?"f":"",
-			item->as_float_int?"fi":"",
-			item->double_sized?"d":"",
-			item->as_double_int?"di":"",
-			item->longdouble_sized?"ld":"",
-			item->as_longdouble_int?"ldi":"");
+			val->int8_sized?"8":"",
+			val->uint8_sized?"u8":"",
+			val->int16_sized?"16":"",
+			val->uint16_sized?"u16":"",
+			val->int32_sized?"32":"",
+			val->uint32_sized?"u32":"",
+			val->int64_sized?"64":"",
+			val->uint64_sized?"u64":"",
+			val->int_sized?"i":"",
+			val->uint_sized?"ui":"",
+			val->long_sized?"l":"",
+			val->ulong_sized?"ul":"",
+			val->longlong_sized?"ll":"",
+			val->ulonglong_sized?"ull":"",
+			val->ssize_sized?"SS":"",
+			val->size_sized?"s":"",
+			val->off_sized?"o":"",
+			val->maxint_sized?"m":"",
+			val->umaxint_sized?"um":"",
+			val->float_sized?"f":"",
+			val->as_float_int?"fi":"",
+			val->double_sized?"d":"",
+			val->as_double_int?"di":"",
+			val->longdouble_sized?"ld":"",
+			val->as_longdouble_int?"ldi":"");
     } else {
 
 	/* -J 3 */ fprint(stream, "%s%s%s%s%s%s%s",
@@ -1472,44 +1863,44 @@ fprnumber(FILE *stream, char *prestr, struct json_number *item, char *midstr, ch
 			item->is_negative?"-":"", item->is_floating?"F":"",
 			item->is_e_notation?"E":"",
 			item->is_integer?"I":"");
-	if (item->int8_sized) {
-	    fprint(stream, "%s", item->int8_sized?"8":"");
-	} else if (item->uint8_sized) {
-	    fprint(stream, "%s", item->uint8_sized?"u8":"");
-	} else if (item->int16_sized) {
-	    fprint(stream, "%s", item->int16_sized?"16":"");
-	} else if (item->uint16_sized) {
-	    fprint(stream, "%s", item->uint16_sized?"u16":"");
-	} else if (item->int32_sized) {
-	    fprint(stream, "%s", item->int32_sized?"32":"");
-	} else if (item->uint32_sized) {
-	    fprint(stream, "%s", item->uint32_sized?"u32":"");
-	} else if (item->int64_sized) {
-	    fprint(stream, "%s", item->int64_sized?"64":"");
-	} else if (item->uint64_sized) {
-	    fprint(stream, "%s", item->uint64_sized?"u64":"");
-	} if (item->ssize_sized) {
-	    fprint(stream, "%s", item->ssize_sized?"SS":"");
-	} else if (item->size_sized) {
-	    fprint(stream, "%s", item->size_sized?"s":"");
-	} if (item->off_sized) {
-	    fprint(stream, "%s", item->off_sized?"o":"");
-	} if (item->maxint_sized) {
-	    fprint(stream, "%s", item->maxint_sized?"m":"");
-	} else if (item->umaxint_sized) {
-	    fprint(stream, "%s", item->umaxint_sized?"um":"");
-	} if (item->as_float_int) {
-	    fprint(stream, "%s", item->as_float_int?"fi":"");
-	} else if (item->float_sized) {
-	    fprint(stream, "%s", item->float_sized?"f":"");
-	} else if (item->as_double_int) {
-	    fprint(stream, "%s", item->as_double_int?"di":"");
-	} else if (item->double_sized) {
-	    fprint(stream, "%s", item->double_sized?"d":"");
-	} else if (item->as_longdouble_int) {
-	    fprint(stream, "%s", item->as_longdouble_int?"ldi":"");
-	} else if (item->longdouble_sized) {
-	    fprint(stream, "%s", item->longdouble_sized?"ld":"");
+	if (val->int8_sized) {
+	    fprint(stream, "%s", val->int8_sized?"8":"");
+	} else if (val->uint8_sized) {
+	    fprint(stream, "%s", val->uint8_sized?"u8":"");
+	} else if (val->int16_sized) {
+	    fprint(stream, "%s", val->int16_sized?"16":"");
+	} else if (val->uint16_sized) {
+	    fprint(stream, "%s", val->uint16_sized?"u16":"");
+	} else if (val->int32_sized) {
+	    fprint(stream, "%s", val->int32_sized?"32":"");
+	} else if (val->uint32_sized) {
+	    fprint(stream, "%s", val->uint32_sized?"u32":"");
+	} else if (val->int64_sized) {
+	    fprint(stream, "%s", val->int64_sized?"64":"");
+	} else if (val->uint64_sized) {
+	    fprint(stream, "%s", val->uint64_sized?"u64":"");
+	} if (val->ssize_sized) {
+	    fprint(stream, "%s", val->ssize_sized?"SS":"");
+	} else if (val->size_sized) {
+	    fprint(stream, "%s", val->size_sized?"s":"");
+	} if (val->off_sized) {
+	    fprint(stream, "%s", val->off_sized?"o":"");
+	} if (val->maxint_sized) {
+	    fprint(stream, "%s", val->maxint_sized?"m":"");
+	} else if (val->umaxint_sized) {
+	    fprint(stream, "%s", val->umaxint_sized?"um":"");
+	} if (val->as_float_int) {
+	    fprint(stream, "%s", val->as_float_int?"fi":"");
+	} else if (val->float_sized) {
+	    fprint(stream, "%s", val->float_sized?"f":"");
+	} else if (val->as_double_int) {
+	    fprint(stream, "%s", val->as_double_int?"di":"");
+	} else if (val->double_sized) {
+	    fprint(stream, "%s", val->double_sized?"d":"");
+	} else if (val->as_longdouble_int) {
+	    fprint(stream, "%s", val->as_longdouble_int?"ldi":"");
+	} else if (val->longdouble_sized) {
+	    fprint(stream, "%s", val->longdouble_sized?"ld":"");
 	}
     }
 
@@ -1627,7 +2018,10 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_NUMBER:	/* JSON item is number - see struct json_number */
 	{
-	    struct json_number *item = &(node->item.number);
+	    struct json_number *item = json_get_number(node);
+
+	    /* print the C values as well, converting them if not yet done */
+	    (void) json_number_convert(node);
 
 	    /*
 	     * case: converted number
@@ -1652,7 +2046,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_STRING:	/* JSON item is a string - see struct json_string */
 	{
-	    struct json_string *item = &(node->item.string);
+	    struct json_string *item = json_get_string(node);
 
 	    /*
 	     * case: converted and parsed string
@@ -1696,7 +2090,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_BOOL:	/* JSON item is a boolean - see struct json_boolean */
 	{
-	    struct json_boolean *item = &(node->item.boolean);
+	    struct json_boolean *item = json_get_boolean(node);
 
 	    /*
 	     * case: converted and parsed boolean
@@ -1728,7 +2122,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_NULL:	/* JSON item is a null - see struct json_null */
 	{
-	    struct json_null *item = &(node->item.null);
+	    struct json_null *item = json_get_null(node);
 
 	    /*
 	     * case: converted and parsed null
@@ -1760,7 +2154,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_MEMBER:	/* JSON item is a member - see struct json_member */
 	{
-	    struct json_member *item = &(node->item.member);
+	    struct json_member *item = json_get_member(node);
 
 	    /*
 	     * case: converted and parsed member
@@ -1777,7 +2171,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 		     * case: name is JTYPE_STRING
 		     */
 		    if (type == JTYPE_STRING) {
-			struct json_string *item2 = &(item->name->item.string);
+			struct json_string *item2 = json_get_string(item->name);
 
 			if (CONVERTED_PARSED_JSON_NODE(item2)) {
 			    fprint(stream, "\t{%s%s}name: ",
@@ -1836,7 +2230,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_OBJECT:	/* JSON item is a { members } - see struct json_object */
 	{
-	    struct json_object *item = &(node->item.object);
+	    struct json_object *item = json_get_object(node);
 
 	    /*
 	     * case: converted and parsed object
@@ -1847,11 +2241,11 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 			       PARSED_JSON_NODE(item)?"p":"",
 			       CONVERTED_PARSED_JSON_NODE(item)?"c":"",
 			       item->len);
-		if (item->set == NULL) {
-		    fprstr(stream, "\tWarning: set == NULL");
+		if (item->set == NULL && item->len > 0) {
+		    fprstr(stream, "	Warning: set == NULL");
 		}
-		if (item->s == NULL) {
-		    fprstr(stream, "\tWarning: s == NULL");
+		if (item->len > item->alloc) {
+		    fprstr(stream, "	Warning: len > alloc");
 		}
 
 	    /*
@@ -1875,7 +2269,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_ARRAY:	/* JSON item is a [ elements ] - see struct json_array */
 	{
-	    struct json_array *item = &(node->item.array);
+	    struct json_array *item = json_get_array(node);
 
 	    /*
 	     * case: converted and parsed object
@@ -1886,11 +2280,11 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 			       PARSED_JSON_NODE(item)?"p":"",
 			       CONVERTED_PARSED_JSON_NODE(item)?"c":"",
 			       item->len);
-		if (item->set == NULL) {
-		    fprstr(stream, "\tWarning: set == NULL");
+		if (item->set == NULL && item->len > 0) {
+		    fprstr(stream, "	Warning: set == NULL");
 		}
-		if (item->s == NULL) {
-		    fprstr(stream, "\tWarning: s == NULL");
+		if (item->len > item->alloc) {
+		    fprstr(stream, "	Warning: len > alloc");
 		}
 
 	    /*
@@ -1914,7 +2308,7 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 
     case JTYPE_ELEMENTS:	/* JSON elements is zero or more JSON values - see struct json_elements */
 	{
-	    struct json_elements *item = &(node->item.elements);
+	    struct json_elements *item = json_get_elements(node);
 
 	    /*
 	     * case: converted and parsed object
@@ -1925,11 +2319,11 @@ vjson_fprint(struct json *node, unsigned int depth, va_list ap)
 			       PARSED_JSON_NODE(item)?"p":"",
 			       CONVERTED_PARSED_JSON_NODE(item)?"c":"",
 			       item->len);
-		if (item->set == NULL) {
-		    fprstr(stream, "\tWarning: set == NULL");
+		if (item->set == NULL && item->len > 0) {
+		    fprstr(stream, "	Warning: set == NULL");
 		}
-		if (item->s == NULL) {
-		    fprstr(stream, "\tWarning: s == NULL");
+		if (item->len > item->alloc) {
+		    fprstr(stream, "	Warning: len > alloc");
 		}
 
 	    /*
@@ -2288,7 +2682,7 @@ vjson_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, b
 
 	/* descend the tree */
 	{
-	    struct json_member *item = &(node->item.member);
+	    struct json_member *item = json_get_member(node);
 
 	    /* perform function operation on JSON member name (left branch) node */
 	    vjson_tree_walk(item->name, max_depth, depth+1, post_order, vcallback, ap);
@@ -2312,7 +2706,7 @@ vjson_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, b
 
 	/* descend the tree */
 	{
-	    struct json_object *item = &(node->item.object);
+	    struct json_object *item = json_get_object(node);
 
 	    /* perform function operation on each object member in order */
 	    if (item->set != NULL) {
@@ -2337,7 +2731,7 @@ vjson_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, b
 
 	/* descend the tree */
 	{
-	    struct json_array *item = &(node->item.array);
+	    struct json_array *item = json_get_array(node);
 
 	    /* perform function operation on each object member in order */
 	    if (item->set != NULL) {
@@ -2362,7 +2756,7 @@ vjson_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, b
 
 	/* descend the tree */
 	{
-	    struct json_elements *item = &(node->item.elements);
+	    struct json_elements *item = json_get_elements(node);
 
 	    /* perform function operation on each object member in order */
 	    if (item->set != NULL) {
@@ -50,8 +50,10 @@
  * JSON parser related definitions and structures
  */
 #define JSON_CHUNK (16)			/* number of pointers to allocate at a time in dynamic array */
+#define JSON_SET_MIN (4)		/* fewest children the set of an object or array has room for */
 #define JSON_DEFAULT_MAX_DEPTH (256)	/* a sane parse tree depth to use */
 #define JSON_INFINITE_DEPTH (0)		/* no limit on parse tree depth to walk */
+#define JSON_FPRINTF_BUF (1024)	/* bytes json_fprintf_*() gather on the stack before writing them */
 
 
 /*
@@ -150,9 +152,21 @@ extern bool json_fprintf_value_time_t(FILE *stream, char const *lead, char const
 				      char const *tail);
 extern bool json_fprintf_value_bool(FILE *stream, char const *lead, char const *name, char const *middle, bool value,
 				    char const *tail);
+extern long double json_strtold(char const *str, char **endptr);
+extern double json_strtod(char const *str, char **endptr);
+extern float json_strtof(char const *str, char **endptr);
+extern int json_fmt_double(char *buf, size_t size, int prec, double value);
 extern char const *json_type_name(enum item_type type);
 extern char const *json_item_type_name(const struct json *node);
 extern char const *json_get_type_str(struct json *node, bool decoded);
+extern struct json_number *json_get_number(struct json const *node);
+extern struct json_string *json_get_string(struct json const *node);
+extern struct json_boolean *json_get_boolean(struct json const *node);
+extern struct json_null *json_get_null(struct json const *node);
+extern struct json_member *json_get_member(struct json const *node);
+extern struct json_object *json_get_object(struct json const *node);
+extern struct json_array *json_get_array(struct json const *node);
+extern struct json_elements *json_get_elements(struct json const *node);
 extern void json_free(struct json *node, unsigned int depth, ...);
 extern void vjson_free(struct json *node, unsigned int depth, va_list ap);
 extern void json_fprint(struct json *node, unsigned int depth, ...);
@@ -160,6 +174,7 @@ extern void vjson_fprint(struct json *node, unsigned int depth, va_list ap);
 extern void json_tree_print(struct json *node, unsigned int max_depth, ...);
 extern void json_dbg_tree_print(int json_dbg_lvl, char const *name, struct json *tree, unsigned int max_depth);
 extern void json_tree_free(struct json *node, unsigned int max_depth, ...);
+extern void json_tree_release(struct json *node);
 extern void json_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, bool post_order,
 			   void (*vcallback)(struct json *, unsigned int, va_list), ...);
 extern void vjson_tree_walk(struct json *node, unsigned int max_depth, unsigned int depth, bool post_order,
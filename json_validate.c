@@ -0,0 +1,681 @@
+/*
+ * json_validate - check JSON without building a parse tree
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * jparse - JSON parser
+ */
+#include "jparse.h"
+
+/*
+ * json_validate - check JSON without building a parse tree
+ */
+#include "json_validate.h"
+
+
+/*
+ * static functions
+ */
+static bool validate_open(struct json_validator *v, bool object);
+static bool validate_is_object(struct json_validator const *v);
+static void validate_value(struct json_validator *v);
+static int validate_hex(unsigned char c);
+
+
+/*
+ * validate_open - open an object or array
+ *
+ * given:
+ *	v	    validator state
+ *	object	    true ==> an object was opened, false ==> an array
+ *
+ * returns:
+ *	true ==> opened, false ==> nested deeper than v->max_depth
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static bool
+validate_open(struct json_validator *v, bool object)
+{
+    uint64_t *word = NULL;	/* word holding the bit of the new level */
+    uint64_t *more = NULL;	/* reallocated deeper levels */
+    size_t n = 0;		/* index of that word */
+    size_t words = 0;		/* words to allocate */
+
+    if (v->max_depth != JSON_INFINITE_DEPTH && v->depth >= v->max_depth) {
+	return false;
+    }
+
+    /*
+     * find the word for the new level, allocating more if needed
+     */
+    n = v->depth / 64;
+    if (n < JSON_VALIDATE_BITS) {
+	word = &v->bits[n];
+    } else {
+	n -= JSON_VALIDATE_BITS;
+	if (n >= v->more_words) {
+	    words = (v->more_words > 0) ? v->more_words * 2 : JSON_VALIDATE_BITS;
+	    errno = 0;	/* pre-clear errno for errp() */
+	    more = realloc(v->more, words * sizeof(*v->more));
+	    if (more == NULL) {
+		errp(97, __func__, "realloc of %ju words failed", (uintmax_t)words);
+		not_reached();
+	    }
+	    v->more = more;
+	    v->more_words = words;
+	}
+	word = &v->more[n];
+    }
+
+    /*
+     * note if the new level is an object or an array
+     */
+    if (object) {
+	*word |= (uint64_t)1 << (v->depth % 64);
+    } else {
+	*word &= ~((uint64_t)1 << (v->depth % 64));
+    }
+    ++v->depth;
+    v->state = object ? JSON_VALIDATE_NAME_OR_CLOSE : JSON_VALIDATE_VALUE_OR_CLOSE;
+    return true;
+}
+
+
+/*
+ * validate_is_object - determine if the innermost open level is an object
+ *
+ * given:
+ *	v	    validator state with at least one object or array open
+ *
+ * returns:
+ *	true ==> innermost is an object, false ==> it is an array
+ */
+static bool
+validate_is_object(struct json_validator const *v)
+{
+    size_t n = (v->depth - 1) / 64;	/* index of the word holding the innermost level */
+    uint64_t word;			/* that word */
+
+    word = (n < JSON_VALIDATE_BITS) ? v->bits[n] : v->more[n - JSON_VALIDATE_BITS];
+    return (word >> ((v->depth - 1) % 64)) & 1;
+}
+
+
+/*
+ * validate_value - note that a value is complete
+ *
+ * given:
+ *	v	    validator state
+ */
+static void
+validate_value(struct json_validator *v)
+{
+    v->state = (v->depth == 0) ? JSON_VALIDATE_EOF : JSON_VALIDATE_COMMA_OR_CLOSE;
+}
+
+
+/*
+ * validate_hex - convert a hex digit
+ *
+ * given:
+ *	c	    byte to convert
+ *
+ * returns:
+ *	value of the hex digit, or -1 if c is not a hex digit
+ */
+static int
+validate_hex(unsigned char c)
+{
+    if (c >= '0' && c <= '9') {
+	return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+	return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+	return c - 'A' + 10;
+    }
+    return -1;
+}
+
+
+/*
+ * json_validator_init - set up a validator
+ *
+ * given:
+ *	v	    validator state to set up
+ *
+ * The caller may then change v->max_depth from its default of
+ * JSON_INFINITE_DEPTH (no limit).
+ *
+ * NOTE: this function does not return on NULL v.
+ */
+void
+json_validator_init(struct json_validator *v)
+{
+    if (v == NULL) {
+	err(98, __func__, "v is NULL");
+	not_reached();
+    }
+    memset(v, 0, sizeof(*v));
+    v->max_depth = JSON_INFINITE_DEPTH;
+    v->state = JSON_VALIDATE_VALUE;
+    v->line = 1;
+    v->column = 1;
+}
+
+
+/*
+ * json_validator_fini - free what a validator holds
+ *
+ * given:
+ *	v	    validator state from json_validator_init()
+ *
+ * The validator itself is not freed.
+ *
+ * NOTE: a NULL v is ignored.
+ */
+void
+json_validator_fini(struct json_validator *v)
+{
+    if (v == NULL) {
+	return;
+    }
+    if (v->more != NULL) {
+	free(v->more);
+	v->more = NULL;
+    }
+    v->more_words = 0;
+}
+
+
+/*
+ * json_validator_feed - check the next chunk of a JSON document
+ *
+ * given:
+ *	v	    validator state from json_validator_init()
+ *	chunk	    next chunk of the document
+ *	len	    length of chunk
+ *
+ * returns:
+ *	true ==> no error so far, false ==> the document is invalid: v->offset,
+ *	v->line and v->column are where the error was found
+ *
+ * The grammar, the number syntax and the string escapes are checked as they
+ * are by parse_json(), without making a parse tree: the document is valid if
+ * parse_json_stream() would find it valid.  A string escape that
+ * parse_json_string() can not decode, such as \x or a \u escape of a lone
+ * surrogate, makes the document invalid.  Chunks may split the document
+ * anywhere.
+ *
+ * NOTE: this function does not return on NULL v.
+ */
+bool
+json_validator_feed(struct json_validator *v, char const *chunk, size_t len)
+{
+    unsigned char const *start = (unsigned char const *)chunk;	/* start of chunk */
+    unsigned char const *end = NULL;		/* end of chunk */
+    unsigned char const *p = NULL;		/* next byte to check */
+    int x;					/* hex digit value */
+
+    /*
+     * firewall
+     */
+    if (v == NULL) {
+	err(99, __func__, "v is NULL");
+	not_reached();
+    }
+    if (v->state == JSON_VALIDATE_INVALID) {
+	return false;
+    }
+    if (chunk == NULL) {
+	if (len == 0) {
+	    return true;
+	}
+	werr(100, __func__, "chunk is NULL");
+	v->state = JSON_VALIDATE_INVALID;
+	return false;
+    }
+
+    end = start + len;
+    for (p = start; p < end; ) {
+
+	/*
+	 * whitespace between tokens
+	 */
+	if (v->state <= JSON_VALIDATE_EOF) {
+	    if (*p == ' ' || *p == '\t' || *p == '\r') {
+		++p;
+		continue;
+	    } else if (*p == '\n') {
+		++v->line;
+		v->line_start = v->offset + (uintmax_t)(p - start) + 1;
+		++p;
+		continue;
+	    }
+	}
+
+	switch (v->state) {
+	case JSON_VALIDATE_VALUE_OR_CLOSE:
+	    if (*p == ']') {
+		--v->depth;
+		validate_value(v);
+		++p;
+		break;
+	    }
+	    /*FALLTHRU*/
+	case JSON_VALIDATE_VALUE:
+	    switch (*p) {
+	    case '{':
+	    case '[':
+		if (!validate_open(v, *p == '{')) {
+		    goto invalid;
+		}
+		break;
+	    case '"':
+		v->name = false;
+		v->state = JSON_VALIDATE_STRING;
+		break;
+	    case '-':
+		v->state = JSON_VALIDATE_MINUS;
+		break;
+	    case '0':
+		v->state = JSON_VALIDATE_ZERO;
+		break;
+	    case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+		v->state = JSON_VALIDATE_INT;
+		break;
+	    case 't':
+		v->literal = "rue";
+		v->state = JSON_VALIDATE_LITERAL;
+		break;
+	    case 'f':
+		v->literal = "alse";
+		v->state = JSON_VALIDATE_LITERAL;
+		break;
+	    case 'n':
+		v->literal = "ull";
+		v->state = JSON_VALIDATE_LITERAL;
+		break;
+	    default:
+		goto invalid;
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_NAME_OR_CLOSE:
+	    if (*p == '}') {
+		--v->depth;
+		validate_value(v);
+		++p;
+		break;
+	    }
+	    /*FALLTHRU*/
+	case JSON_VALIDATE_NAME:
+	    if (*p != '"') {
+		goto invalid;
+	    }
+	    v->name = true;
+	    v->state = JSON_VALIDATE_STRING;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_COLON:
+	    if (*p != ':') {
+		goto invalid;
+	    }
+	    v->state = JSON_VALIDATE_VALUE;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_COMMA_OR_CLOSE:
+	    if (*p == ',') {
+		v->state = validate_is_object(v) ? JSON_VALIDATE_NAME : JSON_VALIDATE_VALUE;
+	    } else if (*p == (validate_is_object(v) ? '}' : ']')) {
+		--v->depth;
+		validate_value(v);
+	    } else {
+		goto invalid;
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_EOF:
+	    goto invalid;
+
+	case JSON_VALIDATE_STRING:
+	    /*
+	     * skip the bytes that stand for themselves
+	     */
+	    while (p < end && *p != '"' && *p != '\\' && *p >= 0x20) {
+		++p;
+	    }
+	    if (p == end) {
+		break;
+	    }
+	    if (*p == '"') {
+		if (v->name) {
+		    v->state = JSON_VALIDATE_COLON;
+		} else {
+		    validate_value(v);
+		}
+	    } else if (*p == '\\') {
+		v->state = JSON_VALIDATE_ESCAPE;
+	    } else {
+		goto invalid;	/* a control byte or NUL */
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_ESCAPE:
+	    if (*p == 'u') {
+		v->hex = 0;
+		v->code = 0;
+		v->low = false;
+		v->state = JSON_VALIDATE_HEX;
+	    } else if (*p != '"' && *p != '\\' && *p != '/' && *p != 'b' && *p != 'f' &&
+		       *p != 'n' && *p != 'r' && *p != 't') {
+		goto invalid;
+	    } else {
+		v->state = JSON_VALIDATE_STRING;
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_HEX:
+	    x = validate_hex(*p);
+	    if (x < 0) {
+		goto invalid;
+	    }
+	    v->code = (v->code << 4) | (uint32_t)x;
+	    if (++v->hex == 4) {
+		if (v->low) {
+		    /* a high surrogate must be followed by a low surrogate */
+		    if (v->code < 0xDC00 || v->code > 0xDFFF) {
+			goto invalid;
+		    }
+		    v->state = JSON_VALIDATE_STRING;
+		} else if (v->code >= 0xD800 && v->code <= 0xDBFF) {
+		    v->state = JSON_VALIDATE_LOW_ESCAPE;
+		} else if (v->code >= 0xDC00 && v->code <= 0xDFFF) {
+		    goto invalid;
+		} else {
+		    v->state = JSON_VALIDATE_STRING;
+		}
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_LOW_ESCAPE:
+	    if (*p != '\\') {
+		goto invalid;
+	    }
+	    v->state = JSON_VALIDATE_LOW_U;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_LOW_U:
+	    if (*p != 'u') {
+		goto invalid;
+	    }
+	    v->hex = 0;
+	    v->code = 0;
+	    v->low = true;
+	    v->state = JSON_VALIDATE_HEX;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_MINUS:
+	    if (*p == '0') {
+		v->state = JSON_VALIDATE_ZERO;
+	    } else if (*p >= '1' && *p <= '9') {
+		v->state = JSON_VALIDATE_INT;
+	    } else {
+		goto invalid;
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_INT:
+	    while (p < end && *p >= '0' && *p <= '9') {
+		++p;
+	    }
+	    if (p == end) {
+		break;
+	    }
+	    /*FALLTHRU*/
+	case JSON_VALIDATE_ZERO:
+	    if (*p == '.') {
+		v->state = JSON_VALIDATE_DOT;
+		++p;
+	    } else if (*p == 'e' || *p == 'E') {
+		v->state = JSON_VALIDATE_E;
+		++p;
+	    } else {
+		validate_value(v);	/* the number ends before this byte */
+	    }
+	    break;
+
+	case JSON_VALIDATE_DOT:
+	    if (*p < '0' || *p > '9') {
+		goto invalid;
+	    }
+	    v->state = JSON_VALIDATE_FRAC;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_FRAC:
+	    while (p < end && *p >= '0' && *p <= '9') {
+		++p;
+	    }
+	    if (p == end) {
+		break;
+	    }
+	    if (*p == 'e' || *p == 'E') {
+		v->state = JSON_VALIDATE_E;
+		++p;
+	    } else {
+		validate_value(v);	/* the number ends before this byte */
+	    }
+	    break;
+
+	case JSON_VALIDATE_E:
+	    if (*p == '+' || *p == '-') {
+		v->state = JSON_VALIDATE_SIGN;
+		++p;
+		break;
+	    }
+	    /*FALLTHRU*/
+	case JSON_VALIDATE_SIGN:
+	    if (*p < '0' || *p > '9') {
+		goto invalid;
+	    }
+	    v->state = JSON_VALIDATE_EXP;
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_EXP:
+	    while (p < end && *p >= '0' && *p <= '9') {
+		++p;
+	    }
+	    if (p < end) {
+		validate_value(v);	/* the number ends before this byte */
+	    }
+	    break;
+
+	case JSON_VALIDATE_LITERAL:
+	    if (*p != (unsigned char)*v->literal) {
+		goto invalid;
+	    }
+	    if (*++v->literal == '\0') {
+		validate_value(v);
+	    }
+	    ++p;
+	    break;
+
+	case JSON_VALIDATE_INVALID:
+	default:
+	    goto invalid;
+	}
+    }
+    v->offset += len;
+    v->column = v->offset - v->line_start + 1;
+    return true;
+
+invalid:
+    v->offset += (uintmax_t)(p - start);
+    v->column = v->offset - v->line_start + 1;
+    v->state = JSON_VALIDATE_INVALID;
+    return false;
+}
+
+
+/*
+ * json_validator_end - finish checking a JSON document
+ *
+ * given:
+ *	v	    validator state given the whole document by json_validator_feed()
+ *
+ * returns:
+ *	true ==> the document is valid JSON, false ==> it is not
+ *
+ * NOTE: this function does not return on NULL v.
+ */
+bool
+json_validator_end(struct json_validator *v)
+{
+    if (v == NULL) {
+	err(101, __func__, "v is NULL");
+	not_reached();
+    }
+
+    /*
+     * a number is complete at the end of the data
+     */
+    switch (v->state) {
+    case JSON_VALIDATE_ZERO:
+    case JSON_VALIDATE_INT:
+    case JSON_VALIDATE_FRAC:
+    case JSON_VALIDATE_EXP:
+	validate_value(v);
+	break;
+    default:
+	break;
+    }
+
+    if (v->state != JSON_VALIDATE_EOF) {
+	v->state = JSON_VALIDATE_INVALID;
+	return false;
+    }
+    return true;
+}
+
+
+/*
+ * json_validate - determine if a block of memory is valid JSON
+ *
+ * given:
+ *	ptr	    pointer to start of JSON blob
+ *	len	    length of the JSON blob
+ *
+ * returns:
+ *	true ==> valid JSON, false ==> invalid JSON
+ *
+ * This checks the JSON as parse_json() would but makes no parse tree: nothing
+ * is allocated unless objects and arrays are nested more than
+ * JSON_VALIDATE_BITS * 64 deep.  Nothing is reported.
+ *
+ * NOTE: as with parse_json_stream(), a NUL byte in a string is invalid.
+ */
+bool
+json_validate(char const *ptr, size_t len)
+{
+    struct json_validator v;		/* validator state */
+    bool valid = false;			/* true ==> ptr is valid JSON */
+
+    if (ptr == NULL) {
+	return false;
+    }
+    json_validator_init(&v);
+    valid = json_validator_feed(&v, ptr, len) && json_validator_end(&v);
+    json_validator_fini(&v);
+    return valid;
+}
+
+
+/*
+ * json_validate_stream - determine if what a stream holds is valid JSON
+ *
+ * given:
+ *	v	    validator state from json_validator_init()
+ *	stream	    open file stream to read the JSON from
+ *
+ * returns:
+ *	true ==> valid JSON, false ==> invalid JSON: v->offset, v->line and
+ *	v->column are where the error was found
+ *
+ * The stream is read JSON_VALIDATE_READ bytes at a time into a buffer on the
+ * stack, so the memory used does not depend on the size of the JSON.  Reading
+ * stops at the first error.  The stream is not closed.
+ *
+ * NOTE: this function does not return on NULL v.
+ */
+bool
+json_validate_stream(struct json_validator *v, FILE *stream)
+{
+    char buf[JSON_VALIDATE_READ];	/* block read from stream */
+    size_t got = 0;			/* bytes read */
+
+    if (v == NULL) {
+	err(102, __func__, "v is NULL");
+	not_reached();
+    }
+    if (stream == NULL) {
+	werr(103, __func__, "stream is NULL");
+	v->state = JSON_VALIDATE_INVALID;
+	return false;
+    }
+
+    do {
+	errno = 0;		/* pre-clear errno for werrp() */
+	got = fread(buf, 1, sizeof(buf), stream);
+	if (got == 0 && ferror(stream)) {
+	    werrp(104, __func__, "error reading stream");
+	    v->state = JSON_VALIDATE_INVALID;
+	    return false;
+	}
+	if (!json_validator_feed(v, buf, got)) {
+	    return false;
+	}
+    } while (got > 0);
+    return json_validator_end(v);
+}
@@ -0,0 +1,110 @@
+/*
+ * json_validate - check JSON without building a parse tree
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_VALIDATE_H)
+#    define  INCLUDE_JSON_VALIDATE_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/*
+ * definitions
+ */
+#define JSON_VALIDATE_BITS (8)		/* 64 bit words of nesting kept in struct json_validator */
+#define JSON_VALIDATE_READ (65536)	/* bytes json_validate_stream() reads at a time */
+
+
+/*
+ * what json_validator_feed() expects the next byte to be part of
+ */
+enum json_validate_state
+{
+    JSON_VALIDATE_VALUE = 0,		/* a value: at the top level, after ',' in an array or after ':' */
+    JSON_VALIDATE_VALUE_OR_CLOSE,	/* a value or ']': just after '[' */
+    JSON_VALIDATE_NAME,			/* a member name: after ',' in an object */
+    JSON_VALIDATE_NAME_OR_CLOSE,	/* a member name or '}': just after '{' */
+    JSON_VALIDATE_COLON,		/* ':' after a member name */
+    JSON_VALIDATE_COMMA_OR_CLOSE,	/* ',' or the close of the innermost array or object */
+    JSON_VALIDATE_EOF,			/* whitespace after the top level value */
+    JSON_VALIDATE_STRING,		/* inside a string */
+    JSON_VALIDATE_ESCAPE,		/* after a backslash in a string */
+    JSON_VALIDATE_HEX,			/* the 4 hex digits of a \u escape */
+    JSON_VALIDATE_LOW_ESCAPE,		/* the backslash of the \u escape that must follow a high surrogate */
+    JSON_VALIDATE_LOW_U,		/* the u of that escape */
+    JSON_VALIDATE_MINUS,		/* after the '-' of a number */
+    JSON_VALIDATE_ZERO,			/* after a leading 0 of a number */
+    JSON_VALIDATE_INT,			/* in the integer digits of a number */
+    JSON_VALIDATE_DOT,			/* after the '.' of a number */
+    JSON_VALIDATE_FRAC,			/* in the fraction digits of a number */
+    JSON_VALIDATE_E,			/* after the 'e' or 'E' of a number */
+    JSON_VALIDATE_SIGN,			/* after the sign of an exponent */
+    JSON_VALIDATE_EXP,			/* in the exponent digits of a number */
+    JSON_VALIDATE_LITERAL,		/* in true, false or null */
+    JSON_VALIDATE_INVALID,		/* the JSON is invalid: the rest is ignored */
+};
+
+/*
+ * struct json_validator - json_validator_feed() state between chunks
+ *
+ * The memory used is one bit per open object or array: the first
+ * JSON_VALIDATE_BITS * 64 levels are kept here and deeper nesting is
+ * allocated, so most JSON is checked without allocating anything.
+ */
+struct json_validator
+{
+    /* option: json_validator_init() sets the default */
+    unsigned int max_depth;		/* most nested objects and arrays, JSON_INFINITE_DEPTH ==> no limit */
+
+    /* state */
+    enum json_validate_state state;	/* what the next byte must be part of */
+    bool name;				/* true ==> the string being checked is a member name */
+    bool low;				/* true ==> the \u escape being checked must be a low surrogate */
+    unsigned int hex;			/* hex digits of the \u escape seen so far */
+    uint32_t code;			/* value of those hex digits */
+    char const *literal;		/* rest of the true, false or null being checked */
+    size_t depth;			/* number of open objects and arrays */
+    uint64_t bits[JSON_VALIDATE_BITS];	/* bit set ==> that level is an object, else an array */
+    uint64_t *more;			/* bits of levels deeper than bits holds, or NULL */
+    size_t more_words;			/* 64 bit words allocated in more */
+
+    /* where the JSON was found to be invalid, or the end of the data so far */
+    uintmax_t offset;			/* byte offset */
+    uintmax_t line;			/* line, starting at 1 */
+    uintmax_t column;			/* byte within the line, starting at 1 */
+    uintmax_t line_start;		/* byte offset of the start of the line */
+};
+
+
+/*
+ * external function declarations
+ */
+extern void json_validator_init(struct json_validator *v);
+extern void json_validator_fini(struct json_validator *v);
+extern bool json_validator_feed(struct json_validator *v, char const *chunk, size_t len);
+extern bool json_validator_end(struct json_validator *v);
+extern bool json_validate(char const *ptr, size_t len);
+extern bool json_validate_stream(struct json_validator *v, FILE *stream);
+
+
+#endif /* INCLUDE_JSON_VALIDATE_H */
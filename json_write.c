@@ -0,0 +1,1483 @@
+/*
+ * json_write - write JSON parse trees as JSON text
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <math.h>
+#include <float.h>
+#include <unistd.h>
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * json_util - general JSON parser utility support functions
+ */
+#include "json_util.h"
+
+/*
+ * json_write - write JSON parse trees as JSON text
+ */
+#include "json_write.h"
+
+
+/*
+ * definitions
+ */
+#define WRITE_STACK (64)		/* open objects and arrays json_tree_write() tracks before it allocates */
+
+
+/*
+ * struct write_frame - an object or array json_tree_write() is in
+ */
+struct write_frame
+{
+    struct json * const *set;		/* children of the object or array */
+    intmax_t len;			/* number of children */
+    intmax_t i;				/* index in set of the child being written */
+    char close;				/* '}' or ']' */
+};
+
+
+/*
+ * static functions
+ */
+static bool buf_write_out(struct json_buf *out, char const *ptr, size_t len);
+static bool buf_newline(struct json_buf *out, unsigned int indent, size_t level);
+static bool write_scalar(struct json_buf *out, struct json const *node);
+static bool writer_value(struct json_writer *w, char const *name);
+static bool writer_open(struct json_writer *w, char open, char const *name);
+static bool writer_close(struct json_writer *w, char close, char const *name);
+
+
+/*
+ * buf_write_out - write bytes to the file descriptor or stream of a struct json_buf
+ *
+ * given:
+ *	out	    where the bytes go
+ *	ptr	    bytes to write
+ *	len	    number of bytes
+ *
+ * returns:
+ *	true ==> all of the bytes were written,
+ *	false ==> a write failed, and out->error is now true
+ */
+static bool
+buf_write_out(struct json_buf *out, char const *ptr, size_t len)
+{
+    ssize_t ret = 0;		/* write(2) return */
+
+    /*
+     * case: write to a stream
+     */
+    if (out->stream != NULL) {
+	errno = 0;		/* pre-clear errno for warnp() */
+	if (fwrite(ptr, 1, len, out->stream) != len) {
+	    warnp(__func__, "fwrite of %ju bytes failed", (uintmax_t)len);
+	    out->error = true;
+	    return false;
+	}
+	return true;
+    }
+
+    /*
+     * write to a file descriptor, as many times as it takes
+     */
+    while (len > 0) {
+	errno = 0;		/* pre-clear errno for warnp() */
+	ret = write(out->fd, ptr, len);
+	if (ret < 0 && errno == EINTR) {
+	    continue;
+	}
+	if (ret <= 0) {
+	    warnp(__func__, "write of %ju bytes to fd %d failed", (uintmax_t)len, out->fd);
+	    out->error = true;
+	    return false;
+	}
+	ptr += ret;
+	len -= (size_t)ret;
+    }
+    return true;
+}
+
+
+/*
+ * json_buf_init - initialise a struct json_buf that gathers all of the text in memory
+ *
+ * given:
+ *	out	    struct json_buf to initialise
+ *
+ * No memory is allocated until something is written.
+ *
+ * NOTE: this function does not return on NULL out.
+ */
+void
+json_buf_init(struct json_buf *out)
+{
+    /*
+     * firewall
+     */
+    if (out == NULL) {
+	err(127, __func__, "out is NULL");
+	not_reached();
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->buf = NULL;
+    out->len = 0;
+    out->size = 0;
+    out->fd = -1;
+    out->stream = NULL;
+    out->error = false;
+    out->borrowed = false;
+}
+
+
+/*
+ * json_buf_init_fd - initialise a struct json_buf that writes to a file descriptor
+ *
+ * given:
+ *	out	    struct json_buf to initialise
+ *	fd	    open file descriptor to write to
+ *
+ * NOTE: this function does not return on NULL out or a negative fd.
+ */
+void
+json_buf_init_fd(struct json_buf *out, int fd)
+{
+    /*
+     * firewall
+     */
+    if (fd < 0) {
+	err(128, __func__, "fd: %d < 0", fd);
+	not_reached();
+    }
+
+    json_buf_init(out);
+    out->fd = fd;
+}
+
+
+/*
+ * json_buf_init_stream - initialise a struct json_buf that writes to a stream
+ *
+ * given:
+ *	out	    struct json_buf to initialise
+ *	stream	    open stream to write to
+ *
+ * NOTE: this function does not return on NULL out or NULL stream.
+ */
+void
+json_buf_init_stream(struct json_buf *out, FILE *stream)
+{
+    /*
+     * firewall
+     */
+    if (stream == NULL) {
+	err(129, __func__, "stream is NULL");
+	not_reached();
+    }
+
+    json_buf_init(out);
+    out->stream = stream;
+}
+
+
+/*
+ * json_buf_flush - write out what a struct json_buf holds
+ *
+ * given:
+ *	out	    struct json_buf
+ *
+ * returns:
+ *	true ==> everything written to out so far has been written out,
+ *	false ==> out is NULL or a write failed
+ *
+ * The text written to a stream is handed to fwrite(3): it is up to the
+ * caller to fflush(3) the stream.  The text of a struct json_buf from
+ * json_buf_init() stays where it is.
+ */
+bool
+json_buf_flush(struct json_buf *out)
+{
+    if (out == NULL) {
+	return false;
+    }
+    if (out->error) {
+	return false;
+    }
+    if (out->fd < 0 && out->stream == NULL) {
+	return true;
+    }
+    if (out->len > 0) {
+	if (!buf_write_out(out, out->buf, out->len)) {
+	    return false;
+	}
+	out->len = 0;
+    }
+    return true;
+}
+
+
+/*
+ * json_buf_fini - flush and free a struct json_buf
+ *
+ * given:
+ *	out	    struct json_buf, may be NULL
+ *
+ * returns:
+ *	true ==> everything written to out was written out or kept,
+ *	false ==> out is NULL or a write failed
+ *
+ * The file descriptor or stream is not closed, and the text of a struct
+ * json_buf from json_buf_init() that was not taken by json_buf_take() is freed.
+ * Memory from json_buf_set_storage() is left to the caller.
+ */
+bool
+json_buf_fini(struct json_buf *out)
+{
+    bool ret = false;		/* return value */
+
+    if (out == NULL) {
+	return false;
+    }
+    ret = json_buf_flush(out);
+    if (out->buf != NULL && !out->borrowed) {
+	free(out->buf);
+    }
+    out->buf = NULL;
+    out->len = 0;
+    out->size = 0;
+    out->borrowed = false;
+    return ret;
+}
+
+
+/*
+ * json_buf_reserve - make room for more text in a struct json_buf
+ *
+ * given:
+ *	out	    struct json_buf
+ *	len	    bytes to make room for
+ *
+ * returns:
+ *	where the next len bytes go, or
+ *	NULL if a write failed
+ *
+ * The caller copies up to len bytes there and adds how many it copied to
+ * out->len.  When there is not room, what out holds is first written out if
+ * it has a file descriptor or stream, and then buf is made bigger if it
+ * still has not room.  Memory from json_buf_set_storage() is not made
+ * bigger but copied to a new buf.
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+char *
+json_buf_reserve(struct json_buf *out, size_t len)
+{
+    size_t size = 0;		/* new size of buf */
+    char *buf = NULL;		/* bigger buf */
+
+    /*
+     * firewall
+     */
+    if (out == NULL) {
+	err(130, __func__, "out is NULL");
+	not_reached();
+    }
+    if (out->error) {
+	return NULL;
+    }
+
+    /*
+     * case: there is room
+     */
+    if (out->size - out->len >= len) {
+	return out->buf + out->len;
+    }
+
+    /*
+     * write out what out holds
+     */
+    if ((out->fd >= 0 || out->stream != NULL) && out->len > 0) {
+	if (!buf_write_out(out, out->buf, out->len)) {
+	    return NULL;
+	}
+	out->len = 0;
+	if (out->size >= len) {
+	    return out->buf;
+	}
+    }
+
+    /*
+     * make buf bigger
+     */
+    if (len > SIZE_MAX / 2 - out->len) {
+	err(131, __func__, "cannot make room for %ju more bytes", (uintmax_t)len);
+	not_reached();
+    }
+    size = (out->size > 0) ? out->size : JSON_BUF_SIZE;
+    while (size - out->len < len) {
+	size *= 2;
+    }
+    errno = 0;			/* pre-clear errno for errp() */
+    if (out->borrowed) {
+	buf = malloc(size);
+	if (buf == NULL) {
+	    errp(134, __func__, "malloc of %ju bytes failed", (uintmax_t)size);
+	    not_reached();
+	}
+	if (out->len > 0) {
+	    memcpy(buf, out->buf, out->len);
+	}
+	out->borrowed = false;
+    } else {
+	buf = realloc(out->buf, size);
+	if (buf == NULL) {
+	    errp(132, __func__, "realloc of %ju bytes failed", (uintmax_t)size);
+	    not_reached();
+	}
+    }
+    out->buf = buf;
+    out->size = size;
+    return out->buf + out->len;
+}
+
+
+/*
+ * json_buf_write - write bytes to a struct json_buf
+ *
+ * given:
+ *	out	    struct json_buf
+ *	ptr	    bytes to write
+ *	len	    number of bytes
+ *
+ * returns:
+ *	true ==> the bytes were written,
+ *	false ==> a write failed
+ *
+ * Bytes that would fill the buffer of a struct json_buf with a file descriptor
+ * or stream on their own, or JSON_BUF_SIZE bytes or more, are written out
+ * without being copied.
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+bool
+json_buf_write(struct json_buf *out, char const *ptr, size_t len)
+{
+    char *p = NULL;		/* where the bytes go */
+
+    /*
+     * case: there is room
+     */
+    if (out != NULL && !out->error && out->size - out->len >= len) {
+	memcpy(out->buf + out->len, ptr, len);
+	out->len += len;
+	return true;
+    }
+
+    /*
+     * case: write a lot of bytes out as they are
+     */
+    if (out != NULL && (out->fd >= 0 || out->stream != NULL) &&
+	(len >= JSON_BUF_SIZE || (out->size > 0 && len >= out->size))) {
+	return json_buf_flush(out) && buf_write_out(out, ptr, len);
+    }
+
+    p = json_buf_reserve(out, len);
+    if (p == NULL) {
+	return false;
+    }
+    memcpy(p, ptr, len);
+    out->len += len;
+    return true;
+}
+
+
+/*
+ * json_buf_putc - write a byte to a struct json_buf
+ *
+ * given:
+ *	out	    struct json_buf
+ *	c	    byte to write
+ *
+ * returns:
+ *	true ==> the byte was written,
+ *	false ==> a write failed
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+bool
+json_buf_putc(struct json_buf *out, char c)
+{
+    char *p = NULL;		/* where the byte goes */
+
+    if (out != NULL && out->len < out->size && !out->error) {
+	out->buf[out->len++] = c;
+	return true;
+    }
+    p = json_buf_reserve(out, 1);
+    if (p == NULL) {
+	return false;
+    }
+    *p = c;
+    ++out->len;
+    return true;
+}
+
+
+/*
+ * json_buf_take - hand over the text of a struct json_buf
+ *
+ * given:
+ *	out	    struct json_buf from json_buf_init()
+ *	retlen	    where to store the length of the text, or NULL
+ *
+ * returns:
+ *	the text, NUL terminated, to be freed by the caller, or
+ *	NULL if a write failed
+ *
+ * out is left empty, as if json_buf_init() had been called.
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+char *
+json_buf_take(struct json_buf *out, size_t *retlen)
+{
+    char *ret = NULL;		/* text to return */
+
+    if (json_buf_reserve(out, 1) == NULL) {
+	return NULL;
+    }
+    out->buf[out->len] = '\0';
+    if (out->borrowed) {
+	errno = 0;		/* pre-clear errno for errp() */
+	ret = malloc(out->len + 1);
+	if (ret == NULL) {
+	    errp(135, __func__, "malloc of %ju bytes failed", (uintmax_t)(out->len + 1));
+	    not_reached();
+	}
+	memcpy(ret, out->buf, out->len + 1);
+	out->borrowed = false;
+    } else {
+	ret = out->buf;
+    }
+    if (retlen != NULL) {
+	*retlen = out->len;
+    }
+    out->buf = NULL;
+    out->len = 0;
+    out->size = 0;
+    return ret;
+}
+
+
+/*
+ * json_buf_set_storage - have a struct json_buf start with memory of the caller
+ *
+ * given:
+ *	out	    struct json_buf from json_buf_init(), json_buf_init_fd()
+ *		    or json_buf_init_stream() that nothing was written to
+ *	buf	    memory to gather text in
+ *	size	    bytes of buf
+ *
+ * With a file descriptor or stream, a small buf on the stack lets a few
+ * bytes at a time be gathered and written out without any malloc().  When
+ * buf is too small for what is to be gathered, the text is copied to
+ * allocated memory; buf itself is never freed by json_buf_fini().
+ *
+ * NOTE: this function does not return on NULL out, NULL buf or if out is
+ *	 already in use.
+ */
+void
+json_buf_set_storage(struct json_buf *out, char *buf, size_t size)
+{
+    /*
+     * firewall
+     */
+    if (out == NULL || buf == NULL) {
+	err(136, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+    if (out->buf != NULL || out->len > 0) {
+	err(137, __func__, "struct json_buf is already in use");
+	not_reached();
+    }
+
+    out->buf = buf;
+    out->len = 0;
+    out->size = size;
+    out->borrowed = true;
+}
+
+
+/*
+ * json_buf_write_escaped - write bytes to a struct json_buf with JSON decoding
+ *
+ * given:
+ *	out	    struct json_buf
+ *	ptr	    bytes to write
+ *	len	    number of bytes
+ *
+ * returns:
+ *	true ==> the bytes were written,
+ *	false ==> a write failed
+ *
+ * Each byte is written as json_decode() would write it: runs of bytes that
+ * stand for themselves, found by json_decode_run(), are copied as they are,
+ * and only the bytes that must be escaped are looked up in byte2asciistr[].
+ * No '"'s are written.
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+bool
+json_buf_write_escaped(struct json_buf *out, char const *ptr, size_t len)
+{
+    struct byte2asciistr const *b = NULL;	/* how a byte is written */
+    size_t start = 0;				/* first byte of a run that stands for itself */
+    size_t i = 0;
+
+    if (ptr == NULL) {
+	warn(__func__, "called with NULL ptr");
+	return false;
+    }
+
+    while (i < len) {
+
+	/*
+	 * copy a run of bytes that stand for themselves
+	 */
+	start = i;
+	i += json_decode_run(ptr + i, len - i);
+	if (i > start && !json_buf_write(out, ptr + start, i - start)) {
+	    return false;
+	}
+
+	/*
+	 * escape the bytes that must be
+	 */
+	for (; i < len && (b = &byte2asciistr[(uint8_t)ptr[i]])->len != 1; ++i) {
+	    if (!json_buf_write(out, b->enc, b->len)) {
+		return false;
+	    }
+	}
+    }
+    return true;
+}
+
+
+/*
+ * json_buf_write_str - write a string to a struct json_buf as a JSON string
+ *
+ * given:
+ *	out	    struct json_buf
+ *	str	    NUL terminated string, or NULL
+ *
+ * returns:
+ *	true ==> the string was written,
+ *	false ==> a write failed
+ *
+ * str is written JSON decoded between '"'s, and a NULL str is written as null.
+ *
+ * NOTE: this function does not return on NULL out or on allocation failure.
+ */
+bool
+json_buf_write_str(struct json_buf *out, char const *str)
+{
+    if (str == NULL) {
+	return json_buf_write(out, "null", 4);
+    }
+    return json_buf_putc(out, '"') && json_buf_write_escaped(out, str, strlen(str)) && json_buf_putc(out, '"');
+}
+
+/*
+ * buf_newline - start a new line of pretty JSON
+ *
+ * given:
+ *	out	    struct json_buf
+ *	indent	    spaces per level, 0 ==> compact JSON, so nothing is written
+ *	level	    number of objects and arrays the line is in
+ *
+ * returns:
+ *	true ==> the line was started,
+ *	false ==> a write failed
+ */
+static bool
+buf_newline(struct json_buf *out, unsigned int indent, size_t level)
+{
+    size_t spaces = 0;		/* spaces to indent the line by */
+    char *p = NULL;		/* where the line goes */
+
+    if (indent == 0) {
+	return true;
+    }
+    spaces = (size_t)indent * level;
+    p = json_buf_reserve(out, spaces + 1);
+    if (p == NULL) {
+	return false;
+    }
+    p[0] = '\n';
+    memset(p+1, ' ', spaces);
+    out->len += spaces + 1;
+    return true;
+}
+
+
+/*
+ * write_scalar - write a JSON number, string, boolean or null
+ *
+ * given:
+ *	out	    struct json_buf
+ *	node	    JSON parse tree node
+ *
+ * returns:
+ *	true ==> the value was written,
+ *	false ==> node is not a valid scalar or a write failed
+ *
+ * A number or string is written as it was in the JSON: the text the parser
+ * converted is already JSON, so it is copied and not formatted or escaped.
+ */
+static bool
+write_scalar(struct json_buf *out, struct json const *node)
+{
+    switch (node->type) {
+    case JTYPE_NUMBER:
+	{
+	    struct json_number const *item = JSON_NODE_ITEM(node, number);
+
+	    if (!PARSED_JSON_NODE(item) || item->first == NULL || item->number_len == 0) {
+		warn(__func__, "JSON number was not parsed");
+		return false;
+	    }
+	    return json_buf_write(out, item->first, item->number_len);
+	}
+    case JTYPE_STRING:
+	{
+	    struct json_string const *item = JSON_NODE_ITEM(node, string);
+	    char *p = NULL;		/* where the string goes */
+
+	    if (!CONVERTED_PARSED_JSON_NODE(item) || item->as_str == NULL) {
+		warn(__func__, "JSON string was not converted");
+		return false;
+	    }
+	    p = json_buf_reserve(out, item->as_str_len + 2);
+	    if (p == NULL) {
+		return false;
+	    }
+	    p[0] = '"';
+	    memcpy(p+1, item->as_str, item->as_str_len);
+	    p[item->as_str_len+1] = '"';
+	    out->len += item->as_str_len + 2;
+	    return true;
+	}
+    case JTYPE_BOOL:
+	{
+	    struct json_boolean const *item = JSON_NODE_ITEM(node, boolean);
+
+	    if (!CONVERTED_PARSED_JSON_NODE(item)) {
+		warn(__func__, "JSON boolean was not converted");
+		return false;
+	    }
+	    return item->value ? json_buf_write(out, "true", 4) : json_buf_write(out, "false", 5);
+	}
+    case JTYPE_NULL:
+	return json_buf_write(out, "null", 4);
+    default:
+	warn(__func__, "cannot write JSON node type: %s (%d)", json_item_type_name(node), node->type);
+	return false;
+    }
+}
+
+
+/*
+ * json_tree_write - write a JSON parse tree as JSON text
+ *
+ * given:
+ *	node	    JSON parse tree to write
+ *	out	    struct json_buf to write to
+ *	indent	    0 ==> compact JSON without whitespace,
+ *		    else pretty JSON with each member and value on a line of
+ *		    its own, indented by indent spaces per level
+ *
+ * returns:
+ *	true ==> the tree was written,
+ *	false ==> node or out is NULL, the tree has a node that was not parsed,
+ *		  or a write failed
+ *
+ * Numbers and strings, and member names, are written as they were in the
+ * JSON, so a tree that is written and parsed again gives the same tree.  A
+ * member on its own is written as name, ':' and value, and JTYPE_ELEMENTS
+ * is written as an array.  No newline is written after the tree.
+ *
+ * The tree is walked without recursion, so however deep it is, the stack
+ * does not overflow.
+ *
+ * NOTE: what a struct json_buf with a file descriptor or stream holds is not
+ *	 written out until it is full or json_buf_flush() or json_buf_fini()
+ *	 is called.
+ */
+bool
+json_tree_write(struct json const *node, struct json_buf *out, unsigned int indent)
+{
+    struct write_frame stack_frames[WRITE_STACK];   /* the first open objects and arrays */
+    struct write_frame *stack = stack_frames;	    /* open objects and arrays */
+    struct write_frame *new_stack = NULL;	    /* stack with more room */
+    size_t stack_size = WRITE_STACK;		    /* frames stack has room for */
+    size_t sp = 0;				    /* number of open objects and arrays */
+    struct write_frame *f = NULL;		    /* innermost open object or array */
+    struct json * const *set = NULL;		    /* children of node */
+    intmax_t len = 0;				    /* number of children of node */
+    char open = '\0';				    /* '{' or '[' of node */
+    bool ret = false;				    /* return value */
+
+    /*
+     * firewall
+     */
+    if (node == NULL || out == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+
+    for (;;) {
+
+	/*
+	 * write node
+	 */
+	if (node == NULL) {
+	    warn(__func__, "JSON parse tree has a NULL node");
+	    goto done;
+	}
+	switch (node->type) {
+	case JTYPE_MEMBER:
+	    {
+		struct json_member const *item = JSON_NODE_ITEM(node, member);
+
+		if (item->name_as_str == NULL || item->value == NULL) {
+		    warn(__func__, "JSON member was not converted");
+		    goto done;
+		}
+		if (!json_buf_putc(out, '"') || !json_buf_write(out, item->name_as_str, item->name_as_str_len) ||
+		    !json_buf_write(out, indent > 0 ? "\": " : "\":", indent > 0 ? 3 : 2)) {
+		    goto done;
+		}
+		node = item->value;
+		continue;
+	    }
+	case JTYPE_OBJECT:
+	    set = JSON_NODE_ITEM(node, object)->set;
+	    len = JSON_NODE_ITEM(node, object)->len;
+	    open = '{';
+	    break;
+	case JTYPE_ARRAY:
+	    set = JSON_NODE_ITEM(node, array)->set;
+	    len = JSON_NODE_ITEM(node, array)->len;
+	    open = '[';
+	    break;
+	case JTYPE_ELEMENTS:
+	    set = JSON_NODE_ITEM(node, elements)->set;
+	    len = JSON_NODE_ITEM(node, elements)->len;
+	    open = '[';
+	    break;
+	default:
+	    if (!write_scalar(out, node)) {
+		goto done;
+	    }
+	    len = -1;
+	    break;
+	}
+
+	/*
+	 * case: open an object or array that is not empty
+	 */
+	if (len > 0) {
+	    if (set == NULL) {
+		warn(__func__, "JSON %s has %jd children and a NULL set", json_item_type_name(node), len);
+		goto done;
+	    }
+	    if (sp == stack_size) {
+		errno = 0;	/* pre-clear errno for errp() */
+		new_stack = malloc(2 * stack_size * sizeof(*stack));
+		if (new_stack == NULL) {
+		    errp(133, __func__, "malloc of %ju write frames failed", (uintmax_t)(2 * stack_size));
+		    not_reached();
+		}
+		memcpy(new_stack, stack, sp * sizeof(*stack));
+		if (stack != stack_frames) {
+		    free(stack);
+		}
+		stack = new_stack;
+		stack_size *= 2;
+	    }
+	    f = &stack[sp++];
+	    f->set = set;
+	    f->len = len;
+	    f->i = 0;
+	    f->close = (open == '{') ? '}' : ']';
+	    if (!json_buf_putc(out, open) || !buf_newline(out, indent, sp)) {
+		goto done;
+	    }
+	    node = set[0];
+	    continue;
+	}
+
+	/*
+	 * case: an empty object or array
+	 */
+	if (len == 0) {
+	    if (!json_buf_putc(out, open) || !json_buf_putc(out, open == '{' ? '}' : ']')) {
+		goto done;
+	    }
+	}
+
+	/*
+	 * go on to the next child of the innermost open object or array,
+	 * closing those that have no more
+	 */
+	node = NULL;
+	while (sp > 0) {
+	    f = &stack[sp-1];
+	    if (++f->i < f->len) {
+		if (!json_buf_putc(out, ',') || !buf_newline(out, indent, sp)) {
+		    goto done;
+		}
+		node = f->set[f->i];
+		break;
+	    }
+	    --sp;
+	    if (!buf_newline(out, indent, sp) || !json_buf_putc(out, f->close)) {
+		goto done;
+	    }
+	}
+	if (node == NULL) {
+	    ret = !out->error;
+	    goto done;
+	}
+    }
+
+done:
+    if (stack != stack_frames) {
+	free(stack);
+    }
+    return ret;
+}
+
+
+/*
+ * json_tree_write_str - write a JSON parse tree as JSON text in memory
+ *
+ * given:
+ *	node	    JSON parse tree to write
+ *	indent	    0 ==> compact JSON, else spaces per level of pretty JSON
+ *	retlen	    where to store the length of the text, or NULL
+ *
+ * returns:
+ *	the text, NUL terminated, to be freed by the caller, or
+ *	NULL if the tree could not be written (see json_tree_write())
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+char *
+json_tree_write_str(struct json const *node, unsigned int indent, size_t *retlen)
+{
+    struct json_buf out;	/* text of the tree */
+    char *ret = NULL;		/* return value */
+
+    json_buf_init(&out);
+    if (json_tree_write(node, &out, indent)) {
+	ret = json_buf_take(&out, retlen);
+    }
+    (void) json_buf_fini(&out);
+    return ret;
+}
+
+
+/*
+ * json_tree_write_fd - write a JSON parse tree as JSON text to a file descriptor
+ *
+ * given:
+ *	node	    JSON parse tree to write
+ *	indent	    0 ==> compact JSON, else spaces per level of pretty JSON
+ *	fd	    open file descriptor to write to
+ *
+ * returns:
+ *	true ==> the tree was written,
+ *	false ==> the tree could not be written (see json_tree_write())
+ *
+ * The text is written JSON_BUF_SIZE bytes at a time.  If the tree has a node
+ * that was not parsed, what came before it may have been written.
+ *
+ * NOTE: this function does not return on a negative fd or on allocation failure.
+ */
+bool
+json_tree_write_fd(struct json const *node, unsigned int indent, int fd)
+{
+    struct json_buf out;	/* what is to be written to fd */
+    bool ret = false;		/* return value */
+
+    json_buf_init_fd(&out, fd);
+    ret = json_tree_write(node, &out, indent);
+    if (!json_buf_fini(&out)) {
+	ret = false;
+    }
+    return ret;
+}
+
+
+/*
+ * json_writer_init - initialise a struct json_writer
+ *
+ * given:
+ *	w	    struct json_writer to initialise
+ *	out	    struct json_buf the JSON text is written to
+ *	indent	    0 ==> compact JSON without whitespace,
+ *		    else pretty JSON with each member and value on a line of
+ *		    its own, indented by indent spaces per level
+ *
+ * The JSON text is laid out as json_tree_write() lays it out.
+ *
+ * NOTE: this function does not return on NULL pointers.
+ */
+void
+json_writer_init(struct json_writer *w, struct json_buf *out, unsigned int indent)
+{
+    /*
+     * firewall
+     */
+    if (w == NULL || out == NULL) {
+	err(138, __func__, "called with NULL arg(s)");
+	not_reached();
+    }
+
+    memset(w, 0, sizeof(*w));
+    w->out = out;
+    w->indent = indent;
+    w->close = NULL;
+    w->depth = 0;
+    w->size = 0;
+    w->first = true;
+    w->named = false;
+    w->done = false;
+    w->error = false;
+}
+
+
+/*
+ * json_writer_fini - free what a struct json_writer allocated
+ *
+ * given:
+ *	w	    struct json_writer, may be NULL
+ *
+ * returns:
+ *	true ==> one whole JSON value was written,
+ *	false ==> w is NULL, nothing or only part of a value was written, a
+ *		  call was refused or a write failed
+ *
+ * The struct json_buf is neither flushed nor freed: the caller does that
+ * with json_buf_flush() or json_buf_fini().
+ */
+bool
+json_writer_fini(struct json_writer *w)
+{
+    bool ret = false;		/* return value */
+
+    if (w == NULL) {
+	return false;
+    }
+    ret = w->done && w->depth == 0 && !w->error && !w->out->error;
+    if (w->close != NULL) {
+	free(w->close);
+	w->close = NULL;
+    }
+    w->depth = 0;
+    w->size = 0;
+    return ret;
+}
+
+
+/*
+ * writer_value - start a value
+ *
+ * given:
+ *	w	    struct json_writer
+ *	name	    name of the calling function, for warnings
+ *
+ * returns:
+ *	true ==> a value may be written next,
+ *	false ==> a value is not allowed here or a write failed
+ *
+ * In an array the ',' before the value, and for pretty JSON the newline
+ * and indent, are written.  In an object the value must follow a name.
+ */
+static bool
+writer_value(struct json_writer *w, char const *name)
+{
+    if (w == NULL) {
+	warn(name, "called with NULL writer");
+	return false;
+    }
+    if (w->error || w->out->error) {
+	w->error = true;
+	return false;
+    }
+
+    /*
+     * case: the value is all of the JSON
+     */
+    if (w->depth == 0) {
+	if (w->done) {
+	    warn(name, "a whole JSON value was already written");
+	    w->error = true;
+	    return false;
+	}
+	return true;
+    }
+
+    /*
+     * case: the value of a member
+     */
+    if (w->close[w->depth-1] == '}') {
+	if (!w->named) {
+	    warn(name, "a value in a JSON object must follow a name");
+	    w->error = true;
+	    return false;
+	}
+	w->named = false;
+	return true;
+    }
+
+    /*
+     * case: an element of an array
+     */
+    if ((!w->first && !json_buf_putc(w->out, ',')) || !buf_newline(w->out, w->indent, w->depth)) {
+	w->error = true;
+	return false;
+    }
+    w->first = false;
+    return true;
+}
+
+
+/*
+ * writer_open - begin an object or array
+ *
+ * given:
+ *	w	    struct json_writer
+ *	open	    '{' or '['
+ *	name	    name of the calling function, for warnings
+ *
+ * returns:
+ *	true ==> the object or array was begun,
+ *	false ==> a value is not allowed here or a write failed
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+static bool
+writer_open(struct json_writer *w, char open, char const *name)
+{
+    char *close = NULL;		/* close with more room */
+    size_t size = 0;		/* entries close has room for */
+
+    if (!writer_value(w, name)) {
+	return false;
+    }
+    if (w->depth == w->size) {
+	size = (w->size > 0) ? w->size * 2 : JSON_WRITER_STACK;
+	errno = 0;		/* pre-clear errno for errp() */
+	close = realloc(w->close, size);
+	if (close == NULL) {
+	    errp(139, __func__, "realloc of %ju open objects and arrays failed", (uintmax_t)size);
+	    not_reached();
+	}
+	w->close = close;
+	w->size = size;
+    }
+    if (!json_buf_putc(w->out, open)) {
+	w->error = true;
+	return false;
+    }
+    w->close[w->depth++] = (open == '{') ? '}' : ']';
+    w->first = true;
+    return true;
+}
+
+
+/*
+ * writer_close - end an object or array
+ *
+ * given:
+ *	w	    struct json_writer
+ *	close	    '}' or ']'
+ *	name	    name of the calling function, for warnings
+ *
+ * returns:
+ *	true ==> the object or array was ended,
+ *	false ==> the innermost open object or array is not one that close
+ *		  ends, or a write failed
+ */
+static bool
+writer_close(struct json_writer *w, char close, char const *name)
+{
+    if (w == NULL) {
+	warn(name, "called with NULL writer");
+	return false;
+    }
+    if (w->error || w->out->error) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0 || w->close[w->depth-1] != close) {
+	warn(name, "no JSON %s is open", close == '}' ? "object" : "array");
+	w->error = true;
+	return false;
+    }
+    if (w->named) {
+	warn(name, "the last name of the JSON object has no value");
+	w->error = true;
+	return false;
+    }
+    --w->depth;
+    if ((!w->first && !buf_newline(w->out, w->indent, w->depth)) || !json_buf_putc(w->out, close)) {
+	w->error = true;
+	return false;
+    }
+    w->first = false;
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
+
+
+/*
+ * json_writer_begin_object - begin a JSON object
+ *
+ * given:
+ *	w	    struct json_writer
+ *
+ * returns:
+ *	true ==> the object was begun,
+ *	false ==> a value is not allowed here or a write failed
+ *
+ * Each member of the object is written by json_writer_key() followed by one
+ * value, and the object is ended by json_writer_end_object().
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+bool
+json_writer_begin_object(struct json_writer *w)
+{
+    return writer_open(w, '{', __func__);
+}
+
+
+/*
+ * json_writer_end_object - end the JSON object begun last
+ *
+ * given:
+ *	w	    struct json_writer
+ *
+ * returns:
+ *	true ==> the object was ended,
+ *	false ==> no object is the innermost one open, its last name has no
+ *		  value, or a write failed
+ */
+bool
+json_writer_end_object(struct json_writer *w)
+{
+    return writer_close(w, '}', __func__);
+}
+
+
+/*
+ * json_writer_begin_array - begin a JSON array
+ *
+ * given:
+ *	w	    struct json_writer
+ *
+ * returns:
+ *	true ==> the array was begun,
+ *	false ==> a value is not allowed here or a write failed
+ *
+ * NOTE: this function does not return on allocation failure.
+ */
+bool
+json_writer_begin_array(struct json_writer *w)
+{
+    return writer_open(w, '[', __func__);
+}
+
+
+/*
+ * json_writer_end_array - end the JSON array begun last
+ *
+ * given:
+ *	w	    struct json_writer
+ *
+ * returns:
+ *	true ==> the array was ended,
+ *	false ==> no array is the innermost one open, or a write failed
+ */
+bool
+json_writer_end_array(struct json_writer *w)
+{
+    return writer_close(w, ']', __func__);
+}
+
+
+/*
+ * json_writer_key - write the name of a member of a JSON object
+ *
+ * given:
+ *	w	    struct json_writer
+ *	name	    NUL terminated name, to be JSON decoded
+ *
+ * returns:
+ *	true ==> the name was written,
+ *	false ==> no object is the innermost one open, a name was just
+ *		  written, name is NULL or a write failed
+ *
+ * The value of the member is written next.
+ */
+bool
+json_writer_key(struct json_writer *w, char const *name)
+{
+    if (w == NULL || name == NULL) {
+	warn(__func__, "called with NULL arg(s)");
+	return false;
+    }
+    if (w->error || w->out->error) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0 || w->close[w->depth-1] != '}') {
+	warn(__func__, "a name must be in a JSON object");
+	w->error = true;
+	return false;
+    }
+    if (w->named) {
+	warn(__func__, "the last name of the JSON object has no value");
+	w->error = true;
+	return false;
+    }
+    if ((!w->first && !json_buf_putc(w->out, ',')) || !buf_newline(w->out, w->indent, w->depth) ||
+	!json_buf_write_str(w->out, name) ||
+	!json_buf_write(w->out, w->indent > 0 ? ": " : ":", w->indent > 0 ? 2 : 1)) {
+	w->error = true;
+	return false;
+    }
+    w->first = false;
+    w->named = true;
+    return true;
+}
+
+
+/*
+ * json_writer_string - write a JSON string
+ *
+ * given:
+ *	w	    struct json_writer
+ *	str	    NUL terminated string to JSON decode, or NULL
+ *
+ * returns:
+ *	true ==> the string was written,
+ *	false ==> a value is not allowed here or a write failed
+ *
+ * A NULL str is written as null.
+ */
+bool
+json_writer_string(struct json_writer *w, char const *str)
+{
+    if (!writer_value(w, __func__)) {
+	return false;
+    }
+    if (!json_buf_write_str(w->out, str)) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
+
+
+/*
+ * json_writer_int64 - write a JSON integer
+ *
+ * given:
+ *	w	    struct json_writer
+ *	value	    integer to write
+ *
+ * returns:
+ *	true ==> the integer was written,
+ *	false ==> a value is not allowed here or a write failed
+ */
+bool
+json_writer_int64(struct json_writer *w, int64_t value)
+{
+    char digits[sizeof("-9223372036854775808")];    /* value in decimal, from the end */
+    char *p = digits + sizeof(digits);		    /* first digit written so far */
+    uint64_t u = 0;				    /* magnitude of value */
+
+    if (!writer_value(w, __func__)) {
+	return false;
+    }
+    u = (value < 0) ? (uint64_t)0 - (uint64_t)value : (uint64_t)value;
+    do {
+	*--p = (char)('0' + u % 10);
+	u /= 10;
+    } while (u > 0);
+    if (value < 0) {
+	*--p = '-';
+    }
+    if (!json_buf_write(w->out, p, (size_t)(digits + sizeof(digits) - p))) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
+
+
+/*
+ * json_writer_double - write a JSON number that is not always an integer
+ *
+ * given:
+ *	w	    struct json_writer
+ *	value	    finite number to write
+ *
+ * returns:
+ *	true ==> the number was written,
+ *	false ==> value is infinite or NaN, which JSON has no way to write, a
+ *		  value is not allowed here or a write failed
+ *
+ * The number is written with the fewest significant digits, up to 17, that
+ * strtod(3) turns back into the same double.  A '.' is always the decimal
+ * point, whatever the locale of the program.
+ */
+bool
+json_writer_double(struct json_writer *w, double value)
+{
+    char text[32];				    /* value as text */
+    int len = 0;				    /* length of text */
+    int prec;
+
+    if (!writer_value(w, __func__)) {
+	return false;
+    }
+    if (!isfinite(value)) {
+	warn(__func__, "JSON has no way to write %s", isnan(value) ? "NaN" : "an infinity");
+	w->error = true;
+	return false;
+    }
+    /*
+     * %g drops trailing zeros, so when %.15g reads back exactly there is no
+     * shorter text for a normal double: each decimal of 15 digits or fewer is
+     * the %.15g of the double nearest to it.  A subnormal double has fewer
+     * significant bits, so its shortest text may be shorter: 5e-324 is
+     * 4.94065645841247e-324 with %.15g.  Look for it from 1 digit up.
+     */
+    prec = (value != 0.0 && fabs(value) < DBL_MIN) ? 1 : 15;
+    for (; prec <= 17; ++prec) {
+	len = json_fmt_double(text, sizeof(text), prec, value);
+	if (len <= 0 || (size_t)len >= sizeof(text)) {
+	    warn(__func__, "snprintf of %.17g failed", value);
+	    w->error = true;
+	    return false;
+	}
+	if (json_strtod(text, NULL) == value) {
+	    break;
+	}
+    }
+    if (!json_buf_write(w->out, text, (size_t)len)) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
+
+
+/*
+ * json_writer_bool - write a JSON boolean
+ *
+ * given:
+ *	w	    struct json_writer
+ *	value	    boolean to write
+ *
+ * returns:
+ *	true ==> true or false was written,
+ *	false ==> a value is not allowed here or a write failed
+ */
+bool
+json_writer_bool(struct json_writer *w, bool value)
+{
+    if (!writer_value(w, __func__)) {
+	return false;
+    }
+    if (!(value ? json_buf_write(w->out, "true", 4) : json_buf_write(w->out, "false", 5))) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
+
+
+/*
+ * json_writer_null - write a JSON null
+ *
+ * given:
+ *	w	    struct json_writer
+ *
+ * returns:
+ *	true ==> null was written,
+ *	false ==> a value is not allowed here or a write failed
+ */
+bool
+json_writer_null(struct json_writer *w)
+{
+    if (!writer_value(w, __func__)) {
+	return false;
+    }
+    if (!json_buf_write(w->out, "null", 4)) {
+	w->error = true;
+	return false;
+    }
+    if (w->depth == 0) {
+	w->done = true;
+    }
+    return true;
+}
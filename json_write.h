@@ -0,0 +1,129 @@
+/*
+ * json_write - write JSON parse trees as JSON text
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JSON_WRITE_H)
+#    define  INCLUDE_JSON_WRITE_H
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * json_parse - JSON parser support code
+ */
+#include "json_parse.h"
+
+
+/*
+ * definitions
+ */
+#define JSON_BUF_SIZE (65536)		/* bytes a struct json_buf holds before they are written out */
+#define JSON_WRITER_STACK (64)		/* open objects and arrays a struct json_writer tracks before it allocates */
+
+
+/*
+ * struct json_buf - where JSON text is written
+ *
+ * Text is gathered in buf.  When fd >= 0 or stream != NULL, buf is written
+ * out with one write(2) or fwrite(3) each time it is full, and by
+ * json_buf_flush(), so that the text is written in large pieces.  Otherwise
+ * buf grows to hold all of the text, which json_buf_take() hands over.
+ *
+ * Use json_buf_init(), json_buf_init_fd() or json_buf_init_stream() to
+ * initialise a struct json_buf and json_buf_fini() when done with it.
+ * json_buf_set_storage() lets it start with memory of the caller, such as an
+ * array on the stack, instead of allocating buf.
+ */
+struct json_buf
+{
+    char *buf;			/* text not yet written out, or all of the text */
+    size_t len;			/* bytes in buf */
+    size_t size;		/* bytes buf has room for */
+
+    int fd;			/* file descriptor buf is written to, or -1 */
+    FILE *stream;		/* stream buf is written to, or NULL */
+
+    bool error;			/* true ==> a write failed, what follows is dropped */
+    bool borrowed;		/* true ==> buf is memory of the caller, not to be freed */
+};
+
+/*
+ * struct json_writer - write JSON text a value at a time
+ *
+ * The json_writer_*() functions write the members and values of JSON
+ * objects and arrays to a struct json_buf, putting in the ','s, ':'s and,
+ * for pretty JSON, the newlines and indents.  The writer tracks the objects
+ * and arrays that are open, and refuses what would not be JSON, such as a
+ * value in an object without a name or a ']' that closes an object.
+ *
+ * Use json_writer_init() to initialise a struct json_writer and
+ * json_writer_fini() when done with it.
+ */
+struct json_writer
+{
+    struct json_buf *out;	/* where the JSON text goes */
+    unsigned int indent;	/* 0 ==> compact JSON, else spaces per level */
+
+    char *close;		/* '}' or ']' of each open object and array */
+    size_t depth;		/* number of open objects and arrays */
+    size_t size;		/* entries close has room for */
+
+    bool first;			/* true ==> nothing is yet in the innermost open object or array */
+    bool named;			/* true ==> a name was written, its value comes next */
+    bool done;			/* true ==> a whole JSON value was written */
+    bool error;			/* true ==> a call was refused or a write failed */
+};
+
+
+/*
+ * external function declarations
+ */
+extern void json_buf_init(struct json_buf *out);
+extern void json_buf_init_fd(struct json_buf *out, int fd);
+extern void json_buf_init_stream(struct json_buf *out, FILE *stream);
+extern bool json_buf_fini(struct json_buf *out);
+extern bool json_buf_flush(struct json_buf *out);
+extern char *json_buf_reserve(struct json_buf *out, size_t len);
+extern bool json_buf_write(struct json_buf *out, char const *ptr, size_t len);
+extern bool json_buf_putc(struct json_buf *out, char c);
+extern char *json_buf_take(struct json_buf *out, size_t *retlen);
+extern void json_buf_set_storage(struct json_buf *out, char *buf, size_t size);
+extern bool json_buf_write_escaped(struct json_buf *out, char const *ptr, size_t len);
+extern bool json_buf_write_str(struct json_buf *out, char const *str);
+extern bool json_tree_write(struct json const *node, struct json_buf *out, unsigned int indent);
+extern char *json_tree_write_str(struct json const *node, unsigned int indent, size_t *retlen);
+extern bool json_tree_write_fd(struct json const *node, unsigned int indent, int fd);
+extern void json_writer_init(struct json_writer *w, struct json_buf *out, unsigned int indent);
+extern bool json_writer_fini(struct json_writer *w);
+extern bool json_writer_begin_object(struct json_writer *w);
+extern bool json_writer_end_object(struct json_writer *w);
+extern bool json_writer_begin_array(struct json_writer *w);
+extern bool json_writer_end_array(struct json_writer *w);
+extern bool json_writer_key(struct json_writer *w, char const *name);
+extern bool json_writer_string(struct json_writer *w, char const *str);
+extern bool json_writer_int64(struct json_writer *w, int64_t value);
+extern bool json_writer_double(struct json_writer *w, double value);
+extern bool json_writer_bool(struct json_writer *w, bool value);
+extern bool json_writer_null(struct json_writer *w);
+
+
+#endif /* INCLUDE_JSON_WRITE_H */
@@ -0,0 +1,576 @@
+/*
+ * jdoc_chk - tool to check the jdoc_* JSON document API
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+/*
+ * jdoc_chk - tool to check the jdoc_* JSON document API
+ */
+#include "jdoc_chk.h"
+
+
+/*
+ * definitions
+ */
+#define REQUIRED_ARGS (0)	/* number of required arguments on the command line */
+
+/*
+ * usage message
+ *
+ * Use the usage() function to print the usage_msg([0-9]?)+ strings.
+ */
+static const char * const usage_msg =
+    "usage: %s [-h] [-v level] [-J level] [-V] [-q]\n"
+    "\n"
+    "\t-h\t\tPrint help message and exit\n"
+    "\t-v level\tSet verbosity level (def level: %d)\n"
+    "\t-J level\tSet JSON verbosity level (def level: %d)\n"
+    "\t-V\t\tPrint version string and exit\n"
+    "\t-q\t\tQuiet mode (def: not quiet)\n"
+    "\t\t\t    NOTE: -q will also silence msg(), warn(), warnp() if -v 0\n"
+    "\n"
+    "Exit codes:\n"
+    "    0\t\tall is OK\n"
+    "    1\t\tsome jdoc_* check failed\n"
+    "    2\t\t-h and help string printed or -V and version string printed\n"
+    "    3\t\tcommand line error\n"
+    "    >=10\tinternal error\n"
+    "\n"
+    "%s version: %s\n"
+    "jparse UTF-8 version: %s\n"
+    "jparse library version: %s";
+
+/*
+ * the document checked, with %s for the two long member names made by main()
+ *
+ * The names of the members with the value 2 to 5 have escapes in them, so
+ * jdoc_get_member() must decode them to compare.
+ */
+static char const * const doc_fmt =
+    "{\"plain\":1, \"tab\\tname\":2, \"\\u00e9t\\u00e9\":3, \"%s\":4, \"%s\":5, \"dup\":6, \"dup\":7,\n"
+    " \"arr\":[10, [20, 21], {\"x\":30}], \"empty\":[], \"obj\":{},\n"
+    " \"min\":-9223372036854775808, \"max\":9223372036854775807,\n"
+    " \"over\":9223372036854775808, \"under\":-9223372036854775809,\n"
+    " \"frac\":1.5, \"exp\":1e3, \"big\":1e400, \"small\":-1e400,\n"
+    " \"str\":\"s\\u0021\", \"t\":true, \"f\":false, \"n\":null}\n";
+
+/*
+ * static variables
+ */
+static bool error = false;	/* true ==> some check failed */
+static FILE *devnull = NULL;	/* write stream to /dev/null */
+
+
+/*
+ * forward declarations
+ */
+static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
+static size_t member(struct jdoc const *doc, char const *name);
+static void chk_index(char const *what, size_t got, size_t want);
+static void chk_int64(struct jdoc const *doc, char const *name, bool ok, int64_t want);
+static void chk_double(struct jdoc const *doc, char const *name, bool ok, double want);
+static void chk_bool(struct jdoc const *doc, char const *what, size_t v, bool ok, bool want);
+static void chk_string(struct jdoc const *doc, char const *what, size_t v, char const *want, size_t want_len);
+static void chk_invalid(char const *json);
+
+int
+main(int argc, char *argv[])
+{
+    char const *program = NULL;	/* our name */
+    extern char *optarg;	/* option argument */
+    extern int optind;		/* argv index of the next arg */
+    char stack_name[JDOC_NAME_BUF + 1];	/* longest escaped name decoded on the stack, as in the JSON */
+    char heap_name[JDOC_NAME_BUF + 8];	/* shortest escaped name decoded on the heap, as in the JSON */
+    char want[JDOC_NAME_BUF + 1];	/* decoding of one of those names */
+    char *json = NULL;		/* the document checked */
+    size_t json_len = 0;	/* length of json */
+    struct jdoc *doc = NULL;	/* json parsed */
+    bool is_valid = false;	/* true ==> json is valid */
+    size_t arr = JDOC_NONE;	/* tape index of the "arr" array */
+    size_t v = JDOC_NONE;	/* tape index of a value */
+    size_t count = 0;		/* values found by jdoc_first() and jdoc_next() */
+    int arg_count = 0;		/* number of args to process */
+    int i;
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:J:Vq")) != -1) {
+	switch (i) {
+	case 'h':		/* -h - print help to stderr and exit 0 */
+	    usage(2, program, ""); /*ooo*/
+	    not_reached();
+	    break;
+	case 'v':		/* -v verbosity */
+	    /*
+	     * parse verbosity
+	     */
+	    verbosity_level = parse_verbosity(optarg);
+	    if (verbosity_level < 0) {
+		usage(3, program, "invalid -v verbosity"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'J':		/* -J json_verbosity */
+	    /*
+	     * parse JSON verbosity level
+	     */
+	    json_verbosity_level = parse_verbosity(optarg);
+	    if (json_verbosity_level < 0) {
+		usage(3, program, "invalid -J json_verbosity"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'V':		/* -V - print version and exit */
+	    print("%s version: %s\n", JDOC_CHK_BASENAME, JDOC_CHK_VERSION);
+	    print("jparse UTF-8 version: %s\n", JPARSE_UTF8_VERSION);
+	    print("jparse library version: %s\n", JPARSE_LIBRARY_VERSION);
+	    exit(2); /*ooo*/
+	    not_reached();
+	    break;
+	case 'q':
+	    msg_warn_silent = true;
+	    break;
+	case ':':   /* option requires an argument */
+	case '?':   /* illegal option */
+	default:    /* anything else but should not actually happen */
+	    check_invalid_option(program, i, optopt);
+	    usage(3, program, ""); /*ooo*/
+	    not_reached();
+	    break;
+	}
+    }
+    arg_count = argc - optind;
+    if (arg_count != REQUIRED_ARGS) {
+	usage(3, program, "wrong number of arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * make the long names: the first decodes to JDOC_NAME_BUF-1 bytes, the
+     * most jdoc_get_member() decodes on the stack, the second to JDOC_NAME_BUF
+     * bytes, the fewest it decodes with json_encode()
+     */
+    memset(stack_name, 'a', JDOC_NAME_BUF - 2);
+    memcpy(stack_name + JDOC_NAME_BUF - 2, "\\n", sizeof("\\n"));
+    memcpy(heap_name, "\\u0062", sizeof("\\u0062")-1);
+    memset(heap_name + sizeof("\\u0062")-1, 'a', JDOC_NAME_BUF - 1);
+    heap_name[sizeof("\\u0062")-1 + JDOC_NAME_BUF - 1] = '\0';
+
+    /*
+     * parse the document
+     */
+    json_len = strlen(doc_fmt) + strlen(stack_name) + strlen(heap_name);
+    errno = 0;		/* pre-clear errno for errp() */
+    json = malloc(json_len + 1);
+    if (json == NULL) {
+	errp(10, program, "malloc of %ju bytes failed", (uintmax_t)json_len + 1);
+	not_reached();
+    }
+    json_len = (size_t)snprintf(json, json_len + 1, doc_fmt, stack_name, heap_name);
+    doc = jdoc_parse(json, json_len, NULL, &is_valid);
+    if (doc == NULL || !is_valid) {
+	err(11, program, "jdoc_parse() of the document to check failed"); /*ooo*/
+	not_reached();
+    }
+    if (jdoc_type(doc, JDOC_ROOT) != JDOC_OBJECT || jdoc_length(doc, JDOC_ROOT) != 22) {
+	warn(__func__, "the document is not an object of 22 members");
+	error = true;
+    }
+
+    /*
+     * jdoc_get_member() with names that are and are not escaped
+     */
+    chk_int64(doc, "plain", true, 1);
+    chk_int64(doc, "tab\tname", true, 2);
+    chk_int64(doc, "\xc3\xa9t\xc3\xa9", true, 3);
+    memset(want, 'a', JDOC_NAME_BUF - 2);
+    memcpy(want + JDOC_NAME_BUF - 2, "\n", sizeof("\n"));
+    chk_int64(doc, want, true, 4);
+    want[0] = 'b';
+    memset(want + 1, 'a', JDOC_NAME_BUF - 1);
+    want[JDOC_NAME_BUF] = '\0';
+    chk_int64(doc, want, true, 5);
+    chk_int64(doc, "dup", true, 6);
+
+    /*
+     * names that are not there: as they are in the JSON, a prefix of a name
+     * that is escaped, and a name of the same length as a decoding that is not
+     * the same
+     */
+    chk_index("member \"tab\\\\tname\"", member(doc, "tab\\tname"), JDOC_NONE);
+    chk_index("member \"tab\"", member(doc, "tab"), JDOC_NONE);
+    chk_index("member \"tab\\tnamf\"", member(doc, "tab\tnamf"), JDOC_NONE);
+    want[JDOC_NAME_BUF - 1] = 'b';
+    chk_index("member \"baaa...b\"", member(doc, want), JDOC_NONE);
+    chk_index("member \"nope\"", member(doc, "nope"), JDOC_NONE);
+    chk_index("NULL member name", jdoc_get_member(doc, JDOC_ROOT, NULL, 0), JDOC_NONE);
+
+    /*
+     * jdoc_array_at() within and past the end of an array
+     */
+    arr = member(doc, "arr");
+    if (jdoc_type(doc, arr) != JDOC_ARRAY || jdoc_length(doc, arr) != 3) {
+	warn(__func__, "member \"arr\" is not an array of 3 elements");
+	error = true;
+    }
+    v = jdoc_array_at(doc, arr, 0);
+    chk_index("arr[0]", jdoc_type(doc, v), JDOC_NUMBER);
+    v = jdoc_array_at(doc, jdoc_array_at(doc, arr, 1), 1);
+    chk_string(doc, "arr[1][1]", v, NULL, 0);
+    if (jdoc_raw(doc, v, NULL) == NULL || strncmp(jdoc_raw(doc, v, NULL), "21", 2) != 0) {
+	warn(__func__, "arr[1][1] is not 21");
+	error = true;
+    }
+    v = jdoc_get_member(doc, jdoc_array_at(doc, arr, 2), "x", 1);
+    chk_index("arr[2].x", jdoc_type(doc, v), JDOC_NUMBER);
+    chk_index("arr[3]", jdoc_array_at(doc, arr, 3), JDOC_NONE);
+    chk_index("arr[SIZE_MAX]", jdoc_array_at(doc, arr, SIZE_MAX), JDOC_NONE);
+    chk_index("empty[0]", jdoc_array_at(doc, member(doc, "empty"), 0), JDOC_NONE);
+    chk_index("jdoc_first(empty)", jdoc_first(doc, member(doc, "empty")), JDOC_NONE);
+    chk_index("jdoc_first(obj)", jdoc_first(doc, member(doc, "obj")), JDOC_NONE);
+    for (v = jdoc_first(doc, arr); v != JDOC_NONE; v = jdoc_next(doc, v)) {
+	++count;
+    }
+    chk_index("elements of arr", count, 3);
+
+    /*
+     * jdoc_as_int64() at the limits of an int64_t and past them
+     */
+    chk_int64(doc, "min", true, INT64_MIN);
+    chk_int64(doc, "max", true, INT64_MAX);
+    chk_int64(doc, "over", false, 0);
+    chk_int64(doc, "under", false, 0);
+    chk_int64(doc, "frac", false, 0);
+    chk_int64(doc, "exp", false, 0);
+
+    /*
+     * jdoc_as_double() within and past the range of a double
+     */
+    chk_double(doc, "frac", true, 1.5);
+    chk_double(doc, "exp", true, 1000.0);
+    chk_double(doc, "min", true, -9223372036854775808.0);
+    chk_double(doc, "big", false, 0.0);
+    chk_double(doc, "small", false, 0.0);
+
+    /*
+     * the other conversions
+     */
+    chk_string(doc, "member \"str\"", member(doc, "str"), "s!", 2);
+    chk_string(doc, "name of member \"tab\\tname\"", member(doc, "tab\tname") - 1, "tab\tname", 8);
+    chk_bool(doc, "member \"t\"", member(doc, "t"), true, true);
+    chk_bool(doc, "member \"f\"", member(doc, "f"), true, false);
+    if (!jdoc_is_null(doc, member(doc, "n"))) {
+	warn(__func__, "member \"n\" is not null");
+	error = true;
+    }
+
+    /*
+     * each conversion of a value of the wrong type, or of no value, must fail
+     */
+    chk_int64(doc, "str", false, 0);
+    chk_int64(doc, "t", false, 0);
+    chk_int64(doc, "arr", false, 0);
+    chk_double(doc, "n", false, 0.0);
+    chk_double(doc, "obj", false, 0.0);
+    chk_bool(doc, "member \"plain\"", member(doc, "plain"), false, false);
+    chk_bool(doc, "member \"n\"", member(doc, "n"), false, false);
+    chk_string(doc, "member \"plain\"", member(doc, "plain"), NULL, 0);
+    chk_string(doc, "member \"arr\"", arr, NULL, 0);
+    if (jdoc_is_null(doc, member(doc, "f")) || jdoc_is_null(doc, JDOC_NONE)) {
+	warn(__func__, "jdoc_is_null() is true for a value that is not null");
+	error = true;
+    }
+    chk_index("jdoc_get_member() of an array", jdoc_get_member(doc, arr, "x", 1), JDOC_NONE);
+    chk_index("jdoc_array_at() of an object", jdoc_array_at(doc, JDOC_ROOT, 0), JDOC_NONE);
+    chk_index("jdoc_length() of a string", jdoc_length(doc, member(doc, "str")), 0);
+    chk_index("jdoc_type(JDOC_NONE)", jdoc_type(doc, JDOC_NONE), JDOC_UNSET);
+    chk_index("jdoc_skip(JDOC_NONE)", jdoc_skip(doc, JDOC_NONE), JDOC_NONE);
+    chk_int64(doc, "nope", false, 0);
+
+    jdoc_free(doc);
+    doc = NULL;
+    free(json);
+    json = NULL;
+
+    /*
+     * invalid documents, their syntax errors are only written with -v 3 or more
+     */
+    if (verbosity_level < DBG_MED) {
+	errno = 0;		/* pre-clear errno for errp() */
+	devnull = fopen("/dev/null", "w");
+	if (devnull == NULL) {
+	    errp(12, program, "cannot open /dev/null"); /*ooo*/
+	    not_reached();
+	}
+    }
+    chk_invalid("{\"a\":1,}");
+    chk_invalid("[\"\\x\"]");
+    chk_invalid("[\"\\ud800\"]");
+    chk_invalid("[1] [2]");
+    chk_invalid("");
+    if (devnull != NULL) {
+	(void) fclose(devnull);
+	devnull = NULL;
+    }
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    if (error == true) {
+	exit(1); /*ooo*/
+    }
+    exit(0); /*ooo*/
+}
+
+
+/*
+ * member - find a member of the top level object by a NUL terminated name
+ *
+ * given:
+ *	doc	document
+ *	name	decoded name
+ *
+ * returns:
+ *	tape index of the value of the member, JDOC_NONE if there is none
+ */
+static size_t
+member(struct jdoc const *doc, char const *name)
+{
+    return jdoc_get_member(doc, JDOC_ROOT, name, strlen(name));
+}
+
+
+/*
+ * chk_index - check a tape index, count or type
+ *
+ * given:
+ *	what	what is checked, for the warning
+ *	got	what was found
+ *	want	what must be found
+ */
+static void
+chk_index(char const *what, size_t got, size_t want)
+{
+    if (got != want) {
+	warn(__func__, "%s: %ju != %ju", what, (uintmax_t)got, (uintmax_t)want);
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: %s: %ju", what, (uintmax_t)got);
+    }
+}
+
+
+/*
+ * chk_int64 - check jdoc_as_int64() of a member of the top level object
+ *
+ * given:
+ *	doc	document
+ *	name	decoded name of the member
+ *	ok	true ==> the conversion must succeed, false ==> it must fail
+ *	want	value the conversion must give if ok
+ */
+static void
+chk_int64(struct jdoc const *doc, char const *name, bool ok, int64_t want)
+{
+    int64_t got = 0;	/* converted value */
+    bool ret = false;	/* jdoc_as_int64() return */
+
+    ret = jdoc_as_int64(doc, member(doc, name), &got);
+    if (ret != ok) {
+	warn(__func__, "member \"%.16s\": jdoc_as_int64() returned %s", name, ret ? "true" : "false");
+	error = true;
+    } else if (ok && got != want) {
+	warn(__func__, "member \"%.16s\": %" PRId64 " != %" PRId64, name, got, want);
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: jdoc_as_int64() of member \"%.16s\"", name);
+    }
+}
+
+
+/*
+ * chk_double - check jdoc_as_double() of a member of the top level object
+ *
+ * given:
+ *	doc	document
+ *	name	decoded name of the member
+ *	ok	true ==> the conversion must succeed, false ==> it must fail
+ *	want	value the conversion must give if ok
+ */
+static void
+chk_double(struct jdoc const *doc, char const *name, bool ok, double want)
+{
+    double got = 0.0;	/* converted value */
+    bool ret = false;	/* jdoc_as_double() return */
+
+    ret = jdoc_as_double(doc, member(doc, name), &got);
+    if (ret != ok) {
+	warn(__func__, "member \"%s\": jdoc_as_double() returned %s", name, ret ? "true" : "false");
+	error = true;
+    } else if (ok && got != want) {
+	warn(__func__, "member \"%s\": %.17g != %.17g", name, got, want);
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: jdoc_as_double() of member \"%s\"", name);
+    }
+}
+
+
+/*
+ * chk_bool - check jdoc_as_bool() of a value
+ *
+ * given:
+ *	doc	document
+ *	what	what is checked, for the warning
+ *	v	tape index of the value
+ *	ok	true ==> the conversion must succeed, false ==> it must fail
+ *	want	value the conversion must give if ok
+ */
+static void
+chk_bool(struct jdoc const *doc, char const *what, size_t v, bool ok, bool want)
+{
+    bool got = false;	/* converted value */
+    bool ret = false;	/* jdoc_as_bool() return */
+
+    ret = jdoc_as_bool(doc, v, &got);
+    if (ret != ok || (ok && got != want)) {
+	warn(__func__, "%s: jdoc_as_bool() returned %s with %s", what, ret ? "true" : "false", got ? "true" : "false");
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: jdoc_as_bool() of %s", what);
+    }
+}
+
+
+/*
+ * chk_string - check jdoc_as_string() of a value
+ *
+ * given:
+ *	doc	    document
+ *	what	    what is checked, for the warning
+ *	v	    tape index of the value
+ *	want	    decoding jdoc_as_string() must return, NULL ==> it must fail
+ *	want_len    length of want
+ */
+static void
+chk_string(struct jdoc const *doc, char const *what, size_t v, char const *want, size_t want_len)
+{
+    char *got = NULL;	/* decoding */
+    size_t len = 1;	/* length of the decoding */
+
+    got = jdoc_as_string(doc, v, &len);
+    if (want == NULL) {
+	if (got != NULL || len != 0) {
+	    warn(__func__, "%s: jdoc_as_string() did not fail", what);
+	    error = true;
+	}
+    } else if (got == NULL || len != want_len || memcmp(got, want, len) != 0) {
+	warn(__func__, "%s: jdoc_as_string() did not return the decoding", what);
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: jdoc_as_string() of %s", what);
+    }
+    if (got != NULL) {
+	free(got);
+	got = NULL;
+    }
+}
+
+
+/*
+ * chk_invalid - check that jdoc_parse_ctx() fails for invalid JSON
+ *
+ * given:
+ *	json	NUL terminated invalid JSON
+ */
+static void
+chk_invalid(char const *json)
+{
+    struct jparse_ctx ctx;	/* parser context, to write syntax errors to devnull */
+    struct jdoc *doc = NULL;	/* what jdoc_parse_ctx() returned */
+    bool is_valid = true;	/* true ==> json is valid */
+
+    jparse_ctx_init(&ctx);
+    ctx.errs = devnull;
+    doc = jdoc_parse_ctx(&ctx, json, strlen(json), NULL, &is_valid);
+    jparse_ctx_fini(&ctx);
+    if (doc != NULL || is_valid) {
+	warn(__func__, "jdoc_parse_ctx() of invalid JSON did not fail: %s", json);
+	error = true;
+	jdoc_free(doc);
+    } else {
+	dbg(DBG_HIGH, "OK: jdoc_parse_ctx() of invalid JSON failed: %s", json);
+    }
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, program, "wrong number of arguments");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	prog		our program name
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *prog, char const *str)
+{
+    /*
+     * firewall
+     */
+    if (str == NULL) {
+	str = "((NULL str))";
+	warn(__func__, "\nin usage(): str was NULL, forcing it to be: %s\n", str);
+    }
+    if (prog == NULL) {
+	prog = JDOC_CHK_BASENAME;
+	warn(__func__, "\nin usage(): prog was NULL, forcing it to be: %s\n", prog);
+    }
+
+    /*
+     * print the formatted usage stream
+     */
+    if (*str != '\0') {
+	fprintf_usage(DO_NOT_EXIT, stderr, "%s\n", str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, prog, DBG_DEFAULT, json_verbosity_level,
+		  JDOC_CHK_BASENAME, JDOC_CHK_VERSION, JPARSE_UTF8_VERSION, JPARSE_LIBRARY_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
@@ -29,6 +29,8 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include <math.h>
+#include <string.h>
+#include <locale.h>
 
 /*
  * jnum_chk - tool to check JSON number string conversions
@@ -41,6 +43,41 @@
  */
 #define REQUIRED_ARGS (0)	/* number of required arguments on the command line */
 
+/*
+ * JSON numbers for chk_get() and what the json_number_get_ functions return for them
+ */
+static struct get_test {
+    char const *str;		/* JSON number string, NULL ==> end of tests */
+    bool int64_ok;		/* true ==> json_number_get_int64() returns true */
+    int64_t int64;		/* value json_number_get_int64() returns */
+    bool uint64_ok;		/* true ==> json_number_get_uint64() returns true */
+    uint64_t uint64;		/* value json_number_get_uint64() returns */
+    bool double_ok;		/* true ==> json_number_get_double() returns true */
+    double dbl;			/* value json_number_get_double() returns */
+} const get_test[] = {
+    { "0", true, 0, true, 0, true, 0.0 },
+    { "-1", true, -1, false, 0, true, -1.0 },
+    { "9223372036854775807", true, INT64_MAX, true, INT64_MAX, true, 9223372036854775807.0 },
+    { "-9223372036854775808", true, INT64_MIN, false, 0, true, -9223372036854775808.0 },
+    { "9223372036854775808", false, 0, true, (uint64_t)INT64_MAX+1, true, 9223372036854775808.0 },
+    { "18446744073709551615", false, 0, true, UINT64_MAX, true, 18446744073709551615.0 },
+
+    /* JSON integers too large for any integer type are still doubles */
+    { "18446744073709551616", false, 0, false, 0, true, 18446744073709551616.0 },
+    { "-9223372036854775809", false, 0, false, 0, true, -9223372036854775809.0 },
+    { "123456789012345678901234567890", false, 0, false, 0, true, 123456789012345678901234567890.0 },
+
+    /* JSON floating point and e-notation numbers are only doubles */
+    { "1.5", false, 0, false, 0, true, 1.5 },
+    { "-2.5e3", false, 0, false, 0, true, -2500.0 },
+    { "0.123456789012345678901234567890", false, 0, false, 0, true, 0.123456789012345678901234567890 },
+    { "1.25e-300", false, 0, false, 0, true, 1.25e-300 },
+    { "1e400", false, 0, false, 0, false, 0.0 },
+
+    /* MUST BE LAST */
+    { NULL, false, 0, false, 0, false, 0.0 }
+};
+
 /*
  * usage message
  *
@@ -172,7 +209,8 @@ main(int argc, char *argv[])
 	    err(10, program, "node->type for test %d: %s != %s", i, json_type_name(node->type), json_type_name(JTYPE_NUMBER));
 	    not_reached();
 	}
-	item = &(node->item.number);
+	item = json_get_number(node);
+	(void) json_number_convert(node);
 
 	/*
 	 * compare conversion with test case
@@ -194,6 +232,30 @@ main(int argc, char *argv[])
 	}
     }
 
+    /*
+     * check the json_number_get_ functions
+     */
+    if (chk_get() == false) {
+	warn(__func__, "test: chk_get() failed");
+	error = true;
+    }
+
+    /*
+     * check them again where the locale does not use '.' for the decimal point
+     */
+    if (chk_get_locale() == false) {
+	warn(__func__, "test: chk_get_locale() failed");
+	error = true;
+    }
+
+    /*
+     * check them on numbers in an arena, with no arena or another arena in use
+     */
+    if (chk_get_arena() == false) {
+	warn(__func__, "test: chk_get_arena() failed");
+	error = true;
+    }
+
     /*
      * All Done!!! All Done!!! -- Jessica Noll, Age 2
      */
@@ -211,7 +273,7 @@ main(int argc, char *argv[])
 /*
  * chk_test - check a given test
  *
- * When strict == true, we will compare every node->item.number element
+ * When strict == true, we will compare every json_get_number(node) element
  * with every *test element.  When strict == false, we will only compare
  * select struct json_number elements.
  *
@@ -343,49 +405,63 @@ chk_test(int testnum, struct json_number *item, struct json_number *test, size_t
 			testnum, test_result[testnum].is_e_notation, item->is_e_notation);
     }
 
+    /*
+     * test C values: json_number_convert() must have allocated them
+     */
+    if (item->value == NULL) {
+	dbg(DBG_VHIGH, "ERROR: item->value is NULL after json_number_convert()");
+	dbg(DBG_MED, "ERROR: test %d failed", testnum);
+	return false;
+    }
+    if (test_result[testnum].value == NULL) {
+	dbg(DBG_VHIGH, "ERROR: test_result[%d].value is NULL", testnum);
+	dbg(DBG_MED, "ERROR: test %d failed", testnum);
+	return false;
+    }
+
     /*
      * perform tests for both strict and non-strict testing of integers
      */
 
     /* test: int8_t */
     check_val(&test_error, "int8", testnum,
-			   test_result[testnum].int8_sized, item->int8_sized,
-			   test_result[testnum].as_int8, item->as_int8);
+			   test_result[testnum].value->int8_sized, item->value->int8_sized,
+			   test_result[testnum].value->as_int8, item->value->as_int8);
 
     /* test: uint8_t */
     check_uval(&test_error, "uint8", testnum,
-			    test_result[testnum].uint8_sized, item->uint8_sized,
-			    test_result[testnum].as_uint8, item->as_uint8);
+			    test_result[testnum].value->uint8_sized, item->value->uint8_sized,
+			    test_result[testnum].value->as_uint8, item->value->as_uint8);
 
     /* test: int16_t */
     check_val(&test_error, "int16", testnum,
-			   test_result[testnum].int16_sized, item->int16_sized,
-			   test_result[testnum].as_int16, item->as_int16);
+			   test_result[testnum].value->int16_sized, item->value->int16_sized,
+			   test_result[testnum].value->as_int16, item->value->as_int16);
 
     /* test: uint16_t */
     check_uval(&test_error, "uint16", testnum,
-			    test_result[testnum].uint16_sized, item->uint16_sized,
-			    test_result[testnum].as_uint16, item->as_uint16);
+			    test_result[testnum].value->uint16_sized, item->value->uint16_sized,
+			    test_result[testnum].value->as_uint16, item->value->as_uint16);
 
     /* test: int32_t */
     check_val(&test_error, "int32", testnum,
-			   test_result[testnum].int32_sized, item->int32_sized,
-			   test_result[testnum].as_int32, item->as_int32);
+			   test_result[testnum].value->int32_sized, item->value->int32_sized,
+			   test_result[testnum].value->as_int32, item->value->as_int32);
 
     /* test: uint32_t */
     check_uval(&test_error, "uint32", testnum,
-			    test_result[testnum].uint32_sized, item->uint32_sized,
-			    test_result[testnum].as_uint32, item->as_uint32);
+			    test_result[testnum].value->uint32_sized, item->value->uint32_sized,
+			    test_result[testnum].value->as_uint32, item->value->as_uint32);
 
     /* test: int64_t */
     check_val(&test_error, "int64", testnum,
-			   test_result[testnum].int64_sized, item->int64_sized,
-			   test_result[testnum].as_int64, item->as_int64);
+			   test_result[testnum].value->int64_sized, item->value->int64_sized,
+			   test_result[testnum].value->as_int64, item->value->as_int64);
 
     /* test: uint64_t */
     check_uval(&test_error, "uint64", testnum,
-			    test_result[testnum].uint64_sized, item->uint64_sized,
-			    test_result[testnum].as_uint64, item->as_uint64);
+			    test_result[testnum].value->uint64_sized, item->value->uint64_sized,
+			    test_result[testnum].value->as_uint64, item->value->as_uint64);
 
     /*
      * tests for strict mode only of integers
@@ -394,48 +470,48 @@ chk_test(int testnum, struct json_number *item, struct json_number *test, size_t
 
 	/* test: int */
 	check_val(&test_error, "int", testnum,
-			       test_result[testnum].int_sized, item->int_sized,
-			       test_result[testnum].as_int, item->as_int);
+			       test_result[testnum].value->int_sized, item->value->int_sized,
+			       test_result[testnum].value->as_int, item->value->as_int);
 
 	/* test: unsigned int */
 	check_uval(&test_error, "uint", testnum,
-				test_result[testnum].uint_sized, item->uint_sized,
-				test_result[testnum].as_uint, item->as_uint);
+				test_result[testnum].value->uint_sized, item->value->uint_sized,
+				test_result[testnum].value->as_uint, item->value->as_uint);
 
 	/* test: long */
 	check_val(&test_error, "long", testnum,
-			       test_result[testnum].long_sized, item->long_sized,
-			       test_result[testnum].as_long, item->as_long);
+			       test_result[testnum].value->long_sized, item->value->long_sized,
+			       test_result[testnum].value->as_long, item->value->as_long);
 
 	/* test: unsigned long */
 	check_uval(&test_error, "ulong", testnum,
-				test_result[testnum].ulong_sized, item->ulong_sized,
-				test_result[testnum].as_ulong, item->as_ulong);
+				test_result[testnum].value->ulong_sized, item->value->ulong_sized,
+				test_result[testnum].value->as_ulong, item->value->as_ulong);
 
 	/* test: long long */
 	check_val(&test_error, "longlong", testnum,
-			       test_result[testnum].longlong_sized, item->longlong_sized,
-			       test_result[testnum].as_longlong, item->as_longlong);
+			       test_result[testnum].value->longlong_sized, item->value->longlong_sized,
+			       test_result[testnum].value->as_longlong, item->value->as_longlong);
 
 	/* test: unsigned long long */
 	check_uval(&test_error, "ulonglong", testnum,
-				test_result[testnum].ulonglong_sized, item->ulonglong_sized,
-				test_result[testnum].as_ulonglong, item->as_ulonglong);
+				test_result[testnum].value->ulonglong_sized, item->value->ulonglong_sized,
+				test_result[testnum].value->as_ulonglong, item->value->as_ulonglong);
 
 	/* test: ssize_t */
 	check_val(&test_error, "ssize", testnum,
-			       test_result[testnum].ssize_sized, item->ssize_sized,
-			       test_result[testnum].as_ssize, item->as_ssize);
+			       test_result[testnum].value->ssize_sized, item->value->ssize_sized,
+			       test_result[testnum].value->as_ssize, item->value->as_ssize);
 
 	/* test: size_t */
 	check_uval(&test_error, "size", testnum,
-				test_result[testnum].size_sized, item->size_sized,
-				test_result[testnum].as_size, item->as_size);
+				test_result[testnum].value->size_sized, item->value->size_sized,
+				test_result[testnum].value->as_size, item->value->as_size);
 
 	/* test: off_t */
 	check_val(&test_error, "off", testnum,
-			       test_result[testnum].off_sized, item->off_sized,
-			       test_result[testnum].as_off, item->as_off);
+			       test_result[testnum].value->off_sized, item->value->off_sized,
+			       test_result[testnum].value->as_off, item->value->as_off);
     }
 
     /*
@@ -444,13 +520,13 @@ chk_test(int testnum, struct json_number *item, struct json_number *test, size_t
 
     /* test: intmax_t */
     check_val(&test_error, "intmax", testnum,
-			   test_result[testnum].maxint_sized, item->maxint_sized,
-			   test_result[testnum].as_maxint, item->as_maxint);
+			   test_result[testnum].value->maxint_sized, item->value->maxint_sized,
+			   test_result[testnum].value->as_maxint, item->value->as_maxint);
 
     /* test: uintmax_t */
     check_uval(&test_error, "uintmax", testnum,
-			    test_result[testnum].umaxint_sized, item->umaxint_sized,
-			    test_result[testnum].as_umaxint, item->as_umaxint);
+			    test_result[testnum].value->umaxint_sized, item->value->umaxint_sized,
+			    test_result[testnum].value->as_umaxint, item->value->as_umaxint);
 
     /*
      * perform tests for both strict and non-strict testing of floating point
@@ -458,21 +534,21 @@ chk_test(int testnum, struct json_number *item, struct json_number *test, size_t
 
     /* test: float */
     check_fval(&test_error, "float", testnum,
-			    test_result[testnum].float_sized, item->float_sized,
-			    (double)test_result[testnum].as_float, (double)item->as_float,
-			    test_result[testnum].as_float_int, item->as_float_int, strict);
+			    test_result[testnum].value->float_sized, item->value->float_sized,
+			    (double)test_result[testnum].value->as_float, (double)item->value->as_float,
+			    test_result[testnum].value->as_float_int, item->value->as_float_int, strict);
 
     /* test: double */
     check_fval(&test_error, "double", testnum,
-			    test_result[testnum].double_sized, item->double_sized,
-			    test_result[testnum].as_double, item->as_double,
-			    test_result[testnum].as_double_int, item->as_double_int, strict);
+			    test_result[testnum].value->double_sized, item->value->double_sized,
+			    test_result[testnum].value->as_double, item->value->as_double,
+			    test_result[testnum].value->as_double_int, item->value->as_double_int, strict);
 
     /* test: long double */
     check_fval(&test_error, "longdouble", testnum,
-			    test_result[testnum].longdouble_sized, item->longdouble_sized,
-			    test_result[testnum].as_longdouble, item->as_longdouble,
-			    test_result[testnum].as_longdouble_int, item->as_longdouble_int, strict);
+			    test_result[testnum].value->longdouble_sized, item->value->longdouble_sized,
+			    test_result[testnum].value->as_longdouble, item->value->as_longdouble,
+			    test_result[testnum].value->as_longdouble_int, item->value->as_longdouble_int, strict);
 
     /*
      * if this test failed, return false
@@ -750,6 +826,254 @@ check_fval(bool *testp, char const *type, int testnum, bool size_a, bool size_b,
 }
 
 
+/*
+ * chk_get - check json_number_get_int64(), json_number_get_uint64() and json_number_get_double()
+ *
+ * For each get_test[] JSON number, the C values must not be found when the
+ * number is parsed, but by the first json_number_get_ call, only once, and
+ * later calls must return what it found.  A JSON integer too large for any
+ * integer type must still be returned as a double.
+ *
+ * returns:
+ *	true ==> all checks passed,
+ *	false ==> some check failed
+ */
+static bool
+chk_get(void)
+{
+    struct get_test const *t = NULL;	/* get_test[] being checked */
+    struct json *node = NULL;		/* allocated JSON parser tree node */
+    struct json_number *item = NULL;	/* JSON number of node */
+    struct json_number_value *value = NULL;	/* C values found by the first call */
+    size_t len = 0;			/* length of the JSON number */
+    bool ok = true;			/* false ==> some check failed */
+    bool ret = false;			/* json_number_get_ return */
+    int64_t i64 = 0;			/* json_number_get_int64() value */
+    uint64_t u64 = 0;			/* json_number_get_uint64() value */
+    double d = 0.0;			/* json_number_get_double() value */
+
+    for (t = get_test; t->str != NULL; ++t) {
+
+	/*
+	 * parse the JSON number
+	 */
+	node = json_conv_number_str(t->str, &len);
+	item = json_get_number(node);
+	if (item == NULL) {
+	    warn(__func__, "%s: json_conv_number_str() did not return a JSON number", t->str);
+	    ok = false;
+	    continue;
+	}
+
+	/*
+	 * the C values are not found until they are asked for
+	 */
+	if (item->value != NULL) {
+	    warn(__func__, "%s: converted when parsed", t->str);
+	    ok = false;
+	}
+
+	/*
+	 * json_number_get_int64() converts the number
+	 */
+	i64 = 0;
+	ret = json_number_get_int64(node, &i64);
+	if (ret != t->int64_ok || (ret && i64 != t->int64)) {
+	    warn(__func__, "%s: json_number_get_int64() returned %s with %jd",
+			   t->str, booltostr(ret), (intmax_t)i64);
+	    ok = false;
+	}
+	value = item->value;
+	if (value == NULL) {
+	    warn(__func__, "%s: json_number_get_int64() did not convert", t->str);
+	    ok = false;
+	    json_free(node, 0);
+	    free(node);
+	    node = NULL;
+	    continue;
+	}
+
+	/*
+	 * json_number_get_uint64() and json_number_get_double() use that conversion
+	 */
+	u64 = 0;
+	ret = json_number_get_uint64(node, &u64);
+	if (ret != t->uint64_ok || (ret && u64 != t->uint64)) {
+	    warn(__func__, "%s: json_number_get_uint64() returned %s with %ju",
+			   t->str, booltostr(ret), (uintmax_t)u64);
+	    ok = false;
+	}
+	d = 0.0;
+	ret = json_number_get_double(node, &d);
+	if (ret != t->double_ok || (ret && d != t->dbl)) {
+	    warn(__func__, "%s: json_number_get_double() returned %s with %.17g",
+			   t->str, booltostr(ret), d);
+	    ok = false;
+	}
+	if (item->value != value) {
+	    warn(__func__, "%s: converted more than once", t->str);
+	    ok = false;
+	}
+
+	/*
+	 * a changed C value is returned as is: the number is not converted again
+	 */
+	if (t->int64_ok) {
+	    value->as_int64 ^= 1;
+	    ret = json_number_get_int64(node, &i64);
+	    if (ret == false || i64 != (t->int64 ^ 1)) {
+		warn(__func__, "%s: json_number_get_int64() did not reuse the C values", t->str);
+		ok = false;
+	    }
+	}
+	if (t->uint64_ok) {
+	    value->as_uint64 ^= 1;
+	    ret = json_number_get_uint64(node, &u64);
+	    if (ret == false || u64 != (t->uint64 ^ 1)) {
+		warn(__func__, "%s: json_number_get_uint64() did not reuse the C values", t->str);
+		ok = false;
+	    }
+	}
+	if (ok) {
+	    dbg(DBG_HIGH, "OK: json_number_get_ functions for %s", t->str);
+	}
+
+	/*
+	 * free converted node
+	 */
+	json_free(node, 0);
+	free(node);
+	node = NULL;
+    }
+    return ok;
+}
+
+
+/*
+ * chk_get_locale - check the json_number_get_ functions in a locale with a ',' decimal point
+ *
+ * A JSON number always has a '.' for its decimal point, whatever the locale
+ * of the program.  The LC_NUMERIC of the environment is tried first, then a
+ * few locales known to use a ',': when none of them can be set, or they all
+ * use a '.', there is nothing to check.
+ *
+ * returns:
+ *	true ==> all checks passed or there was nothing to check,
+ *	false ==> some check failed
+ */
+static bool
+chk_get_locale(void)
+{
+    static char const * const locales[] = {
+	"", "de_DE.UTF-8", "de_DE", "fr_FR.UTF-8", "fr_FR", NULL
+    };
+    char const * const *name = NULL;	/* locale being tried */
+    struct lconv const *conv = NULL;	/* numeric conventions of the locale */
+    bool ok = true;			/* false ==> some check failed */
+
+    for (name = locales; *name != NULL; ++name) {
+	if (setlocale(LC_NUMERIC, *name) == NULL) {
+	    continue;
+	}
+	conv = localeconv();
+	if (conv != NULL && conv->decimal_point != NULL && strcmp(conv->decimal_point, ".") != 0) {
+	    break;
+	}
+    }
+    if (*name == NULL) {
+	dbg(DBG_MED, "no locale with a decimal point other than '.' was found: locale checks skipped");
+    } else {
+	dbg(DBG_MED, "checking the json_number_get_ functions with the decimal point: %s", conv->decimal_point);
+	ok = chk_get();
+    }
+    (void) setlocale(LC_NUMERIC, "C");
+    return ok;
+}
+
+
+/*
+ * chk_get_arena - check the json_number_get_ functions on numbers in an arena
+ *
+ * The C values of a number in an arena must be put in its own arena, not in
+ * whichever arena is in use when it is first converted: each get_test[]
+ * number is parsed in one arena and converted with no arena in use, or with
+ * another arena in use that is then reset.
+ *
+ * returns:
+ *	true ==> all checks passed,
+ *	false ==> some check failed
+ */
+static bool
+chk_get_arena(void)
+{
+    struct json_arena *arena = NULL;	/* arena the numbers are parsed in */
+    struct json_arena *other = NULL;	/* arena in use when they are converted */
+    struct json_arena *prev = NULL;	/* arena in use before */
+    struct get_test const *t = NULL;	/* get_test[] being checked */
+    struct json *node = NULL;		/* JSON parser tree node in arena */
+    size_t len = 0;			/* length of the JSON number */
+    size_t bytes = 0;			/* bytes handed out by arena before the conversion */
+    bool ok = true;			/* false ==> some check failed */
+    bool ret = false;			/* json_number_get_ return */
+    bool use_other = false;		/* true ==> convert while other is in use */
+    double d = 0.0;			/* json_number_get_double() value */
+    int64_t i64 = 0;			/* json_number_get_int64() value */
+
+    arena = json_arena_create();
+    other = json_arena_create();
+    for (t = get_test; t->str != NULL; ++t, use_other = !use_other) {
+
+	/*
+	 * parse the JSON number in arena
+	 */
+	prev = json_arena_use(arena);
+	node = json_conv_number_str(t->str, &len);
+	(void) json_arena_use(use_other ? other : NULL);
+	if (json_get_number(node) == NULL || !node->arena || json_get_number(node)->arena != arena) {
+	    warn(__func__, "%s: json_conv_number_str() did not return a JSON number in the arena", t->str);
+	    ok = false;
+	    (void) json_arena_use(prev);
+	    continue;
+	}
+
+	/*
+	 * the C values go in arena, not in the arena in use
+	 */
+	bytes = arena->bytes;
+	d = 0.0;
+	ret = json_number_get_double(node, &d);
+	if (ret != t->double_ok || (ret && d != t->dbl)) {
+	    warn(__func__, "%s: json_number_get_double() in an arena returned %s with %.17g with %s arena in use",
+			   t->str, booltostr(ret), d, use_other ? "another" : "no");
+	    ok = false;
+	}
+	if (arena->bytes == bytes || other->bytes != 0) {
+	    warn(__func__, "%s: C values not put in the arena of the number", t->str);
+	    ok = false;
+	}
+
+	/*
+	 * they are still there when the arena that was in use is reset
+	 */
+	json_arena_reset(other);
+	i64 = 0;
+	ret = json_number_get_int64(node, &i64);
+	if (ret != t->int64_ok || (ret && i64 != t->int64)) {
+	    warn(__func__, "%s: json_number_get_int64() in an arena returned %s with %jd after json_arena_reset()",
+			   t->str, booltostr(ret), (intmax_t)i64);
+	    ok = false;
+	}
+	(void) json_arena_use(prev);
+    }
+    if (ok) {
+	dbg(DBG_HIGH, "OK: json_number_get_ functions for numbers in an arena");
+    }
+    json_arena_free(other);
+    json_arena_free(arena);
+    return ok;
+}
+
+
 /*
  * usage - print usage to stderr
  *
@@ -64,7 +64,7 @@
 /*
  * official jnum_chk version
  */
-#define JNUM_CHK_VERSION "1.0.1 2024-03-02"      /* format: major.minor YYYY-MM-DD */
+#define JNUM_CHK_VERSION "1.0.4 2026-10-17"      /* format: major.minor YYYY-MM-DD */
 
 
 /*
@@ -99,6 +99,9 @@ static void check_val(bool *testp, char const *type, int testnum, bool size_a, b
 static void check_uval(bool *testp, char const *type, int testnum, bool size_a, bool size_b, uintmax_t val_a, uintmax_t val_b);
 static void check_fval(bool *testp, char const *type, int testnum, bool size_a, bool size_b,
 		       long double val_a, long double val_b, bool int_a, bool int_b, bool strict);
+static bool chk_get(void);
+static bool chk_get_locale(void);
+static bool chk_get_arena(void);
 #endif
 
 #endif /* INCLUDE_JNUM_CHK_H */
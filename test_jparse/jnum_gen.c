@@ -319,7 +319,8 @@ main(int argc, char *argv[])
 		    json_type_name(JTYPE_NUMBER));
 	    not_reached();
 	}
-	fpr_number(stdout, &node->item.number);
+	(void) json_number_convert(node);
+	fpr_number(stdout, json_get_number(node));
 
 	/*
 	 * print end of json_number structure
@@ -376,6 +377,8 @@ main(int argc, char *argv[])
 static void
 fpr_number(FILE *stream, struct json_number *item)
 {
+    struct json_number_value *val = NULL;	/* C values of item */
+
     /*
      * firewall
      */
@@ -399,6 +402,28 @@ fpr_number(FILE *stream, struct json_number *item)
 		   booltostr(item->converted));
     fprstr(stream, "\n");
 
+    /*
+     * print bool is_negative
+     */
+    fprint(stream, "\t%s,\t"
+		   "\t/* true ==> value < 0 */\n",
+		   booltostr(item->is_negative));
+    fprstr(stream, "\n");
+
+    /*
+     * print bool is_floating and is_e_notation and is_integer
+     */
+    fprint(stream, "\t%s,\t"
+		   "\t/* true ==> as_str had a '.' in it such as 1.234, false ==> no '.' found */\n",
+		   booltostr(item->is_floating));
+    fprint(stream, "\t%s,\t"
+		   "\t/* true ==> e notation used such as 1e10, false ==> no e notation found */\n",
+		   booltostr(item->is_e_notation));
+    fprint(stream, "\t%s,\t"
+		   "\t/* true ==> integer conversion success, false ==> no integer conversion */\n",
+		   booltostr(item->is_integer));
+    fprstr(stream, "\n");
+
     /*
      * print JSON string
      */
@@ -424,162 +449,151 @@ fpr_number(FILE *stream, struct json_number *item)
     fprstr(stream, "\n");
 
     /*
-     * print bool is_negative
-     */
-    fprint(stream, "\t%s,\t"
-		   "\t/* true ==> value < 0 */\n",
-		   booltostr(item->is_negative));
-    fprstr(stream, "\n");
-
-    /*
-     * print bool is_floating and is_e_notation and is_integer
+     * print C values
      */
-    fprint(stream, "\t%s,\t"
-		   "\t/* true ==> as_str had a '.' in it such as 1.234, false ==> no '.' found */\n",
-		   booltostr(item->is_floating));
-    fprint(stream, "\t%s,\t"
-		   "\t/* true ==> e notation used such as 1e10, false ==> no e notation found */\n",
-		   booltostr(item->is_e_notation));
-    fprint(stream, "\t%s,\t"
-		   "\t/* true ==> integer conversion success, false ==> no integer conversion */\n",
-		   booltostr(item->is_integer));
-    fprstr(stream, "\n");
+    if (item->value == NULL) {
+	fprstr(stream, "\tNULL,\t\t/* C values, NULL ==> json_number_convert() not yet called */\n");
+	fprstr(stream, "\tNULL,\t\t/* not in an arena */\n");
+	return;
+    }
+    val = item->value;
+    fprstr(stream, "\t&(struct json_number_value) {\n");
 
     /*
      * print integer values
      */
-    fprstr(stream, "\t/* integer values */\n");
+    fprstr(stream, "\t    /* integer values */\n");
 
     /*
      * print int8_t info
      */
-    fpr_info(stream, item->int8_sized, item->as_int8,
+    fpr_info(stream, val->int8_sized, val->as_int8,
 	   "true ==> converted JSON integer to C int8_t",
 	   "JSON integer value in int8_t form");
 
     /*
      * print uint8_t info
      */
-    fpr_uinfo(stream, item->uint8_sized, item->as_uint8,
+    fpr_uinfo(stream, val->uint8_sized, val->as_uint8,
 	    "true ==> converted JSON integer to C uint8_t",
 	    "JSON integer value in uint8_t form");
 
     /*
      * print int16_t info
      */
-    fpr_info(stream, item->int16_sized, item->as_int16,
+    fpr_info(stream, val->int16_sized, val->as_int16,
 	   "true ==> converted JSON integer to C int16_t",
 	   "JSON integer value in int16_t form");
 
     /*
      * print uint16_t info
      */
-    fpr_uinfo(stream, item->uint16_sized, item->as_uint16,
+    fpr_uinfo(stream, val->uint16_sized, val->as_uint16,
 	    "true ==> converted JSON integer to C uint16_t",
 	    "JSON integer value in uint16_t form");
 
     /*
      * print int32_t info
      */
-    fpr_info(stream, item->int32_sized, item->as_int32,
+    fpr_info(stream, val->int32_sized, val->as_int32,
 	   "true ==> converted JSON integer to C int32_t",
 	   "JSON integer value in int32_t form");
 
     /*
      * print uint32_t info
      */
-    fpr_uinfo(stream, item->uint32_sized, item->as_uint32,
+    fpr_uinfo(stream, val->uint32_sized, val->as_uint32,
 	    "true ==> converted JSON integer to C uint32_t",
 	    "JSON integer value in uint32_t form");
 
     /*
      * print int64_t info
      */
-    fpr_info(stream, item->int64_sized, item->as_int64,
+    fpr_info(stream, val->int64_sized, val->as_int64,
 	   "true ==> converted JSON integer to C int64_t",
 	   "JSON integer value in int64_t form");
 
     /*
      * print uint64_t info
      */
-    fpr_uinfo(stream, item->uint64_sized, item->as_uint64,
+    fpr_uinfo(stream, val->uint64_sized, val->as_uint64,
 	    "true ==> converted JSON integer to C uint64_t",
 	    "JSON integer value in uint64_t form");
 
     /*
      * print int info
      */
-    fpr_info(stream, item->int_sized, item->as_int,
+    fpr_info(stream, val->int_sized, val->as_int,
 	   "true ==> converted JSON integer to C int",
 	   "JSON integer value in int form");
 
     /*
      * print unsigned int info
      */
-    fpr_uinfo(stream, item->uint_sized, item->as_uint,
+    fpr_uinfo(stream, val->uint_sized, val->as_uint,
 	    "true ==> converted JSON integer to C unsigned int",
 	    "JSON integer value in unsigned int form");
 
     /*
      * print long info
      */
-    fpr_info(stream, item->long_sized, item->as_long,
+    fpr_info(stream, val->long_sized, val->as_long,
 	   "true ==> converted JSON integer to C long",
 	   "JSON integer value in long form");
 
     /*
      * print unsigned long info
      */
-    fpr_uinfo(stream, item->ulong_sized, item->as_ulong,
+    fpr_uinfo(stream, val->ulong_sized, val->as_ulong,
 	    "true ==> converted JSON integer to C unsigned long",
 	    "JSON integer value in unsigned long form");
 
     /*
      * print long long info
      */
-    fpr_info(stream, item->longlong_sized, item->as_longlong,
+    fpr_info(stream, val->longlong_sized, val->as_longlong,
 	   "true ==> converted JSON integer to C long long",
 	   "JSON integer value in long long form");
 
     /*
      * print unsigned long long info
      */
-    fpr_uinfo(stream, item->ulonglong_sized, item->as_ulonglong,
+    fpr_uinfo(stream, val->ulonglong_sized, val->as_ulonglong,
 	    "true ==> converted JSON integer to C unsigned long long",
 	    "JSON integer value in unsigned long long form");
 
     /*
      * print ssize_t info
      */
-    fpr_info(stream, item->ssize_sized, item->as_ssize,
+    fpr_info(stream, val->ssize_sized, val->as_ssize,
 	   "true ==> converted JSON integer to C ssize_t",
 	   "JSON integer value in ssize_t form");
 
     /*
      * print size_t info
      */
-    fpr_uinfo(stream, item->size_sized, item->as_size,
+    fpr_uinfo(stream, val->size_sized, val->as_size,
 	    "true ==> converted JSON integer to C size_t",
 	    "JSON integer value in size_t form");
 
     /*
      * print off_t info
      */
-    fpr_info(stream, item->off_sized, item->as_off,
+    fpr_info(stream, val->off_sized, val->as_off,
 	   "true ==> converted JSON integer to C off_t",
 	   "JSON integer value in off_t form");
 
     /*
      * print intmax_t info
      */
-    fpr_info(stream, item->maxint_sized, item->as_maxint,
+    fpr_info(stream, val->maxint_sized, val->as_maxint,
 	   "true ==> converted JSON integer to C intmax_t",
 	   "JSON integer value in intmax_t form");
 
     /*
      * print uintmax_t info
      */
-    fpr_uinfo(stream, item->umaxint_sized, item->as_umaxint,
+    fpr_uinfo(stream, val->umaxint_sized, val->as_umaxint,
 	    "true ==> converted JSON integer to C uintmax_t",
 	    "JSON integer value in uintmax_t form");
 
@@ -587,12 +601,12 @@ fpr_number(FILE *stream, struct json_number *item)
      * print floating point values
      */
     fprstr(stream, "\n");
-    fprstr(stream, "\t/* floating point values */\n");
+    fprstr(stream, "\t    /* floating point values */\n");
 
     /*
      * print float info
      */
-    fpr_finfo(stream, item->float_sized, (long double)item->as_float, item->as_float_int,
+    fpr_finfo(stream, val->float_sized, (long double)val->as_float, val->as_float_int,
 	   "true ==> converted JSON floating point to C float",
 	   "JSON floating point value in float form",
 	   "if float_sized == true, true ==> as_float is an integer", "");
@@ -600,7 +614,7 @@ fpr_number(FILE *stream, struct json_number *item)
     /*
      * print double info
      */
-    fpr_finfo(stream, item->double_sized, (long double)item->as_double, item->as_double_int,
+    fpr_finfo(stream, val->double_sized, (long double)val->as_double, val->as_double_int,
 	    "true ==> converted JSON floating point to C double",
 	    "JSON floating point value in double form",
 	    "if double_sized == true, true ==> as_double is an integer", "");
@@ -608,10 +622,16 @@ fpr_number(FILE *stream, struct json_number *item)
     /*
      * print long double info
      */
-    fpr_finfo(stream, item->longdouble_sized, item->as_longdouble, item->as_float_int,
+    fpr_finfo(stream, val->longdouble_sized, val->as_longdouble, val->as_float_int,
 	   "true ==> converted JSON floating point to C long double",
 	   "JSON floating point value in long double form",
 	   "if float_sized == true, true ==> as_float is an integer", "L");
+
+    /*
+     * print end of C values
+     */
+    fprstr(stream, "\t},\n");
+    fprstr(stream, "\tNULL,\t\t/* not in an arena */\n");
 }
 
 
@@ -643,8 +663,8 @@ fpr_info(FILE *stream, bool sized, intmax_t value, char const *scomm, char const
      */
     fprstr(stream,"\n");
     if (sized == true) {
-	fprint(stream, "\ttrue,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t%jd,%s/* %s */\n",
+	fprint(stream, "\t    true,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    %jd,%s/* %s */\n",
 		       value,
 		       (value < -99999 || value > 999999) ? "\t" : "\t\t",
 		       vcomm);
@@ -653,8 +673,8 @@ fpr_info(FILE *stream, bool sized, intmax_t value, char const *scomm, char const
      * case: sized is false - no value to print
      */
     } else {
-	fprint(stream, "\tfalse,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t0,\t\t/* no %s */\n", vcomm);
+	fprint(stream, "\t    false,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    0,\t\t/* no %s */\n", vcomm);
     }
     return;
 }
@@ -688,8 +708,8 @@ fpr_uinfo(FILE *stream, bool sized, uintmax_t value, char const *scomm, char con
      */
     fprstr(stream,"\n");
     if (sized == true) {
-	fprint(stream, "\ttrue,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t%ju,%s/* %s */\n",
+	fprint(stream, "\t    true,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    %ju,%s/* %s */\n",
 		       value,
 		       (value > 999999) ? "\t" : "\t\t",
 		       vcomm);
@@ -698,8 +718,8 @@ fpr_uinfo(FILE *stream, bool sized, uintmax_t value, char const *scomm, char con
      * case: sized is false - no value to print
      */
     } else {
-	fprint(stream, "\tfalse,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t0,\t\t/* no %s */\n", vcomm);
+	fprint(stream, "\t    false,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    0,\t\t/* no %s */\n", vcomm);
     }
     return;
 }
@@ -736,21 +756,21 @@ fpr_finfo(FILE *stream, bool sized, long double value, bool intval, char const *
      */
     fprstr(stream,"\n");
     if (sized == true) {
-	fprint(stream, "\ttrue,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t%.22Lg%s,%s/* %s */\n",
+	fprint(stream, "\t    true,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    %.22Lg%s,%s/* %s */\n",
 		       value, suffix,
 		       (islessequal(value, -100000.0L) ||
 			isgreaterequal(value, 1000000.0L)) ? "\t" : "\t\t",
 		       vcomm);
-	fprint(stream, "\t%s,\t\t/* %s */\n", booltostr(intval), sintval);
+	fprint(stream, "\t    %s,\t\t/* %s */\n", booltostr(intval), sintval);
 
     /*
      * case: sized is false - no value to print
      */
     } else {
-	fprint(stream, "\tfalse,\t\t/* %s */\n", scomm);
-	fprint(stream, "\t0,\t\t/* no %s */\n", vcomm);
-	fprint(stream, "\tfalse,\t\t/* %s */\n", sintval);
+	fprint(stream, "\t    false,\t\t/* %s */\n", scomm);
+	fprint(stream, "\t    0,\t\t/* no %s */\n", vcomm);
+	fprint(stream, "\t    false,\t\t/* %s */\n", sintval);
     }
     return;
 }
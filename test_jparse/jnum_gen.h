@@ -64,7 +64,7 @@
 /*
  * official jnum_gen version
  */
-#define JNUM_GEN_VERSION "1.0.1 2024-03-02"	/* format: major.minor YYYY-MM-DD */
+#define JNUM_GEN_VERSION "1.0.2 2026-10-17"	/* format: major.minor YYYY-MM-DD */
 
 /*
  * jnum_gen tool basename
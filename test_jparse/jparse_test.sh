@@ -73,16 +73,24 @@
 
 # setup
 #
-export JPARSE_TEST_VERSION="1.2.2 2024-10-13"	    # version format: major.minor YYYY-MM-DD */
+export JPARSE_TEST_VERSION="1.2.11 2026-10-17"	    # version format: major.minor YYYY-MM-DD */
 export CHK_TEST_FILE="./test_jparse/json_teststr.txt"
 export CHK_INVALID_TEST_FILE="./test_jparse/json_teststr_fail.txt"
 export JPARSE="./jparse"
+export BACKEND="flex"
+export PARSER="bison"
+export CHUNK=""
+export VALIDATE=""
+export ARENA=""
+export INTERN=""
+export WRITE=""
+export EVENTS=""
 export PRINT_TEST="./test_jparse/print_test"
 export JSON_TREE="./test_jparse/test_JSON"
 export PASS_FAIL="pass"
 export SUBDIR="."
 export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J level] [-q] [-j jparse]
-		[-p print_test] [-d json_tree] [-s subdir] [-Z topdir] [-k] [-f] [-L] [-F] [file ..]
+		[-B backend] [-P parser] [-c size] [-n] [-a] [-i] [-w] [-e] [-p print_test] [-d json_tree] [-s subdir] [-Z topdir] [-k] [-f] [-L] [-F] [file ..]
 
     -h			print help and exit
     -V			print version and exit
@@ -91,6 +99,16 @@ export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J level] [-q] [-j
     -J level		set JSON parser verbosity level (def level: 0)
     -q			quiet mode: silence msg(), warn(), warnp() if -v 0 (def: not quiet)
     -j jparse		path to jparse tool (def: $JPARSE)
+    -B backend		jparse scanner backend, see jparse -h (def: $BACKEND)
+    -P parser		jparse parser, see jparse -h (def: $PARSER)
+    -c size		feed jparse push parser size bytes at a time, see jparse -h (def: parse all at once)
+    -n			only check the JSON with jparse -n, without a parse tree (def: build the tree)
+    -a			build the parse tree in an arena with jparse -a (def: allocate each node on its own)
+    -i			intern member names with jparse -i (def: store each name on its own)
+    -w			also check that what jparse -w writes for each good file parses and is written the same way
+			    (def: do not write the JSON)
+    -e			also check that jparse -e writes the same JSON for each good file, fails for each
+			    bad file and stops when a callback returns false (def: do not check jparse -e)
     -p print_test	path to print_test tool (def: $PRINT_TEST)
     -d json_tree	read files under json_tree/subdir/good and json_tree/subdir/bad (def: $JSON_TREE)
 			    These subdirectories are expected:
@@ -139,7 +157,7 @@ export TOPDIR=
 
 # parse args
 #
-while getopts :hVv:D:J:qj:p:d:s:Z:kfLF flag; do
+while getopts :hVv:D:J:qj:B:P:c:naiwep:d:s:Z:kfLF flag; do
     case "$flag" in
     h)	echo "$USAGE" 1>&2
 	exit 2
@@ -157,6 +175,22 @@ while getopts :hVv:D:J:qj:p:d:s:Z:kfLF flag; do
 	;;
     j)	JPARSE="$OPTARG";
 	;;
+    B)	BACKEND="$OPTARG";
+	;;
+    P)	PARSER="$OPTARG";
+	;;
+    c)	CHUNK="$OPTARG";
+	;;
+    n)	VALIDATE="-n";
+	;;
+    a)	ARENA="-a";
+	;;
+    i)	INTERN="-i";
+	;;
+    w)	WRITE="-w";
+	;;
+    e)	EVENTS="-e";
+	;;
     p)	PRINT_TEST="$OPTARG";
 	PRINT_TEST_FLAG_USED="1"
 	;;
@@ -189,6 +223,12 @@ while getopts :hVv:D:J:qj:p:d:s:Z:kfLF flag; do
 	;;
     esac
 done
+
+# jparse options for each test, and for the -w tests, which take neither -c nor -n
+#
+JPARSE_WRITE_OPTS=(-B "$BACKEND" -P "$PARSER" ${ARENA:+-a} ${INTERN:+-i})
+JPARSE_OPTS=("${JPARSE_WRITE_OPTS[@]}" ${CHUNK:+-c "$CHUNK"} ${VALIDATE:+-n})
+
 if [[ $V_FLAG -ge 1 ]]; then
     echo "$0: debug[1]: -v: $V_FLAG" 1>&2
     echo "$0: debug[1]: -D: $DBG_LEVEL" 1>&2
@@ -214,6 +254,26 @@ if [[ $V_FLAG -ge 1 ]]; then
 	echo "$0: debug[1]: -q: true" 1>&2
     fi
     echo "$0: debug[1]: jparse: $JPARSE" 1>&2
+    echo "$0: debug[1]: -B: $BACKEND" 1>&2
+    echo "$0: debug[1]: -P: $PARSER" 1>&2
+    if [[ -n "$CHUNK" ]]; then
+	echo "$0: debug[1]: -c: $CHUNK" 1>&2
+    fi
+    if [[ -n "$VALIDATE" ]]; then
+	echo "$0: debug[1]: -n: true" 1>&2
+    fi
+    if [[ -n "$ARENA" ]]; then
+	echo "$0: debug[1]: -a: true" 1>&2
+    fi
+    if [[ -n "$INTERN" ]]; then
+	echo "$0: debug[1]: -i: true" 1>&2
+    fi
+    if [[ -n "$WRITE" ]]; then
+	echo "$0: debug[1]: -w: true" 1>&2
+    fi
+    if [[ -n "$EVENTS" ]]; then
+	echo "$0: debug[1]: -e: true" 1>&2
+    fi
     if [[ -n "$PRINT_TEST_FLAG_USED" ]]; then
 	echo "$0: debug[1]: print_test: $PRINT_TEST" 1>&2
     fi
@@ -400,6 +460,11 @@ if [[ ! -w "$TMP_STDERR_FILE" ]]; then
     exit 36
 fi
 
+# With -w or -e we need a file to write the JSON that jparse -w or jparse -e
+# writes to in order to parse it again.
+TMP_WRITE_FILE=$(mktemp -u .jparse_test.write.XXXXXXXXXX)
+rm -f "$TMP_WRITE_FILE"
+
 # remove logfile so that each run starts out with an empty file
 #
 rm -f "$LOGFILE"
@@ -416,9 +481,9 @@ fi
 # remove or keep (some) temporary files
 #
 if [[ -z $K_FLAG ]]; then
-    trap "rm -f \$TMP_STDERR_FILE; exit" 0 1 2 3 15
+    trap "rm -f \$TMP_STDERR_FILE \$TMP_WRITE_FILE; exit" 0 1 2 3 15
 else
-    trap "rm -f \$TMP_STDERR_FILE; exit" 1 2 3 15
+    trap "rm -f \$TMP_STDERR_FILE \$TMP_WRITE_FILE; exit" 1 2 3 15
 fi
 
 # update_file_summary - updates file failure summary message
@@ -513,10 +578,10 @@ run_location_err_test()
     fi
 
     if [[ $V_FLAG -ge 3 ]]; then
-	echo "$0: debug[3]: about to run test that must fail: $JPARSE -- $jparse_test_file >> ${LOGFILE} 2>$TMP_STDERR_FILE" 1>&2
+	echo "$0: debug[3]: about to run test that must fail: $JPARSE ${JPARSE_OPTS[*]} -- $jparse_test_file >> ${LOGFILE} 2>$TMP_STDERR_FILE" 1>&2
     fi
 
-    "$JPARSE" -- "$jparse_test_file" 2>"$TMP_STDERR_FILE" | tee -a -- "${LOGFILE}"
+    "$JPARSE" "${JPARSE_OPTS[@]}" -- "$jparse_test_file" 2>"$TMP_STDERR_FILE" | tee -a -- "${LOGFILE}"
 
     if [[ $V_FLAG -ge 7 ]]; then
 	echo "$0: debug[7]: in run_location_err_test: jparse exit code: $status" 1>&2
@@ -527,17 +592,17 @@ run_location_err_test()
     # if we have an error file (expected errors) and the output of the above
     # command does not match it is a fail.
     if ! cmp -s "$jparse_err_file" "$TMP_STDERR_FILE"; then
-	echo "$0: Warning: in run_location_err_test: FAIL: $JPARSE -- $jparse_test_file 2>$TMP_STDERR_FILE | tee -a -- ${LOGFILE}" 2>&1
+	echo "$0: Warning: in run_location_err_test: FAIL: $JPARSE ${JPARSE_OPTS[*]} -- $jparse_test_file 2>$TMP_STDERR_FILE | tee -a -- ${LOGFILE}" 2>&1
 	echo "$0: Warning: in run_location_err_test: expected errors: $jparse_err_file do not match result of test: $TMP_STDERR_FILE" 1>&2
 
 	if [[ $V_FLAG -lt 3 ]]; then
-	    echo "$0: Warning: for more details try: $JPARSE -- $jparse_test_file" | tee -a -- "$LOGFILE" 1>&2
+	    echo "$0: Warning: for more details try: $JPARSE ${JPARSE_OPTS[*]} -- $jparse_test_file" | tee -a -- "$LOGFILE" 1>&2
 	fi
 
 	echo | tee -a -- "${LOGFILE}" 1>&2
 	EXIT_CODE=50
     elif [[ "$V_FLAG" -ge 1 ]]; then
-	echo "$0: debug[1]: fail test OK, $JPARSE -- $jparse_test_file matches error file" | tee -a -- "$LOGFILE"
+	echo "$0: debug[1]: fail test OK, $JPARSE ${JPARSE_OPTS[*]} -- $jparse_test_file matches error file" | tee -a -- "$LOGFILE"
     fi
 
     # return
@@ -592,16 +657,16 @@ run_file_test()
 
     if [[ -z $quiet_mode ]]; then
 	if [[ $V_FLAG -ge 3 ]]; then
-	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -- $json_doc_file >> ${LOGFILE} 2>&1" 1>&2
+	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -- $json_doc_file >> ${LOGFILE} 2>&1" 1>&2
 	fi
-	echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -- $json_doc_file >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
-	"$jparse" -v "$dbg_level" -J "$json_dbg_level" -- "$json_doc_file" >> "${LOGFILE}" 2>&1
+	echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -- $json_doc_file >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
+	"$jparse" "${JPARSE_OPTS[@]}" -v "$dbg_level" -J "$json_dbg_level" -- "$json_doc_file" >> "${LOGFILE}" 2>&1
     else
 	if [[ $V_FLAG -ge 3 ]]; then
-	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -q -- $json_doc_file >> ${LOGFILE} 2>&1" 1>&2
+	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -q -- $json_doc_file >> ${LOGFILE} 2>&1" 1>&2
 	fi
-	echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -q -- $json_doc_file >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
-	"$jparse" -v "$dbg_level" -J "$json_dbg_level" -q -- "$json_doc_file" >> "${LOGFILE}" 2>&1
+	echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -q -- $json_doc_file >> ${LOGFILE} 2>&1" >> "${LOGFILE}"
+	"$jparse" "${JPARSE_OPTS[@]}" -v "$dbg_level" -J "$json_dbg_level" -q -- "$json_doc_file" >> "${LOGFILE}" 2>&1
     fi
     status="$?"
 
@@ -652,6 +717,130 @@ run_file_test()
     return
 }
 
+# run_write_test - check that what jparse -w writes for a good JSON file parses and is written the same way
+#
+# The compact JSON that jparse -w 0 writes for the file must be written again,
+# byte for byte, by jparse -w 0 given that JSON, and by jparse -w 0 given the
+# pretty JSON that jparse -w 4 writes for the file.
+#
+# usage:
+#	run_write_test jparse json_doc_file
+#
+#	jparse			path to the jparse program
+#	json_doc_file		JSON file that must pass
+#
+run_write_test()
+{
+    # parse args
+    #
+    if [[ $# -ne 2 ]]; then
+	echo "$0: ERROR: expected 2 args to run_write_test, found $#" 1>&2
+	exit 10
+    fi
+    declare jparse="$1"
+    declare json_doc_file="$2"
+
+    echo "$0: debug[3]: about to run write test: $jparse ${JPARSE_WRITE_OPTS[*]} -w 0 -- $json_doc_file > $TMP_WRITE_FILE" >> "${LOGFILE}"
+    "$jparse" "${JPARSE_WRITE_OPTS[@]}" -w 0 -- "$json_doc_file" > "$TMP_WRITE_FILE" 2>> "${LOGFILE}"
+    status="$?"
+    if [[ $status -eq 0 ]]; then
+	"$jparse" "${JPARSE_WRITE_OPTS[@]}" -w 0 -- "$TMP_WRITE_FILE" 2>> "${LOGFILE}" |
+	    cmp -s - "$TMP_WRITE_FILE"
+	status="$?"
+    fi
+    if [[ $status -eq 0 ]]; then
+	"$jparse" "${JPARSE_WRITE_OPTS[@]}" -w 4 -- "$json_doc_file" 2>> "${LOGFILE}" |
+	    "$jparse" -B "$BACKEND" -P "$PARSER" -w 0 -- - 2>> "${LOGFILE}" | cmp -s - "$TMP_WRITE_FILE"
+	status="$?"
+    fi
+    if [[ $status -ne 0 ]]; then
+	echo "$0: in write test: jparse -w FAIL for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+	update_file_summary "$json_doc_file"
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 3 ]]; then
+	echo "$0: debug[3]: jparse -w OK for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+    fi
+    echo >> "${LOGFILE}"
+
+    # return
+    #
+    return
+}
+
+# run_events_test - check what jparse -e writes for a JSON file
+#
+# A good file must be written by jparse -e 0 as JSON that jparse -w 0 writes
+# byte for byte as it writes the file, so the parse_json_events() callbacks
+# were called for each part of the JSON in order.  With jparse -e 1 the parse
+# must stop after the first callback: only the first token may be written and
+# the JSON is still valid.  A bad file must be invalid with jparse -e 0.
+#
+# usage:
+#	run_events_test jparse json_doc_file pass|fail
+#
+#	jparse			path to the jparse program
+#	json_doc_file		JSON file to check
+#	pass|fail		string saying if jparse must return valid json or invalid json
+#
+run_events_test()
+{
+    # parse args
+    #
+    if [[ $# -ne 3 ]]; then
+	echo "$0: ERROR: expected 3 args to run_events_test, found $#" 1>&2
+	exit 10
+    fi
+    declare jparse="$1"
+    declare json_doc_file="$2"
+    declare pass_fail="$3"
+    declare events_json=""
+    declare first=""
+
+    echo "$0: debug[3]: about to run events test that must $pass_fail: $jparse -e 0 -- $json_doc_file > $TMP_WRITE_FILE" >> "${LOGFILE}"
+    "$jparse" -e 0 -- "$json_doc_file" > "$TMP_WRITE_FILE" 2>> "${LOGFILE}"
+    status="$?"
+    if [[ $pass_fail = fail ]]; then
+	if [[ $status -eq 0 ]]; then
+	    echo "$0: in events test that must fail: jparse -e OK for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+	    update_file_summary "$json_doc_file"
+	    EXIT_CODE=1
+	elif [[ $V_FLAG -ge 3 ]]; then
+	    echo "$0: debug[3]: jparse -e fails for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+	fi
+	echo >> "${LOGFILE}"
+	return
+    fi
+    if [[ $status -eq 0 ]]; then
+	"$jparse" -B "$BACKEND" -P "$PARSER" -w 0 -- "$TMP_WRITE_FILE" 2>> "${LOGFILE}" |
+	    cmp -s - <("$jparse" -B "$BACKEND" -P "$PARSER" -w 0 -- "$json_doc_file" 2>> "${LOGFILE}")
+	status="$?"
+    fi
+    if [[ $status -eq 0 ]]; then
+	events_json=$(< "$TMP_WRITE_FILE")
+	first=$("$jparse" -e 1 -- "$json_doc_file" 2>> "${LOGFILE}")
+	status="$?"
+	if [[ $status -eq 0 ]]; then
+	    case "$events_json" in
+	    "{"*|"["*) [[ "$first" = "${events_json:0:1}" ]] ;;
+	    *) [[ "$first" = "$events_json" ]] ;;
+	    esac
+	    status="$?"
+	fi
+    fi
+    if [[ $status -ne 0 ]]; then
+	echo "$0: in events test: jparse -e FAIL for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+	update_file_summary "$json_doc_file"
+	EXIT_CODE=1
+    elif [[ $V_FLAG -ge 3 ]]; then
+	echo "$0: debug[3]: jparse -e OK for: $json_doc_file" 1>&2 >> "${LOGFILE}"
+    fi
+    echo >> "${LOGFILE}"
+
+    # return
+    #
+    return
+}
+
 # run_print_test - run print_test tool, making sure it passes
 #
 # usage:
@@ -765,14 +954,14 @@ run_string_test()
 
     if [[ -z $quiet_mode ]]; then
 	if [[ $V_FLAG -ge 3 ]]; then
-	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -s -- $json_doc_string >> ${LOGFILE} 2>&1" 1>&2
+	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -s -- $json_doc_string >> ${LOGFILE} 2>&1" 1>&2
 	fi
-	"$jparse" -v "$dbg_level" -J "$json_dbg_level" -s -- "$json_doc_string" >> "${LOGFILE}" 2>&1
+	"$jparse" "${JPARSE_OPTS[@]}" -v "$dbg_level" -J "$json_dbg_level" -s -- "$json_doc_string" >> "${LOGFILE}" 2>&1
     else
 	if [[ $V_FLAG -ge 3 ]]; then
-	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse -v $dbg_level -J $json_dbg_level -q -s -- $json_doc_string >> ${LOGFILE} 2>&1" 1>&2
+	    echo "$0: debug[3]: about to run test that must $pass_fail: $jparse ${JPARSE_OPTS[*]} -v $dbg_level -J $json_dbg_level -q -s -- $json_doc_string >> ${LOGFILE} 2>&1" 1>&2
 	fi
-	"$jparse" -v "$dbg_level" -J "$json_dbg_level" -q -s -- "$json_doc_string" >> "${LOGFILE}" 2>&1
+	"$jparse" "${JPARSE_OPTS[@]}" -v "$dbg_level" -J "$json_dbg_level" -q -s -- "$json_doc_string" >> "${LOGFILE}" 2>&1
     fi
     status="$?"
 
@@ -923,6 +1112,12 @@ if [[ -n "$D_FLAG" ]]; then
     # run tests that must pass
     while read -r file; do
 	run_file_test "$JPARSE" "$DBG_LEVEL" "$JSON_DBG_LEVEL" "$Q_FLAG" "$file" pass
+	if [[ -n "$WRITE" ]]; then
+	    run_write_test "$JPARSE" "$file"
+	fi
+	if [[ -n "$EVENTS" ]]; then
+	    run_events_test "$JPARSE" "$file" pass
+	fi
     done < <(find "$JSON_GOOD_TREE" -type f -name '*.json' -print)
 
 
@@ -933,6 +1128,9 @@ if [[ -n "$D_FLAG" ]]; then
     fi
     while read -r file; do
 	run_file_test "$JPARSE" "$DBG_LEVEL" "$JSON_DBG_LEVEL" "$Q_FLAG" "$file" fail
+	if [[ -n "$EVENTS" ]]; then
+	    run_events_test "$JPARSE" "$file" fail
+	fi
     done < <(find "$JSON_BAD_TREE" -type f -name '*.json' -print)
 
     # run tests that must fail with correct error locations, if -L not used
@@ -24,7 +24,7 @@ export JSTRDECODE="./jstrdecode"
 export TEST_FILE="./test_jparse/jstr_test.out"
 export TEST_FILE2="./test_jparse/jstr_test2.out"
 export JSTR_TEST_TXT="./test_jparse/jstr_test.txt"
-export JSTR_TEST_VERSION="1.2.1 2024-10-31" # version format: major.minor YYYY-MM-DD
+export JSTR_TEST_VERSION="1.2.2 2026-10-17" # version format: major.minor YYYY-MM-DD
 export TOPDIR=
 
 export USAGE="usage: $0 [-h] [-V] [-v level] [-e jstrdecode] [-d jstrencode] [-Z topdir]
@@ -339,6 +339,28 @@ else
     EXIT_CODE=4
 fi
 
+echo "$0: about to run test #10" 1>&2
+echo "$JSTRENCODE -n 'a\\tb\\uD83D\\uDE00c\\/d'" 1>&2
+RESULT=$("$JSTRENCODE" -n 'a\tb\uD83D\uDE00c\/d')
+if [[ "$RESULT" = "$(printf 'a\tb\360\237\230\200c/d')" ]]; then
+    echo "$0: test #10 passed" 1>&2
+else
+    echo "$0: test #10 failed: result: $RESULT" 1>&2
+    EXIT_CODE=4
+fi
+
+echo "$0: about to run test #11" 1>&2
+for BAD in '\uD83D' '\uDE00x' '\u12' '\u 123' '\uzzzz' 'a\' '\x'; do
+    echo "$JSTRENCODE -q -n '$BAD'" 1>&2
+    if "$JSTRENCODE" -q -n "$BAD" >/dev/null 2>&1; then
+	echo "$0: test #11 failed: accepted: $BAD" 1>&2
+	EXIT_CODE=4
+    fi
+done
+if [[ $EXIT_CODE == 0 ]]; then
+    echo "$0: test #11 passed" 1>&2
+fi
+
 # All Done!!! All Done!!! -- Jessica Noll, Age 2
 #
 if [[ $EXIT_CODE == 0 ]]; then
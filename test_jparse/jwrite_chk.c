@@ -0,0 +1,474 @@
+/*
+ * jwrite_chk - tool to check the json_writer_* JSON writer API
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+/* special comments for the seqcexit tool */
+/* exit code out of numerical order - ignore in sequencing - ooo */
+/* exit code change of order - use new value in sequencing - coo */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <math.h>
+#include <float.h>
+
+/*
+ * jwrite_chk - tool to check the json_writer_* JSON writer API
+ */
+#include "jwrite_chk.h"
+
+
+/*
+ * definitions
+ */
+#define REQUIRED_ARGS (0)	/* number of required arguments on the command line */
+
+/*
+ * usage message
+ *
+ * Use the usage() function to print the usage_msg([0-9]?)+ strings.
+ */
+static const char * const usage_msg =
+    "usage: %s [-h] [-v level] [-J level] [-V] [-q]\n"
+    "\n"
+    "\t-h\t\tPrint help message and exit\n"
+    "\t-v level\tSet verbosity level (def level: %d)\n"
+    "\t-J level\tSet JSON verbosity level (def level: %d)\n"
+    "\t-V\t\tPrint version string and exit\n"
+    "\t-q\t\tQuiet mode (def: not quiet)\n"
+    "\t\t\t    NOTE: -q will also silence msg(), warn(), warnp() if -v 0\n"
+    "\n"
+    "Exit codes:\n"
+    "    0\t\tall is OK\n"
+    "    1\t\tsome json_writer_* check failed\n"
+    "    2\t\t-h and help string printed or -V and version string printed\n"
+    "    3\t\tcommand line error\n"
+    "    >=10\tinternal error\n"
+    "\n"
+    "%s version: %s\n"
+    "jparse UTF-8 version: %s\n"
+    "jparse library version: %s";
+
+/*
+ * the nested document written by write_nested(), compact and pretty
+ */
+static char const * const nested_compact =
+    "{\"a\":[1,-2,{\"b\":true},[],{}],\"s\":\"x\\\"y\\n\",\"n\":null,\"d\":0.5,\"o\":{\"f\":false}}";
+static char const * const nested_pretty =
+    "{\n"
+    "  \"a\": [\n"
+    "    1,\n"
+    "    -2,\n"
+    "    {\n"
+    "      \"b\": true\n"
+    "    },\n"
+    "    [],\n"
+    "    {}\n"
+    "  ],\n"
+    "  \"s\": \"x\\\"y\\n\",\n"
+    "  \"n\": null,\n"
+    "  \"d\": 0.5,\n"
+    "  \"o\": {\n"
+    "    \"f\": false\n"
+    "  }\n"
+    "}";
+
+/*
+ * static variables
+ */
+static bool error = false;	/* true ==> some check failed */
+
+
+/*
+ * forward declarations
+ */
+static void usage(int exitcode, char const *prog, char const *str) __attribute__((noreturn));
+static void begin(struct json_writer *w, struct json_buf *out, unsigned int indent, bool refused);
+static bool write_nested(struct json_writer *w);
+static void chk_text(char const *what, struct json_writer *w, struct json_buf *out, bool ret, bool ok, char const *want);
+static void chk_int64(int64_t value, char const *want);
+static void chk_double(double value, char const *want);
+
+int
+main(int argc, char *argv[])
+{
+    char const *program = NULL;	/* our name */
+    extern char *optarg;	/* option argument */
+    extern int optind;		/* argv index of the next arg */
+    struct json_buf out;	/* where the JSON text goes */
+    struct json_writer w;	/* writer of the JSON text */
+    bool ret = false;		/* json_writer_*() return */
+    int arg_count = 0;		/* number of args to process */
+    int i;
+
+    /*
+     * parse args
+     */
+    program = argv[0];
+    while ((i = getopt(argc, argv, ":hv:J:Vq")) != -1) {
+	switch (i) {
+	case 'h':		/* -h - print help to stderr and exit 0 */
+	    usage(2, program, ""); /*ooo*/
+	    not_reached();
+	    break;
+	case 'v':		/* -v verbosity */
+	    /*
+	     * parse verbosity
+	     */
+	    verbosity_level = parse_verbosity(optarg);
+	    if (verbosity_level < 0) {
+		usage(3, program, "invalid -v verbosity"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'J':		/* -J json_verbosity */
+	    /*
+	     * parse JSON verbosity level
+	     */
+	    json_verbosity_level = parse_verbosity(optarg);
+	    if (json_verbosity_level < 0) {
+		usage(3, program, "invalid -J json_verbosity"); /*ooo*/
+		not_reached();
+	    }
+	    break;
+	case 'V':		/* -V - print version and exit */
+	    print("%s version: %s\n", JWRITE_CHK_BASENAME, JWRITE_CHK_VERSION);
+	    print("jparse UTF-8 version: %s\n", JPARSE_UTF8_VERSION);
+	    print("jparse library version: %s\n", JPARSE_LIBRARY_VERSION);
+	    exit(2); /*ooo*/
+	    not_reached();
+	    break;
+	case 'q':
+	    msg_warn_silent = true;
+	    break;
+	case ':':   /* option requires an argument */
+	case '?':   /* illegal option */
+	default:    /* anything else but should not actually happen */
+	    check_invalid_option(program, i, optopt);
+	    usage(3, program, ""); /*ooo*/
+	    not_reached();
+	    break;
+	}
+    }
+    arg_count = argc - optind;
+    if (arg_count != REQUIRED_ARGS) {
+	usage(3, program, "wrong number of arguments"); /*ooo*/
+	not_reached();
+    }
+
+    /*
+     * nested objects and arrays, compact and pretty
+     */
+    begin(&w, &out, 0, false);
+    chk_text("compact nested JSON", &w, &out, write_nested(&w), true, nested_compact);
+    begin(&w, &out, 2, false);
+    chk_text("pretty nested JSON", &w, &out, write_nested(&w), true, nested_pretty);
+
+    /*
+     * objects and arrays nested deeper than the writer tracks before it
+     * allocates
+     */
+    begin(&w, &out, 0, false);
+    ret = true;
+    for (i = 0; i < JSON_WRITER_STACK * 2; ++i) {
+	ret = (i % 2 == 0) ? json_writer_begin_array(&w) && ret :
+			     json_writer_begin_object(&w) && json_writer_key(&w, "k") && ret;
+    }
+    ret = json_writer_null(&w) && ret;
+    for (i = JSON_WRITER_STACK * 2 - 1; i >= 0; --i) {
+	ret = ((i % 2 == 0) ? json_writer_end_array(&w) : json_writer_end_object(&w)) && ret;
+    }
+    if (!ret || !w.done) {
+	warn(__func__, "deep nested JSON was not written");
+	error = true;
+    }
+    /* each array is [] and each object is {"k":}, with null in the last one */
+    if (!json_writer_fini(&w) || out.len != JSON_WRITER_STACK * (2 + 6) + 4) {
+	warn(__func__, "deep nested JSON is not %d bytes", JSON_WRITER_STACK * (2 + 6) + 4);
+	error = true;
+    }
+    (void) json_buf_fini(&out);
+
+    /*
+     * calls that would not be JSON are refused, and so is each call after
+     * one: the warnings of the refusals are only written with -v 3 or more
+     */
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_array(&w) && json_writer_key(&w, "k");
+    chk_text("name in an array", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_int64(&w, 1) && json_writer_int64(&w, 2);
+    chk_text("second top level value", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_object(&w) && json_writer_key(&w, "k") && json_writer_end_object(&w);
+    chk_text("name without a value", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_object(&w) && json_writer_key(&w, "k") && json_writer_key(&w, "l");
+    chk_text("name after a name", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_object(&w) && json_writer_null(&w);
+    chk_text("value in an object without a name", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_object(&w) && json_writer_end_array(&w);
+    chk_text("] that closes an object", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_end_object(&w);
+    chk_text("} with nothing open", &w, &out, ret, false, NULL);
+    begin(&w, &out, 0, false);
+    ret = json_writer_begin_array(&w);
+    chk_text("array that is not ended", &w, &out, ret, true, NULL);
+    begin(&w, &out, 0, false);
+    chk_text("nothing", &w, &out, true, true, NULL);
+    begin(&w, &out, 0, true);
+    ret = json_writer_begin_array(&w) && !json_writer_key(&w, "k") && json_writer_end_array(&w);
+    chk_text("call after a refused call", &w, &out, ret, false, NULL);
+
+    /*
+     * integers at the limits of an int64_t
+     */
+    chk_int64(0, "0");
+    chk_int64(-1, "-1");
+    chk_int64(INT64_MAX, "9223372036854775807");
+    chk_int64(INT64_MIN, "-9223372036854775808");
+
+    /*
+     * doubles are written with the fewest digits that read back the same
+     */
+    chk_double(0.0, "0");
+    chk_double(-0.0, "-0");
+    chk_double(100.0, "100");
+    chk_double(0.1, "0.1");
+    chk_double(-1.5, "-1.5");
+    chk_double(1e21, "1e+21");
+    chk_double(0.1 + 0.2, "0.30000000000000004");
+    chk_double(1.0 / 3.0, "0.3333333333333333");
+    chk_double(DBL_MAX, "1.7976931348623157e+308");
+    chk_double(DBL_MIN, "2.2250738585072014e-308");
+    chk_double(5e-324, "5e-324");
+    chk_double(-1e-320, "-1e-320");
+    chk_double(INFINITY, NULL);
+    chk_double(-INFINITY, NULL);
+    chk_double(NAN, NULL);
+
+    /*
+     * All Done!!! All Done!!! -- Jessica Noll, Age 2
+     */
+    if (error == true) {
+	exit(1); /*ooo*/
+    }
+    exit(0); /*ooo*/
+}
+
+
+/*
+ * begin - start a check with an empty struct json_buf and a writer to it
+ *
+ * given:
+ *	w	    writer to initialise
+ *	out	    struct json_buf to initialise with json_buf_init()
+ *	indent	    0 ==> compact JSON, else spaces per level
+ *	refused	    true ==> a call is to be refused: its warning is only
+ *		    written with -v 3 or more
+ */
+static void
+begin(struct json_writer *w, struct json_buf *out, unsigned int indent, bool refused)
+{
+    json_buf_init(out);
+    json_writer_init(w, out, indent);
+    warn_output_allowed = !refused || verbosity_level >= DBG_MED;
+}
+
+
+/*
+ * write_nested - write the nested document of nested_compact and nested_pretty
+ *
+ * given:
+ *	w	writer to write it with
+ *
+ * returns:
+ *	true ==> every json_writer_*() call returned true, false ==> one did not
+ */
+static bool
+write_nested(struct json_writer *w)
+{
+    return json_writer_begin_object(w) &&
+	       json_writer_key(w, "a") &&
+	       json_writer_begin_array(w) &&
+		   json_writer_int64(w, 1) &&
+		   json_writer_int64(w, -2) &&
+		   json_writer_begin_object(w) &&
+		       json_writer_key(w, "b") &&
+		       json_writer_bool(w, true) &&
+		   json_writer_end_object(w) &&
+		   json_writer_begin_array(w) &&
+		   json_writer_end_array(w) &&
+		   json_writer_begin_object(w) &&
+		   json_writer_end_object(w) &&
+	       json_writer_end_array(w) &&
+	       json_writer_key(w, "s") &&
+	       json_writer_string(w, "x\"y\n") &&
+	       json_writer_key(w, "n") &&
+	       json_writer_string(w, NULL) &&
+	       json_writer_key(w, "d") &&
+	       json_writer_double(w, 0.5) &&
+	       json_writer_key(w, "o") &&
+	       json_writer_begin_object(w) &&
+		   json_writer_key(w, "f") &&
+		   json_writer_bool(w, false) &&
+	       json_writer_end_object(w) &&
+	   json_writer_end_object(w);
+}
+
+
+/*
+ * chk_text - check what a writer wrote, then free the writer and its text
+ *
+ * given:
+ *	what	what is checked, for the warning
+ *	w	writer
+ *	out	struct json_buf from json_buf_init() that w wrote to
+ *	ret	true ==> the json_writer_*() calls all returned true
+ *	ok	true ==> they must all have returned true,
+ *		false ==> one must have been refused
+ *	want	text that must have been written, or
+ *		NULL ==> no whole JSON value may have been written
+ *
+ * json_writer_fini() must return true only when want is not NULL.
+ */
+static void
+chk_text(char const *what, struct json_writer *w, struct json_buf *out, bool ret, bool ok, char const *want)
+{
+    bool done = false;	/* json_writer_fini() return */
+    char *got = NULL;	/* text written */
+    size_t len = 0;	/* length of got */
+
+    done = json_writer_fini(w);
+    got = json_buf_take(out, &len);
+    (void) json_buf_fini(out);
+    warn_output_allowed = true;
+    if (ret != ok) {
+	warn(__func__, "%s: a json_writer_*() call returned %s", what, ret ? "true" : "false");
+	error = true;
+    } else if (done != (want != NULL)) {
+	warn(__func__, "%s: json_writer_fini() returned %s", what, done ? "true" : "false");
+	error = true;
+    } else if (want != NULL && (got == NULL || len != strlen(want) || memcmp(got, want, len) != 0)) {
+	warn(__func__, "%s: wrote <%s> instead of <%s>", what, got == NULL ? "((NULL))" : got, want);
+	error = true;
+    } else {
+	dbg(DBG_HIGH, "OK: %s", what);
+    }
+    if (got != NULL) {
+	free(got);
+	got = NULL;
+    }
+}
+
+
+/*
+ * chk_int64 - check json_writer_int64()
+ *
+ * given:
+ *	value	integer to write
+ *	want	text that must be written
+ */
+static void
+chk_int64(int64_t value, char const *want)
+{
+    struct json_buf out;	/* where the JSON text goes */
+    struct json_writer w;	/* writer of the JSON text */
+    char what[sizeof("json_writer_int64() of -9223372036854775808")];	/* what is checked */
+
+    begin(&w, &out, 0, false);
+    (void) snprintf(what, sizeof(what), "json_writer_int64() of %" PRId64, value);
+    chk_text(what, &w, &out, json_writer_int64(&w, value), true, want);
+}
+
+
+/*
+ * chk_double - check json_writer_double()
+ *
+ * given:
+ *	value	double to write
+ *	want	text that must be written, NULL ==> the write must be refused
+ *
+ * The text must also read back as value.
+ */
+static void
+chk_double(double value, char const *want)
+{
+    struct json_buf out;	/* where the JSON text goes */
+    struct json_writer w;	/* writer of the JSON text */
+    char what[64];		/* what is checked */
+
+    begin(&w, &out, 0, want == NULL);
+    (void) snprintf(what, sizeof(what), "json_writer_double() of %.17g", value);
+    chk_text(what, &w, &out, json_writer_double(&w, value), want != NULL, want);
+    if (want != NULL && json_strtod(want, NULL) != value) {
+	warn(__func__, "%s: <%s> does not read back as the same double", what, want);
+	error = true;
+    }
+}
+
+
+/*
+ * usage - print usage to stderr
+ *
+ * Example:
+ *      usage(3, program, "wrong number of arguments");
+ *
+ * given:
+ *	exitcode        value to exit with
+ *	prog		our program name
+ *	str		top level usage message
+ *
+ * NOTE: We warn with extra newlines to help internal fault messages stand out.
+ *       Normally one should NOT include newlines in warn messages.
+ *
+ * This function does not return.
+ */
+static void
+usage(int exitcode, char const *prog, char const *str)
+{
+    /*
+     * firewall
+     */
+    if (str == NULL) {
+	str = "((NULL str))";
+	warn(__func__, "\nin usage(): str was NULL, forcing it to be: %s\n", str);
+    }
+    if (prog == NULL) {
+	prog = JWRITE_CHK_BASENAME;
+	warn(__func__, "\nin usage(): prog was NULL, forcing it to be: %s\n", prog);
+    }
+
+    /*
+     * print the formatted usage stream
+     */
+    if (*str != '\0') {
+	fprintf_usage(DO_NOT_EXIT, stderr, "%s\n", str);
+    }
+    fprintf_usage(exitcode, stderr, usage_msg, prog, DBG_DEFAULT, json_verbosity_level,
+		  JWRITE_CHK_BASENAME, JWRITE_CHK_VERSION, JPARSE_UTF8_VERSION, JPARSE_LIBRARY_VERSION);
+    exit(exitcode); /*ooo*/
+    not_reached();
+}
@@ -0,0 +1,65 @@
+/*
+ * jwrite_chk - tool to check the json_writer_* JSON writer API
+ *
+ * "Because specs w/o version numbers are forced to commit to their original design flaws." :-)
+ *
+ * This JSON parser was co-developed in 2022 by:
+ *
+ *	@xexyl
+ *	https://xexyl.net		Cody Boone Ferguson
+ *	https://ioccc.xexyl.net
+ * and:
+ *	chongo (Landon Curt Noll, http://www.isthe.com/chongo/index.html) /\oo/\
+ *
+ * "Because sometimes even the IOCCC Judges need some help." :-)
+ *
+ * "Share and Enjoy!"
+ *     --  Sirius Cybernetics Corporation Complaints Division, JSON spec department. :-)
+ */
+
+
+#if !defined(INCLUDE_JWRITE_CHK_H)
+#    define  INCLUDE_JWRITE_CHK_H
+
+
+/*
+ * dbg - info, debug, warning, error, and usage message facility
+ */
+#if defined(INTERNAL_INCLUDE)
+#include "../../dbg/dbg.h"
+#else
+#include <dbg.h>
+#endif
+
+/*
+ * util - common utility functions for the JSON parser
+ */
+#include "../util.h"
+
+/*
+ * jparse - JSON parser
+ */
+#include "../jparse.h"
+
+/*
+ * version - JSON parser API and tool version
+ */
+#include "../version.h"
+
+/*
+ * json_utf8.h - JSON UTF-8 encoder
+ */
+#include "../json_utf8.h"
+
+/*
+ * official jwrite_chk version
+ */
+#define JWRITE_CHK_VERSION "1.0.0 2026-10-17"	/* format: major.minor YYYY-MM-DD */
+
+/*
+ * jwrite_chk tool basename
+ */
+#define JWRITE_CHK_BASENAME "jwrite_chk"
+
+
+#endif /* INCLUDE_JWRITE_CHK_H */
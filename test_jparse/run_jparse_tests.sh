@@ -20,8 +20,8 @@
 
 # setup
 #
-export RUN_JPARSE_TESTS_VERSION="1.0.1 2024-10-22"
-export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j jparse] [-p pr_jparse_test] [-c jnum_chk] [-Z topdir]
+export RUN_JPARSE_TESTS_VERSION="1.0.15 2026-10-17"
+export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j jparse] [-p pr_jparse_test] [-c jnum_chk] [-d jdoc_chk] [-w jwrite_chk] [-Z topdir]
 
     -h			print help and exit
     -V			print version and exit
@@ -31,6 +31,8 @@ export USAGE="usage: $0 [-h] [-V] [-v level] [-D dbg_level] [-J json_level] [-j
     -j jparse		path to jparse
     -p pr_jparse_test	path to pr_jparse_test
     -c jnum_chk		path to jnum_chk
+    -d jdoc_chk		path to jdoc_chk
+    -w jwrite_chk	path to jwrite_chk
     -Z topdir		top level build directory (def: try . or ..)
 
 Exit codes:
@@ -53,11 +55,13 @@ export TOPDIR=
 export JPARSE="./jparse"
 export PR_JPARSE_TEST="./test_jparse/pr_jparse_test"
 export JNUM_CHK="./test_jparse/jnum_chk"
+export JDOC_CHK="./test_jparse/jdoc_chk"
+export JWRITE_CHK="./test_jparse/jwrite_chk"
 export UTIL_TEST="./util_test"
 
 # parse args
 #
-while getopts :hVv:D:J:j:p:c:Z: flag; do
+while getopts :hVv:D:J:j:p:c:d:w:Z: flag; do
     case "$flag" in
     h)	echo "$USAGE" 1>&2
 	exit 2
@@ -72,6 +76,10 @@ while getopts :hVv:D:J:j:p:c:Z: flag; do
 	;;
     c)	JNUM_CHK="$OPTARG";
 	;;
+    d)	JDOC_CHK="$OPTARG";
+	;;
+    w)	JWRITE_CHK="$OPTARG";
+	;;
     J)	J_FLAG="$OPTARG";
 	;;
     V)	echo "$RUN_JPARSE_TESTS_VERSION"
@@ -231,6 +239,38 @@ elif [[ ! -x "$JNUM_CHK" ]]; then
     EXIT_CODE="5"
 fi
 
+# jdoc_chk
+#
+if [[ -z "$JDOC_CHK" ]]; then
+    echo "$0: ERROR: \$JDOC_CHK empty, try a non-empty string for -d option" | tee -a -- "${LOGFILE}"
+    EXIT_CODE="5"
+elif [[ ! -e "$JDOC_CHK" ]]; then
+    echo "$0: ERROR: $JDOC_CHK file not found" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -f "$JDOC_CHK" ]]; then
+    echo "$0: ERROR: $JDOC_CHK is not a regular file" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -x "$JDOC_CHK" ]]; then
+    echo "$0: ERROR: $JDOC_CHK is not executable" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+fi
+
+# jwrite_chk
+#
+if [[ -z "$JWRITE_CHK" ]]; then
+    echo "$0: ERROR: \$JWRITE_CHK empty, try a non-empty string for -w option" | tee -a -- "${LOGFILE}"
+    EXIT_CODE="5"
+elif [[ ! -e "$JWRITE_CHK" ]]; then
+    echo "$0: ERROR: $JWRITE_CHK file not found" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -f "$JWRITE_CHK" ]]; then
+    echo "$0: ERROR: $JWRITE_CHK is not a regular file" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+elif [[ ! -x "$JWRITE_CHK" ]]; then
+    echo "$0: ERROR: $JWRITE_CHK is not executable" | tee -a -- "$LOGFILE"
+    EXIT_CODE="5"
+fi
+
 # test_jparse/jparse_test.sh
 if [[ ! -e test_jparse/jparse_test.sh ]]; then
     echo "$0: ERROR: test_jparse/jparse_test.sh file not found" | tee -a -- "$LOGFILE"
@@ -329,6 +369,150 @@ else
     echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
 fi
 
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -B index -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -B index -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -B index non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -B index non-zero exit code: $status"
+    EXIT_CODE="29"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -B index -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -B index -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -P fast -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -P fast non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -P fast non-zero exit code: $status"
+    EXIT_CODE="30"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -c 7 -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -c 7 -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -c 7 non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -c 7 non-zero exit code: $status"
+    EXIT_CODE="31"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -c 7 -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -c 7 -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -a -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -a -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -a non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -a non-zero exit code: $status"
+    EXIT_CODE="37"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -a -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -a -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -i -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -i -P fast -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -i non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -i non-zero exit code: $status"
+    EXIT_CODE="38"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -i -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -i -P fast -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -w -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -w -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -w non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -w non-zero exit code: $status"
+    EXIT_CODE="39"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -w -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -w -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -e -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -e -p "$PR_JPARSE_TEST" -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -e non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -e non-zero exit code: $status"
+    EXIT_CODE="40"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -e -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -e -p $PR_JPARSE_TEST -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: ./test_jparse/jparse_test.sh -D ${D_FLAG} -v ${V_FLAG} -j $JPARSE -n -L -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+./test_jparse/jparse_test.sh -D "${V_FLAG}" -v "${V_FLAG}" -j "$JPARSE" -n -L -d test_jparse/test_JSON \
+    -s . test_jparse/json_teststr.txt | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: test_jparse/jparse_test.sh -n non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    test_jparse/jparse_test.sh -n non-zero exit code: $status"
+    EXIT_CODE="35"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -n -L -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" \
+	| tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: ./jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -n -L -d test_jparse/test_JSON -s . test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
 echo | tee -a -- "${LOGFILE}"
 echo "RUNNING: ./test_jparse/jparse_test.sh -D $V_FLAG -v ${V_FLAG} -j $JPARSE -F jparse.json" | tee -a -- "${LOGFILE}"
 ./test_jparse/jparse_test.sh -D "$V_FLAG" -v "${V_FLAG}" -j "$JPARSE" -F jparse.json | tee -a -- "${LOGFILE}"
@@ -361,6 +545,157 @@ else
 fi
 
 
+# jparse -l and -r: parse the JSON strings test files as sequences of records
+#
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: $JPARSE -l test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+"$JPARSE" -l test_jparse/json_teststr.txt 2>&1 | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JPARSE -l test_jparse/json_teststr.txt non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE -l test_jparse/json_teststr.txt non-zero exit code: $status"
+    EXIT_CODE="32"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE -l test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: $JPARSE -l test_jparse/json_teststr.txt" | tee -a -- "${LOGFILE}"
+fi
+
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: tr '\\n' '\\036' < test_jparse/json_teststr.txt | $JPARSE -r -" | tee -a -- "${LOGFILE}"
+tr '\n' '\036' < test_jparse/json_teststr.txt | "$JPARSE" -r - 2>&1 | tee -a -- "${LOGFILE}"
+status="${PIPESTATUS[1]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JPARSE -r - non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE -r - non-zero exit code: $status"
+    EXIT_CODE="33"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: tr '\\n' '\\036' < test_jparse/json_teststr.txt | $JPARSE -r -" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: tr '\\n' '\\036' < test_jparse/json_teststr.txt | $JPARSE -r -" | tee -a -- "${LOGFILE}"
+fi
+
+# every line of json_teststr_fail.txt must be reported as an invalid record
+#
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: $JPARSE -l test_jparse/json_teststr_fail.txt" | tee -a -- "${LOGFILE}"
+LINES=$(grep -c '[^[:space:]]' test_jparse/json_teststr_fail.txt)
+INVALID=$("$JPARSE" -l test_jparse/json_teststr_fail.txt 2>&1 | tee -a -- "${LOGFILE}" | grep -c ': invalid JSON$')
+# the last line is the error for the whole file
+INVALID=$((INVALID - 1))
+if [[ $INVALID -ne $LINES ]]; then
+    echo "$0: ERROR: $JPARSE -l test_jparse/json_teststr_fail.txt found $INVALID invalid records, expected $LINES" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE -l test_jparse/json_teststr_fail.txt found $INVALID invalid records, expected $LINES"
+    EXIT_CODE="34"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE -l test_jparse/json_teststr_fail.txt" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: $JPARSE -l test_jparse/json_teststr_fail.txt" | tee -a -- "${LOGFILE}"
+fi
+
+# jparse -l must free each record before the next: 200000 records, about 70
+# bytes each, must be parsed in 64 MB of address space
+#
+RECORDS=200000
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: $JPARSE -l - with $RECORDS records in 64 MB" | tee -a -- "${LOGFILE}"
+RECORDS_FAILED=
+for PARSER in "-P bison" "-P fast" "-a"; do
+    # shellcheck disable=SC2086
+    awk -v n="$RECORDS" 'BEGIN {
+	for (i = 0; i < n; ++i) {
+	    printf "{\"id\":%d,\"tags\":[\"a\",\"b\",\"c\"],\"v\":[1.5,2,3],\"o\":{\"x\":true,\"y\":null}}\n", i
+	}
+    }' | (ulimit -v 65536 && "$JPARSE" -q $PARSER -l - > /dev/null 2>> "${LOGFILE}")
+    status="${PIPESTATUS[1]}"
+    if [[ $status -ne 0 ]]; then
+	echo "$0: ERROR: $JPARSE $PARSER -l - with $RECORDS records in 64 MB exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+	RECORDS_FAILED="$RECORDS_FAILED $PARSER"
+    fi
+done
+if [[ -n $RECORDS_FAILED ]]; then
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE -l - with $RECORDS records in 64 MB failed for:$RECORDS_FAILED"
+    EXIT_CODE="43"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE -l - with $RECORDS records in 64 MB" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: $JPARSE -l - with $RECORDS records in 64 MB" | tee -a -- "${LOGFILE}"
+fi
+
+
+# jparse -L: each limit must pass JSON that is at the limit and fail JSON that
+# exceeds it, with each parser
+#
+LIMIT_JSON='{"abc":[1,2,1234]}'
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: $JPARSE -L name=max -s '$LIMIT_JSON'" | tee -a -- "${LOGFILE}"
+LIMIT_FAILED=
+for PARSER in "-P bison -B flex" "-P bison -B index" "-P fast" "-c 5"; do
+    for LIMIT in bytes=18:0 nodes=6:0 string=3:0 number=4:0 bytes=17:1 nodes=5:1 string=2:1 number=3:1; do
+	# shellcheck disable=SC2086
+	"$JPARSE" -q $PARSER -L "${LIMIT%:*}" -s "$LIMIT_JSON" >> "${LOGFILE}" 2>&1
+	status="$?"
+	if [[ $status -ne "${LIMIT#*:}" ]]; then
+	    echo "$0: ERROR: $JPARSE $PARSER -L ${LIMIT%:*} exit code: $status, expected ${LIMIT#*:}" 1>&2 | tee -a -- "$LOGFILE"
+	    LIMIT_FAILED="$LIMIT_FAILED $PARSER -L ${LIMIT%:*}"
+	fi
+    done
+done
+if [[ -n $LIMIT_FAILED ]]; then
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE -L failed for:$LIMIT_FAILED"
+    EXIT_CODE="36"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE -L name=max -s '$LIMIT_JSON'" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: $JPARSE -L name=max -s '$LIMIT_JSON'" | tee -a -- "${LOGFILE}"
+fi
+
+
+# arrays and objects nested 100000 deep must be parsed, written and freed by
+# the parsers that have no depth limit of their own
+#
+DEEP=100000
+echo | tee -a -- "${LOGFILE}"
+echo "RUNNING: $JPARSE -P fast - with arrays and objects nested $DEEP deep" | tee -a -- "${LOGFILE}"
+DEEP_FAILED=
+for PARSER in "-P fast" "-P fast -w 0" "-P fast -a" "-c 4096" "-n"; do
+    for OPEN in '[' '{"a":'; do
+	if [[ $OPEN == '[' ]]; then
+	    VALUE= CLOSE=']'
+	else
+	    VALUE=1 CLOSE='}'
+	fi
+	# shellcheck disable=SC2086
+	{ printf '%*s' "$DEEP" '' | sed "s/ /$OPEN/g"; printf '%s' "$VALUE"; printf '%*s' "$DEEP" '' | tr ' ' "$CLOSE"; } |
+	    "$JPARSE" -q $PARSER - > /dev/null 2>> "${LOGFILE}"
+	status="${PIPESTATUS[1]}"
+	if [[ $status -ne 0 ]]; then
+	    echo "$0: ERROR: $JPARSE $PARSER - with $OPEN nested $DEEP deep exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+	    DEEP_FAILED="$DEEP_FAILED $PARSER $OPEN"
+	fi
+    done
+done
+if [[ -n $DEEP_FAILED ]]; then
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JPARSE nested $DEEP deep failed for:$DEEP_FAILED"
+    EXIT_CODE="42"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JPARSE -P fast - with arrays and objects nested $DEEP deep" | tee -a -- "${LOGFILE}"
+else
+    echo "PASSED: $JPARSE -P fast - with arrays and objects nested $DEEP deep" | tee -a -- "${LOGFILE}"
+fi
+
 # jstr_test.sh
 #
 echo | tee -a -- "$LOGFILE"
@@ -419,6 +754,42 @@ else
     echo "PASSED: $JNUM_CHK -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
 fi
 
+# jdoc_chk
+#
+echo | tee -a -- "$LOGFILE"
+echo "RUNNING: $JDOC_CHK" -J "$J_FLAG" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+"$JDOC_CHK" -J "${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JDOC_CHK non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JDOC_CHK non-zero exit code: $status"
+    EXIT_CODE="41"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JDOC_CHK -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+else
+    echo "PASSED: $JDOC_CHK -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+fi
+
+# jwrite_chk
+#
+echo | tee -a -- "$LOGFILE"
+echo "RUNNING: $JWRITE_CHK" -J "$J_FLAG" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+"$JWRITE_CHK" -J "${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+status="${PIPESTATUS[0]}"
+if [[ $status -ne 0 ]]; then
+    echo "$0: ERROR: $JWRITE_CHK non-zero exit code: $status" 1>&2 | tee -a -- "$LOGFILE"
+    FAILURE_SUMMARY="$FAILURE_SUMMARY
+    $JWRITE_CHK non-zero exit code: $status"
+    EXIT_CODE="44"
+    echo | tee -a -- "$LOGFILE"
+    echo "EXIT_CODE set to: $EXIT_CODE" | tee -a -- "$LOGFILE"
+    echo "FAILED: $JWRITE_CHK -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+else
+    echo "PASSED: $JWRITE_CHK -J ${J_FLAG}" -v "$V_FLAG" | tee -a -- "$LOGFILE"
+fi
+
 # report overall status
 #
 if [[ $EXIT_CODE -ne 0 ]]; then
@@ -33,6 +33,7 @@
 #include <stdarg.h>
 #include <poll.h>
 #include <fcntl.h>		/* for open() */
+#include <sys/mman.h>		/* for mmap() */
 
 /*
  * dbg - info, debug, warning, error, and usage message facility
@@ -2320,6 +2321,130 @@ read_all(FILE *stream, size_t *psize)
 }
 
 
+/*
+ * map_all - map all data of an open regular file into memory
+ *
+ * given:
+ *	stream	    - an open file stream to map
+ *	psize	    - if psize != NULL, *psize is the amount of data mapped
+ *	ppad	    - if ppad != NULL, *ppad is the number of writable NUL bytes
+ *		      that follow the data
+ *
+ * returns:
+ *	private writable mapping of the entire contents of stream,
+ *	or NULL if stream is not a non-empty regular file at its start or
+ *	it could not be mapped.
+ *
+ * Unlike read_all(), the data is not copied: pages are read in as they are
+ * used and changes made to the mapping are not written back to the file.  The
+ * stream is left at EOF, as if read_all() had read it.
+ *
+ * The bytes from the end of the file to the end of its last page read as NUL,
+ * so if the file size is not a multiple of the page size there may be room
+ * after the data for a NUL terminator or other padding: *ppad says how many
+ * such bytes there are (0 if the file ends on a page boundary).
+ *
+ * NOTE: a NULL return is not an error: the caller should use read_all().
+ *
+ * NOTE: if the file is truncated while mapped, reading past the new end of
+ *	 file raises SIGBUS.
+ *
+ * NOTE: It is the caller's responsibility to unmap_all() the returned data,
+ *	 with the size from *psize, when it is no longer needed.
+ */
+void *
+map_all(FILE *stream, size_t *psize, size_t *ppad)
+{
+    struct stat buf;			/* status of the open file */
+    long page_size = 0;			/* size of a page of memory */
+    void *ret = NULL;			/* mapping to return */
+    int fd = -1;			/* file descriptor of stream */
+
+    /*
+     * firewall
+     */
+    if (stream == NULL) {
+	err(175, __func__, "called with NULL stream");
+	not_reached();
+    }
+    if (psize != NULL) {
+	*psize = 0;
+    }
+    if (ppad != NULL) {
+	*ppad = 0;
+    }
+
+    /*
+     * only a regular file that has not been read from can be mapped
+     */
+    fd = fileno(stream);
+    if (fd < 0 || fstat(fd, &buf) != 0 || !S_ISREG(buf.st_mode) || buf.st_size <= 0 ||
+	(uintmax_t)buf.st_size > SIZE_MAX || ftello(stream) != 0) {
+	dbg(DBG_VHIGH, "%s: stream is not a non-empty regular file at its start", __func__);
+	return NULL;
+    }
+
+    /*
+     * map the file
+     */
+    errno = 0;			/* pre-clear errno for dbg() */
+    ret = mmap(NULL, (size_t)buf.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (ret == MAP_FAILED) {
+	dbg(DBG_VHIGH, "%s: mmap of %jd bytes failed: %s", __func__, (intmax_t)buf.st_size, strerror(errno));
+	return NULL;
+    }
+    (void) posix_madvise(ret, (size_t)buf.st_size, POSIX_MADV_SEQUENTIAL);
+
+    /*
+     * leave the stream at EOF as read_all() would
+     */
+    if (fseeko(stream, 0, SEEK_END) != 0) {
+	dbg(DBG_VHIGH, "%s: fseeko to EOF failed", __func__);
+    }
+
+    /*
+     * report the amount of data mapped and the padding after it, if requested
+     */
+    if (psize != NULL) {
+	*psize = (size_t)buf.st_size;
+    }
+    if (ppad != NULL) {
+	page_size = sysconf(_SC_PAGESIZE);
+	if (page_size > 0 && buf.st_size % page_size != 0) {
+	    *ppad = (size_t)(page_size - buf.st_size % page_size);
+	}
+    }
+    dbg(DBG_VVHIGH, "%s: mapped %jd bytes", __func__, (intmax_t)buf.st_size);
+
+    /*
+     * return the mapping
+     */
+    return ret;
+}
+
+
+/*
+ * unmap_all - unmap data mapped by map_all()
+ *
+ * given:
+ *	data	    - data returned by map_all()
+ *	size	    - size of data set by map_all()
+ *
+ * NOTE: a NULL data is ignored.
+ */
+void
+unmap_all(void *data, size_t size)
+{
+    if (data == NULL) {
+	return;
+    }
+    errno = 0;			/* pre-clear errno for warnp() */
+    if (munmap(data, size) != 0) {
+	warnp(__func__, "munmap of %ju bytes failed", (uintmax_t)size);
+    }
+}
+
+
 /*
  * is_string - determine if a block of memory is a C string
  *
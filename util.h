@@ -189,6 +189,8 @@ extern ssize_t readline(char **linep, FILE * stream);
 extern char *readline_dup(char **linep, bool strip, size_t *lenp, FILE * stream);
 extern void chkbyte2asciistr(void);
 extern void *read_all(FILE *stream, size_t *psize);
+extern void *map_all(FILE *stream, size_t *psize, size_t *ppad);
+extern void unmap_all(void *data, size_t size);
 extern bool is_string(char const * const ptr, size_t len);
 extern char const *strnull(char const * const str);
 extern bool string_to_intmax(char const *str, intmax_t *ret);